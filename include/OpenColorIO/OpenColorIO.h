@@ -135,6 +135,30 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * Check the files whose information is cached (e.g. LUT files) and only flush what depends on the
+ * files which changed on disk since they were read (i.e. different modification time or size).
+ * That includes the loaded file contents, the processors cached by the Config instances and
+ * the Config cache IDs, the processors and cache IDs depending on unchanged files stay in the
+ * caches. The invalidated entries are rebuilt on their next access.
+ *
+ * \return The number of changed files.
+ */
+extern OCIOEXPORT int ClearChangedFileCaches();
+
+/**
+ * \brief Get whether each access to the cached information of a file first checks if the file
+ * changed on disk (i.e. same as calling \ref ClearChangedFileCaches for each access, but only
+ * for the needed files).
+ *
+ * That adds a file system access for each cache access so it is disabled by default. It can be
+ * enabled using the \ref OCIO_VALIDATE_FILE_CACHES environment variable.
+ */
+extern OCIOEXPORT bool IsFileCacheValidationEnabled();
+
+/// Enable or disable the file change checks for each cache access.
+extern OCIOEXPORT void SetFileCacheValidation(bool enable);
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -186,6 +210,16 @@ extern OCIOEXPORT void LogMessage(LoggingLevel level, const char * message);
 extern OCIOEXPORT void SetComputeHashFunction(ComputeHashFunction hashFunction);
 extern OCIOEXPORT void ResetComputeHashFunction();
 
+/**
+ * \brief Set the executor running the asynchronous requests (e.g. Config::GetProcessorAsync);
+ * otherwise, use the default (i.e. a pool of threads sized to the number of cores).
+ *
+ * The executor may run the tasks on any thread, for example using the thread pool of the
+ * application.
+ */
+extern OCIOEXPORT void SetAsyncExecutor(AsyncExecutor executor);
+extern OCIOEXPORT void ResetToDefaultAsyncExecutor();
+
 //
 // Note that the following environment variable access methods are not thread safe.
 //
@@ -1454,6 +1488,34 @@ public:
                                      const ConstTransformRcPtr & transform,
                                      TransformDirection direction) const;
 
+    /**
+     * \brief Get the processor for the specified transform without blocking.
+     *
+     * The processor is built by the executor (see \ref SetAsyncExecutor) and stored in the
+     * processor cache of the config.  The request is immediately ready if the processor is
+     * already in the cache.  Concurrent requests (synchronous or not) for the same cache entry
+     * share the same build.
+     *
+     * The optional callback is called once the processor is built or failed, from the executor
+     * thread (or from the calling thread if the processor is already in the cache).  It is not
+     * called if the request is canceled.
+     */
+    static ProcessorRequestRcPtr GetProcessorAsync(const ConstConfigRcPtr & config,
+                                                   const ConstContextRcPtr & context,
+                                                   const ConstTransformRcPtr & transform,
+                                                   TransformDirection direction,
+                                                   const ProcessorCallback & callback
+                                                       = ProcessorCallback());
+    /// Get the processor for a display and view without blocking.
+    static ProcessorRequestRcPtr GetProcessorAsync(const ConstConfigRcPtr & config,
+                                                   const ConstContextRcPtr & context,
+                                                   const char * srcColorSpaceName,
+                                                   const char * display,
+                                                   const char * view,
+                                                   TransformDirection direction,
+                                                   const ProcessorCallback & callback
+                                                       = ProcessorCallback());
+
     /**
      * \brief Get a Processor to or from a known external color space.
      * 
@@ -2779,6 +2841,20 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    /**
+     * \brief Get the optimized CPU processor without blocking.
+     *
+     * The CPU processor is built by the executor (see \ref SetAsyncExecutor) and stored in the
+     * CPU processor cache of the processor.  The callback follows the same rules as the one of
+     * Config::GetProcessorAsync.
+     */
+    static CPUProcessorRequestRcPtr GetOptimizedCPUProcessorAsync(
+        const ConstProcessorRcPtr & processor,
+        BitDepth inBitDepth,
+        BitDepth outBitDepth,
+        OptimizationFlags oFlags,
+        const CPUProcessorCallback & callback = CPUProcessorCallback());
+
     Processor(const Processor &) = delete;
     Processor & operator= (const Processor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2858,6 +2934,24 @@ public:
     void applyRGB(float * pixel) const;
     void applyRGBA(float * pixel) const;
 
+    /**
+     * \brief Apply to a list of scattered points (e.g. the colors of a color picker,
+     * of a histogram or of a gamut check) respecting that the input and output bit-depths
+     * be 32-bit float.
+     *
+     * The points are processed by chunks like the image lines so the cost per point is
+     * close to the one of an image.  Each point has three (RGB) or four (RGBA) channels and
+     * the strides are the byte offsets between two consecutive points, use AutoStride for
+     * tightly packed points.  The in and out buffers could be the same buffer.  A missing
+     * alpha is processed as 0 like for applyRGB.
+     *
+     * \note The double precision values are processed in 32-bit float.
+     */
+    void applyPoints(const float * inPoints, float * outPoints, long numPoints,
+                     long numChannels, ptrdiff_t inStrideBytes, ptrdiff_t outStrideBytes) const;
+    void applyPoints(const double * inPoints, double * outPoints, long numPoints,
+                     long numChannels, ptrdiff_t inStrideBytes, ptrdiff_t outStrideBytes) const;
+
     CPUProcessor(const CPUProcessor &) = delete;
     CPUProcessor& operator= (const CPUProcessor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2951,6 +3045,187 @@ private:
     const Impl * getImpl() const { return m_impl; }
 };
 
+/**
+ * \brief Pending result of Config::GetProcessorAsync.
+ *
+ * Destroying the request does not cancel it, so the processor still ends up in the cache and
+ * the callback is still called.
+ */
+class OCIOEXPORT ProcessorRequest
+{
+public:
+    /// True once the processor is built, failed or the request is canceled.
+    bool isReady() const noexcept;
+    /// Block until the request is ready.
+    void wait() const;
+    /// Block until the request is ready or the time elapsed, return true if ready.
+    bool waitFor(unsigned milliseconds) const;
+    /// Block until the request is ready and get the processor.  It throws on failure or cancel.
+    ConstProcessorRcPtr get() const;
+
+    /**
+     * The request is immediately ready and its callback is not called.  A build in progress
+     * still completes for the other requests & the cache.
+     */
+    void cancel() noexcept;
+    bool isCanceled() const noexcept;
+
+    ProcessorRequest(const ProcessorRequest &) = delete;
+    ProcessorRequest & operator= (const ProcessorRequest &) = delete;
+    ~ProcessorRequest();
+
+private:
+    ProcessorRequest();
+
+    static void deleter(ProcessorRequest * c);
+
+    friend class Config;
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+/// Pending result of Processor::GetOptimizedCPUProcessorAsync, see \ref ProcessorRequest.
+class OCIOEXPORT CPUProcessorRequest
+{
+public:
+    bool isReady() const noexcept;
+    void wait() const;
+    bool waitFor(unsigned milliseconds) const;
+    ConstCPUProcessorRcPtr get() const;
+
+    void cancel() noexcept;
+    bool isCanceled() const noexcept;
+
+    CPUProcessorRequest(const CPUProcessorRequest &) = delete;
+    CPUProcessorRequest & operator= (const CPUProcessorRequest &) = delete;
+    ~CPUProcessorRequest();
+
+private:
+    CPUProcessorRequest();
+
+    static void deleter(CPUProcessorRequest * c);
+
+    friend class Processor;
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+
+/**
+ * \brief Builds processors ahead of time on background threads.
+ *
+ * The first Config::getProcessor call for a given display and view pays for building the ops,
+ * loading the LUT files and optimizing.  An application may use this class to do that work
+ * when the config is loaded, instead of when the user switches views.  The processors are
+ * stored in the processor cache of the config (see Config::setProcessorCacheFlags), along
+ * with their default CPU and GPU processors, so the later Config::getProcessor calls requesting the same transforms (with
+ * the same context) return them immediately.
+ *
+ * Items which fail (e.g. a missing LUT file) do not stop the other ones, their error
+ * messages are available once the item is done.
+ *
+ * **Usage Example:**
+ *
+ * \code{.cpp}
+ *
+ *    OCIO::ProcessorPrewarmRcPtr prewarm = OCIO::ProcessorPrewarm::Create(config);
+ *    prewarm->addActiveDisplayViews("scene_linear");
+ *    prewarm->start();
+ *
+ *    // Later on, this processor is already built.
+ *    auto processor = config->getProcessor("scene_linear", display, view,
+ *                                          OCIO::TRANSFORM_DIR_FORWARD);
+ *
+ * \endcode
+ */
+class OCIOEXPORT ProcessorPrewarm
+{
+public:
+    /// The processors are built using the current context of the config.
+    static ProcessorPrewarmRcPtr Create(const ConstConfigRcPtr & config);
+    static ProcessorPrewarmRcPtr Create(const ConstConfigRcPtr & config,
+                                        const ConstContextRcPtr & context);
+
+    /**
+     * Add the processor returned by Config::getProcessor(srcColorSpaceName, display, view,
+     * direction).  If looks is not null, it overrides the looks of the view the same way
+     * LegacyViewingPipeline::setLooksOverride does (i.e. the processor is the one from a
+     * LegacyViewingPipeline only using these display, view and looks override).
+     */
+    void addDisplayView(const char * srcColorSpaceName,
+                        const char * display,
+                        const char * view,
+                        const char * looks,
+                        TransformDirection direction);
+    /**
+     * Add the processors for all the active displays and their active views (i.e. filtered
+     * by the viewing rules) applied to the source color space, in the forward direction.
+     */
+    void addActiveDisplayViews(const char * srcColorSpaceName);
+    /// Add the processor returned by Config::getProcessor(context, transform, direction).
+    void addTransform(const ConstTransformRcPtr & transform, TransformDirection direction);
+
+    size_t getNumItems() const noexcept;
+
+    /// Also build the default CPU processor of each processor (on by default).
+    void setDefaultCPUProcessorEnabled(bool enabled) noexcept;
+    bool isDefaultCPUProcessorEnabled() const noexcept;
+
+    /// Also build the default GPU processor of each processor (on by default).
+    void setDefaultGPUProcessorEnabled(bool enabled) noexcept;
+    bool isDefaultGPUProcessorEnabled() const noexcept;
+
+    /// Number of worker threads, 0 (the default) means the number of cores.
+    void setNumThreads(unsigned numThreads) noexcept;
+    unsigned getNumThreads() const noexcept;
+
+    /**
+     * The callback is called from the worker threads each time an item is done, with the
+     * number of completed items and the total number of items.
+     */
+    typedef std::function<void(size_t numCompleted, size_t numItems)> ProgressCallback;
+    void setProgressCallback(const ProgressCallback & callback);
+
+    /// Start building the items in the background.  It throws if already started.
+    void start();
+
+    /// Items done so far (i.e. built, failed or skipped because of a cancel).
+    size_t getNumCompleted() const noexcept;
+    bool isDone() const noexcept;
+
+    /// The items not yet started are skipped.  The items in progress still complete.
+    void cancel() noexcept;
+    bool isCanceled() const noexcept;
+
+    /// Block until all the items are done.  It returns immediately if not started.
+    void wait();
+
+    size_t getNumErrors() const;
+    /// Get the error message of a failed item, once it is done.
+    const char * getError(size_t index) const;
+
+    ProcessorPrewarm(const ProcessorPrewarm &) = delete;
+    ProcessorPrewarm & operator= (const ProcessorPrewarm &) = delete;
+    /// Cancel and wait for the items in progress.
+    ~ProcessorPrewarm();
+
+private:
+    ProcessorPrewarm();
+
+    static void deleter(ProcessorPrewarm * c);
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
 
 
 /**
@@ -3786,6 +4061,13 @@ public:
                             TextureDimensions & dimensions,
                             Interpolation & interpolation) const = 0;
     virtual void getTextureValues(unsigned index, const float *& values) const = 0;
+    /**
+     * \brief Get the hash of the texture values.
+     *
+     * Textures with identical values share the same hash (and the same read-only values
+     * buffer) so the host application can upload them only once, even across shader programs.
+     */
+    virtual const char * getTextureCacheID(unsigned index) const = 0;
 
     // 3D lut related methods
     virtual unsigned getNum3DTextures() const noexcept = 0;
@@ -3795,6 +4077,8 @@ public:
                               unsigned & edgelen,
                               Interpolation & interpolation) const = 0;
     virtual void get3DTextureValues(unsigned index, const float *& values) const = 0;
+    /// Get the hash of the 3D texture values (refer to \ref getTextureCacheID).
+    virtual const char * get3DTextureCacheID(unsigned index) const = 0;
 
     /// Get the complete OCIO shader program.
     const char * getShaderText() const noexcept;
@@ -80,6 +80,18 @@ class OCIOEXPORT ProcessorMetadata;
 typedef OCIO_SHARED_PTR<const ProcessorMetadata> ConstProcessorMetadataRcPtr;
 typedef OCIO_SHARED_PTR<ProcessorMetadata> ProcessorMetadataRcPtr;
 
+class OCIOEXPORT ProcessorRequest;
+typedef OCIO_SHARED_PTR<const ProcessorRequest> ConstProcessorRequestRcPtr;
+typedef OCIO_SHARED_PTR<ProcessorRequest> ProcessorRequestRcPtr;
+
+class OCIOEXPORT CPUProcessorRequest;
+typedef OCIO_SHARED_PTR<const CPUProcessorRequest> ConstCPUProcessorRequestRcPtr;
+typedef OCIO_SHARED_PTR<CPUProcessorRequest> CPUProcessorRequestRcPtr;
+
+class OCIOEXPORT ProcessorPrewarm;
+typedef OCIO_SHARED_PTR<const ProcessorPrewarm> ConstProcessorPrewarmRcPtr;
+typedef OCIO_SHARED_PTR<ProcessorPrewarm> ProcessorPrewarmRcPtr;
+
 class OCIOEXPORT Baker;
 typedef OCIO_SHARED_PTR<const Baker> ConstBakerRcPtr;
 typedef OCIO_SHARED_PTR<Baker> BakerRcPtr;
@@ -299,6 +311,18 @@ enum LoggingLevel
 /// Define Compute Hash function signature.
 using ComputeHashFunction = std::function<std::string(const std::string &)>;
 
+/// Define the executor signature of the asynchronous requests, it must call the task once.
+using AsyncExecutor = std::function<void(const std::function<void()> & task)>;
+
+/**
+ * Define the completion callback signature of the asynchronous processor requests.  On failure,
+ * the processor is null and the error message is not null.
+ */
+using ProcessorCallback
+    = std::function<void(const ConstProcessorRcPtr & processor, const char * error)>;
+using CPUProcessorCallback
+    = std::function<void(const ConstCPUProcessorRcPtr & processor, const char * error)>;
+
 /**
  * OCIO does not mandate the image state of the main reference space and it is not
  * required to be scene-referred.  This enum is used in connection with the display color space
@@ -686,6 +710,14 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
+    /**
+     * For CPU processor, store the Lut1D (half domain) and Lut3D (tetrahedral) values as half
+     * floats to halve their memory footprint, at the cost of about 1e-3 relative precision.
+     * Only applies where a suitable implementation exists, the LUTs are kept as floats
+     * otherwise.
+     */
+    OPTIMIZATION_LUT_HALF_STORAGE                = 0x20000000,
+
     /// Apply all possible optimizations.
     OPTIMIZATION_ALL                             = 0xFFFFFFFF,
 
@@ -1005,6 +1037,13 @@ extern OCIOEXPORT const char * OCIO_DISABLE_PROCESSOR_CACHES;
 // variable to disable the fallback.
 extern OCIOEXPORT const char * OCIO_DISABLE_CACHE_FALLBACK;
 
+//!rst::
+// .. c:var:: const char * OCIO_VALIDATE_FILE_CACHES
+//
+// Check if the files (e.g. LUT files) changed on disk each time their cached information is used,
+// so that the changed files are reloaded. Refer to SetFileCacheValidation().
+extern OCIOEXPORT const char * OCIO_VALIDATE_FILE_CACHES;
+
 
 // Archive config feature
 // Default filename (with extension) of an config.
@@ -115,6 +115,12 @@ ocio_handle_dependency(  minizip-ng REQUIRED ALLOW_INSTALL
                          RECOMMENDED_VERSION 4.0.10
                          RECOMMENDED_VERSION_REASON "Latest version tested with OCIO")
 
+###############################################################################
+
+# Threads
+# Used to spread the baking of large LUTs over several threads.
+find_package(Threads REQUIRED)
+
 ###############################################################################
 ##
 ## Optional dependencies
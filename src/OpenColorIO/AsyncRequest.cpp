@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "AsyncRequest.h"
+#include "Mutex.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Default executor i.e. a pool of threads processing the tasks in submission order.  A worker
+// thread is started when a task is submitted and there are fewer workers than cores, and it
+// stops once there is no more task to process.
+class AsyncThreadPool
+{
+public:
+    AsyncThreadPool() = default;
+    AsyncThreadPool(const AsyncThreadPool &) = delete;
+    AsyncThreadPool & operator=(const AsyncThreadPool &) = delete;
+
+    ~AsyncThreadPool()
+    {
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // The pending tasks are dropped.
+            m_tasks.clear();
+            threads.swap(m_threads);
+        }
+
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    void submit(const std::function<void()> & task)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_tasks.push_back(task);
+
+        // Otherwise, the running workers take the task once done with their current one.
+        const size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+        if (m_numRunning < maxThreads)
+        {
+            joinStopped();
+
+            ++m_numRunning;
+            m_threads.emplace_back(&AsyncThreadPool::run, this);
+        }
+    }
+
+private:
+    void run()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_tasks.empty())
+                {
+                    --m_numRunning;
+                    m_stopped.push_back(std::this_thread::get_id());
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    // Join the workers which are done, the mutex must be held.
+    void joinStopped()
+    {
+        for (const auto & id : m_stopped)
+        {
+            auto it = std::find_if(m_threads.begin(), m_threads.end(),
+                                   [&id](const std::thread & thread)
+                                   {
+                                       return thread.get_id() == id;
+                                   });
+            if (it != m_threads.end())
+            {
+                it->join();
+                m_threads.erase(it);
+            }
+        }
+        m_stopped.clear();
+    }
+
+    std::mutex m_mutex;
+    std::deque<std::function<void()>> m_tasks;
+    std::vector<std::thread> m_threads;
+    std::vector<std::thread::id> m_stopped;
+    size_t m_numRunning = 0;
+};
+
+AsyncThreadPool & GetDefaultThreadPool()
+{
+    static AsyncThreadPool pool;
+    return pool;
+}
+
+Mutex g_executorMutex;
+AsyncExecutor g_executor;
+
+} // anon.
+
+void SetAsyncExecutor(AsyncExecutor executor)
+{
+    AutoMutex lock(g_executorMutex);
+    g_executor = executor;
+}
+
+void ResetToDefaultAsyncExecutor()
+{
+    AutoMutex lock(g_executorMutex);
+    g_executor = AsyncExecutor();
+}
+
+void SubmitAsyncTask(const std::function<void()> & task)
+{
+    AsyncExecutor executor;
+    {
+        AutoMutex lock(g_executorMutex);
+        executor = g_executor;
+    }
+
+    if (executor)
+    {
+        executor(task);
+    }
+    else
+    {
+        GetDefaultThreadPool().submit(task);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+ProcessorRequest::ProcessorRequest()
+    :   m_impl(new ProcessorRequest::Impl)
+{
+}
+
+ProcessorRequest::~ProcessorRequest()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void ProcessorRequest::deleter(ProcessorRequest * c)
+{
+    delete c;
+}
+
+bool ProcessorRequest::isReady() const noexcept
+{
+    return getImpl()->m_state->isReady();
+}
+
+void ProcessorRequest::wait() const
+{
+    getImpl()->m_state->wait();
+}
+
+bool ProcessorRequest::waitFor(unsigned milliseconds) const
+{
+    return getImpl()->m_state->waitFor(milliseconds);
+}
+
+ConstProcessorRcPtr ProcessorRequest::get() const
+{
+    return getImpl()->m_state->get();
+}
+
+void ProcessorRequest::cancel() noexcept
+{
+    getImpl()->m_state->cancel();
+}
+
+bool ProcessorRequest::isCanceled() const noexcept
+{
+    return getImpl()->m_state->isCanceled();
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+CPUProcessorRequest::CPUProcessorRequest()
+    :   m_impl(new CPUProcessorRequest::Impl)
+{
+}
+
+CPUProcessorRequest::~CPUProcessorRequest()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void CPUProcessorRequest::deleter(CPUProcessorRequest * c)
+{
+    delete c;
+}
+
+bool CPUProcessorRequest::isReady() const noexcept
+{
+    return getImpl()->m_state->isReady();
+}
+
+void CPUProcessorRequest::wait() const
+{
+    getImpl()->m_state->wait();
+}
+
+bool CPUProcessorRequest::waitFor(unsigned milliseconds) const
+{
+    return getImpl()->m_state->waitFor(milliseconds);
+}
+
+ConstCPUProcessorRcPtr CPUProcessorRequest::get() const
+{
+    return getImpl()->m_state->get();
+}
+
+void CPUProcessorRequest::cancel() noexcept
+{
+    getImpl()->m_state->cancel();
+}
+
+bool CPUProcessorRequest::isCanceled() const noexcept
+{
+    return getImpl()->m_state->isCanceled();
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_ASYNCREQUEST_H
+#define INCLUDED_OCIO_ASYNCREQUEST_H
+
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Run the task using the executor from SetAsyncExecutor() or the default pool of threads.
+void SubmitAsyncTask(const std::function<void()> & task);
+
+// State of an asynchronous request, shared between the request instance returned to the caller
+// and the task computing the result.
+template<typename T>
+class AsyncRequestState
+{
+public:
+    typedef std::function<void(const T &, const char *)> Callback;
+
+    AsyncRequestState() = default;
+    AsyncRequestState(const AsyncRequestState &) = delete;
+    AsyncRequestState & operator=(const AsyncRequestState &) = delete;
+
+    void setCallback(const Callback & callback) { m_callback = callback; }
+
+    // Return false once ready, e.g. when canceled before the task started.
+    bool isPending() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return !m_isReady;
+    }
+
+    void setValue(const T & value) { finish(value, std::string()); }
+    void setError(const std::string & error) { finish(T(), error); }
+
+    void cancel() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isReady)
+            {
+                return;
+            }
+            m_canceled = true;
+            m_isReady  = true;
+        }
+        m_readyPromise.set_value();
+    }
+
+    bool isCanceled() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_canceled;
+    }
+
+    bool isReady() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_isReady;
+    }
+
+    void wait() const
+    {
+        m_ready.wait();
+    }
+
+    bool waitFor(unsigned milliseconds) const
+    {
+        return m_ready.wait_for(std::chrono::milliseconds(milliseconds))
+            == std::future_status::ready;
+    }
+
+    T get() const
+    {
+        wait();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_canceled)
+        {
+            throw Exception("The asynchronous request was canceled.");
+        }
+        if (!m_error.empty())
+        {
+            throw Exception(m_error.c_str());
+        }
+        return m_value;
+    }
+
+private:
+    void finish(const T & value, const std::string & error)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isReady)
+            {
+                // Canceled in the meantime.
+                return;
+            }
+            m_value   = value;
+            m_error   = error;
+            m_isReady = true;
+        }
+        m_readyPromise.set_value();
+
+        if (m_callback)
+        {
+            try
+            {
+                m_callback(value, error.empty() ? nullptr : error.c_str());
+            }
+            catch (...)
+            {
+                // An exception must not escape from the executor.
+            }
+        }
+    }
+
+    mutable std::mutex m_mutex;
+    bool m_isReady  = false;
+    bool m_canceled = false;
+    T m_value;
+    std::string m_error;
+    Callback m_callback;
+
+    // Set once, when the request becomes ready.
+    std::promise<void> m_readyPromise;
+    std::shared_future<void> m_ready{ m_readyPromise.get_future().share() };
+};
+
+// Compute the request result with the executor, unless canceled before the task starts.
+template<typename T>
+void RunAsyncRequest(const std::shared_ptr<AsyncRequestState<T>> & state,
+                     const std::function<T()> & builder)
+{
+    SubmitAsyncTask([state, builder]()
+    {
+        if (!state->isPending())
+        {
+            return;
+        }
+
+        try
+        {
+            state->setValue(builder());
+        }
+        catch (const std::exception & e)
+        {
+            state->setError(e.what());
+        }
+        catch (...)
+        {
+            state->setError("Unknown error.");
+        }
+    });
+}
+
+class ProcessorRequest::Impl
+{
+public:
+    std::shared_ptr<AsyncRequestState<ConstProcessorRcPtr>> m_state
+        = std::make_shared<AsyncRequestState<ConstProcessorRcPtr>>();
+};
+
+class CPUProcessorRequest::Impl
+{
+public:
+    std::shared_ptr<AsyncRequestState<ConstCPUProcessorRcPtr>> m_state
+        = std::make_shared<AsyncRequestState<ConstCPUProcessorRcPtr>>();
+};
+
+} // namespace OCIO_NAMESPACE
+
+
+#endif // INCLUDED_OCIO_ASYNCREQUEST_H
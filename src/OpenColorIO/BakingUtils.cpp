@@ -1,6 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
 #include "BakingUtils.h"
 
 namespace OCIO_NAMESPACE
@@ -130,4 +135,60 @@ void GetTargetRange(const Baker & baker, float& start, float& end)
     return GetSrcRange(baker, baker.getTargetSpace(), start, end);
 }
 
+void ApplyParallel(const ConstCPUProcessorRcPtr & processor, float * rgb, long numPixels)
+{
+    // Below that size, the thread creation costs more than the processing.
+    static constexpr long MIN_PIXELS_PER_THREAD = 16 * 1024;
+
+    const long numCores = std::max(1L, (long)std::thread::hardware_concurrency());
+    const long numThreads = std::min(numCores, numPixels / MIN_PIXELS_PER_THREAD);
+
+    if (numThreads <= 1)
+    {
+        PackedImageDesc img(rgb, numPixels, 1, 3);
+        processor->apply(img);
+        return;
+    }
+
+    const long chunkSize = (numPixels + numThreads - 1) / numThreads;
+
+    std::vector<std::exception_ptr> errors(numThreads);
+
+    auto applyChunk = [&](long idx)
+    {
+        try
+        {
+            const long start = idx * chunkSize;
+            const long size = std::min(chunkSize, numPixels - start);
+            PackedImageDesc img(rgb + 3 * start, size, 1, 3);
+            processor->apply(img);
+        }
+        catch (...)
+        {
+            errors[idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (long idx = 1; idx < numThreads; ++idx)
+    {
+        threads.emplace_back(applyChunk, idx);
+    }
+    applyChunk(0);
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto & error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 } // namespace OCIO_NAMESPACE
@@ -23,6 +23,10 @@ void GetShaperRange(const Baker & baker, float& start, float& end);
 
 void GetTargetRange(const Baker & baker, float& start, float& end);
 
+// Apply the processor to the packed RGB values. Large buffers (e.g. the lattice of a 3D LUT)
+// are split across several threads.
+void ApplyParallel(const ConstCPUProcessorRcPtr & processor, float * rgb, long numPixels);
+
 
 } // namespace OCIO_NAMESPACE
 
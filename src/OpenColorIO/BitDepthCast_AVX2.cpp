@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthCast_AVX2.h"
+
+#if OCIO_USE_AVX2
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Round exactly like Converter<outBD>::CastValue() i.e. add 0.5, clamp and truncate. The
+// packing functions then only see integral values so their own rounding mode has no effect.
+static inline __m256 round_avx2(__m256 v, const __m256 & maxValue)
+{
+    v = avx2_clamp(_mm256_add_ps(v, _mm256_set1_ps(0.5f)), maxValue);
+    return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(v));
+}
+
+template <BitDepth inBD, BitDepth outBD>
+void castBitDepth(const void * inImg, void * outImg, long numPixels)
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    const InType * in = reinterpret_cast<const InType *>(inImg);
+    OutType * out = reinterpret_cast<OutType *>(outImg);
+
+    // Same scale as the scalar BitDepthCast so that the results are bit-exact.
+    const float scale = float(BitDepthInfo<outBD>::maxValue)
+                        / float(BitDepthInfo<inBD>::maxValue);
+
+    const __m256 vscale   = _mm256_set1_ps(scale);
+    const __m256 maxValue = _mm256_set1_ps(float(BitDepthInfo<outBD>::maxValue));
+
+    // The cast is done per component so the transposes of the packing functions cancel out.
+    const long pixelCount = numPixels / 8 * 8;
+
+    __m256 r, g, b, a;
+    for (long i = 0; i < pixelCount; i += 8)
+    {
+        AVX2RGBAPack<inBD>::Load(in, r, g, b, a);
+
+        r = _mm256_mul_ps(r, vscale);
+        g = _mm256_mul_ps(g, vscale);
+        b = _mm256_mul_ps(b, vscale);
+        a = _mm256_mul_ps(a, vscale);
+
+        if (!BitDepthInfo<outBD>::isFloat)
+        {
+            r = round_avx2(r, maxValue);
+            g = round_avx2(g, maxValue);
+            b = round_avx2(b, maxValue);
+            a = round_avx2(a, maxValue);
+        }
+
+        AVX2RGBAPack<outBD>::Store(out, r, g, b, a);
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Handle the leftover pixels.
+    for (long i = pixelCount * 4; i < numPixels * 4; ++i)
+    {
+        *out++ = Converter<outBD>::CastValue(*in++ * scale);
+    }
+}
+
+template<BitDepth inBD>
+inline BitDepthCastApplyFunc * GetCastInBitDepth(BitDepth outBD)
+{
+    switch(outBD)
+    {
+        case BIT_DEPTH_UINT8:
+            return castBitDepth<inBD, BIT_DEPTH_UINT8>;
+        case BIT_DEPTH_UINT10:
+            return castBitDepth<inBD, BIT_DEPTH_UINT10>;
+        case BIT_DEPTH_UINT12:
+            return castBitDepth<inBD, BIT_DEPTH_UINT12>;
+        case BIT_DEPTH_UINT16:
+            return castBitDepth<inBD, BIT_DEPTH_UINT16>;
+        case BIT_DEPTH_F16:
+#if OCIO_USE_F16C
+            if (CPUInfo::instance().hasF16C())
+                return castBitDepth<inBD, BIT_DEPTH_F16>;
+#endif
+            break;
+        case BIT_DEPTH_F32:
+            return castBitDepth<inBD, BIT_DEPTH_F32>;
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
+} // anonymous namespace
+
+BitDepthCastApplyFunc * AVX2GetBitDepthCastApplyFunc(BitDepth inBD, BitDepth outBD)
+{
+    switch(inBD)
+    {
+        case BIT_DEPTH_UINT8:
+            return GetCastInBitDepth<BIT_DEPTH_UINT8>(outBD);
+        case BIT_DEPTH_UINT10:
+            return GetCastInBitDepth<BIT_DEPTH_UINT10>(outBD);
+        case BIT_DEPTH_UINT12:
+            return GetCastInBitDepth<BIT_DEPTH_UINT12>(outBD);
+        case BIT_DEPTH_UINT16:
+            return GetCastInBitDepth<BIT_DEPTH_UINT16>(outBD);
+        case BIT_DEPTH_F16:
+#if OCIO_USE_F16C
+            if (CPUInfo::instance().hasF16C())
+                return GetCastInBitDepth<BIT_DEPTH_F16>(outBD);
+#endif
+            break;
+        case BIT_DEPTH_F32:
+            return GetCastInBitDepth<BIT_DEPTH_F32>(outBD);
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_BITDEPTHCAST_SSE2_H
+#define INCLUDED_OCIO_BITDEPTHCAST_SSE2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+typedef void (BitDepthCastApplyFunc)(const void *, void *, long);
+
+#if OCIO_USE_SSE2
+namespace OCIO_NAMESPACE
+{
+
+BitDepthCastApplyFunc * SSE2GetBitDepthCastApplyFunc(BitDepth inBD, BitDepth outBD);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
+
+#endif /* INCLUDED_OCIO_BITDEPTHCAST_SSE2_H */
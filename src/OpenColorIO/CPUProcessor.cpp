@@ -1,12 +1,18 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <string.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BitDepthCast_AVX2.h"
+#include "BitDepthCast_AVX512.h"
+#include "BitDepthCast_SSE2.h"
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "CPUProcessor.h"
+#include "ops/FusedOpCPU.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
@@ -24,11 +30,44 @@ class BitDepthCast : public OpCPU
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
 public:
-    BitDepthCast() = default;
+    BitDepthCast()
+    {
+#if OCIO_USE_SSE2
+        if (CPUInfo::instance().hasSSE2())
+        {
+            m_applyFunc = SSE2GetBitDepthCastApplyFunc(inBD, outBD);
+        }
+#endif
+
+#if OCIO_USE_AVX2
+        if (CPUInfo::instance().hasAVX2())
+        {
+            BitDepthCastApplyFunc * func = AVX2GetBitDepthCastApplyFunc(inBD, outBD);
+            if (func)
+            {
+                m_applyFunc = func;
+            }
+        }
+#endif
+
+#if OCIO_USE_AVX512
+        if (CPUInfo::instance().hasAVX512())
+        {
+            m_applyFunc = AVX512GetBitDepthCastApplyFunc(inBD, outBD);
+        }
+#endif
+    }
+
     ~BitDepthCast() override {};
 
     void apply(const void * inImg, void * outImg, long numPixels) const override
     {
+        if (m_applyFunc)
+        {
+            m_applyFunc(inImg, outImg, numPixels);
+            return;
+        }
+
         const InType * in = reinterpret_cast<const InType*>(inImg);
         OutType * out = reinterpret_cast<OutType*>(outImg);
 
@@ -47,6 +86,9 @@ public:
 protected:
     const float m_scale = float(BitDepthInfo<outBD>::maxValue)
                             / float(BitDepthInfo<inBD>::maxValue);
+
+    // Vectorized version of the cast, bit-exact with the scalar code above.
+    BitDepthCastApplyFunc * m_applyFunc = nullptr;
 };
 
 template<>
@@ -63,6 +105,22 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    bool hasRGBApply() const override { return true; }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        if(inImg!=outImg)
+        {
+            memcpy(outImg, inImg, 3*numPixels*sizeof(float));
+        }
+    }
+
+    bool hasPlanarApply() const override { return true; }
+
+    void applyPlanar(float *, float *, float *, float *, long) const override
+    {
+    }
 };
 
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
@@ -119,6 +177,27 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+// Returns the CPU Op of an op processing F32 pixels.
+ConstOpCPURcPtr GetCPUOp(const ConstOpRcPtr & op, bool fastLogExpPow, bool halfLutStorage)
+{
+    if (halfLutStorage)
+    {
+        ConstOpDataRcPtr opData = op->data();
+        if (opData->getType() == OpData::Lut1DType)
+        {
+            ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
+            return GetLut1DRenderer(lut, BIT_DEPTH_F32, BIT_DEPTH_F32, true);
+        }
+        else if (opData->getType() == OpData::Lut3DType)
+        {
+            ConstLut3DOpDataRcPtr lut = DynamicPtrCast<const Lut3DOpData>(opData);
+            return GetLut3DRenderer(lut, true);
+        }
+    }
+
+    return op->getCPUOp(fastLogExpPow);
+}
+
 void CreateCPUEngine(const OpRcPtrVec & ops, 
                      BitDepth in, 
                      BitDepth out,
@@ -132,8 +211,51 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
 {
     const size_t maxOps = ops.size();
     const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
+    const bool halfLutStorage = HasFlag(oFlags, OPTIMIZATION_LUT_HALF_STORAGE);
     for(size_t idx=0; idx<maxOps; ++idx)
     {
+        // The common sequences of ops are processed in one pass by a fused renderer.
+        size_t numFusedOps = 0;
+        ConstOpCPURcPtr fusedOp = GetFusedRenderer(ops, idx, fastLogExpPow, numFusedOps);
+        if(fusedOp)
+        {
+            const bool isFirst = idx==0;
+            const bool isLast  = idx+numFusedOps==maxOps;
+
+            if(isFirst)
+            {
+                if(in==BIT_DEPTH_F32)
+                {
+                    inBitDepthOp = fusedOp;
+                }
+                else
+                {
+                    inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
+                    cpuOps.push_back(fusedOp);
+                }
+
+                if(isLast)
+                {
+                    outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
+                }
+            }
+            else if(isLast && out==BIT_DEPTH_F32)
+            {
+                outBitDepthOp = fusedOp;
+            }
+            else
+            {
+                if(isLast)
+                {
+                    outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
+                }
+                cpuOps.push_back(fusedOp);
+            }
+
+            idx += numFusedOps - 1;
+            continue;
+        }
+
         ConstOpRcPtr op = ops[idx];
         ConstOpDataRcPtr opData = op->data();
 
@@ -142,16 +264,16 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             if(opData->getType()==OpData::Lut1DType)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
-                inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
+                inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32, halfLutStorage);
             }
             else if(in==BIT_DEPTH_F32)
             {
-                inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                inBitDepthOp = GetCPUOp(op, fastLogExpPow, halfLutStorage);
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(GetCPUOp(op, fastLogExpPow, halfLutStorage));
             }
 
             if(maxOps==1)
@@ -164,21 +286,21 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             if(opData->getType()==OpData::Lut1DType)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
-                outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
+                outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out, halfLutStorage);
             }
             else if(out==BIT_DEPTH_F32)
             {
-                outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                outBitDepthOp = GetCPUOp(op, fastLogExpPow, halfLutStorage);
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(GetCPUOp(op, fastLogExpPow, halfLutStorage));
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            cpuOps.push_back(GetCPUOp(op, fastLogExpPow, halfLutStorage));
         }
     }
 }
@@ -365,6 +487,22 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_outBitDepthOp = nullptr;
     CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
 
+    // Can the packed RGB 32-bit float images be processed without the RGBA buffer?
+    m_hasRGBApply = in == BIT_DEPTH_F32 && out == BIT_DEPTH_F32
+                 && m_inBitDepthOp->hasRGBApply() && m_outBitDepthOp->hasRGBApply();
+    for (const auto & op : m_cpuOps)
+    {
+        m_hasRGBApply = m_hasRGBApply && op->hasRGBApply();
+    }
+
+    // Can the planar 32-bit float images be processed without the RGBA buffer?
+    m_hasPlanarApply = in == BIT_DEPTH_F32 && out == BIT_DEPTH_F32
+                    && m_inBitDepthOp->hasPlanarApply() && m_outBitDepthOp->hasPlanarApply();
+    for (const auto & op : m_cpuOps)
+    {
+        m_hasPlanarApply = m_hasPlanarApply && op->hasPlanarApply();
+    }
+
     // Compute the cache id.
 
     std::stringstream ss;
@@ -376,8 +514,119 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
+bool CPUProcessor::Impl::applyPackedRGB(const ImageDesc & srcImgDesc,
+                                        const ImageDesc & dstImgDesc) const
+{
+    if (!m_hasRGBApply)
+    {
+        return false;
+    }
+
+    GenericImageDesc srcImg;
+    srcImg.init(srcImgDesc, m_inBitDepth, m_inBitDepthOp);
+    GenericImageDesc dstImg;
+    dstImg.init(dstImgDesc, m_outBitDepth, m_outBitDepthOp);
+
+    if (!srcImg.isPackedFloatRGB() || !dstImg.isPackedFloatRGB()
+        || srcImg.m_width != dstImg.m_width || srcImg.m_height != dstImg.m_height)
+    {
+        return false;
+    }
+
+    // The lines are processed in place in the destination image, three floats per pixel.
+    const long width = srcImg.m_width;
+    for (long y = 0; y < srcImg.m_height; ++y)
+    {
+        const char * src = srcImg.m_rData + y * srcImg.m_yStrideBytes;
+        char * dst = dstImg.m_rData + y * dstImg.m_yStrideBytes;
+
+        m_inBitDepthOp->applyRGB(src, dst, width);
+
+        for (const auto & op : m_cpuOps)
+        {
+            op->applyRGB(dst, dst, width);
+        }
+
+        m_outBitDepthOp->applyRGB(dst, dst, width);
+    }
+
+    return true;
+}
+
+bool CPUProcessor::Impl::applyPlanarFloat(const ImageDesc & srcImgDesc,
+                                          const ImageDesc & dstImgDesc) const
+{
+    if (!m_hasPlanarApply)
+    {
+        return false;
+    }
+
+    GenericImageDesc srcImg;
+    srcImg.init(srcImgDesc, m_inBitDepth, m_inBitDepthOp);
+    GenericImageDesc dstImg;
+    dstImg.init(dstImgDesc, m_outBitDepth, m_outBitDepthOp);
+
+    // Some ops (e.g. a matrix) could need the source alpha which is then not available.
+    if (!srcImg.isPlanarFloat() || !dstImg.isPlanarFloat()
+        || srcImg.m_width != dstImg.m_width || srcImg.m_height != dstImg.m_height
+        || (srcImg.m_aData && !dstImg.m_aData))
+    {
+        return false;
+    }
+
+    const long width = srcImg.m_width;
+    const size_t lineBytes = width * sizeof(float);
+
+    for (long y = 0; y < srcImg.m_height; ++y)
+    {
+        const ptrdiff_t srcOffset = y * srcImg.m_yStrideBytes;
+        const ptrdiff_t dstOffset = y * dstImg.m_yStrideBytes;
+
+        const char * srcPlanes[4] = { srcImg.m_rData + srcOffset, srcImg.m_gData + srcOffset,
+                                      srcImg.m_bData + srcOffset,
+                                      srcImg.m_aData ? srcImg.m_aData + srcOffset : nullptr };
+
+        float * dstPlanes[4] = { (float *)(dstImg.m_rData + dstOffset),
+                                 (float *)(dstImg.m_gData + dstOffset),
+                                 (float *)(dstImg.m_bData + dstOffset),
+                                 dstImg.m_aData ? (float *)(dstImg.m_aData + dstOffset) : nullptr };
+
+        // The lines are processed in place in the destination image.
+        for (int c = 0; c < 4; ++c)
+        {
+            if (!dstPlanes[c] || srcPlanes[c] == (const char *)dstPlanes[c]) continue;
+
+            if (srcPlanes[c])
+            {
+                memcpy(dstPlanes[c], srcPlanes[c], lineBytes);
+            }
+            else
+            {
+                // As for the packed images, the missing alpha is 0.
+                std::fill(dstPlanes[c], dstPlanes[c] + width, 0.0f);
+            }
+        }
+
+        m_inBitDepthOp->applyPlanar(dstPlanes[0], dstPlanes[1], dstPlanes[2], dstPlanes[3], width);
+
+        for (const auto & op : m_cpuOps)
+        {
+            op->applyPlanar(dstPlanes[0], dstPlanes[1], dstPlanes[2], dstPlanes[3], width);
+        }
+
+        m_outBitDepthOp->applyPlanar(dstPlanes[0], dstPlanes[1], dstPlanes[2], dstPlanes[3], width);
+    }
+
+    return true;
+}
+
 void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
 {   
+    if (applyPackedRGB(imgDesc, imgDesc) || applyPlanarFloat(imgDesc, imgDesc))
+    {
+        return;
+    }
+
     // Get the ScanlineHelper for this thread (no significant performance impact).
     std::unique_ptr<ScanlineHelper> 
         scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
@@ -406,6 +655,11 @@ void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
 
 void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
 {
+    if (applyPackedRGB(srcImgDesc, dstImgDesc) || applyPlanarFloat(srcImgDesc, dstImgDesc))
+    {
+        return;
+    }
+
     // Get the ScanlineHelper for this thread (no significant performance impact).
     std::unique_ptr<ScanlineHelper> 
         scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
@@ -464,6 +718,107 @@ void CPUProcessor::Impl::applyRGBA(float * pixel) const
     m_outBitDepthOp->apply(pixel, pixel, 1);
 }
 
+template<typename T>
+void CPUProcessor::Impl::applyPoints(const T * inPoints, T * outPoints, long numPoints,
+                                     long numChannels,
+                                     ptrdiff_t inStrideBytes, ptrdiff_t outStrideBytes) const
+{
+    if (m_inBitDepth != BIT_DEPTH_F32 || m_outBitDepth != BIT_DEPTH_F32)
+    {
+        throw Exception("The points processing needs 32-bit float input and output bit-depths.");
+    }
+
+    if (numChannels != 3 && numChannels != 4)
+    {
+        throw Exception("The points processing only supports RGB and RGBA points.");
+    }
+
+    if (numPoints < 0)
+    {
+        throw Exception("The number of points cannot be negative.");
+    }
+
+    if (numPoints == 0)
+    {
+        return;
+    }
+
+    if (!inPoints || !outPoints)
+    {
+        throw Exception("The points buffers cannot be null.");
+    }
+
+    const ptrdiff_t pointBytes = numChannels * sizeof(T);
+    const ptrdiff_t inStride   = inStrideBytes  == AutoStride ? pointBytes : inStrideBytes;
+    const ptrdiff_t outStride  = outStrideBytes == AutoStride ? pointBytes : outStrideBytes;
+
+    // The RGB points skip the alpha processing when all the ops allow it.
+    const bool useRGB = numChannels == 3 && m_hasRGBApply;
+    const long bufferChannels = useRGB ? 3 : 4;
+
+    // Small enough to stay in the L1 cache.
+    constexpr long BufferPoints = 256;
+    alignas(64) float buffer[4 * BufferPoints];
+
+    const char * in = reinterpret_cast<const char *>(inPoints);
+    char * out = reinterpret_cast<char *>(outPoints);
+
+    for (long first = 0; first < numPoints; first += BufferPoints)
+    {
+        const long count = std::min(BufferPoints, numPoints - first);
+
+        // Gather the points in the buffer (the in and out points could be the same).
+        for (long idx = 0; idx < count; ++idx)
+        {
+            const T * src = reinterpret_cast<const T *>(in + idx * inStride);
+            float * dst = buffer + bufferChannels * idx;
+
+            dst[0] = static_cast<float>(src[0]);
+            dst[1] = static_cast<float>(src[1]);
+            dst[2] = static_cast<float>(src[2]);
+            if (bufferChannels == 4)
+            {
+                // Like applyRGB, a missing alpha is 0.
+                dst[3] = numChannels == 4 ? static_cast<float>(src[3]) : 0.0f;
+            }
+        }
+
+        if (useRGB)
+        {
+            m_inBitDepthOp->applyRGB(buffer, buffer, count);
+            for (const auto & op : m_cpuOps)
+            {
+                op->applyRGB(buffer, buffer, count);
+            }
+            m_outBitDepthOp->applyRGB(buffer, buffer, count);
+        }
+        else
+        {
+            m_inBitDepthOp->apply(buffer, buffer, count);
+            for (const auto & op : m_cpuOps)
+            {
+                op->apply(buffer, buffer, count);
+            }
+            m_outBitDepthOp->apply(buffer, buffer, count);
+        }
+
+        // Scatter the processed points.
+        for (long idx = 0; idx < count; ++idx)
+        {
+            const float * src = buffer + bufferChannels * idx;
+            T * dst = reinterpret_cast<T *>(out + idx * outStride);
+
+            for (long c = 0; c < numChannels; ++c)
+            {
+                dst[c] = static_cast<T>(src[c]);
+            }
+        }
+
+        in  += count * inStride;
+        out += count * outStride;
+    }
+}
+
 
 
 
@@ -553,4 +908,20 @@ void CPUProcessor::applyRGBA(float * pixel) const
     getImpl()->applyRGBA(pixel);
 }
 
+void CPUProcessor::applyPoints(const float * inPoints, float * outPoints, long numPoints,
+                               long numChannels,
+                               ptrdiff_t inStrideBytes, ptrdiff_t outStrideBytes) const
+{
+    getImpl()->applyPoints(inPoints, outPoints, numPoints, numChannels,
+                           inStrideBytes, outStrideBytes);
+}
+
+void CPUProcessor::applyPoints(const double * inPoints, double * outPoints, long numPoints,
+                               long numChannels,
+                               ptrdiff_t inStrideBytes, ptrdiff_t outStrideBytes) const
+{
+    getImpl()->applyPoints(inPoints, outPoints, numPoints, numChannels,
+                           inStrideBytes, outStrideBytes);
+}
+
 } // namespace OCIO_NAMESPACE
@@ -16,6 +16,7 @@ namespace OCIO_NAMESPACE
 const char * OCIO_DISABLE_ALL_CACHES       = "OCIO_DISABLE_ALL_CACHES";
 const char * OCIO_DISABLE_PROCESSOR_CACHES = "OCIO_DISABLE_PROCESSOR_CACHES";
 const char * OCIO_DISABLE_CACHE_FALLBACK   = "OCIO_DISABLE_CACHE_FALLBACK";
+const char * OCIO_VALIDATE_FILE_CACHES     = "OCIO_VALIDATE_FILE_CACHES";
 
 
 // TODO: Processors which the user hangs onto have local caches.
@@ -26,4 +27,11 @@ void ClearAllCaches()
     ClearPathCaches();
     ClearFileTransformCaches();
 }
+
+int ClearChangedFileCaches()
+{
+    // The cache entries depending on the changed files are lazily rebuilt as they all keep the
+    // revisions of their files.
+    return CheckFileRevisions();
+}
 } // namespace OCIO_NAMESPACE
@@ -3,6 +3,7 @@
 
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -31,6 +32,7 @@ public:
             {
                 m_colorSpaces.push_back(cs->createEditableCopy());
             }
+            rebuildIndex();
         }
         return *this;
     }
@@ -91,21 +93,10 @@ public:
         // Search for name and aliases.
         if (csName && *csName)
         {
-            const std::string str = StringUtils::Lower(csName);
-            for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
+            const auto it = m_index.find(StringUtils::Lower(csName));
+            if (it != m_index.end())
             {
-                if (StringUtils::Compare(m_colorSpaces[idx]->getName(), str))
-                {
-                    return static_cast<int>(idx);
-                }
-                const size_t numAliases = m_colorSpaces[idx]->getNumAliases();
-                for (size_t aidx = 0; aidx < numAliases; ++aidx)
-                {
-                    if (StringUtils::Compare(m_colorSpaces[idx]->getAlias(aidx), str))
-                    {
-                        return static_cast<int>(idx);
-                    }
-                }
+                return static_cast<int>(it->second);
             }
         }
 
@@ -163,11 +154,14 @@ public:
         if (replaceIdx != (size_t)-1)
         {
             // The color space replaces the existing one.
+            unindex(replaceIdx);
             m_colorSpaces[replaceIdx] = cs->createEditableCopy();
+            index(replaceIdx);
             return;
         }
 
         m_colorSpaces.push_back(cs->createEditableCopy());
+        index(m_colorSpaces.size() - 1);
     }
 
     void add(const Impl & rhs)
@@ -183,13 +177,12 @@ public:
         const std::string name = StringUtils::Lower(csName);
         if (name.empty()) return;
 
-        for (auto itr = m_colorSpaces.begin(); itr != m_colorSpaces.end(); ++itr)
+        // Only a color space name (i.e. not an alias) removes the color space.
+        const auto it = m_index.find(name);
+        if (it != m_index.end() && StringUtils::Compare(m_colorSpaces[it->second]->getName(), name))
         {
-            if (StringUtils::Lower((*itr)->getName())==name)
-            {
-                m_colorSpaces.erase(itr);
-                return;
-            }
+            m_colorSpaces.erase(m_colorSpaces.begin() + it->second);
+            rebuildIndex();
         }
     }
 
@@ -204,11 +197,48 @@ public:
     void clear()
     {
         m_colorSpaces.clear();
+        m_index.clear();
     }
 
 private:
+    // Add the lower case name & aliases of the color space at position idx to the index.
+    void index(size_t idx)
+    {
+        const ColorSpaceRcPtr & cs = m_colorSpaces[idx];
+        m_index.emplace(StringUtils::Lower(cs->getName()), idx);
+        const size_t numAliases = cs->getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            m_index.emplace(StringUtils::Lower(cs->getAlias(aidx)), idx);
+        }
+    }
+
+    void unindex(size_t idx)
+    {
+        const ColorSpaceRcPtr & cs = m_colorSpaces[idx];
+        m_index.erase(StringUtils::Lower(cs->getName()));
+        const size_t numAliases = cs->getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            m_index.erase(StringUtils::Lower(cs->getAlias(aidx)));
+        }
+    }
+
+    void rebuildIndex()
+    {
+        m_index.clear();
+        m_index.reserve(m_colorSpaces.size());
+        for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
+        {
+            index(idx);
+        }
+    }
+
     typedef std::vector<ColorSpaceRcPtr> ColorSpaceVec;
     ColorSpaceVec m_colorSpaces;
+
+    // Lower case color space names & aliases to their position in m_colorSpaces.
+    std::unordered_map<std::string, size_t> m_index;
 };
 
 
@@ -7,15 +7,21 @@
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <regex>
 #include <functional>
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
 
 #include <pystring.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "AsyncRequest.h"
 #include "builtinconfigs/BuiltinConfigRegistry.h"
 #include "ConfigUtils.h"
 #include "ContextVariableUtils.h"
@@ -291,6 +297,8 @@ public:
 
     StringMap m_roles;
     LookVec m_looksList;
+    // Lower case look names to their position in m_looksList.
+    std::unordered_map<std::string, size_t> m_lookIndex;
 
     DisplayMap m_displays;
     StringUtils::StringVec m_activeDisplays;
@@ -304,6 +312,8 @@ public:
     Display m_virtualDisplay;
 
     std::vector<ViewTransformRcPtr> m_viewTransforms;
+    // Lower case view transform names to their position in m_viewTransforms.
+    std::unordered_map<std::string, size_t> m_viewTransformIndex;
     std::string m_defaultViewTransform;
 
     mutable std::string m_activeDisplaysStr;
@@ -312,6 +322,8 @@ public:
 
     // All the named transforms(i.e. no filtering).
     std::vector<ConstNamedTransformRcPtr> m_allNamedTransforms;
+    // Lower case named transform names & aliases to their position in m_allNamedTransforms.
+    std::unordered_map<std::string, size_t> m_namedTransformIndex;
     // Active named transform names.
     StringUtils::StringVec m_activeNamedTransformNames;
     // Inactive named transform names.
@@ -327,10 +339,44 @@ public:
     mutable Mutex m_cacheidMutex;
     mutable StringMap m_cacheids;
     mutable std::string m_cacheidnocontext;
+    // The files used by each cache id (i.e. per context cache id).
+    mutable std::map<std::string, FileRevisionVec> m_cacheidFileRevisions;
+    mutable unsigned m_cacheidFileChangeCount { 0 };
     FileRulesRcPtr m_fileRules;
 
     mutable ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
     mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
+    mutable unsigned m_processorFileChangeCount { 0 };
+
+    // Processor being built, shared with the concurrent requests for the same cache entry.
+    class ProcessorBuild
+    {
+    public:
+        void finish(const ProcessorRcPtr & processor, std::exception_ptr error)
+        {
+            if (error)
+            {
+                m_promise.set_exception(error);
+            }
+            else
+            {
+                m_promise.set_value(processor);
+            }
+        }
+
+        // Block until the build is done, it throws if the build failed.
+        ProcessorRcPtr wait() const
+        {
+            return m_result.get();
+        }
+
+    private:
+        std::promise<ProcessorRcPtr> m_promise;
+        std::shared_future<ProcessorRcPtr> m_result{ m_promise.get_future().share() };
+    };
+
+    // The processors being built, protected by the processor cache lock.
+    mutable std::map<std::size_t, std::shared_ptr<ProcessorBuild>> m_processorBuilds;
 
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
@@ -404,6 +450,7 @@ public:
             {
                 m_looksList.push_back(look->createEditableCopy());
             }
+            m_lookIndex = rhs.m_lookIndex;
 
             // Assignment operator will suffice for these.
             m_roles = rhs.m_roles;
@@ -414,6 +461,7 @@ public:
             {
                 m_allNamedTransforms.push_back(nt->createEditableCopy());
             }
+            m_namedTransformIndex = rhs.m_namedTransformIndex;
             m_activeNamedTransformNames = rhs.m_activeNamedTransformNames;
             m_inactiveNamedTransformNames = rhs.m_inactiveNamedTransformNames;
 
@@ -436,6 +484,7 @@ public:
             {
                 m_viewTransforms.push_back(vt->createEditableCopy());
             }
+            m_viewTransformIndex = rhs.m_viewTransformIndex;
             m_defaultViewTransform = rhs.m_defaultViewTransform;
             m_defaultLumaCoefs = rhs.m_defaultLumaCoefs;
             m_strictParsing = rhs.m_strictParsing;
@@ -445,6 +494,8 @@ public:
 
             m_cacheids = rhs.m_cacheids;
             m_cacheidnocontext = rhs.m_cacheidnocontext;
+            m_cacheidFileRevisions = rhs.m_cacheidFileRevisions;
+            m_cacheidFileChangeCount = rhs.m_cacheidFileChangeCount;
 
             m_fileRules = rhs.m_fileRules->createEditableCopy();
             
@@ -497,26 +548,47 @@ public:
     {
         if (name && *name)
         {
-            const std::string str = StringUtils::Lower(name);
-            for (size_t idx = 0; idx < m_allNamedTransforms.size(); ++idx)
+            const auto it = m_namedTransformIndex.find(StringUtils::Lower(name));
+            if (it != m_namedTransformIndex.end())
             {
-                if (StringUtils::Lower(m_allNamedTransforms[idx]->getName()) == str)
-                {
-                    return idx;
-                }
-                const auto numAliases = m_allNamedTransforms[idx]->getNumAliases();
-                for (size_t alias = 0; alias < numAliases; ++alias)
-                {
-                    if (StringUtils::Lower(m_allNamedTransforms[idx]->getAlias(alias)) == str)
-                    {
-                        return idx;
-                    }
-                }
+                return it->second;
             }
         }
         return static_cast<size_t>(-1);
     }
 
+    // Add the lower case name & aliases of the named transform at position idx to the index.
+    void indexNamedTransform(size_t idx)
+    {
+        const ConstNamedTransformRcPtr & nt = m_allNamedTransforms[idx];
+        m_namedTransformIndex.emplace(StringUtils::Lower(nt->getName()), idx);
+        const size_t numAliases = nt->getNumAliases();
+        for (size_t alias = 0; alias < numAliases; ++alias)
+        {
+            m_namedTransformIndex.emplace(StringUtils::Lower(nt->getAlias(alias)), idx);
+        }
+    }
+
+    void unindexNamedTransform(size_t idx)
+    {
+        const ConstNamedTransformRcPtr & nt = m_allNamedTransforms[idx];
+        m_namedTransformIndex.erase(StringUtils::Lower(nt->getName()));
+        const size_t numAliases = nt->getNumAliases();
+        for (size_t alias = 0; alias < numAliases; ++alias)
+        {
+            m_namedTransformIndex.erase(StringUtils::Lower(nt->getAlias(alias)));
+        }
+    }
+
+    void rebuildNamedTransformIndex()
+    {
+        m_namedTransformIndex.clear();
+        for (size_t idx = 0; idx < m_allNamedTransforms.size(); ++idx)
+        {
+            indexNamedTransform(idx);
+        }
+    }
+
     enum InactiveType
     {
         INACTIVE_COLORSPACE =0,
@@ -528,14 +600,10 @@ public:
 
     ConstViewTransformRcPtr getViewTransform(const char * name) const noexcept
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & vt : m_viewTransforms)
+        const auto it = m_viewTransformIndex.find(StringUtils::Lower(name));
+        if (it != m_viewTransformIndex.end())
         {
-            if (StringUtils::Lower(vt->getName()) == namelower)
-            {
-                return vt;
-            }
+            return m_viewTransforms[it->second];
         }
 
         return ConstViewTransformRcPtr();
@@ -543,14 +611,10 @@ public:
 
     ConstLookRcPtr getLook(const char * name) const
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & look : m_looksList)
+        const auto it = m_lookIndex.find(StringUtils::Lower(name));
+        if (it != m_lookIndex.end())
         {
-            if (StringUtils::Lower(look->getName()) == namelower)
-            {
-                return look;
-            }
+            return m_looksList[it->second];
         }
 
         return ConstLookRcPtr();
@@ -921,6 +985,76 @@ public:
 
     }
 
+    ProcessorRcPtr createProcessor(const Config & config,
+                                   const ConstContextRcPtr & context,
+                                   const ConstTransformRcPtr & transform,
+                                   TransformDirection direction) const
+    {
+        ProcessorRcPtr processor = Processor::Create();
+        processor->getImpl()->setProcessorCacheFlags(m_cacheFlags);
+        processor->getImpl()->setTransform(config, context, transform, direction);
+        processor->getImpl()->computeMetadata();
+        return processor;
+    }
+
+    std::size_t getProcessorCacheKey(const Config & config,
+                                     const ConstContextRcPtr & context,
+                                     const ConstTransformRcPtr & transform,
+                                     TransformDirection direction) const
+    {
+        // The goal of the usedContext is to only contain the context vars that are actually used
+        // for this transform.  This allows the cache to be more efficient. However, there are
+        // still some various TODOs since the usedContext will sometimes contain more vars than
+        // are needed.
+
+        ContextRcPtr usedContext = Context::Create();
+        usedContext->setSearchPath(context->getSearchPath());
+        usedContext->setWorkingDir(context->getWorkingDir());
+        usedContext->setConfigIOProxy(context->getConfigIOProxy());
+
+        const bool needContextVariables
+            = CollectContextVariables(config, *context, transform, usedContext);
+
+        // Note that the key includes a string description of the transform which does not
+        // include all the LUT entries (just the arguments of the FileTransforms for LUTs).
+        std::ostringstream oss;
+        oss << (needContextVariables ? std::string(usedContext->getCacheID()) : "")
+            << *transform
+            << direction;
+
+        return std::hash<std::string>{}(oss.str());
+    }
+
+    // Get the processor from the cache, or null.  The processor cache lock must be held.
+    ProcessorRcPtr getCachedProcessor(std::size_t key) const
+    {
+        // Drop the processors using files which changed on disk.
+        if (IsFileCacheValidationEnabled())
+        {
+            ProcessorRcPtr & processor = m_processorCache[key];
+            if (processor && processor->getImpl()->hasChangedFiles())
+            {
+                processor.reset();
+            }
+        }
+        else if (m_processorFileChangeCount != GetFileChangeCount())
+        {
+            m_processorFileChangeCount = GetFileChangeCount();
+            for (auto & entry : m_processorCache)
+            {
+                if (entry.second && entry.second->getImpl()->hasChangedFiles())
+                {
+                    entry.second.reset();
+                }
+            }
+        }
+
+        // As the entry is a shared pointer instance, having an empty one means that the entry
+        // does not exist in the cache. So, it provides a fast existence check & access in one
+        // call.
+        return m_processorCache[key];
+    }
+
     ProcessorCacheFlags getProcessorCacheFlags() const noexcept
     {
         return m_cacheFlags;
@@ -3284,13 +3418,16 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
         NamedTransformRcPtr copy = nt->createEditableCopy();
         ConstNamedTransformRcPtr namedTransformCopy = copy;
         // Safe to swap, copy is not used after.
+        getImpl()->unindexNamedTransform(replaceIdx);
         getImpl()->m_allNamedTransforms[replaceIdx].swap(namedTransformCopy);
+        getImpl()->indexNamedTransform(replaceIdx);
     }
     else
     {
         NamedTransformRcPtr copy = nt->createEditableCopy();
         ConstNamedTransformRcPtr namedTransformCopy = copy;
         getImpl()->m_allNamedTransforms.push_back(namedTransformCopy);
+        getImpl()->indexNamedTransform(getImpl()->m_allNamedTransforms.size() - 1);
     }
 
     getImpl()->resetCacheIDs();
@@ -3302,15 +3439,18 @@ void Config::removeNamedTransform(const char * name)
     const std::string nameToSearch = StringUtils::Lower(name);
     if (nameToSearch.empty()) return;
 
-    for (auto itr = getImpl()->m_allNamedTransforms.begin(); itr != getImpl()->m_allNamedTransforms.end(); ++itr)
+    // Only a named transform name (i.e. not an alias) removes the named transform.
+    const auto it = getImpl()->m_namedTransformIndex.find(nameToSearch);
+    if (it == getImpl()->m_namedTransformIndex.end()
+        || !StringUtils::Compare(getImpl()->m_allNamedTransforms[it->second]->getName(),
+                                 nameToSearch))
     {
-        if (StringUtils::Lower((*itr)->getName()) == nameToSearch)
-        {
-            getImpl()->m_allNamedTransforms.erase(itr);
-            return;
-        }
+        return;
     }
 
+    getImpl()->m_allNamedTransforms.erase(getImpl()->m_allNamedTransforms.begin() + it->second);
+    getImpl()->rebuildNamedTransformIndex();
+
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
@@ -3319,6 +3459,7 @@ void Config::removeNamedTransform(const char * name)
 void Config::clearNamedTransforms()
 {
     getImpl()->m_allNamedTransforms.clear();
+    getImpl()->m_namedTransformIndex.clear();
 
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
@@ -4491,20 +4632,19 @@ void Config::addLook(const ConstLookRcPtr & look)
     const std::string namelower = StringUtils::Lower(name);
 
     // If the look exists, replace it
-    for(unsigned int i=0; i<getImpl()->m_looksList.size(); ++i)
+    const auto it = getImpl()->m_lookIndex.find(namelower);
+    if (it != getImpl()->m_lookIndex.end())
     {
-        if(StringUtils::Lower(getImpl()->m_looksList[i]->getName()) == namelower)
-        {
-            getImpl()->m_looksList[i] = look->createEditableCopy();
+        getImpl()->m_looksList[it->second] = look->createEditableCopy();
 
-            AutoMutex lock(getImpl()->m_cacheidMutex);
-            getImpl()->resetCacheIDs();
+        AutoMutex lock(getImpl()->m_cacheidMutex);
+        getImpl()->resetCacheIDs();
 
-            return;
-        }
+        return;
     }
 
     // Otherwise, add it
+    getImpl()->m_lookIndex.emplace(namelower, getImpl()->m_looksList.size());
     getImpl()->m_looksList.push_back(look->createEditableCopy());
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -4514,6 +4654,7 @@ void Config::addLook(const ConstLookRcPtr & look)
 void Config::clearLooks()
 {
     getImpl()->m_looksList.clear();
+    getImpl()->m_lookIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4599,22 +4740,16 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
 
     const std::string namelower = StringUtils::Lower(name);
 
-    bool addIt = true;
-
     // If the view transform exists, replace it.
-    for (auto && vt : getImpl()->m_viewTransforms)
+    const auto it = getImpl()->m_viewTransformIndex.find(namelower);
+    if (it != getImpl()->m_viewTransformIndex.end())
     {
-        if (StringUtils::Lower(vt->getName()) == namelower)
-        {
-            vt = viewTransform->createEditableCopy();
-            addIt = false;
-            break;
-        }
+        getImpl()->m_viewTransforms[it->second] = viewTransform->createEditableCopy();
     }
-
     // Otherwise, add it.
-    if (addIt)
+    else
     {
+        getImpl()->m_viewTransformIndex.emplace(namelower, getImpl()->m_viewTransforms.size());
         getImpl()->m_viewTransforms.push_back(viewTransform->createEditableCopy());
     }
 
@@ -4625,6 +4760,7 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
 void Config::clearViewTransforms()
 {
     getImpl()->m_viewTransforms.clear();
+    getImpl()->m_viewTransformIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4794,51 +4930,66 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
         throw Exception("Config::GetProcessor failed. Transform is null.");
     }
 
+    if (!getImpl()->m_processorCache.isEnabled())
+    {
+        return getImpl()->createProcessor(*this, context, transform, direction);
+    }
 
-    // The goal of the usedContext is to only contain the context vars that are actually used for
-    // this transform.  This allows the cache to be more efficient. However, there are still some
-    // various TODOs since the usedContext will sometimes contain more vars than are needed.
+    const std::size_t key = getImpl()->getProcessorCacheKey(*this, context, transform, direction);
 
-    ContextRcPtr usedContext = Context::Create();
-    usedContext->setSearchPath(context->getSearchPath());
-    usedContext->setWorkingDir(context->getWorkingDir());
-    usedContext->setConfigIOProxy(context->getConfigIOProxy());
+    // Only one thread builds a given processor, the concurrent requests for the same cache entry
+    // wait for its result.
+    std::shared_ptr<Impl::ProcessorBuild> build;
+    bool buildHere = false;
+    {
+        AutoMutex guard(getImpl()->m_processorCache.lock());
 
-    const bool needContextVariables = CollectContextVariables(*this, *context, transform, usedContext);
+        ProcessorRcPtr processor = getImpl()->getCachedProcessor(key);
+        if (processor)
+        {
+            return processor;
+        }
+
+        std::shared_ptr<Impl::ProcessorBuild> & entry = getImpl()->m_processorBuilds[key];
+        if (!entry)
+        {
+            entry = std::make_shared<Impl::ProcessorBuild>();
+            buildHere = true;
+        }
+        build = entry;
+    }
 
-    // Create helper method.
-    auto CreateProcessor = [](const Config & config, 
-                              const ConstContextRcPtr & context,
-                              const ConstTransformRcPtr & transform,
-                              TransformDirection direction) -> ProcessorRcPtr
+    if (!buildHere)
     {
-        ProcessorRcPtr processor = Processor::Create();
-        processor->getImpl()->setProcessorCacheFlags(config.getImpl()->m_cacheFlags);
-        processor->getImpl()->setTransform(config, context, transform, direction);
-        processor->getImpl()->computeMetadata();
-        return processor;
-    };
+        return build->wait();
+    }
 
-    if (getImpl()->m_processorCache.isEnabled())
+    // The processor is built without holding the cache lock so that other threads (e.g. a
+    // ProcessorPrewarm) can still get or build unrelated processors in the meantime.
+    ProcessorRcPtr proc;
+    try
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
+        proc = getImpl()->createProcessor(*this, context, transform, direction);
+    }
+    catch (...)
+    {
+        {
+            AutoMutex guard(getImpl()->m_processorCache.lock());
+            getImpl()->m_processorBuilds.erase(key);
+        }
+        build->finish(ProcessorRcPtr(), std::current_exception());
+        throw;
+    }
 
-        // Note that the key includes a string description of the transform which does not include
-        // all the LUT entries (just the arguments of the FileTransforms for LUTs).
-        std::ostringstream oss;
-        oss << (needContextVariables ? std::string(usedContext->getCacheID()) : "")
-            << *transform
-            << direction;
+    ProcessorRcPtr processor;
+    {
+        AutoMutex guard(getImpl()->m_processorCache.lock());
 
-        const std::size_t key = std::hash<std::string>{}(oss.str());
+        getImpl()->m_processorBuilds.erase(key);
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
+        processor = getImpl()->m_processorCache[key];
         if (!processor)
         {
-            ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
-
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
             if (doFallback)
             {
@@ -4868,14 +5019,85 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
             {
                 processor = proc;
             }
+
+            getImpl()->m_processorCache[key] = processor;
         }
+    }
 
-        return processor;
+    build->finish(processor, nullptr);
+
+    return processor;
+}
+
+ProcessorRequestRcPtr Config::GetProcessorAsync(const ConstConfigRcPtr & config,
+                                                const ConstContextRcPtr & context,
+                                                const ConstTransformRcPtr & transform,
+                                                TransformDirection direction,
+                                                const ProcessorCallback & callback)
+{
+    if (!config)
+    {
+        throw Exception("Config::GetProcessorAsync failed. Config is null.");
     }
-    else
+
+    if (!context)
+    {
+        throw Exception("Config::GetProcessorAsync failed. Context is null.");
+    }
+
+    if (!transform)
     {
-        return CreateProcessor(*this, context, transform, direction);
+        throw Exception("Config::GetProcessorAsync failed. Transform is null.");
     }
+
+    ProcessorRequestRcPtr request(new ProcessorRequest(), &ProcessorRequest::deleter);
+    auto state = request->getImpl()->m_state;
+    state->setCallback(callback);
+
+    // The request is immediately ready when the processor is already in the cache.
+    if (config->getImpl()->m_processorCache.isEnabled())
+    {
+        const std::size_t key
+            = config->getImpl()->getProcessorCacheKey(*config, context, transform, direction);
+
+        ProcessorRcPtr processor;
+        {
+            AutoMutex guard(config->getImpl()->m_processorCache.lock());
+            processor = config->getImpl()->getCachedProcessor(key);
+        }
+
+        if (processor)
+        {
+            state->setValue(processor);
+            return request;
+        }
+    }
+
+    // The transform could be changed by the caller in the meantime.
+    ConstTransformRcPtr transformCopy = transform->createEditableCopy();
+
+    RunAsyncRequest<ConstProcessorRcPtr>(state, [config, context, transformCopy, direction]()
+    {
+        return config->getProcessor(context, transformCopy, direction);
+    });
+
+    return request;
+}
+
+ProcessorRequestRcPtr Config::GetProcessorAsync(const ConstConfigRcPtr & config,
+                                                const ConstContextRcPtr & context,
+                                                const char * srcColorSpaceName,
+                                                const char * display,
+                                                const char * view,
+                                                TransformDirection direction,
+                                                const ProcessorCallback & callback)
+{
+    auto dt = DisplayViewTransform::Create();
+    dt->setSrc(srcColorSpaceName);
+    dt->setDisplay(display);
+    dt->setView(view);
+    dt->validate();
+    return GetProcessorAsync(config, context, dt, direction, callback);
 }
 
 ConstProcessorRcPtr Config::GetProcessorFromConfigs(const ConstConfigRcPtr & srcConfig,
@@ -5247,6 +5469,27 @@ const char * Config::getCacheID(const ConstContextRcPtr & context) const
     std::string contextcacheid;
     if(context) contextcacheid = context->getCacheID();
 
+    // Drop the cache ids using files which changed on disk.
+    if (IsFileCacheValidationEnabled())
+    {
+        auto iter = getImpl()->m_cacheidFileRevisions.find(contextcacheid);
+        if (iter != getImpl()->m_cacheidFileRevisions.end() && HasChangedFiles(iter->second))
+        {
+            getImpl()->m_cacheids.erase(contextcacheid);
+        }
+    }
+    else if (getImpl()->m_cacheidFileChangeCount != GetFileChangeCount())
+    {
+        getImpl()->m_cacheidFileChangeCount = GetFileChangeCount();
+        for (const auto & entry : getImpl()->m_cacheidFileRevisions)
+        {
+            if (HasChangedFiles(entry.second))
+            {
+                getImpl()->m_cacheids.erase(entry.first);
+            }
+        }
+    }
+
     StringMap::const_iterator cacheiditer = getImpl()->m_cacheids.find(contextcacheid);
     if(cacheiditer != getImpl()->m_cacheids.end())
     {
@@ -5264,6 +5507,7 @@ const char * Config::getCacheID(const ConstContextRcPtr & context) const
 
     // Also include all file references, using the context (if specified)
     std::string fileReferencesFastHash;
+    FileRevisionVec fileRevisions;
     if(context)
     {
         std::ostringstream filehash;
@@ -5286,7 +5530,17 @@ const char * Config::getCacheID(const ConstContextRcPtr & context) const
             try
             {
                 const std::string resolvedLocation = context->resolveFileLocation(iter.c_str());
-                filehash << GetFastFileHash(resolvedLocation, *context) << " ";
+                filehash << GetFastFileHash(resolvedLocation, *context);
+
+                // A file could change without changing its fast hash (e.g. the same inode).
+                const unsigned revision = GetFileRevision(resolvedLocation);
+                if (revision > 0)
+                {
+                    filehash << "@" << revision;
+                }
+                filehash << " ";
+
+                fileRevisions.emplace_back(resolvedLocation, revision);
             }
             catch(...)
             {
@@ -5299,6 +5553,7 @@ const char * Config::getCacheID(const ConstContextRcPtr & context) const
         fileReferencesFastHash = CacheIDHash(fullstr.c_str(), fullstr.size());
     }
 
+    getImpl()->m_cacheidFileRevisions[contextcacheid] = fileRevisions;
     getImpl()->m_cacheids[contextcacheid] = getImpl()->m_cacheidnocontext + ":" + fileReferencesFastHash;
     return getImpl()->m_cacheids[contextcacheid].c_str();
 }
@@ -5457,6 +5712,7 @@ void Config::Impl::resetCacheIDs()
 {
     m_cacheids.clear();
     m_cacheidnocontext = "";
+    m_cacheidFileRevisions.clear();
     m_validation = VALIDATION_UNKNOWN;
     m_validationtext = "";
 
@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <bitset>
 #include <cctype>
 #include <cstring>
 #include <map>
@@ -292,6 +293,266 @@ void ValidateRegularExpression(const char * filePathPattern, const char * fileNa
 
 }
 
+// Matcher compiled from the regular expression built for a glob rule (refer to
+// BuildRegularExpression()) or from a simple regex rule. Only the subset of the ECMAScript
+// grammar produced by the glob conversion is supported i.e. literals, escaped literals, '.',
+// '.*' and bracket expressions.
+// The matching simulates the corresponding automaton using a bit-parallel (i.e. shift-and)
+// algorithm so a path is processed in one pass without any backtracking.
+class GlobMatcher
+{
+public:
+    GlobMatcher() = default;
+    GlobMatcher(const GlobMatcher &) = delete;
+    GlobMatcher & operator=(const GlobMatcher &) = delete;
+
+    // Return false if the expression is not in the supported subset.
+    bool compile(const std::string & regex);
+
+    bool matches(const char * path) const;
+
+private:
+    typedef std::bitset<256> CharSet;
+
+    // A token matches either one character from a set, or any sequence of characters from a
+    // set (i.e. a '.*').
+    struct Token
+    {
+        CharSet m_chars;
+        bool m_repeat = false;
+    };
+
+    // The automaton state 'k' means that the k first tokens are matched so the states fit in a
+    // 64-bit mask.
+    static constexpr size_t MaxTokens = 63;
+
+    uint64_t closure(uint64_t states) const noexcept
+    {
+        // Repeated tokens also match an empty sequence.
+        for (size_t idx = 0; idx < m_maxRepeatRun; ++idx)
+        {
+            states |= (states & m_repeatMask) << 1;
+        }
+        return states;
+    }
+
+    uint64_t m_stepMasks[256] = {}; // Tokens matching a character.
+    uint64_t m_loopMasks[256] = {}; // States looping on a character i.e. after a '.*'.
+    uint64_t m_repeatMask     = 0;  // Repeated tokens.
+    uint64_t m_acceptState    = 0;
+    size_t   m_maxRepeatRun   = 0;  // Max number of consecutive repeated tokens.
+
+    // Fast rejection of the paths which are too short or with a non-matching ending (i.e. the
+    // extension in most cases).
+    size_t m_minLength = 0;
+    bool m_fixedLength = true;
+    std::vector<CharSet> m_suffix;
+};
+
+bool GlobMatcher::compile(const std::string & regex)
+{
+    // Characters escaped by the glob conversion.
+    static const std::string escapedChars{ ".+^${}()|[]\\*?" };
+
+    // Refer to the ECMAScript definition of the '.' i.e. excludes the line terminators.
+    CharSet anyChar;
+    anyChar.set();
+    anyChar.reset('\n');
+    anyChar.reset('\r');
+
+    std::vector<Token> tokens;
+
+    const size_t size = regex.size();
+    size_t idx = 0;
+    while (idx < size)
+    {
+        const char c = regex[idx];
+
+        Token token;
+        if ((c == '^' && idx == 0) || (c == '$' && idx + 1 == size) || c == '(' || c == ')')
+        {
+            // Anchors & groups (without any alternative) do not change the matching.
+            ++idx;
+            continue;
+        }
+        else if (c == '.')
+        {
+            token.m_chars = anyChar;
+            if (idx + 1 < size && regex[idx + 1] == '*')
+            {
+                token.m_repeat = true;
+                ++idx;
+            }
+            ++idx;
+        }
+        else if (c == '\\')
+        {
+            if (idx + 1 >= size || escapedChars.find(regex[idx + 1]) == std::string::npos)
+            {
+                return false;
+            }
+            token.m_chars.set(static_cast<unsigned char>(regex[idx + 1]));
+            idx += 2;
+        }
+        else if (c == '[')
+        {
+            ++idx;
+            const bool negate = idx < size && regex[idx] == '^';
+            if (negate)
+            {
+                ++idx;
+            }
+
+            bool closed = false;
+            while (idx < size && !closed)
+            {
+                unsigned char first = static_cast<unsigned char>(regex[idx]);
+                if (first == ']')
+                {
+                    closed = true;
+                    ++idx;
+                    continue;
+                }
+                if (first == '\\')
+                {
+                    if (idx + 1 >= size || escapedChars.find(regex[idx + 1]) == std::string::npos)
+                    {
+                        return false;
+                    }
+                    first = static_cast<unsigned char>(regex[++idx]);
+                }
+                ++idx;
+
+                unsigned char last = first;
+                if (idx + 1 < size && regex[idx] == '-' && regex[idx + 1] != ']')
+                {
+                    last = static_cast<unsigned char>(regex[idx + 1]);
+                    if (last == '\\')
+                    {
+                        if (idx + 2 >= size 
+                            || escapedChars.find(regex[idx + 2]) == std::string::npos)
+                        {
+                            return false;
+                        }
+                        last = static_cast<unsigned char>(regex[idx + 2]);
+                        ++idx;
+                    }
+                    idx += 2;
+                    if (last < first)
+                    {
+                        return false;
+                    }
+                }
+
+                for (unsigned ch = first; ch <= last; ++ch)
+                {
+                    token.m_chars.set(ch);
+                }
+            }
+
+            if (!closed || token.m_chars.none())
+            {
+                return false;
+            }
+            if (negate)
+            {
+                token.m_chars.flip();
+            }
+        }
+        else if (c == '*' || c == '+' || c == '?' || c == '{' || c == '}' || c == '|' 
+                 || c == ']' || c == '^' || c == '$')
+        {
+            // Quantifiers, alternatives & anchors are not supported.
+            return false;
+        }
+        else
+        {
+            token.m_chars.set(static_cast<unsigned char>(c));
+            ++idx;
+        }
+
+        if (idx < size && (regex[idx] == '*' || regex[idx] == '+' || regex[idx] == '?' 
+                           || regex[idx] == '{'))
+        {
+            return false;
+        }
+
+        tokens.push_back(token);
+    }
+
+    if (tokens.size() > MaxTokens)
+    {
+        return false;
+    }
+
+    // Build the automaton.
+
+    size_t repeatRun = 0;
+    for (size_t tok = 0; tok < tokens.size(); ++tok)
+    {
+        const Token & token = tokens[tok];
+        if (token.m_repeat)
+        {
+            m_repeatMask |= uint64_t(1) << tok;
+            m_maxRepeatRun = std::max(m_maxRepeatRun, ++repeatRun);
+            m_fixedLength = false;
+            m_suffix.clear();
+        }
+        else
+        {
+            repeatRun = 0;
+            ++m_minLength;
+            m_suffix.push_back(token.m_chars);
+        }
+
+        for (unsigned ch = 0; ch < 256; ++ch)
+        {
+            if (token.m_chars.test(ch))
+            {
+                if (token.m_repeat)
+                {
+                    m_loopMasks[ch] |= uint64_t(1) << (tok + 1);
+                }
+                else
+                {
+                    m_stepMasks[ch] |= uint64_t(1) << tok;
+                }
+            }
+        }
+    }
+
+    m_acceptState = uint64_t(1) << tokens.size();
+
+    return true;
+}
+
+bool GlobMatcher::matches(const char * path) const
+{
+    const size_t length = std::strlen(path);
+    if (length < m_minLength || (m_fixedLength && length != m_minLength))
+    {
+        return false;
+    }
+
+    for (size_t idx = 0; idx < m_suffix.size(); ++idx)
+    {
+        const unsigned char c = static_cast<unsigned char>(path[length - m_suffix.size() + idx]);
+        if (!m_suffix[idx].test(c))
+        {
+            return false;
+        }
+    }
+
+    uint64_t states = closure(1);
+    for (size_t idx = 0; idx < length && states; ++idx)
+    {
+        const unsigned char c = static_cast<unsigned char>(path[idx]);
+        states = closure(((states & m_stepMasks[c]) << 1) | (states & m_loopMasks[c]));
+    }
+
+    return (states & m_acceptState) != 0;
+}
+
 class FileRule
 {
 public:
@@ -329,6 +590,7 @@ public:
             m_pattern   = "*";
             m_extension = "*";
             m_type      = FILE_RULE_GLOB;
+            compile();
         }
     }
 
@@ -342,6 +604,8 @@ public:
         rule->m_extension  = m_extension;
         rule->m_regex      = m_regex;
         rule->m_type       = m_type;
+        rule->m_matcher    = m_matcher;
+        rule->m_compiledRegex = m_compiledRegex;
 
         return rule;
     }
@@ -380,6 +644,7 @@ public:
             m_pattern = pattern;
             m_regex = "";
             m_type = FILE_RULE_GLOB;
+            compile();
         }
     }
 
@@ -412,6 +677,7 @@ public:
             m_extension = extension;
             m_regex = "";
             m_type = FILE_RULE_GLOB;
+            compile();
         }
     }
 
@@ -441,6 +707,7 @@ public:
             m_pattern = "";
             m_extension = "";
             m_type = FILE_RULE_REGEX;
+            compile();
         }
     }
 
@@ -488,21 +755,24 @@ public:
             return false;
         }
         case FILE_RULE_REGEX:
-        {
-            const std::regex reg(m_regex.c_str());
-            return regex_match(path, reg);
-        }
         case FILE_RULE_GLOB:
         {
-            const std::string exp = BuildRegularExpression(m_pattern.c_str(),
-                                                           m_extension.c_str());
-            const std::regex reg(exp.c_str());
-            return regex_match(path, reg);
+            if (m_matcher)
+            {
+                return m_matcher->matches(path);
+            }
+            return regex_match(path, *m_compiledRegex);
         }
         }
         return false;
     }
 
+    // True if the matching depends on the config i.e. on its color spaces.
+    bool dependsOnConfig() const noexcept
+    {
+        return m_type == FILE_RULE_PARSE_FILEPATH;
+    }
+
     void validate(const Config & cfg) const
     {
         if (m_type != FILE_RULE_PARSE_FILEPATH)
@@ -532,6 +802,33 @@ private:
     std::string m_extension;
     std::string m_regex;
     RuleType m_type{ FILE_RULE_GLOB };
+
+    // The rules are compiled once, into a matcher when possible (i.e. always for the glob
+    // rules in practice) or else into a std::regex.
+    std::shared_ptr<const GlobMatcher> m_matcher;
+    std::shared_ptr<const std::regex> m_compiledRegex;
+
+    // Note that the pattern, extension or regex are already validated.
+    void compile()
+    {
+        m_matcher.reset();
+        m_compiledRegex.reset();
+
+        const std::string exp 
+            = m_type == FILE_RULE_GLOB ? BuildRegularExpression(m_pattern.c_str(),
+                                                                m_extension.c_str())
+                                       : m_regex;
+
+        // Simple regular expressions (e.g. '.*\\.exr') also use the matcher.
+        auto matcher = std::make_shared<GlobMatcher>();
+        if (matcher->compile(exp))
+        {
+            m_matcher = matcher;
+            return;
+        }
+
+        m_compiledRegex = std::make_shared<const std::regex>(exp);
+    }
 };
 
 FileRules::FileRules()
@@ -579,11 +876,19 @@ FileRules::Impl & FileRules::Impl::operator=(const FileRules::Impl & rhs)
         {
             m_rules.push_back(rule->clone());
         }
+
+        clearRuleIndexCache();
     }
 
     return *this;
 }
 
+void FileRules::Impl::clearRuleIndexCache()
+{
+    AutoMutex guard(m_ruleIndexCacheMutex);
+    m_ruleIndexCache.clear();
+}
+
 void FileRules::Impl::validatePosition(size_t ruleIndex, DefaultAllowed allowDefault) const
 {
     const auto numRules = m_rules.size();
@@ -632,11 +937,39 @@ void FileRules::Impl::validateNewRule(size_t ruleIndex, const char * name) const
 const char * FileRules::Impl::getRuleFromFilepath(const Config & config, const char * filePath,
                                                   size_t & ruleIndex) const
 {
+    // Bound the memory used by the cache of the rule indices.
+    static constexpr size_t MaxCachedFilepaths = 16384;
+
+    const std::string path(filePath);
+    {
+        AutoMutex guard(m_ruleIndexCacheMutex);
+        const auto entry = m_ruleIndexCache.find(path);
+        if (entry != m_ruleIndexCache.end())
+        {
+            ruleIndex = entry->second;
+            return m_rules[ruleIndex]->getColorSpace();
+        }
+    }
+
+    bool dependsOnConfig = false;
+
     const auto numRules = m_rules.size();
     for (size_t i = 0; i < numRules; ++i)
     {
+        dependsOnConfig = dependsOnConfig || m_rules[i]->dependsOnConfig();
+
         if (m_rules[i]->matches(config, filePath))
         {
+            if (!dependsOnConfig)
+            {
+                AutoMutex guard(m_ruleIndexCacheMutex);
+                if (m_ruleIndexCache.size() >= MaxCachedFilepaths)
+                {
+                    m_ruleIndexCache.clear();
+                }
+                m_ruleIndexCache.emplace(path, i);
+            }
+
             ruleIndex = i;
             return m_rules[i]->getColorSpace();
         }
@@ -659,6 +992,8 @@ void FileRules::Impl::moveRule(size_t ruleIndex, int offset)
     auto rule = m_rules[ruleIndex];
     m_rules.erase(m_rules.begin() + ruleIndex);
     m_rules.insert(m_rules.begin() + newIndex, rule);
+
+    clearRuleIndexCache();
 }
 
 
@@ -721,6 +1056,7 @@ void FileRules::setPattern(size_t ruleIndex, const char * pattern)
 {
     m_impl->validatePosition(ruleIndex, Impl::DEFAULT_NOT_ALLOWED);
     m_impl->m_rules[ruleIndex]->setPattern(pattern);
+    m_impl->clearRuleIndexCache();
 }
 
 const char * FileRules::getExtension(size_t ruleIndex) const
@@ -733,6 +1069,7 @@ void FileRules::setExtension(size_t ruleIndex, const char * extension)
 {
     m_impl->validatePosition(ruleIndex, Impl::DEFAULT_NOT_ALLOWED);
     m_impl->m_rules[ruleIndex]->setExtension(extension);
+    m_impl->clearRuleIndexCache();
 }
 
 const char * FileRules::getRegex(size_t ruleIndex) const
@@ -745,6 +1082,7 @@ void FileRules::setRegex(size_t ruleIndex, const char * regex)
 {
     m_impl->validatePosition(ruleIndex, Impl::DEFAULT_NOT_ALLOWED);
     m_impl->m_rules[ruleIndex]->setRegex(regex);
+    m_impl->clearRuleIndexCache();
 }
 
 // Color space or role.
@@ -828,6 +1166,7 @@ void FileRules::insertRule(size_t ruleIndex, const char * name, const char * col
     newRule->setPattern(pattern);
     newRule->setExtension(extension);
     m_impl->m_rules.insert(m_impl->m_rules.begin() + ruleIndex, newRule);
+    m_impl->clearRuleIndexCache();
 }
 
 void FileRules::insertRule(size_t ruleIndex, const char * name, const char * colorSpace,
@@ -841,6 +1180,7 @@ void FileRules::insertRule(size_t ruleIndex, const char * name, const char * col
     newRule->setColorSpace(colorSpace);
     newRule->setRegex(regex);
     m_impl->m_rules.insert(m_impl->m_rules.begin() + ruleIndex, newRule);
+    m_impl->clearRuleIndexCache();
 }
 
 void FileRules::insertPathSearchRule(size_t ruleIndex)
@@ -857,6 +1197,7 @@ void FileRules::removeRule(size_t ruleIndex)
 {
     m_impl->validatePosition(ruleIndex, Impl::DEFAULT_NOT_ALLOWED);
     m_impl->m_rules.erase(m_impl->m_rules.begin() + ruleIndex);
+    m_impl->clearRuleIndexCache();
 }
 
 void FileRules::increaseRulePriority(size_t ruleIndex)
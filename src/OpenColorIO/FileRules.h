@@ -6,9 +6,13 @@
 #define INCLUDED_OCIO_FILERULES_H
 
 #include <functional>
+#include <string>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Mutex.h"
+
 
 namespace OCIO_NAMESPACE
 {
@@ -61,12 +65,20 @@ public:
 
     void validate(const Config & cfg) const;
 
+    // To be called when the rules matching the file paths change.
+    void clearRuleIndexCache();
+
 private:
 
     friend class FileRules;
 
     // All rules, default rule always at the end.
     std::vector<FileRuleRcPtr> m_rules;
+
+    // Memoized rule indices of the file paths. The file paths only matched by (or after) the
+    // ColorSpaceNamePathSearch rule are not memoized as the result depends on the config.
+    mutable std::unordered_map<std::string, size_t> m_ruleIndexCache;
+    mutable Mutex m_ruleIndexCacheMutex;
 };
 
 
@@ -3,6 +3,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -11,6 +13,8 @@
 
 #include "DynamicProperty.h"
 #include "GpuShader.h"
+#include "HashUtils.h"
+#include "Mutex.h"
 #include "ops/lut3d/Lut3DOpData.h"
 #include "Platform.h"
 
@@ -20,10 +24,23 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
-static void  CreateArray(const float * buf,
-                         unsigned w, unsigned h, unsigned d,
-                         GpuShaderDesc::TextureType type,
-                         std::vector<float> & res)
+typedef std::vector<float> TextureValues;
+typedef OCIO_SHARED_PTR<const TextureValues> ConstTextureValuesRcPtr;
+
+// Registry of the texture payloads alive in the process. It only holds weak references so
+// payloads are released with the last shader description using them.
+typedef std::map<std::string, std::weak_ptr<const TextureValues>> TextureValuesRegistry;
+
+Mutex g_textureValuesMutex;
+TextureValuesRegistry g_textureValues;
+
+// Return the payload matching the buffer content i.e. identical LUTs (from different shader
+// descriptions, processors or clones) share the same immutable payload instead of each holding
+// its own copy. The payload content hash is returned in cacheID.
+ConstTextureValuesRcPtr CreateArray(const float * buf,
+                                    unsigned w, unsigned h, unsigned d,
+                                    GpuShaderDesc::TextureType type,
+                                    std::string & cacheID)
 {
     if(buf==nullptr)
     {
@@ -32,8 +49,32 @@ static void  CreateArray(const float * buf,
 
     const size_t size
         = w * h * d * (type==GpuShaderDesc::TEXTURE_RGB_CHANNEL ? 3 : 1);
-    res.resize(size);
-    std::memcpy(&res[0], buf, size * sizeof(float));
+
+    cacheID = CacheIDHash(reinterpret_cast<const char *>(buf), size * sizeof(float));
+
+    AutoMutex guard(g_textureValuesMutex);
+
+    auto it = g_textureValues.find(cacheID);
+    if (it != g_textureValues.end())
+    {
+        ConstTextureValuesRcPtr values = it->second.lock();
+        if (values && values->size() == size
+            && std::memcmp(values->data(), buf, size * sizeof(float)) == 0)
+        {
+            return values;
+        }
+    }
+
+    // Purge the released payloads before registering the new one.
+    for (auto entry = g_textureValues.begin(); entry != g_textureValues.end(); )
+    {
+        entry = entry->second.expired() ? g_textureValues.erase(entry) : std::next(entry);
+    }
+
+    ConstTextureValuesRcPtr values = std::make_shared<const TextureValues>(buf, buf + size);
+    g_textureValues[cacheID] = values;
+
+    return values;
 }
 
 std::size_t alignOffset(std::size_t offset, std::size_t alignment)
@@ -99,10 +140,10 @@ public:
                 throw Exception(ss.str().c_str());
             }
 
-            // An unfortunate copy is mandatory to allow the creation of a GPU shader cache.
-            // The cache needs a decoupling of the processor and shader instances forbidding
-            // shared naked pointer usage.
-            CreateArray(v, m_width, m_height, m_depth, m_type, m_values);
+            // The shader instance cannot keep a naked pointer to the processor data (to allow
+            // a GPU shader cache) so it holds a reference-counted immutable payload instead,
+            // shared by all the textures having the same content.
+            m_values = CreateArray(v, m_width, m_height, m_depth, m_type, m_cacheID);
         }
 
         std::string m_textureName;
@@ -114,7 +155,9 @@ public:
         unsigned m_dimensions;
         Interpolation m_interp;
 
-        std::vector<float> m_values;
+        ConstTextureValuesRcPtr m_values;
+        // Hash of the texture values.
+        std::string m_cacheID;
 
         Texture() = delete;
     };
@@ -265,7 +308,20 @@ public:
         }
 
         const Texture & t = m_textures[index];
-        values   = &t.m_values[0];
+        values   = t.m_values->data();
+    }
+
+    const char * getTextureCacheID(unsigned index) const
+    {
+        if(index >= m_textures.size())
+        {
+            std::ostringstream ss;
+            ss << "1D LUT access error: index = " << index
+               << " where size = " << m_textures.size();
+            throw Exception(ss.str().c_str());
+        }
+
+        return m_textures[index].m_cacheID.c_str();
     }
 
     unsigned add3DTexture(const char * textureName,
@@ -322,7 +378,20 @@ public:
         }
 
         const Texture & t = m_textures3D[index];
-        values = &t.m_values[0];
+        values = t.m_values->data();
+    }
+
+    const char * get3DTextureCacheID(unsigned index) const
+    {
+        if(index >= m_textures3D.size())
+        {
+            std::ostringstream ss;
+            ss << "3D LUT access error: index = " << index
+               << " where size = " << m_textures3D.size();
+            throw Exception(ss.str().c_str());
+        }
+
+        return m_textures3D[index].m_cacheID.c_str();
     }
 
     unsigned getNumUniforms() const
@@ -418,6 +487,28 @@ public:
     {
         return m_uniformBufferSize;
     }
+
+    bool isEmpty() const
+    {
+        return m_textures.empty() && m_textures3D.empty() && m_uniforms.empty();
+    }
+
+    void copyFrom(const PrivateImpl & rhs)
+    {
+        if (this != &rhs)
+        {
+            m_textures   = rhs.m_textures;
+            m_textures3D = rhs.m_textures3D;
+
+            // Uniform names are const so only copy construction is available.
+            Uniforms uniforms(rhs.m_uniforms);
+            m_uniforms.swap(uniforms);
+
+            m_max1DLUTWidth     = rhs.m_max1DLUTWidth;
+            m_allowTexture1D    = rhs.m_allowTexture1D;
+            m_uniformBufferSize = rhs.m_uniformBufferSize;
+        }
+    }
     Textures m_textures;
     Textures m_textures3D;
     Uniforms m_uniforms;
@@ -465,6 +556,17 @@ GenericGpuShaderDesc::~GenericGpuShaderDesc()
     m_implGeneric = nullptr;
 }
 
+bool GenericGpuShaderDesc::isEmpty() const noexcept
+{
+    return isCreatorEmpty() && getImplGeneric()->isEmpty();
+}
+
+void GenericGpuShaderDesc::copyFrom(const GenericGpuShaderDesc & rhs)
+{
+    copyCreatorFrom(rhs);
+    getImplGeneric()->copyFrom(*rhs.getImplGeneric());
+}
+
 unsigned GenericGpuShaderDesc::getNumUniforms() const noexcept
 {
     return getImplGeneric()->getNumUniforms();
@@ -563,6 +665,11 @@ void GenericGpuShaderDesc::getTextureValues(unsigned index, const float *& value
     getImplGeneric()->getTextureValues(index, values);
 }
 
+const char * GenericGpuShaderDesc::getTextureCacheID(unsigned index) const
+{
+    return getImplGeneric()->getTextureCacheID(index);
+}
+
 unsigned GenericGpuShaderDesc::getNum3DTextures() const noexcept
 {
     return unsigned(getImplGeneric()->m_textures3D.size());
@@ -591,6 +698,11 @@ void GenericGpuShaderDesc::get3DTextureValues(unsigned index, const float *& val
     getImplGeneric()->get3DTextureValues(index, values);
 }
 
+const char * GenericGpuShaderDesc::get3DTextureCacheID(unsigned index) const
+{
+    return getImplGeneric()->get3DTextureCacheID(index);
+}
+
 void GenericGpuShaderDesc::Deleter(GenericGpuShaderDesc* c)
 {
     delete c;
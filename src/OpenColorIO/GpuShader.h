@@ -67,6 +67,7 @@ public:
                     TextureDimensions & dimensions,
                     Interpolation & interpolation) const override;
     void getTextureValues(unsigned index, const float *& values) const override;
+    const char * getTextureCacheID(unsigned index) const override;
 
     // Accessors to the 3D textures built from 3D LUT
     //
@@ -82,6 +83,15 @@ public:
                       unsigned & edgelen,
                       Interpolation & interpolation) const override;
     void get3DTextureValues(unsigned index, const float *& value) const override;
+    const char * get3DTextureCacheID(unsigned index) const override;
+
+    // Helpers for the GPU processor shader cache (not exposed).
+    //
+    // True when nothing was extracted into the instance yet i.e. no shader code,
+    // resources, uniforms or textures.
+    bool isEmpty() const noexcept;
+    // Replace the content by a full copy of rhs including the generated shader program.
+    void copyFrom(const GenericGpuShaderDesc & rhs);
 
 private:
 
@@ -93,6 +103,10 @@ private:
 
     static void Deleter(GenericGpuShaderDesc* c);
 
+    // Implemented in GpuShaderDesc.cpp where the GpuShaderCreator implementation lives.
+    bool isCreatorEmpty() const noexcept;
+    void copyCreatorFrom(const GenericGpuShaderDesc & rhs);
+
     class ImplGeneric;
     ImplGeneric * m_implGeneric;
 
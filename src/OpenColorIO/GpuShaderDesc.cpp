@@ -412,6 +412,38 @@ GpuShaderDesc::~GpuShaderDesc()
 {
 }
 
+bool GenericGpuShaderDesc::isCreatorEmpty() const noexcept
+{
+    return getImpl()->m_numResources == 0
+        && getImpl()->m_shaderCode.empty()
+        && getImpl()->m_parameterDeclarations.empty()
+        && getImpl()->m_textureDeclarations.empty()
+        && getImpl()->m_helperMethods.empty()
+        && getImpl()->m_functionHeader.empty()
+        && getImpl()->m_functionBody.empty()
+        && getImpl()->m_functionFooter.empty()
+        && getImpl()->m_dynamicProperties.empty();
+}
+
+void GenericGpuShaderDesc::copyCreatorFrom(const GenericGpuShaderDesc & rhs)
+{
+    if (this == &rhs)
+    {
+        return;
+    }
+
+    AutoMutex lock(getImpl()->m_cacheIDMutex);
+
+    // Unlike the assignment operator (used by clone()), the shader program
+    // and its dynamic properties are also copied.
+    *getImpl() = *rhs.getImpl();
+
+    getImpl()->m_shaderCode        = rhs.getImpl()->m_shaderCode;
+    getImpl()->m_shaderCodeID      = rhs.getImpl()->m_shaderCodeID;
+    getImpl()->m_dynamicProperties = rhs.getImpl()->m_dynamicProperties;
+    getImpl()->m_cacheID.clear();
+}
+
 GpuShaderCreatorRcPtr GpuShaderDesc::clone() const
 {
     GpuShaderDescRcPtr gpuDesc = CreateShaderDesc();
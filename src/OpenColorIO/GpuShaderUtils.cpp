@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <math.h>
+#include <stdio.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -28,10 +29,18 @@ std::string getFloatString(T v, GpuLanguage lang)
     T integerpart = (T)0;
     const T fracpart = std::modf(value, &integerpart);
 
-    std::ostringstream oss;
-    oss.precision(std::numeric_limits<T>::max_digits10);
-    oss << value << ((fracpart == (T)0) && std::isfinite(value) ? "." : "");
-    return oss.str();
+    // Same formatting as an ostream using max_digits10 precision, without the
+    // stream construction and locale overhead.
+    char buf[64];
+    const int len = snprintf(buf, sizeof(buf), "%.*g",
+                             std::numeric_limits<T>::max_digits10, (double)value);
+
+    std::string str(buf, len);
+    if ((fracpart == (T)0) && std::isfinite(value))
+    {
+        str += '.';
+    }
+    return str;
 }
 
 template<int N>
@@ -253,38 +262,38 @@ GpuShaderText::GpuShaderLine& GpuShaderText::GpuShaderLine::operator<<(const cha
 {
     if (str)
     {
-        m_text->m_ossLine << str;
+        m_text->m_line += str;
     }
     return *this;
 }
 
 GpuShaderText::GpuShaderLine& GpuShaderText::GpuShaderLine::operator<<(float value)
 {
-    m_text->m_ossLine << getFloatString(value, m_text->m_lang);
+    m_text->m_line += getFloatString(value, m_text->m_lang);
     return *this;
 }
 
 GpuShaderText::GpuShaderLine& GpuShaderText::GpuShaderLine::operator<<(double value)
 {
-    m_text->m_ossLine << getFloatString(value, m_text->m_lang);
+    m_text->m_line += getFloatString(value, m_text->m_lang);
     return *this;
 }
 
 GpuShaderText::GpuShaderLine& GpuShaderText::GpuShaderLine::operator<<(unsigned value)
 {
-    m_text->m_ossLine << value;
+    m_text->m_line += std::to_string(value);
     return *this;
 }
 
 GpuShaderText::GpuShaderLine& GpuShaderText::GpuShaderLine::operator<<(int value)
 {
-    m_text->m_ossLine << value;
+    m_text->m_line += std::to_string(value);
     return *this;
 }
 
 GpuShaderText::GpuShaderLine& GpuShaderText::GpuShaderLine::operator<<(const std::string& str)
 {
-    m_text->m_ossLine << str;
+    m_text->m_line += str;
     return *this;
 }
 
@@ -301,8 +310,8 @@ GpuShaderText::GpuShaderText(GpuLanguage lang)
     :   m_lang(lang)
     ,   m_indent(0)
 {
-    m_ossText.precision(16);
-    m_ossLine.precision(16);
+    m_text.reserve(4 * 1024);
+    m_line.reserve(256);
 }
 
 void GpuShaderText::setIndent(unsigned i)
@@ -327,19 +336,18 @@ GpuShaderText::GpuShaderLine GpuShaderText::newLine()
 
 std::string GpuShaderText::string() const
 {
-    return m_ossText.str();
+    return m_text;
 }
 
 void GpuShaderText::flushLine()
 {
     static constexpr unsigned tabSize = 2;
 
-    m_ossText << std::string(tabSize * m_indent, ' ')
-              << m_ossLine.str()
-              << std::endl;
+    m_text.append(tabSize * m_indent, ' ');
+    m_text += m_line;
+    m_text += '\n';
 
-    m_ossLine.str("");
-    m_ossLine.clear();
+    m_line.clear();
 }
 
 std::string GpuShaderText::constKeyword() const
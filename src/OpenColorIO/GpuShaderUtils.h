@@ -249,17 +249,17 @@ private:
 private:
     // Shader language to use in the various shader text builder methods.
     GpuLanguage m_lang; 
-    // String stream containing the current shader text.
-    std::ostringstream m_ossText;
+    // Current shader text.
+    std::string m_text;
 
-    // In order to avoid repeated allocations of an output string stream 
-    // for multiple shader lines, create a single ostringstream instance 
-    // on the shader text and just reset it after a line has  been added 
-    // to the text. This should not pose a racing problem since we're only 
-    // creating a single line at a time for a given shader text.
+    // Lines are appended to a plain string buffer rather than going through
+    // std::ostringstream. Both buffers are reserved once and then reused, so
+    // building a shader text only allocates when it outgrows its capacity.
+    // This should not pose a racing problem since we're only creating a
+    // single line at a time for a given shader text.
 
-    // String stream containing the current shader line.
-    std::ostringstream m_ossLine;
+    // Current shader line.
+    std::string m_line;
 
     // Indentation level to use for the next line.
     unsigned m_indent;
@@ -1,7 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
-#include <sstream>
+#include <cinttypes>
+#include <cstdio>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -18,11 +19,31 @@ namespace OCIO_NAMESPACE
 
 std::string CacheIDHash(const char * array, std::size_t size)
 {
-    XXH128_hash_t hash = XXH3_128bits(array, size);
+    return CacheIDDigestToString(CacheIDDigestFromData(array, size));
+}
+
+CacheIDDigest CacheIDDigestFromData(const void * data, std::size_t size)
+{
+    const XXH128_hash_t hash = XXH3_128bits(data, size);
+
+    CacheIDDigest digest;
+    digest.low  = hash.low64;
+    digest.high = hash.high64;
+    return digest;
+}
 
-    std::stringstream oss;
-    oss << std::hex << hash.low64 << hash.high64;
-    return oss.str();
+CacheIDDigest CombineCacheIDDigests(const CacheIDDigest & seed, const CacheIDDigest & digest)
+{
+    const uint64_t values[4] = { seed.low, seed.high, digest.low, digest.high };
+    return CacheIDDigestFromData(values, sizeof(values));
+}
+
+std::string CacheIDDigestToString(const CacheIDDigest & digest)
+{
+    // Two 64-bit values in hexadecimal without leading zeros.
+    char buffer[33];
+    std::snprintf(buffer, sizeof(buffer), "%" PRIx64 "%" PRIx64, digest.low, digest.high);
+    return buffer;
 }
 
 } // namespace OCIO_NAMESPACE
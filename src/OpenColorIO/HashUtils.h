@@ -7,6 +7,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include <cstdint>
 #include <string>
 
 namespace OCIO_NAMESPACE
@@ -14,6 +15,37 @@ namespace OCIO_NAMESPACE
 
 std::string CacheIDHash(const char * array, std::size_t size);
 
+// 128-bit digest of some data, used to build the cache identifiers without going through the
+// string representations.
+struct CacheIDDigest
+{
+    uint64_t low  = 0;
+    uint64_t high = 0;
+};
+
+inline bool operator==(const CacheIDDigest & lhs, const CacheIDDigest & rhs)
+{
+    return lhs.low == rhs.low && lhs.high == rhs.high;
+}
+
+inline bool operator!=(const CacheIDDigest & lhs, const CacheIDDigest & rhs)
+{
+    return !(lhs == rhs);
+}
+
+CacheIDDigest CacheIDDigestFromData(const void * data, std::size_t size);
+
+inline CacheIDDigest CacheIDDigestFromData(const std::string & str)
+{
+    return CacheIDDigestFromData(str.data(), str.size());
+}
+
+// Combine two digests. Note that the combination depends on the order.
+CacheIDDigest CombineCacheIDDigests(const CacheIDDigest & seed, const CacheIDDigest & digest);
+
+// Same string representation as the CacheIDHash() result.
+std::string CacheIDDigestToString(const CacheIDDigest & digest);
+
 } // namespace OCIO_NAMESPACE
 
 #endif
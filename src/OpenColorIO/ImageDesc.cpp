@@ -101,6 +101,19 @@ bool GenericImageDesc::isPackedFloatRGBA() const
     return m_isFloat && m_isRGBAPacked;
 }
 
+bool GenericImageDesc::isPackedFloatRGB() const
+{
+    return m_isFloat && !m_aData
+        && m_xStrideBytes == 3 * ptrdiff_t(sizeof(float))
+        && m_gData == m_rData + sizeof(float)
+        && m_bData == m_rData + 2 * sizeof(float);
+}
+
+bool GenericImageDesc::isPlanarFloat() const
+{
+    return m_isFloat && m_xStrideBytes == ptrdiff_t(sizeof(float));
+}
+
 bool GenericImageDesc::isRGBAPacked() const
 {
     return m_isRGBAPacked;
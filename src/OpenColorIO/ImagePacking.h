@@ -40,6 +40,10 @@ struct GenericImageDesc
 
     // Is the image buffer a packed RGBA 32-bit float buffer?
     bool isPackedFloatRGBA() const;
+    // Is the image buffer a packed RGB (i.e. no alpha) 32-bit float buffer?
+    bool isPackedFloatRGB() const;
+    // Is the image buffer a planar (i.e. one buffer per channel) 32-bit float buffer?
+    bool isPlanarFloat() const;
     // Is the image buffer a RGBA packed buffer?
     bool isRGBAPacked() const;
     // Is the image buffer a 32-bit float image buffer?
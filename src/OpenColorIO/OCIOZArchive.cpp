@@ -1,12 +1,16 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <sstream>
 #include <fstream>
 #include <vector>
 #include <map>
 #include <set>
 #include <limits>
+#include <thread>
 
 #include <pystring.h>
 
@@ -29,6 +33,8 @@
 #include "mz_zip.h"
 #include "mz_zip_rw.h"
 
+#include <zlib.h>
+
 namespace OCIO_NAMESPACE
 {
 // Minizip-np compression levels.
@@ -325,21 +331,15 @@ void archiveConfig(std::ostream & ostream, const Config & config, const char * c
     mz_stream_mem_delete(&write_mem_stream); 
 }
 
-/**
- * \brief Extract the specified OCIOZ archive.
- * 
- * This function can only be used with the OCIOZ archive format (not arbitrary zip files).
- * 
- * Note: Signature is in OpenColorIO.h since the function is OCIOEXPORT-ed for client apps.
- */
-void ExtractOCIOZArchive(const char * archivePath, const char * destination)
+namespace
+{
+
+// Extract all the entries of the archive to the destination directory using Minizip-ng.
+void ExtractArchiveWithMinizip(const char * archivePath, const std::string & outputDestination)
 {
     void * extracter = NULL;
     int32_t err = MZ_OK;
 
-    // Normalize the path for the platform.
-    std::string outputDestination = pystring::os::path::normpath(destination);
-
     // Create zip reader.
 #if MZ_VERSION_BUILD >= 040000
     extracter = mz_zip_reader_create();
@@ -387,6 +387,199 @@ void ExtractOCIOZArchive(const char * archivePath, const char * destination)
     mz_zip_reader_delete(&extracter);
 }
 
+// Split the path of an archive entry into its components, rejecting the paths which could
+// escape the destination directory.
+bool SplitEntryPath(const std::string & filename, StringUtils::StringVec & components)
+{
+    std::string path = filename;
+    std::replace(path.begin(), path.end(), '\\', '/');
+
+    if (path.empty() || path[0] == '/' || path.find(':') != std::string::npos)
+    {
+        return false;
+    }
+
+    components.clear();
+    for (const auto & component : StringUtils::Split(path, '/'))
+    {
+        if (component == "..")
+        {
+            return false;
+        }
+        if (!component.empty() && component != ".")
+        {
+            components.push_back(component);
+        }
+    }
+
+    return !components.empty();
+}
+
+} // anon.
+
+/**
+ * \brief Extract the specified OCIOZ archive.
+ * 
+ * This function can only be used with the OCIOZ archive format (not arbitrary zip files).
+ * 
+ * The entries are decompressed concurrently once the directory tree is created.
+ * 
+ * Note: Signature is in OpenColorIO.h since the function is OCIOEXPORT-ed for client apps.
+ */
+void ExtractOCIOZArchive(const char * archivePath, const char * destination)
+{
+    // Normalize the path for the platform.
+    const std::string outputDestination = pystring::os::path::normpath(destination);
+
+    std::unique_ptr<ArchiveReader> reader;
+    try
+    {
+        reader.reset(new ArchiveReader(archivePath));
+    }
+    catch (const Exception &)
+    {
+        // Let Minizip-ng handle (or report) the archives the index could not be built for.
+        ExtractArchiveWithMinizip(archivePath, outputDestination);
+        return;
+    }
+
+    const std::vector<ArchiveEntry> & entries = reader->getEntries();
+    if (entries.empty())
+    {
+        throw Exception("No files in archive.");
+    }
+
+    // Collect the directories to create and the files to write.
+    std::set<std::string> directories;
+    std::vector<std::pair<const ArchiveEntry *, std::string>> files;
+
+    for (const auto & entry : entries)
+    {
+        if (!entry.isDirectlyReadable())
+        {
+            ExtractArchiveWithMinizip(archivePath, outputDestination);
+            return;
+        }
+
+        StringUtils::StringVec components;
+        if (!SplitEntryPath(entry.m_filename, components))
+        {
+            std::ostringstream os;
+            os << "Could not extract: " << archivePath << ". Invalid file path '"
+               << entry.m_filename << "'.";
+            throw Exception(os.str().c_str());
+        }
+
+        std::string path;
+        const size_t numDirectories = entry.isDirectory() ? components.size() 
+                                                          : components.size() - 1;
+        for (size_t idx = 0; idx < components.size(); ++idx)
+        {
+            path = path.empty() ? components[idx] : path + "/" + components[idx];
+            if (idx < numDirectories)
+            {
+                directories.insert(path);
+            }
+        }
+
+        if (!entry.isDirectory())
+        {
+            files.emplace_back(&entry, pystring::os::path::join(outputDestination, path));
+        }
+    }
+
+    // As a parent directory always sorts before its sub-directories, the directory tree is
+    // created in order.
+    bool success = Platform::MakeDirectory(outputDestination);
+    for (auto it = directories.begin(); success && it != directories.end(); ++it)
+    {
+        success = Platform::MakeDirectory(pystring::os::path::join(outputDestination, *it));
+    }
+
+    if (!success)
+    {
+        std::ostringstream os;
+        os << "Could not extract: " << archivePath << ". Could not create the directories in '"
+           << outputDestination << "'.";
+        throw Exception(os.str().c_str());
+    }
+
+    // Decompress and write the files concurrently.
+
+    std::atomic<size_t> nextFile{ 0 };
+    std::atomic<bool> failed{ false };
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto extractFiles = [&]()
+    {
+        try
+        {
+            for (size_t idx = nextFile++; idx < files.size() && !failed; idx = nextFile++)
+            {
+                const std::vector<uint8_t> buffer = reader->readEntry(*files[idx].first);
+
+                std::ofstream stream(Platform::filenameToUTF(files[idx].second),
+                                     std::ios_base::out | std::ios_base::binary
+                                        | std::ios_base::trunc);
+                if (!buffer.empty())
+                {
+                    stream.write(reinterpret_cast<const char *>(buffer.data()), 
+                                 static_cast<std::streamsize>(buffer.size()));
+                }
+
+                if (!stream.good())
+                {
+                    std::ostringstream os;
+                    os << "Could not write '" << files[idx].second << "'.";
+                    throw Exception(os.str().c_str());
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    const size_t numThreads 
+        = std::max(size_t(1), std::min(size_t(std::thread::hardware_concurrency()), files.size()));
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (size_t idx = 1; idx < numThreads; ++idx)
+    {
+        threads.emplace_back(extractFiles);
+    }
+
+    // The calling thread also extracts files.
+    extractFiles();
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        try
+        {
+            std::rethrow_exception(error);
+        }
+        catch (const Exception & ex)
+        {
+            std::ostringstream os;
+            os << "Could not extract: " << archivePath << ". " << ex.what();
+            throw Exception(os.str().c_str());
+        }
+    }
+}
+
 /**
  * \brief Callback function for getFileStringFromArchiveStream in order to get the contents of a
  *        file inside an OCIOZ archive as a buffer. 
@@ -570,6 +763,391 @@ void getEntriesMappingFromArchiveFile(const std::string & archivePath,
 //////////////////////////////////////////////////////////////////////////////////////
 
 
+//////////////////////////////////////////////////////////////////////////////////////
+// Implementation of ArchiveReader class.
+//////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Zip format signatures and record sizes (refer to the PKWARE APPNOTE.TXT specification).
+constexpr uint32_t ZIP_LOCAL_HEADER_SIGNATURE   = 0x04034b50;
+constexpr uint32_t ZIP_CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+constexpr uint32_t ZIP_EOCD_SIGNATURE           = 0x06054b50;
+constexpr uint32_t ZIP64_EOCD_SIGNATURE         = 0x06064b50;
+constexpr uint32_t ZIP64_LOCATOR_SIGNATURE      = 0x07064b50;
+
+constexpr uint64_t ZIP_LOCAL_HEADER_SIZE   = 30;
+constexpr uint64_t ZIP_CENTRAL_HEADER_SIZE = 46;
+constexpr uint64_t ZIP_EOCD_SIZE           = 22;
+constexpr uint64_t ZIP64_EOCD_SIZE         = 56;
+constexpr uint64_t ZIP64_LOCATOR_SIZE      = 20;
+constexpr uint64_t ZIP_MAX_COMMENT_SIZE    = 0xFFFF;
+
+constexpr uint16_t ZIP64_EXTRA_FIELD_ID    = 0x0001;
+
+constexpr uint16_t ZIP_METHOD_STORE        = 0;
+constexpr uint16_t ZIP_METHOD_DEFLATE      = 8;
+constexpr uint16_t ZIP_FLAG_ENCRYPTED      = 0x0001;
+
+// zlib functions take 32-bit sizes.
+constexpr uint64_t ZLIB_MAX_CHUNK_SIZE     = 0x40000000;
+
+// The zip format is little-endian.
+inline uint16_t GetUInt16(const uint8_t * ptr)
+{
+    return uint16_t(ptr[0] | (ptr[1] << 8));
+}
+
+inline uint32_t GetUInt32(const uint8_t * ptr)
+{
+    return uint32_t(ptr[0]) | (uint32_t(ptr[1]) << 8) 
+        | (uint32_t(ptr[2]) << 16) | (uint32_t(ptr[3]) << 24);
+}
+
+inline uint64_t GetUInt64(const uint8_t * ptr)
+{
+    return uint64_t(GetUInt32(ptr)) | (uint64_t(GetUInt32(ptr + 4)) << 32);
+}
+
+// Normalize a path for the index lookups i.e. same behavior as mz_path_compare_wc() ignoring
+// the case.
+std::string NormalizeEntryPath(const std::string & filepath)
+{
+    std::string path = StringUtils::Lower(filepath);
+    std::replace(path.begin(), path.end(), '\\', '/');
+    return path;
+}
+
+void ThrowInvalidArchive(const std::string & archivePath, const char * reason)
+{
+    std::ostringstream os;
+    os << "Invalid OCIOZ archive '" << archivePath << "': " << reason;
+    throw Exception(os.str().c_str());
+}
+
+// Decompress raw deflate data.
+bool Inflate(const uint8_t * src, uint64_t srcSize, uint8_t * dst, uint64_t dstSize)
+{
+    z_stream stream{};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+    {
+        return false;
+    }
+
+    int status = Z_OK;
+    uint64_t srcRemaining = srcSize;
+    uint64_t dstRemaining = dstSize;
+    stream.next_in  = const_cast<Bytef *>(src);
+    stream.next_out = dst;
+
+    while (status == Z_OK)
+    {
+        if (stream.avail_in == 0)
+        {
+            stream.avail_in = uInt(std::min(srcRemaining, ZLIB_MAX_CHUNK_SIZE));
+            srcRemaining -= stream.avail_in;
+        }
+        if (stream.avail_out == 0)
+        {
+            stream.avail_out = uInt(std::min(dstRemaining, ZLIB_MAX_CHUNK_SIZE));
+            dstRemaining -= stream.avail_out;
+        }
+
+        // Note that the chunks are refilled before each call so Z_BUF_ERROR means that the
+        // data is truncated or that the uncompressed size is wrong.
+        status = inflate(&stream, Z_NO_FLUSH);
+    }
+
+    inflateEnd(&stream);
+
+    return status == Z_STREAM_END && stream.avail_out == 0 && dstRemaining == 0;
+}
+
+uint32_t ComputeCrc(const uint8_t * data, uint64_t size)
+{
+    uLong crc = crc32(0L, Z_NULL, 0);
+    while (size > 0)
+    {
+        const uInt chunkSize = uInt(std::min(size, ZLIB_MAX_CHUNK_SIZE));
+        crc = crc32(crc, data, chunkSize);
+        data += chunkSize;
+        size -= chunkSize;
+    }
+    return uint32_t(crc);
+}
+
+} // anon.
+
+bool ArchiveEntry::isDirectory() const
+{
+    return !m_filename.empty() && (m_filename.back() == '/' || m_filename.back() == '\\');
+}
+
+bool ArchiveEntry::isDirectlyReadable() const
+{
+    return (m_flags & ZIP_FLAG_ENCRYPTED) == 0
+        && (m_method == ZIP_METHOD_STORE || m_method == ZIP_METHOD_DEFLATE);
+}
+
+ArchiveReader::ArchiveReader(const std::string & archivePath)
+    :   m_archivePath(archivePath)
+{
+    Platform::OpenInputFileStream(m_stream, m_archivePath.c_str(), 
+                                  std::ios_base::in | std::ios_base::binary);
+    if (m_stream.fail())
+    {
+        std::ostringstream os;
+        os << "Could not open " << m_archivePath << " for reading.";
+        throw Exception(os.str().c_str());
+    }
+
+    readCentralDirectory();
+}
+
+void ArchiveReader::readAt(uint64_t offset, char * buffer, uint64_t size) const
+{
+    AutoMutex lock(m_streamMutex);
+
+    m_stream.clear();
+    m_stream.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+    m_stream.read(buffer, static_cast<std::streamsize>(size));
+
+    if (m_stream.fail() || static_cast<uint64_t>(m_stream.gcount()) != size)
+    {
+        ThrowInvalidArchive(m_archivePath, "unexpected end of file.");
+    }
+}
+
+void ArchiveReader::readCentralDirectory()
+{
+    uint64_t archiveSize = 0;
+    {
+        AutoMutex lock(m_streamMutex);
+        m_stream.seekg(0, std::ios_base::end);
+        archiveSize = static_cast<uint64_t>(m_stream.tellg());
+    }
+
+    if (archiveSize < ZIP_EOCD_SIZE)
+    {
+        ThrowInvalidArchive(m_archivePath, "the file is too small.");
+    }
+
+    // The end of central directory record is at the end of the archive, only followed by an
+    // optional comment.
+
+    const uint64_t tailSize = std::min(archiveSize, ZIP_EOCD_SIZE + ZIP_MAX_COMMENT_SIZE);
+    const uint64_t tailOffset = archiveSize - tailSize;
+
+    std::vector<uint8_t> tail(static_cast<size_t>(tailSize));
+    readAt(tailOffset, reinterpret_cast<char *>(tail.data()), tailSize);
+
+    size_t eocdPos = static_cast<size_t>(tailSize - ZIP_EOCD_SIZE + 1);
+    while (eocdPos > 0 && GetUInt32(&tail[eocdPos - 1]) != ZIP_EOCD_SIGNATURE)
+    {
+        --eocdPos;
+    }
+
+    if (eocdPos == 0)
+    {
+        ThrowInvalidArchive(m_archivePath, "the end of central directory record is missing.");
+    }
+
+    const uint8_t * eocd = &tail[--eocdPos];
+
+    if (GetUInt16(eocd + 4) != 0 || GetUInt16(eocd + 6) != 0)
+    {
+        ThrowInvalidArchive(m_archivePath, "split archives are not supported.");
+    }
+
+    uint64_t numEntries = GetUInt16(eocd + 10);
+    uint64_t cdSize     = GetUInt32(eocd + 12);
+    uint64_t cdOffset   = GetUInt32(eocd + 16);
+
+    if (numEntries == 0xFFFF || cdSize == 0xFFFFFFFF || cdOffset == 0xFFFFFFFF)
+    {
+        // Zip64 archive i.e. the actual values are in the zip64 end of central directory record
+        // whose locator immediately precedes the end of central directory record.
+
+        const uint64_t eocdOffset = tailOffset + eocdPos;
+        if (eocdOffset < ZIP64_LOCATOR_SIZE)
+        {
+            ThrowInvalidArchive(m_archivePath, "the zip64 locator is missing.");
+        }
+
+        uint8_t locator[ZIP64_LOCATOR_SIZE];
+        readAt(eocdOffset - ZIP64_LOCATOR_SIZE, reinterpret_cast<char *>(locator), 
+               ZIP64_LOCATOR_SIZE);
+        if (GetUInt32(locator) != ZIP64_LOCATOR_SIGNATURE)
+        {
+            ThrowInvalidArchive(m_archivePath, "the zip64 locator is missing.");
+        }
+
+        uint8_t eocd64[ZIP64_EOCD_SIZE];
+        readAt(GetUInt64(locator + 8), reinterpret_cast<char *>(eocd64), ZIP64_EOCD_SIZE);
+        if (GetUInt32(eocd64) != ZIP64_EOCD_SIGNATURE)
+        {
+            ThrowInvalidArchive(m_archivePath, 
+                                "the zip64 end of central directory record is missing.");
+        }
+
+        numEntries = GetUInt64(eocd64 + 32);
+        cdSize     = GetUInt64(eocd64 + 40);
+        cdOffset   = GetUInt64(eocd64 + 48);
+    }
+
+    if (cdOffset > archiveSize || cdSize > archiveSize - cdOffset
+        || numEntries > cdSize / ZIP_CENTRAL_HEADER_SIZE)
+    {
+        ThrowInvalidArchive(m_archivePath, "the central directory is corrupted.");
+    }
+
+    std::vector<uint8_t> cd(static_cast<size_t>(cdSize));
+    if (cdSize > 0)
+    {
+        readAt(cdOffset, reinterpret_cast<char *>(cd.data()), cdSize);
+    }
+
+    m_entries.reserve(static_cast<size_t>(numEntries));
+    m_index.reserve(static_cast<size_t>(numEntries));
+
+    size_t pos = 0;
+    for (uint64_t idx = 0; idx < numEntries; ++idx)
+    {
+        const uint8_t * header = cd.data() + pos;
+        if (cd.size() - pos < ZIP_CENTRAL_HEADER_SIZE 
+            || GetUInt32(header) != ZIP_CENTRAL_HEADER_SIGNATURE)
+        {
+            ThrowInvalidArchive(m_archivePath, "the central directory is corrupted.");
+        }
+
+        const size_t nameSize    = GetUInt16(header + 28);
+        const size_t extraSize   = GetUInt16(header + 30);
+        const size_t commentSize = GetUInt16(header + 32);
+
+        if (cd.size() - pos - ZIP_CENTRAL_HEADER_SIZE < nameSize + extraSize + commentSize)
+        {
+            ThrowInvalidArchive(m_archivePath, "the central directory is corrupted.");
+        }
+
+        ArchiveEntry entry;
+        entry.m_flags             = GetUInt16(header + 8);
+        entry.m_method            = GetUInt16(header + 10);
+        entry.m_crc               = GetUInt32(header + 16);
+        entry.m_compressedSize    = GetUInt32(header + 20);
+        entry.m_uncompressedSize  = GetUInt32(header + 24);
+        entry.m_localHeaderOffset = GetUInt32(header + 42);
+        entry.m_filename.assign(reinterpret_cast<const char *>(header + ZIP_CENTRAL_HEADER_SIZE),
+                                nameSize);
+
+        // The zip64 extra field only holds the values overflowing their 32-bit fields.
+        const uint8_t * extra = header + ZIP_CENTRAL_HEADER_SIZE + nameSize;
+        const uint8_t * extraEnd = extra + extraSize;
+        while (extraEnd - extra >= 4)
+        {
+            const uint16_t fieldId   = GetUInt16(extra);
+            const uint16_t fieldSize = GetUInt16(extra + 2);
+            const uint8_t * field    = extra + 4;
+            const uint8_t * fieldEnd = field + std::min<ptrdiff_t>(fieldSize, extraEnd - field);
+
+            if (fieldId == ZIP64_EXTRA_FIELD_ID)
+            {
+                for (uint64_t * value : { &entry.m_uncompressedSize, 
+                                          &entry.m_compressedSize, 
+                                          &entry.m_localHeaderOffset })
+                {
+                    if (*value == 0xFFFFFFFF && fieldEnd - field >= 8)
+                    {
+                        *value = GetUInt64(field);
+                        field += 8;
+                    }
+                }
+            }
+
+            extra = fieldEnd;
+        }
+
+        // Keep the first entry in case of duplicated paths (same as the Minizip-ng lookups).
+        m_index.emplace(NormalizeEntryPath(entry.m_filename), m_entries.size());
+        m_entries.push_back(std::move(entry));
+
+        pos += ZIP_CENTRAL_HEADER_SIZE + nameSize + extraSize + commentSize;
+    }
+}
+
+const ArchiveEntry * ArchiveReader::findEntry(const std::string & filepath) const
+{
+    const auto it = m_index.find(NormalizeEntryPath(filepath));
+    return it == m_index.end() ? nullptr : &m_entries[it->second];
+}
+
+std::vector<uint8_t> ArchiveReader::readEntry(const ArchiveEntry & entry) const
+{
+    if (!entry.isDirectlyReadable())
+    {
+        std::ostringstream os;
+        os << "Unsupported compression or encryption for '" << entry.m_filename 
+           << "' in OCIOZ archive '" << m_archivePath << "'.";
+        throw Exception(os.str().c_str());
+    }
+
+    // The name & extra field sizes of the local header could differ from the central directory
+    // ones so the local header must be read to locate the data.
+    uint8_t header[ZIP_LOCAL_HEADER_SIZE];
+    readAt(entry.m_localHeaderOffset, reinterpret_cast<char *>(header), ZIP_LOCAL_HEADER_SIZE);
+    if (GetUInt32(header) != ZIP_LOCAL_HEADER_SIGNATURE)
+    {
+        ThrowInvalidArchive(m_archivePath, "a local file header is corrupted.");
+    }
+
+    const uint64_t dataOffset = entry.m_localHeaderOffset + ZIP_LOCAL_HEADER_SIZE
+                              + GetUInt16(header + 26) + GetUInt16(header + 28);
+
+    std::vector<uint8_t> buffer(static_cast<size_t>(entry.m_uncompressedSize));
+    if (buffer.empty())
+    {
+        return buffer;
+    }
+
+    if (entry.m_method == ZIP_METHOD_STORE)
+    {
+        // Stored entries are directly read in the output buffer.
+        if (entry.m_compressedSize != entry.m_uncompressedSize)
+        {
+            ThrowInvalidArchive(m_archivePath, "a stored file has inconsistent sizes.");
+        }
+        readAt(dataOffset, reinterpret_cast<char *>(buffer.data()), buffer.size());
+    }
+    else
+    {
+        // Only the read is serialized, the decompression runs without holding the lock.
+        std::vector<uint8_t> compressed(static_cast<size_t>(entry.m_compressedSize));
+        if (!compressed.empty())
+        {
+            readAt(dataOffset, reinterpret_cast<char *>(compressed.data()), compressed.size());
+        }
+
+        if (!Inflate(compressed.data(), compressed.size(), buffer.data(), buffer.size()))
+        {
+            std::ostringstream os;
+            os << "Could not decompress '" << entry.m_filename << "' from OCIOZ archive '" 
+               << m_archivePath << "'.";
+            throw Exception(os.str().c_str());
+        }
+    }
+
+    if (ComputeCrc(buffer.data(), buffer.size()) != entry.m_crc)
+    {
+        std::ostringstream os;
+        os << "CRC error for '" << entry.m_filename << "' from OCIOZ archive '" 
+           << m_archivePath << "'.";
+        throw Exception(os.str().c_str());
+    }
+
+    return buffer;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////
 // Implementation of CIOPOciozArchive class.
 //////////////////////////////////////////////////////////////////////////////////////
@@ -586,8 +1164,23 @@ std::vector<uint8_t> CIOPOciozArchive::getLutData(const char * filepath) const
     // instead of a std::istream (max 5%). But the following iterations are just as fast due to
     // the FileTransform cache.
 
+    const std::string fpath = pystring::os::path::normpath(filepath);
+
+    if (m_reader)
+    {
+        const ArchiveEntry * entry = m_reader->findEntry(fpath);
+        if (!entry)
+        {
+            return {};
+        }
+        if (entry->isDirectlyReadable())
+        {
+            return m_reader->readEntry(*entry);
+        }
+    }
+
     std::vector<uint8_t> buffer;
-    buffer = getFileBufferFromArchive(pystring::os::path::normpath(filepath), m_archiveAbsPath);
+    buffer = getFileBufferFromArchive(fpath, m_archiveAbsPath);
     return buffer;
 }
 
@@ -601,7 +1194,7 @@ std::string CIOPOciozArchive::getConfigData() const
     std::string configData = "";
     std::string configFilename = std::string(OCIO_CONFIG_DEFAULT_NAME) +
                                  std::string(OCIO_CONFIG_DEFAULT_FILE_EXT);
-    std::vector<uint8_t> configBuffer = getFileBufferFromArchive(configFilename, m_archiveAbsPath);
+    std::vector<uint8_t> configBuffer = getLutData(configFilename.c_str());
     if (configBuffer.size() > 0)
     {
         configData = std::string(configBuffer.begin(), configBuffer.end());
@@ -613,10 +1206,22 @@ std::string CIOPOciozArchive::getConfigData() const
 std::string CIOPOciozArchive::getFastLutFileHash(const char * filepath) const
 {
     std::string hash = "";
+    // Normalize filepath and find it in the index of the archive entries.
+    std::string fpath = pystring::os::path::normpath(filepath);
+
+    if (m_reader)
+    {
+        // The hash is the full path of the file inside the archive and its CRC32.
+        const ArchiveEntry * entry = m_reader->findEntry(fpath);
+        if (entry)
+        {
+            hash = entry->m_filename + std::to_string(entry->m_crc);
+        }
+        return hash;
+    }
+
     // Check into the map to check if the file exists in the archive.
     // The key is the full path of the file inside the archive and the value is the hash.
-    // Normalize filepath and find it in the std::map.
-    std::string fpath = pystring::os::path::normpath(filepath);
     for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
     {
         // Verify that the key and the specfied filepath matches while ignoring the slashes
@@ -636,6 +1241,17 @@ void CIOPOciozArchive::setArchiveAbsPath(const std::string & absPath)
 
 void CIOPOciozArchive::buildEntries()
 {
+    try
+    {
+        m_reader = std::make_shared<ArchiveReader>(m_archiveAbsPath);
+        return;
+    }
+    catch (const Exception &)
+    {
+        // Fall back to Minizip-ng below.
+        m_reader.reset();
+    }
+
     std::ifstream ociozStream = Platform::CreateInputFileStream(
         m_archiveAbsPath.c_str(), 
         std::ios_base::in | std::ios_base::binary
@@ -9,10 +9,14 @@
 #include <fstream>
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Mutex.h"
+
 namespace OCIO_NAMESPACE
 {
 /**
@@ -74,6 +78,69 @@ void getEntriesMappingFromArchiveFile(
 
 //////////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * \brief Description of a file inside an OCIOZ archive, read from the zip central directory.
+ */
+struct ArchiveEntry
+{
+    std::string m_filename;             // Full path of the file inside the archive.
+    uint32_t    m_crc              = 0;
+    uint16_t    m_method           = 0; // Compression method.
+    uint16_t    m_flags            = 0; // General purpose bit flags.
+    uint64_t    m_compressedSize   = 0;
+    uint64_t    m_uncompressedSize = 0;
+    uint64_t    m_localHeaderOffset = 0;
+
+    bool isDirectory() const;
+    // Only the stored and deflated entries without encryption are directly readable.
+    bool isDirectlyReadable() const;
+};
+
+/**
+ * \brief Persistent reader of an OCIOZ archive.
+ * 
+ * The zip central directory is read once to build a hashed index of the entries, and the
+ * archive stays open so that reading an entry is an index lookup, a positioned read and a
+ * decompression (a plain copy for the stored entries).  Only the positioned read is serialized
+ * so several entries can be decompressed concurrently.
+ */
+class ArchiveReader
+{
+public:
+    ArchiveReader() = delete;
+    ArchiveReader(const ArchiveReader &) = delete;
+    ArchiveReader & operator=(const ArchiveReader &) = delete;
+
+    // Throw if the archive could not be opened or if its central directory is invalid.
+    explicit ArchiveReader(const std::string & archivePath);
+
+    const std::string & getArchivePath() const noexcept { return m_archivePath; }
+
+    // Entries in the order of the central directory.
+    const std::vector<ArchiveEntry> & getEntries() const noexcept { return m_entries; }
+
+    // Find an entry ignoring the case and the slash differences between platforms. Return
+    // nullptr if the archive does not contain the file.
+    const ArchiveEntry * findEntry(const std::string & filepath) const;
+
+    // Return the content of a directly readable entry. The method is thread-safe.
+    std::vector<uint8_t> readEntry(const ArchiveEntry & entry) const;
+
+private:
+    void readCentralDirectory();
+    void readAt(uint64_t offset, char * buffer, uint64_t size) const;
+
+    std::string m_archivePath;
+    mutable std::ifstream m_stream;
+    mutable Mutex m_streamMutex;
+
+    std::vector<ArchiveEntry> m_entries;
+    // Normalized path (i.e. lower case with forward slashes) to the entry index.
+    std::unordered_map<std::string, size_t> m_index;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
 class CIOPOciozArchive : public ConfigIOProxy
 {
 public:
@@ -95,15 +162,17 @@ public:
     void setArchiveAbsPath(const std::string & absPath);
 
     /**
-     * \brief Build a map of the zip file table of contents for the files in the archive.
+     * \brief Build the index of the zip file table of contents for the files in the archive.
      * 
-     * The structure is a std::map with the key as the full path of the file and the value as a 
-     * calculated hash.
+     * The archive then stays open for the lifetime of the object so the files are read without
+     * going through the archive again. Archives the index could not be built for, are read
+     * through Minizip-ng.
      */
     void buildEntries();
 private:
     std::string m_archiveAbsPath;
     std::map<std::string, std::string> m_entries;
+    std::shared_ptr<ArchiveReader> m_reader;
 };
 
 } // namespace OCIO_NAMESPACE
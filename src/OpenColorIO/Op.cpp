@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 
@@ -26,6 +27,53 @@
 
 namespace OCIO_NAMESPACE
 {
+void OpCPU::applyRGB(const void * /* inImg */, void * /* outImg */, long /* numPixels */) const
+{
+    throw Exception("Op does not implement RGB processing.");
+}
+
+void OpCPU::applyPlanar(float * /* r */, float * /* g */, float * /* b */, float * /* a */,
+                        long /* numPixels */) const
+{
+    throw Exception("Op does not implement planar processing.");
+}
+
+void OpCPU::applyRGBWithRGBABuffer(const void * inImg, void * outImg, long numPixels) const
+{
+    // Small enough to stay in the L1 cache.
+    constexpr long BufferPixels = 256;
+    alignas(64) float rgba[4 * BufferPixels];
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long first = 0; first < numPixels; first += BufferPixels)
+    {
+        const long count = std::min(BufferPixels, numPixels - first);
+
+        // Like the image packing, a missing alpha is 0.
+        for (long idx = 0; idx < count; ++idx)
+        {
+            rgba[4 * idx + 0] = in[3 * idx + 0];
+            rgba[4 * idx + 1] = in[3 * idx + 1];
+            rgba[4 * idx + 2] = in[3 * idx + 2];
+            rgba[4 * idx + 3] = 0.0f;
+        }
+
+        apply(rgba, rgba, count);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            out[3 * idx + 0] = rgba[4 * idx + 0];
+            out[3 * idx + 1] = rgba[4 * idx + 1];
+            out[3 * idx + 2] = rgba[4 * idx + 2];
+        }
+
+        in  += 3 * count;
+        out += 3 * count;
+    }
+}
+
 bool OpCPU::isDynamic() const
 {
     return false;
@@ -78,6 +126,11 @@ bool OpData::equals(const OpData & other) const
     return getType() == other.getType();
 }
 
+CacheIDDigest OpData::getCacheIDDigest() const
+{
+    return CacheIDDigestFromData(getCacheID());
+}
+
 const std::string & OpData::getID() const
 {
     return m_metadata.getAttributeValueString(METADATA_ID);
@@ -155,6 +208,11 @@ void Op::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & /*secondOp*/) const
     throw Exception(os.str().c_str());
 }
 
+CacheIDDigest Op::getCacheIDDigest() const
+{
+    return CacheIDDigestFromData(getCacheID());
+}
+
 void Op::validate() const
 {
     m_data->validate();
@@ -464,6 +522,21 @@ std::string OpRcPtrVec::getCacheID() const
     return stream.str();
 }
 
+CacheIDDigest OpRcPtrVec::getCacheIDDigest() const
+{
+    CacheIDDigest digest;
+
+    for (const auto & op : m_ops)
+    {
+        if (!op->isNoOpType())
+        {
+            digest = CombineCacheIDDigests(digest, op->getCacheIDDigest());
+        }
+    }
+
+    return digest;
+}
+
 std::ostream& operator<< (std::ostream & os, const Op & op)
 {
     os << op.getInfo();
@@ -12,6 +12,7 @@
 
 #include "DynamicProperty.h"
 #include "fileformats/FormatMetadata.h"
+#include "HashUtils.h"
 #include "Mutex.h"
 
 namespace OCIO_NAMESPACE
@@ -45,11 +46,36 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // The Ops whose red, green and blue results do not depend on alpha may also process packed
+    // RGB 32-bit float pixels, so the images without alpha avoid the RGBA intermediate buffer.
+    virtual bool hasRGBApply() const { return false; }
+    virtual void applyRGB(const void * inImg, void * outImg, long numPixels) const;
+
+    // Some Ops may also process in place the separate 32-bit float planes of a planar image.
+    // The alpha plane is null when the image has no alpha, the missing alpha being then 0.
+    virtual bool hasPlanarApply() const { return false; }
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
+
     virtual bool isDynamic() const;
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
+
+protected:
+    // Implements applyRGB() with apply() using a small RGBA buffer, for the Ops whose processing
+    // is done by RGBA only SIMD code.
+    void applyRGBWithRGBABuffer(const void * inImg, void * outImg, long numPixels) const;
 };
 
+// Applies in place a per-value function to a plane of a planar processing.
+template<typename Func>
+inline void ApplyToPlane(float * plane, long numValues, const Func & func)
+{
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        plane[idx] = func(plane[idx]);
+    }
+}
+
 class OpData;
 typedef OCIO_SHARED_PTR<OpData> OpDataRcPtr;
 typedef OCIO_SHARED_PTR<const OpData> ConstOpDataRcPtr;
@@ -159,6 +185,10 @@ public:
     // This should yield a string of not unreasonable length.
     virtual std::string getCacheID() const = 0;
 
+    // Numerical form of the cache identifier. By default, it is the digest of getCacheID() but
+    // op data holding large arrays should rather compute & memoize it once.
+    virtual CacheIDDigest getCacheIDDigest() const;
+
     // FormatMetadata.
     FormatMetadataImpl & getFormatMetadata() { return m_metadata;  }
     const FormatMetadataImpl & getFormatMetadata() const { return m_metadata; }
@@ -229,6 +259,9 @@ public:
     // This should yield a string of not unreasonable length.
     virtual std::string getCacheID() const = 0;
 
+    // Numerical form of the cache identifier, see OpData::getCacheIDDigest().
+    virtual CacheIDDigest getCacheIDDigest() const;
+
     // Render the specified pixels.
     //
     // This must be safe to call in a multi-threaded context. Ops that have mutable data
@@ -390,6 +423,9 @@ public:
 
     std::string getCacheID() const;
 
+    // Combination of the op cache identifier digests.
+    CacheIDDigest getCacheIDDigest() const;
+
     // The method validates and finalizes each op.
     void finalize();
 
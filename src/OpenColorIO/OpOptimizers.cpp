@@ -314,8 +314,36 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
 
         if (IsCombineEnabled(type1, oFlags) && op1->canCombineWith(op2))
         {
+            int lastindex = firstindex + 2;
+            if (type1 == OpData::Lut3DType)
+            {
+                // Compose all the adjacent 3D LUTs at once rather than pair by pair, so the
+                // lattice is only evaluated once and at the final grid size.
+                while (lastindex < static_cast<int>(opVec.size()))
+                {
+                    ConstOpRcPtr nextOp = opVec[lastindex];
+                    if (!op1->canCombineWith(nextOp))
+                    {
+                        break;
+                    }
+                    ++lastindex;
+                }
+            }
+
             tmpops.clear();
-            op1->combineWith(tmpops, op2);
+            if (lastindex - firstindex > 2)
+            {
+                OpRcPtrVec lutOps;
+                for (int idx = firstindex; idx < lastindex; ++idx)
+                {
+                    lutOps.push_back(opVec[idx]);
+                }
+                ComposeLut3DOps(tmpops, lutOps);
+            }
+            else
+            {
+                op1->combineWith(tmpops, op2);
+            }
             FinalizeOps(tmpops);
 
             // The tmpops may have any number of ops in it: (0, 1, 2, ...).
@@ -325,8 +353,8 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
             //
             // No matter the number, we need to swap them in for the original ops.
 
-            // Erase the initial two ops we've combined.
-            opVec.erase(opVec.begin() + firstindex, opVec.begin() + firstindex + 2);
+            // Erase the initial ops we've combined.
+            opVec.erase(opVec.begin() + firstindex, opVec.begin() + lastindex);
 
             // Insert the new ops (which may be empty) at this location.
             opVec.insert(opVec.begin() + firstindex, tmpops.begin(), tmpops.end());
@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
 #include <iostream>
 #include <map>
 
@@ -42,6 +43,7 @@ struct FileHashResult
     Mutex mutex;
     std::string hash;
     bool ready { false };
+    unsigned revision { 0 };
 };
 
 typedef OCIO_SHARED_PTR<FileHashResult> FileHashResultPtr;
@@ -49,6 +51,35 @@ typedef std::map<std::string, FileHashResultPtr> FileCacheMap;
 
 FileCacheMap g_fastFileHashCache;
 Mutex g_fastFileHashCache_mutex;
+
+struct FileRevision
+{
+    std::string stamp;      // Modification time and size of the file.
+    unsigned revision { 0 };
+};
+
+typedef std::map<std::string, FileRevision> FileRevisionMap;
+
+FileRevisionMap g_fileRevisions;
+Mutex g_fileRevisions_mutex;
+
+std::atomic<unsigned> g_fileChangeCount { 0 };
+std::atomic<bool> g_fileCacheValidation { Platform::isEnvPresent(OCIO_VALIDATE_FILE_CACHES) };
+
+// Check the file on disk and update its revision if it changed.
+// To only use when the g_fileRevisions_mutex is locked.
+bool UpdateFileRevision(FileRevision & fileRevision, const std::string & filename)
+{
+    std::string stamp = Platform::CreateFileStamp(filename);
+    if (stamp != fileRevision.stamp)
+    {
+        fileRevision.stamp = std::move(stamp);
+        ++fileRevision.revision;
+        ++g_fileChangeCount;
+        return true;
+    }
+    return false;
+}
 }
 
 void SetComputeHashFunction(ComputeHashFunction hashFunction)
@@ -78,14 +109,17 @@ std::string GetFastFileHash(const std::string & filename, const Context & contex
         }
     }
 
+    const unsigned revision = GetValidatedFileRevision(filename);
+
     std::string hash;
     {
         AutoMutex lock(fileHashResultPtr->mutex);
-        if(!fileHashResultPtr->ready)
+        if(!fileHashResultPtr->ready || fileHashResultPtr->revision != revision)
         {
-            // NB: OCIO does not attempt to detect if files have changed and caused the cache to
-            // become stale.
+            // NB: The changes of the file are only detected using the file revisions i.e. when
+            // calling ClearChangedFileCaches() or with the file cache validation enabled.
             fileHashResultPtr->ready = true;
+            fileHashResultPtr->revision = revision;
 
             std::string h = "";
             if (context.getConfigIOProxy())
@@ -126,6 +160,86 @@ void ClearPathCaches()
     g_fastFileHashCache.clear();
 }
 
+unsigned GetFileRevision(const std::string & filename)
+{
+    AutoMutex lock(g_fileRevisions_mutex);
+
+    FileRevisionMap::iterator iter = g_fileRevisions.find(filename);
+    if (iter == g_fileRevisions.end())
+    {
+        iter = g_fileRevisions.emplace(filename, FileRevision()).first;
+        iter->second.stamp = Platform::CreateFileStamp(filename);
+    }
+
+    return iter->second.revision;
+}
+
+unsigned GetValidatedFileRevision(const std::string & filename)
+{
+    if (!g_fileCacheValidation)
+    {
+        return GetFileRevision(filename);
+    }
+
+    AutoMutex lock(g_fileRevisions_mutex);
+
+    FileRevisionMap::iterator iter = g_fileRevisions.find(filename);
+    if (iter == g_fileRevisions.end())
+    {
+        iter = g_fileRevisions.emplace(filename, FileRevision()).first;
+        iter->second.stamp = Platform::CreateFileStamp(filename);
+    }
+    else
+    {
+        UpdateFileRevision(iter->second, filename);
+    }
+
+    return iter->second.revision;
+}
+
+int CheckFileRevisions()
+{
+    AutoMutex lock(g_fileRevisions_mutex);
+
+    int numChangedFiles = 0;
+    for (auto & entry : g_fileRevisions)
+    {
+        if (UpdateFileRevision(entry.second, entry.first))
+        {
+            ++numChangedFiles;
+        }
+    }
+
+    return numChangedFiles;
+}
+
+bool HasChangedFiles(const FileRevisionVec & fileRevisions)
+{
+    for (const auto & fileRevision : fileRevisions)
+    {
+        if (GetValidatedFileRevision(fileRevision.first) != fileRevision.second)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+unsigned GetFileChangeCount() noexcept
+{
+    return g_fileChangeCount;
+}
+
+bool IsFileCacheValidationEnabled()
+{
+    return g_fileCacheValidation;
+}
+
+void SetFileCacheValidation(bool enable)
+{
+    g_fileCacheValidation = enable;
+}
+
 namespace
 {
 std::string GetCwd()
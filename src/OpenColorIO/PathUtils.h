@@ -5,8 +5,10 @@
 #ifndef INCLUDED_OCIO_PATHUTILS_H
 #define INCLUDED_OCIO_PATHUTILS_H
 
-#include <OpenColorIO/OpenColorIO.h>
+#include <utility>
+#include <vector>
 
+#include <OpenColorIO/OpenColorIO.h>
 
 
 namespace OCIO_NAMESPACE
@@ -26,6 +28,34 @@ std::string GetFastFileHash(const std::string & filename, const Context & contex
 
 void ClearPathCaches();
 
+// File change detection.
+//
+// The cached information built from a file (i.e. fast hash, loaded content, processors and
+// config cache IDs) remembers the revision of the file it was built from. The revision of a file
+// is incremented each time a change on disk (i.e. different modification time or size) is
+// detected, which invalidates the dependent cache entries.
+
+// Return the last known revision of the file. The modification time and size of a file are
+// recorded the first time the file is seen.
+unsigned GetFileRevision(const std::string & filename);
+
+// Same as GetFileRevision() but first checks the file on disk when the file cache validation is
+// enabled (see SetFileCacheValidation()).
+unsigned GetValidatedFileRevision(const std::string & filename);
+
+// Check all the known files on disk. Return the number of changed files.
+int CheckFileRevisions();
+
+// The files used by a cache entry, with their revisions when the entry was created.
+typedef std::vector<std::pair<std::string, unsigned>> FileRevisionVec;
+
+// Return true if one of the files changed since the revisions were collected.
+bool HasChangedFiles(const FileRevisionVec & fileRevisions);
+
+// Number of changes detected since the library was loaded. It allows to quickly know if any of
+// the cached entries could be stale.
+unsigned GetFileChangeCount() noexcept;
+
 // Works on active and inactive color spaces name and aliases.
 int ParseColorSpaceFromString(const Config & config, const char * str);
 
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <cerrno>
 #include <codecvt>
 #include <locale>
 #include <random>
@@ -352,6 +353,49 @@ std::string CreateFileContentHash(const std::string &filename)
     return "";
 }
 
+std::string CreateFileStamp(const std::string & filename)
+{
+#if defined(_WIN32) && defined(UNICODE)
+    struct _stat fileInfo;
+    if (_wstat(Platform::Utf8ToUtf16(filename).c_str(), &fileInfo) == 0)
+#else
+    struct stat fileInfo;
+    if (stat(filename.c_str(), &fileInfo) == 0)
+#endif
+    {
+        std::ostringstream stamp;
+#if defined(__APPLE__)
+        stamp << fileInfo.st_mtimespec.tv_sec << "." << fileInfo.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+        stamp << fileInfo.st_mtime;
+#else
+        stamp << fileInfo.st_mtim.tv_sec << "." << fileInfo.st_mtim.tv_nsec;
+#endif
+        stamp << ":" << fileInfo.st_size;
+        return stamp.str();
+    }
+
+    return "";
+}
+
+bool MakeDirectory(const std::string & path)
+{
+#ifdef _WIN32
+    if (CreateDirectoryW(Utf8ToUtf16(path).c_str(), nullptr) == 0)
+    {
+        return GetLastError() == ERROR_ALREADY_EXISTS;
+    }
+#else
+    if (mkdir(path.c_str(), 0777) != 0)
+    {
+        struct stat fileInfo;
+        return errno == EEXIST && stat(path.c_str(), &fileInfo) == 0 && S_ISDIR(fileInfo.st_mode);
+    }
+#endif
+
+    return true;
+}
+
 } // Platform
 
 } // namespace OCIO_NAMESPACE
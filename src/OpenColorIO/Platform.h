@@ -106,6 +106,14 @@ void OpenInputFileStream(std::ifstream & stream, const char * filename, std::ios
 // Create a unique hash of a file provided as a UTF-8 filename on any platform.
 std::string CreateFileContentHash(const std::string &filename);
 
+// Identify the revision of a file (i.e. its modification time and size) provided as a UTF-8
+// filename on any platform. Return an empty string if the file does not exist.
+std::string CreateFileStamp(const std::string & filename);
+
+// Create a directory provided as a UTF-8 path on any platform. The parent directory must exist.
+// Return false if the directory could not be created and does not already exist.
+bool MakeDirectory(const std::string & path);
+
 // Convert UTF-8 string to UTF-16LE.
 std::wstring Utf8ToUtf16(const std::string & str);
 
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "AsyncRequest.h"
 #include "CPUProcessor.h"
 #include "GPUProcessor.h"
 #include "HashUtils.h"
@@ -218,6 +219,31 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
     return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
 }
 
+CPUProcessorRequestRcPtr Processor::GetOptimizedCPUProcessorAsync(
+    const ConstProcessorRcPtr & processor,
+    BitDepth inBitDepth,
+    BitDepth outBitDepth,
+    OptimizationFlags oFlags,
+    const CPUProcessorCallback & callback)
+{
+    if (!processor)
+    {
+        throw Exception("Processor::GetOptimizedCPUProcessorAsync failed. Processor is null.");
+    }
+
+    CPUProcessorRequestRcPtr request(new CPUProcessorRequest(), &CPUProcessorRequest::deleter);
+    auto state = request->getImpl()->m_state;
+    state->setCallback(callback);
+
+    // The CPU processor cache already makes the concurrent requests share the same build.
+    RunAsyncRequest<ConstCPUProcessorRcPtr>(state, [processor, inBitDepth, outBitDepth, oFlags]()
+    {
+        return processor->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
+    });
+
+    return request;
+}
+
 
 // Instantiate the cache with the right types.
 template class ProcessorCache<std::size_t, ProcessorRcPtr>;
@@ -243,6 +269,8 @@ Processor::Impl & Processor::Impl::operator=(const Impl & rhs)
         m_metadata = rhs.m_metadata;
         m_ops      = rhs.m_ops;
 
+        m_fileRevisions = rhs.m_fileRevisions;
+
         m_cacheID.clear();
 
         m_cacheFlags = rhs.m_cacheFlags;
@@ -336,8 +364,7 @@ const char * Processor::Impl::getCacheID() const
     }
     else
     {
-        const std::string fullstr = m_ops.getCacheID();
-        m_cacheID = CacheIDHash(fullstr.c_str(), fullstr.size());
+        m_cacheID = CacheIDDigestToString(m_ops.getCacheIDDigest());
     }
 
     return m_cacheID.c_str();
@@ -477,11 +504,13 @@ ConstGPUProcessorRcPtr Processor::Impl::getGPUProcessor(const OpRcPtrVec & gpuOp
                                                         OptimizationFlags oFlags) const
 {
     // Helper method.
-    auto CreateProcessor = [](const OpRcPtrVec & ops,
-                              OptimizationFlags oFlags) -> GPUProcessorRcPtr
+    auto CreateProcessor = [this](const OpRcPtrVec & ops,
+                                  OptimizationFlags oFlags) -> GPUProcessorRcPtr
     {
         GPUProcessorRcPtr gpu = GPUProcessorRcPtr(new GPUProcessor(), &GPUProcessor::deleter);
         gpu->getImpl()->finalize(ops, oFlags);
+        gpu->getImpl()->enableShaderCache(
+            (m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
         return gpu;
     };
 
@@ -646,6 +675,18 @@ void Processor::Impl::computeMetadata()
     {
         op->dumpMetadata(m_metadata);
     }
+
+    m_fileRevisions.clear();
+    for (int idx = 0; idx < m_metadata->getNumFiles(); ++idx)
+    {
+        const std::string filename = m_metadata->getFile(idx);
+        m_fileRevisions.emplace_back(filename, GetFileRevision(filename));
+    }
+}
+
+bool Processor::Impl::hasChangedFiles() const
+{
+    return HasChangedFiles(m_fileRevisions);
 }
 
 } // namespace OCIO_NAMESPACE
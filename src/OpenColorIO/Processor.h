@@ -10,6 +10,7 @@
 #include "Caching.h"
 #include "Mutex.h"
 #include "Op.h"
+#include "PathUtils.h"
 #include "PrivateTypes.h"
 
 
@@ -34,6 +35,9 @@ private:
     mutable ProcessorCache<std::size_t, GPUProcessorRcPtr> m_gpuProcessorCache;
     mutable ProcessorCache<std::size_t, CPUProcessorRcPtr> m_cpuProcessorCache;
 
+    // Revisions of the files used by the processor (see PathUtils.h).
+    FileRevisionVec m_fileRevisions;
+
 public:
     Impl();
     Impl(Impl &) = delete;
@@ -87,6 +91,9 @@ public:
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    // Return true if one of the files used by the processor changed since its creation.
+    bool hasChangedFiles() const;
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
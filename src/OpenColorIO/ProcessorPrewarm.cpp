@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+class ProcessorPrewarm::Impl
+{
+public:
+    typedef std::function<ConstProcessorRcPtr()> ItemBuilder;
+
+    ConstConfigRcPtr m_config;
+    ConstContextRcPtr m_context;
+
+    std::vector<ItemBuilder> m_items;
+
+    bool m_defaultCPUProcessor = true;
+    bool m_defaultGPUProcessor = true;
+    unsigned m_numThreads = 0;
+    ProgressCallback m_progressCallback;
+
+    std::atomic<bool> m_started{ false };
+    std::atomic<bool> m_canceled{ false };
+    std::atomic<size_t> m_nextItem{ 0 };
+    std::atomic<size_t> m_numCompleted{ 0 };
+
+    Mutex m_threadsMutex;
+    std::vector<std::thread> m_threads;
+
+    // A deque keeps the error strings in place when new ones are added so getError() can
+    // return pointers while the workers are still running.
+    mutable Mutex m_errorsMutex;
+    std::deque<std::string> m_errors;
+
+    Impl() = default;
+    Impl(const Impl &) = delete;
+    Impl & operator=(const Impl &) = delete;
+
+    ~Impl()
+    {
+        m_canceled = true;
+        join();
+    }
+
+    void checkNotStarted() const
+    {
+        if (m_started)
+        {
+            throw Exception("ProcessorPrewarm: cannot add items once started.");
+        }
+    }
+
+    // Worker thread loop, each worker takes the next item not yet built.
+    void run()
+    {
+        const size_t numItems = m_items.size();
+
+        for (size_t idx = m_nextItem++; idx < numItems; idx = m_nextItem++)
+        {
+            if (!m_canceled)
+            {
+                try
+                {
+                    ConstProcessorRcPtr processor = m_items[idx]();
+
+                    if (m_defaultCPUProcessor && !m_canceled)
+                    {
+                        processor->getDefaultCPUProcessor();
+                    }
+                    if (m_defaultGPUProcessor && !m_canceled)
+                    {
+                        processor->getDefaultGPUProcessor();
+                    }
+                }
+                catch (const std::exception & e)
+                {
+                    AutoMutex lock(m_errorsMutex);
+                    m_errors.push_back(e.what());
+                }
+            }
+
+            const size_t numCompleted = ++m_numCompleted;
+
+            if (m_progressCallback)
+            {
+                try
+                {
+                    m_progressCallback(numCompleted, numItems);
+                }
+                catch (...)
+                {
+                    // An exception must not escape from a worker thread.
+                }
+            }
+        }
+    }
+
+    void join()
+    {
+        AutoMutex lock(m_threadsMutex);
+
+        for (auto & thread : m_threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+
+ProcessorPrewarmRcPtr ProcessorPrewarm::Create(const ConstConfigRcPtr & config)
+{
+    if (!config)
+    {
+        throw Exception("ProcessorPrewarm: the config is null.");
+    }
+
+    return Create(config, config->getCurrentContext());
+}
+
+ProcessorPrewarmRcPtr ProcessorPrewarm::Create(const ConstConfigRcPtr & config,
+                                               const ConstContextRcPtr & context)
+{
+    if (!config)
+    {
+        throw Exception("ProcessorPrewarm: the config is null.");
+    }
+    if (!context)
+    {
+        throw Exception("ProcessorPrewarm: the context is null.");
+    }
+
+    ProcessorPrewarmRcPtr prewarm(new ProcessorPrewarm(), &deleter);
+    prewarm->getImpl()->m_config  = config;
+    prewarm->getImpl()->m_context = context;
+    return prewarm;
+}
+
+void ProcessorPrewarm::deleter(ProcessorPrewarm * c)
+{
+    delete c;
+}
+
+ProcessorPrewarm::ProcessorPrewarm()
+    :   m_impl(new ProcessorPrewarm::Impl)
+{
+}
+
+ProcessorPrewarm::~ProcessorPrewarm()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void ProcessorPrewarm::addDisplayView(const char * srcColorSpaceName,
+                                      const char * display,
+                                      const char * view,
+                                      const char * looks,
+                                      TransformDirection direction)
+{
+    getImpl()->checkNotStarted();
+
+    DisplayViewTransformRcPtr dt = DisplayViewTransform::Create();
+    dt->setSrc(srcColorSpaceName);
+    dt->setDisplay(display);
+    dt->setView(view);
+    dt->validate();
+
+    ConstConfigRcPtr config   = getImpl()->m_config;
+    ConstContextRcPtr context = getImpl()->m_context;
+
+    if (!looks)
+    {
+        // Same transform as Config::getProcessor(context, src, display, view, direction).
+        getImpl()->m_items.push_back([config, context, dt, direction]()
+        {
+            return config->getProcessor(context, dt, direction);
+        });
+    }
+    else
+    {
+        dt->setDirection(direction);
+
+        LegacyViewingPipelineRcPtr pipeline = LegacyViewingPipeline::Create();
+        pipeline->setDisplayViewTransform(dt);
+        pipeline->setLooksOverrideEnabled(true);
+        pipeline->setLooksOverride(looks);
+
+        getImpl()->m_items.push_back([config, context, pipeline]()
+        {
+            return pipeline->getProcessor(config, context);
+        });
+    }
+}
+
+void ProcessorPrewarm::addActiveDisplayViews(const char * srcColorSpaceName)
+{
+    getImpl()->checkNotStarted();
+
+    const Config & config = *getImpl()->m_config;
+
+    for (int dispIdx = 0; dispIdx < config.getNumDisplays(); ++dispIdx)
+    {
+        const std::string display = config.getDisplay(dispIdx);
+
+        const int numViews = config.getNumViews(display.c_str(), srcColorSpaceName);
+        for (int viewIdx = 0; viewIdx < numViews; ++viewIdx)
+        {
+            const std::string view
+                = config.getView(display.c_str(), srcColorSpaceName, viewIdx);
+
+            addDisplayView(srcColorSpaceName, display.c_str(), view.c_str(),
+                           nullptr, TRANSFORM_DIR_FORWARD);
+        }
+    }
+}
+
+void ProcessorPrewarm::addTransform(const ConstTransformRcPtr & transform,
+                                    TransformDirection direction)
+{
+    getImpl()->checkNotStarted();
+
+    if (!transform)
+    {
+        throw Exception("ProcessorPrewarm: the transform is null.");
+    }
+
+    ConstConfigRcPtr config   = getImpl()->m_config;
+    ConstContextRcPtr context = getImpl()->m_context;
+    ConstTransformRcPtr copy  = transform->createEditableCopy();
+
+    getImpl()->m_items.push_back([config, context, copy, direction]()
+    {
+        return config->getProcessor(context, copy, direction);
+    });
+}
+
+size_t ProcessorPrewarm::getNumItems() const noexcept
+{
+    return getImpl()->m_items.size();
+}
+
+void ProcessorPrewarm::setDefaultCPUProcessorEnabled(bool enabled) noexcept
+{
+    if (!getImpl()->m_started)
+    {
+        getImpl()->m_defaultCPUProcessor = enabled;
+    }
+}
+
+bool ProcessorPrewarm::isDefaultCPUProcessorEnabled() const noexcept
+{
+    return getImpl()->m_defaultCPUProcessor;
+}
+
+void ProcessorPrewarm::setDefaultGPUProcessorEnabled(bool enabled) noexcept
+{
+    if (!getImpl()->m_started)
+    {
+        getImpl()->m_defaultGPUProcessor = enabled;
+    }
+}
+
+bool ProcessorPrewarm::isDefaultGPUProcessorEnabled() const noexcept
+{
+    return getImpl()->m_defaultGPUProcessor;
+}
+
+void ProcessorPrewarm::setNumThreads(unsigned numThreads) noexcept
+{
+    if (!getImpl()->m_started)
+    {
+        getImpl()->m_numThreads = numThreads;
+    }
+}
+
+unsigned ProcessorPrewarm::getNumThreads() const noexcept
+{
+    return getImpl()->m_numThreads;
+}
+
+void ProcessorPrewarm::setProgressCallback(const ProgressCallback & callback)
+{
+    getImpl()->checkNotStarted();
+
+    getImpl()->m_progressCallback = callback;
+}
+
+void ProcessorPrewarm::start()
+{
+    if (getImpl()->m_started.exchange(true))
+    {
+        throw Exception("ProcessorPrewarm: already started.");
+    }
+
+    const size_t numItems = getImpl()->m_items.size();
+
+    size_t numThreads = getImpl()->m_numThreads;
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min(numThreads, numItems);
+
+    AutoMutex lock(getImpl()->m_threadsMutex);
+    for (size_t idx = 0; idx < numThreads; ++idx)
+    {
+        getImpl()->m_threads.emplace_back(&ProcessorPrewarm::Impl::run, getImpl());
+    }
+}
+
+size_t ProcessorPrewarm::getNumCompleted() const noexcept
+{
+    return getImpl()->m_numCompleted;
+}
+
+bool ProcessorPrewarm::isDone() const noexcept
+{
+    return getImpl()->m_started && getImpl()->m_numCompleted == getImpl()->m_items.size();
+}
+
+void ProcessorPrewarm::cancel() noexcept
+{
+    getImpl()->m_canceled = true;
+}
+
+bool ProcessorPrewarm::isCanceled() const noexcept
+{
+    return getImpl()->m_canceled;
+}
+
+void ProcessorPrewarm::wait()
+{
+    getImpl()->join();
+}
+
+size_t ProcessorPrewarm::getNumErrors() const
+{
+    AutoMutex lock(getImpl()->m_errorsMutex);
+    return getImpl()->m_errors.size();
+}
+
+const char * ProcessorPrewarm::getError(size_t index) const
+{
+    AutoMutex lock(getImpl()->m_errorsMutex);
+    if (index >= getImpl()->m_errors.size())
+    {
+        return "";
+    }
+    return getImpl()->m_errors[index].c_str();
+}
+
+} // namespace OCIO_NAMESPACE
@@ -70,6 +70,14 @@ namespace OCIO_NAMESPACE
 #define OCIO_SIMD_BYTES 16
 #define OCIO_ALIGN(decl) alignas(OCIO_SIMD_BYTES) decl
 
+// Inline the whole call tree of a function whatever the inlining limits of the compiler, for
+// the functions chaining several SIMD computations to keep the values in registers.
+#if defined(__GNUC__) || defined(__clang__)
+#define OCIO_FLATTEN __attribute__((flatten))
+#else
+#define OCIO_FLATTEN
+#endif
+
 
 #include <limits>
 
@@ -657,6 +665,74 @@ inline void sseSinCos(const float x, float& sin_x, float& cos_x)
     sin_x = buf[1];
 }
 
+// Applies in place a function of four values to a plane of a planar processing, the last
+// values being processed with some padding.
+template<typename Func>
+inline void sseApplyToPlane(float * plane, long numValues, const Func & func)
+{
+    long idx = 0;
+    for (; idx + 4 <= numValues; idx += 4)
+    {
+        _mm_storeu_ps(plane + idx, func(_mm_loadu_ps(plane + idx)));
+    }
+
+    if (idx < numValues)
+    {
+        OCIO_ALIGN(float buf[4]) = { 0.f, 0.f, 0.f, 0.f };
+        const long count = numValues - idx;
+        for (long i = 0; i < count; ++i) buf[i] = plane[idx + i];
+
+        _mm_store_ps(buf, func(_mm_load_ps(buf)));
+
+        for (long i = 0; i < count; ++i) plane[idx + i] = buf[i];
+    }
+}
+
+// Same as above for the functions of four red, green and blue values (i.e. with crosstalk
+// between the channels), the function updating the three registers.
+template<typename Func>
+inline void sseApplyToPlanes(float * r, float * g, float * b, long numValues, const Func & func)
+{
+    long idx = 0;
+    for (; idx + 4 <= numValues; idx += 4)
+    {
+        __m128 red = _mm_loadu_ps(r + idx);
+        __m128 grn = _mm_loadu_ps(g + idx);
+        __m128 blu = _mm_loadu_ps(b + idx);
+
+        func(red, grn, blu);
+
+        _mm_storeu_ps(r + idx, red);
+        _mm_storeu_ps(g + idx, grn);
+        _mm_storeu_ps(b + idx, blu);
+    }
+
+    if (idx < numValues)
+    {
+        OCIO_ALIGN(float buf[12]) = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+        const long count = numValues - idx;
+        for (long i = 0; i < count; ++i)
+        {
+            buf[i] = r[idx + i]; buf[4 + i] = g[idx + i]; buf[8 + i] = b[idx + i];
+        }
+
+        __m128 red = _mm_load_ps(buf);
+        __m128 grn = _mm_load_ps(buf + 4);
+        __m128 blu = _mm_load_ps(buf + 8);
+
+        func(red, grn, blu);
+
+        _mm_store_ps(buf, red);
+        _mm_store_ps(buf + 4, grn);
+        _mm_store_ps(buf + 8, blu);
+
+        for (long i = 0; i < count; ++i)
+        {
+            r[idx + i] = buf[i]; g[idx + i] = buf[4 + i]; b[idx + i] = buf[8 + i];
+        }
+    }
+}
+
 } // namespace OCIO_NAMESPACE
 
 
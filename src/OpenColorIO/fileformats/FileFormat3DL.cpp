@@ -244,44 +244,51 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
 
     // Parse the file 3D LUT data to an int array.
     {
-        const int MAX_LINE_SIZE = 4096;
-        char lineBuffer[MAX_LINE_SIZE];
+        TextLutScanner scanner(istream);
 
-        StringUtils::StringVec lineParts;
+        std::vector<TextLutScanner::Token> lineParts(3);
         std::vector<int> tmpData;
 
         int lineNumber = 0;
 
-        while(istream.good())
+        while(scanner.nextLine())
         {
-            istream.getline(lineBuffer, MAX_LINE_SIZE);
             ++lineNumber;
 
-            // Strip and split the line.
-            lineParts = StringUtils::SplitByWhiteSpaces(StringUtils::Trim(lineBuffer));
+            // Split the line (in place).
+            const size_t numParts = scanner.getTokens(lineParts.data(), lineParts.size());
+            if (numParts > lineParts.size())
+            {
+                lineParts.resize(numParts);
+                scanner.getTokens(lineParts.data(), numParts);
+            }
 
-            if(lineParts.empty()) continue;
-            if (lineParts.size() > 0)
+            if (numParts == 0) continue;
+            if (*lineParts[0].m_begin == '#')
             {
-                if (StringUtils::StartsWith(lineParts[0], '#'))
-                {
-                    continue;
-                }
-                if (StringUtils::StartsWith(lineParts[0], '<'))
-                {
-                    // Format error: reject files that could be
-                    // formatted as xml.
-                    std::ostringstream os;
-                    os << "Error parsing .3dl file. ";
-                    os << "Not expecting a line starting with \"<\".";
-                    os << "Line (" << lineNumber << "): '";
-                    os << lineBuffer << "'.";
-                    throw Exception(os.str().c_str());
-                }
+                continue;
+            }
+            if (*lineParts[0].m_begin == '<')
+            {
+                // Format error: reject files that could be
+                // formatted as xml.
+                std::ostringstream os;
+                os << "Error parsing .3dl file. ";
+                os << "Not expecting a line starting with \"<\".";
+                os << "Line (" << lineNumber << "): '";
+                os << scanner.getLine() << "'.";
+                throw Exception(os.str().c_str());
             }
 
             // If we haven't found a list of ints, continue.
-            if (!StringVecToIntVec(tmpData, lineParts))
+            // (Ints followed by other characters, e.g. "3d", are not considered as ints.)
+            tmpData.resize(numParts);
+            bool allInts = true;
+            for (size_t i = 0; allInts && i < numParts; ++i)
+            {
+                allInts = TextLutScanner::ParseInt(lineParts[i], tmpData[i]);
+            }
+            if (!allInts)
             {
                 // Some keywords are valid (3DMESH, mesh, gamma, LUT*)
                 // but others could be format error.
@@ -307,7 +314,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                     os << "Error parsing .3dl file. ";
                     os << "Appears to contain more than 1 shaper LUT.";
                     os << "Line (" << lineNumber << "): '";
-                    os << lineBuffer << "'.";
+                    os << scanner.getLine() << "'.";
                     throw Exception(os.str().c_str());
                 }
             }
@@ -329,7 +336,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 os << "Error parsing .3dl file. ";
                 os << "Invalid line with less than 3 values.";
                 os << "Line (" << lineNumber << "): '";
-                os << lineBuffer << "'.";
+                os << scanner.getLine() << "'.";
                 throw Exception(os.str().c_str());
             }
         }
@@ -527,9 +534,8 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyParallel(inputToTarget, &cubeData[0], cubeSize*cubeSize*cubeSize);
 
     // Write out the file.
     // For for maximum compatibility with other apps, we will
@@ -560,14 +566,17 @@ void LocalFileFormat::bake(const Baker & baker,
     float cubeScale = static_cast<float>(
         GetMaxValueFromIntegerBitDepth(CUBE_BIT_DEPTH));
 
-    for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
     {
-        int r = GetClampedIntFromNormFloat(cubeData[3*i+0], cubeScale);
-        int g = GetClampedIntFromNormFloat(cubeData[3*i+1], cubeScale);
-        int b = GetClampedIntFromNormFloat(cubeData[3*i+2], cubeScale);
-        ostream << r << " " << g << " " << b << "\n";
+        TextLutWriter writer(ostream, 0);
+        for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
+        {
+            int r = GetClampedIntFromNormFloat(cubeData[3*i+0], cubeScale);
+            int g = GetClampedIntFromNormFloat(cubeData[3*i+1], cubeScale);
+            int b = GetClampedIntFromNormFloat(cubeData[3*i+2], cubeScale);
+            writer << r << " " << g << " " << b << "\n";
+        }
+        writer << "\n";
     }
-    ostream << "\n";
 
     if(formatName == "lustre")
     {
@@ -506,30 +506,21 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         lut1d_ptr->setFileOutputBitDepth(BIT_DEPTH_F32);
         Array & lutArray = lut1d_ptr->getArray();
 
+        TextLutScanner scanner(istream);
         for(int i = 0; i < points1D; ++i)
         {
-            // Scan for the three floats.
-            nextline (istream, line);
-
-            const StringUtils::StringVec lineParts = StringUtils::SplitByWhiteSpaces(line);
-            std::vector<float> floatArray;
+            // Scan for the three floats (stored directly in the LUT).
+            const bool notEmpty = scanner.nextNonEmptyLine();
 
-            if (!StringVecToFloatVec(floatArray, lineParts)
-                || 3 != floatArray.size())
+            if (!notEmpty || !scanner.getFloats(&lutArray[i*3], 3))
             {
                 std::ostringstream os;
                 os << "Malformed 1D csp LUT. Each line of LUT values ";
                 os << "must contain three numbers. Line: '";
-                os << line << "'. File: ";
+                os << (notEmpty ? scanner.getLine() : std::string()) << "'. File: ";
                 os << fileName << ".";
                 throw Exception(os.str().c_str());
             }
-
-            // Store each channel.
-            lutArray[i*3 + 0] = floatArray[0];
-            lutArray[i*3 + 1] = floatArray[1];
-            lutArray[i*3 + 2] = floatArray[2];
-
         }
 
     }
@@ -585,32 +576,27 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         int g = 0;
         int b = 0;
 
+        TextLutScanner scanner(istream);
         for(int i=0; i<num3dentries; ++i)
         {
             // Load the cube.
-            nextline (istream, line);
+            const bool notEmpty = scanner.nextNonEmptyLine();
 
             // OpData::Lut3D Array index, b changes fastest.
             const unsigned long arrayIdx =
                 GetLut3DIndex_BlueFast(r, g, b,
                                         lutSize, lutSize, lutSize);
 
-            const StringUtils::StringVec lineParts = StringUtils::SplitByWhiteSpaces(line);
-            std::vector<float> floatArray;
-
-            if (!StringVecToFloatVec(floatArray, lineParts)
-                || 3 != floatArray.size())
+            // Scan for the three floats (stored directly in the LUT).
+            if (!notEmpty || !scanner.getFloats(&lutArray[arrayIdx], 3))
             {
                 std::ostringstream os;
                 os << "Malformed 3D csp LUT, couldn't read cube row (";
-                os << i << "): " << line << "' in " << fileName << ".";
+                os << i << "): " << (notEmpty ? scanner.getLine() : std::string());
+                os << "' in " << fileName << ".";
                 throw Exception(os.str().c_str());
             }
 
-            lutArray[arrayIdx + 0] = floatArray[0];
-            lutArray[arrayIdx + 1] = floatArray[1];
-            lutArray[arrayIdx + 2] = floatArray[2];
-
             // CSP stores the LUT in red-fastest order.
             r += 1;
             if (r == lutSize)
@@ -708,7 +694,6 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     std::vector<float> shaperInData;
     std::vector<float> shaperOutData;
@@ -728,11 +713,10 @@ void LocalFileFormat::bake(const Baker & baker,
         GenerateIdentityLut1D(&shaperInData[0], shaperSize, 3);
 
         ConstCPUProcessorRcPtr shaperToInput = GetShaperToInputProcessor(baker);
-        PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
-        shaperToInput->apply(shaperInImg);
+        ApplyParallel(shaperToInput, &shaperInData[0], shaperSize);
 
         ConstCPUProcessorRcPtr shaperToTarget = GetShaperToTargetProcessor(baker);
-        shaperToTarget->apply(cubeImg);
+        ApplyParallel(shaperToTarget, &cubeData[0], cubeSize*cubeSize*cubeSize);
     }
     else
     {
@@ -778,12 +762,12 @@ void LocalFileFormat::bake(const Baker & baker,
             = config->getProcessor(allocationTransform, TRANSFORM_DIR_INVERSE)->getOptimizedCPUProcessor(OPTIMIZATION_LOSSLESS);
 
         PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
-        shaperToInput->apply(shaperInImg);
-        shaperToInput->apply(cubeImg);
+        ApplyParallel(shaperToInput, &shaperInData[0], shaperSize);
+        ApplyParallel(shaperToInput, &cubeData[0], cubeSize*cubeSize*cubeSize);
 
         // Apply the 3D LUT to the remainder (from the input to the output).
         ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-        inputToTarget->apply(cubeImg);
+        ApplyParallel(inputToTarget, &cubeData[0], cubeSize*cubeSize*cubeSize);
     }
 
     // Write out the file.
@@ -810,35 +794,37 @@ void LocalFileFormat::bake(const Baker & baker,
         throw Exception("Internal shaper size exception.");
     }
 
+    TextLutWriter writer(ostream, 6);
+
     if(!shaperInData.empty())
     {
         for(int c=0; c<3; ++c)
         {
-            ostream << shaperInData.size()/3 << "\n";
+            writer << static_cast<int>(shaperInData.size()/3) << "\n";
             for(unsigned int i = 0; i<shaperInData.size()/3; ++i)
             {
-                if(i != 0) ostream << " ";
-                ostream << shaperInData[3*i+c];
+                if(i != 0) writer << " ";
+                writer << shaperInData[3*i+c];
             }
-            ostream << "\n";
+            writer << "\n";
 
             for(unsigned int i = 0; i<shaperInData.size()/3; ++i)
             {
-                if(i != 0) ostream << " ";
-                ostream << shaperOutData[3*i+c];
+                if(i != 0) writer << " ";
+                writer << shaperOutData[3*i+c];
             }
-            ostream << "\n";
+            writer << "\n";
         }
     }
-    ostream << "\n";
+    writer << "\n";
 
     // Write out the 3D Cube.
-    ostream << cubeSize << " " << cubeSize << " " << cubeSize << "\n";
+    writer << cubeSize << " " << cubeSize << " " << cubeSize << "\n";
     for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
     {
-        ostream << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
+        writer << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
     }
-    ostream << "\n";
+    writer << "\n";
 }
 
 void
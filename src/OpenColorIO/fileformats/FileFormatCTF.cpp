@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdio>
 #include <iostream>
 #include <fstream>
@@ -195,22 +196,45 @@ public:
 
     void Parse(std::istream & istream)
     {
-        std::string line;
-        m_lineNumber = 0;
-        while (istream.good())
+        // Read the complete content and give it to the parser in large blocks of complete
+        // lines, instead of line by line, as that's the bottleneck of the large LUTs.
+        // Note: The line numbers are then provided by the parser.
+        std::string content;
+        ReadStreamContent(istream, content);
+
+        // Parsing will copy the buffer up to its length without the null termination.
+        // Our code will be called back to parse the buffer into numbers. The buffer
+        // has to be delimited so that the number parsing does not access it after its
+        // length, hence the newline character is added back to the last line.
+        content.push_back('\n');
+
+        static constexpr size_t BLOCK_SIZE = 1 << 16;
+
+        m_parsing = true;
+
+        size_t blockStart = 0;
+        while (blockStart < content.size())
         {
-            std::getline(istream, line);
-            // Add back the newline character. Parsing will copy the line in a
-            // buffer up to the length of the line without the null termination.
-            // Our code will be called back to parse the buffer into a number.
-            // Code uses strtod. The buffer has to be delimited so that strtod
-            // does not access it after its length.
-            line.push_back('\n');
-            ++m_lineNumber;
-
-            Parse(line, !istream.good());
+            size_t blockEnd = content.size();
+            if (blockEnd - blockStart > BLOCK_SIZE)
+            {
+                // Cut the block after a newline so that the values are never split.
+                const size_t eol = content.find('\n', blockStart + BLOCK_SIZE);
+                blockEnd = (eol == std::string::npos) ? content.size() : eol + 1;
+            }
+
+            Parse(content.c_str() + blockStart, blockEnd - blockStart,
+                  blockEnd == content.size());
+
+            blockStart = blockEnd;
         }
 
+        m_parsing = false;
+
+        // Same line count as reading the stream line by line.
+        m_lineNumber = static_cast<unsigned int>(
+            std::count(content.begin(), content.end() - 1, '\n') + 1);
+
         if (!m_elms.empty())
         {
             std::string error("CTF/CLF parsing error (no closing tag for '");
@@ -235,13 +259,13 @@ public:
         }
     }
 
-    void Parse(const std::string & buffer, bool lastLine)
+    void Parse(const char * buffer, size_t size, bool lastBlock)
     {
-        const int done = lastLine?1:0;
+        const int done = lastBlock?1:0;
 
         if (XML_STATUS_ERROR == XML_Parse(m_parser,
-                                          buffer.c_str(),
-                                          (int)buffer.size(), done))
+                                          buffer,
+                                          (int)size, done))
         {
             XML_Error eXpatErrorCode = XML_GetErrorCode(m_parser);
             if (eXpatErrorCode == XML_ERROR_TAG_MISMATCH)
@@ -328,7 +352,7 @@ private:
         os << "Error parsing CTF/CLF file (";
         os << m_fileName.c_str() << "). ";
         os << "Error is: " << error.c_str();
-        os << ". At line (" << m_lineNumber << ")";
+        os << ". At line (" << getXmLineNumber() << ")";
         throw Exception(os.str().c_str());
     }
 
@@ -503,7 +527,7 @@ private:
                     std::make_shared<CTFReaderMetadataElt>(
                         name,
                         pMD,
-                        pImpl->m_lineNumber,
+                        pImpl->getXmLineNumber(),
                         pImpl->m_fileName));
 
                 pImpl->m_elms.back()->start(atts);
@@ -1141,7 +1165,8 @@ private:
 
     unsigned int getXmLineNumber() const
     {
-        return m_lineNumber;
+        return m_parsing ? static_cast<unsigned int>(XML_GetCurrentLineNumber(m_parser))
+                         : m_lineNumber;
     }
 
     const std::string & getXmlFilename() const
@@ -1155,7 +1180,8 @@ private:
     }
 
     XML_Parser m_parser;
-    unsigned int m_lineNumber;
+    unsigned int m_lineNumber{ 0 };
+    bool m_parsing{ false };
     std::string m_fileName;
     bool m_isCLF;
     XmlReaderElementStack m_elms; // Parsing stack
@@ -1454,9 +1480,8 @@ void LocalFileFormat::bake(const Baker & baker,
             }
         }
         const auto shaperSize = shaperLut->getArray().getLength();
-        PackedImageDesc shaperImg(shaperLut->getArray().getValues().data(),shaperSize, 1, 3);
         ConstCPUProcessorRcPtr inputToShaper = GetInputToShaperProcessor(baker);
-        inputToShaper->apply(shaperImg);
+        ApplyParallel(inputToShaper, shaperLut->getArray().getValues().data(), shaperSize);
     }
 
     //
@@ -1468,7 +1493,6 @@ void LocalFileFormat::bake(const Baker & baker,
     {
         cubeData.resize(cubeSize*cubeSize*cubeSize * 3);
         GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
         ConstCPUProcessorRcPtr cubeProc;
         if (required_lut == CTF_1D_3D)
@@ -1480,7 +1504,7 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTarget;
         }
 
-        cubeProc->apply(cubeImg);
+        ApplyParallel(cubeProc, &cubeData[0], cubeSize*cubeSize*cubeSize);
     }
 
     //
@@ -1503,8 +1527,7 @@ void LocalFileFormat::bake(const Baker & baker,
             GenerateIdentityLut1D(&onedData[0], onedSize, 3);
         }
 
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-        inputToTarget->apply(onedImg);
+        ApplyParallel(inputToTarget, &onedData[0], onedSize);
     }
 
     //
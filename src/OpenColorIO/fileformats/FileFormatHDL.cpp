@@ -655,9 +655,8 @@ void LocalFileFormat::bake(const Baker & baker,
         GenerateLinearScaleLut1D(
             prelutData.data(), shaperSize, 3, fromInStart, fromInEnd);
 
-        PackedImageDesc prelutImg(&prelutData[0], shaperSize, 1, 3);
         ConstCPUProcessorRcPtr inputToShaper = GetInputToShaperProcessor(baker);
-        inputToShaper->apply(prelutImg);
+        ApplyParallel(inputToShaper, &prelutData[0], shaperSize);
     }
 
     // TODO: Do same "auto prelut" input-space allocation as FileFormatCSP?
@@ -669,7 +668,6 @@ void LocalFileFormat::bake(const Baker & baker,
         cubeData.resize(cubeSize*cubeSize*cubeSize*3);
 
         GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
         ConstCPUProcessorRcPtr cubeProc;
         if(required_lut == HDL_3D1D)
@@ -682,7 +680,7 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTarget;
         }
 
-        cubeProc->apply(cubeImg);
+        ApplyParallel(cubeProc, &cubeData[0], cubeSize*cubeSize*cubeSize);
     }
 
 
@@ -703,8 +701,7 @@ void LocalFileFormat::bake(const Baker & baker,
             GenerateIdentityLut1D(&onedData[0], onedSize, 3);
         }
 
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-        inputToTarget->apply(onedImg);
+        ApplyParallel(inputToTarget, &onedData[0], onedSize);
     }
 
 
@@ -735,28 +732,30 @@ void LocalFileFormat::bake(const Baker & baker,
 
     ostream << "LUT:\n";
 
+    TextLutWriter writer(ostream, 6);
+
     // Write prelut
     if(required_lut == HDL_3D1D)
     {
-        ostream << "Pre {\n";
+        writer << "Pre {\n";
         for(int i=0; i < shaperSize; ++i)
         {
             // Grab green channel from RGB prelut
-            ostream << "\t" << prelutData[i*3+1] << "\n";
+            writer << "\t" << prelutData[i*3+1] << "\n";
         }
-        ostream << "}\n";
+        writer << "}\n";
     }
 
     // Write "3D {" part of output of 3D+1D LUT
     if(required_lut == HDL_3D1D)
     {
-        ostream << "3D {\n";
+        writer << "3D {\n";
     }
 
     // Write the slightly-different "{" without line for the 3D-only LUT
     if(required_lut == HDL_3D)
     {
-        ostream << " {\n";
+        writer << " {\n";
     }
 
     // Write the cube data after the "{"
@@ -767,32 +766,32 @@ void LocalFileFormat::bake(const Baker & baker,
             // TODO: Original baker code clamped values to
             // 1.0, was this necessary/desirable?
 
-            ostream << "\t" << cubeData[3*i+0];
-            ostream << " "  << cubeData[3*i+1];
-            ostream << " "  << cubeData[3*i+2] << "\n";
+            writer << "\t" << cubeData[3*i+0];
+            writer << " "  << cubeData[3*i+1];
+            writer << " "  << cubeData[3*i+2] << "\n";
         }
 
         // Write closing "}"
-        ostream << " }\n";
+        writer << " }\n";
     }
 
     // Write out channels for 1D LUT
     if(required_lut == HDL_1D)
     {
-        ostream << "R {\n";
+        writer << "R {\n";
         for(int i=0; i < onedSize; ++i)
-            ostream << "\t" << onedData[i*3+0] << "\n";
-        ostream << "}\n";
+            writer << "\t" << onedData[i*3+0] << "\n";
+        writer << "}\n";
 
-        ostream << "G {\n";
+        writer << "G {\n";
         for(int i=0; i < onedSize; ++i)
-            ostream << "\t" << onedData[i*3+1] << "\n";
-        ostream << "}\n";
+            writer << "\t" << onedData[i*3+1] << "\n";
+        writer << "}\n";
 
-        ostream << "B {\n";
+        writer << "B {\n";
         for(int i=0; i < onedSize; ++i)
-            ostream << "\t" << onedData[i*3+2] << "\n";
-        ostream << "}\n";
+            writer << "\t" << onedData[i*3+2] << "\n";
+        writer << "}\n";
     }
 }
 
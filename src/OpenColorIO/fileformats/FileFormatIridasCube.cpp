@@ -171,14 +171,18 @@ LocalFileFormat::read(std::istream & istream,
     float domain_max[] = { 1.0f, 1.0f, 1.0f };
 
     {
+        TextLutScanner scanner(istream);
+
         std::string line;
         int lineNumber = 0;
         char endTok;
         bool entriesStarted = false;
 
-        while(!entriesStarted && nextline(istream, line))
+        while(!entriesStarted && scanner.nextNonEmptyLine())
         {
             ++lineNumber;
+            line = scanner.getLine();
+
             // All lines starting with '#' are comments
             if (StringUtils::StartsWith(line,'#')) continue;
 
@@ -308,59 +312,45 @@ LocalFileFormat::read(std::istream & istream,
             }
         }
 
-        do
+        // Parse the color triples in place (i.e. without copying the lines).
+        while (entriesStarted)
         {
-            line = StringUtils::LeftTrim(line);
+            TextLutScanner::Token tokens[3];
+            const size_t numTokens = scanner.getTokens(tokens, 3);
 
             // All lines starting with '#' are comments
-            if (StringUtils::StartsWith(line,'#')) continue;
-
-            if (line.empty()) continue;
-
-            char valR[64] = "";
-            char valG[64] = "";
-            char valB[64] = "";
-
-#ifdef _WIN32
-            if (sscanf_s(line.c_str(), "%s %s %s %c", valR, 64, valG, 64, valB, 64, &endTok, 1) != 3)
-#else
-            if (sscanf(line.c_str(), "%s %s %s %c", valR, valG, valB, &endTok) != 3)
-#endif
-            {
-                // It must be a float triple!
-                ThrowErrorMessage(
-                    "Malformed color triples specified.",
-                    fileName,
-                    lineNumber,
-                    line);
-            }
-            else
+            if (numTokens > 0 && *tokens[0].m_begin != '#')
             {
-                float r = NAN;
-                float g = NAN;
-                float b = NAN;
+                if (numTokens != 3)
+                {
+                    // It must be a float triple!
+                    ThrowErrorMessage(
+                        "Malformed color triples specified.",
+                        fileName,
+                        lineNumber,
+                        StringUtils::LeftTrim(scanner.getLine()));
+                }
 
-                const auto rAnswer = NumberUtils::from_chars(valR, valR + 64, r);
-                const auto gAnswer = NumberUtils::from_chars(valG, valG + 64, g);
-                const auto bAnswer = NumberUtils::from_chars(valB, valB + 64, b);
+                float rgb[3] = { NAN, NAN, NAN };
 
-                if (rAnswer.ec != std::errc() || gAnswer.ec != std::errc() || bAnswer.ec != std::errc())
+                if (!TextLutScanner::ParseFloat(tokens[0], rgb[0])
+                    || !TextLutScanner::ParseFloat(tokens[1], rgb[1])
+                    || !TextLutScanner::ParseFloat(tokens[2], rgb[2]))
                 {
                     ThrowErrorMessage(
                         "Invalid color triples",
                         fileName,
                         lineNumber,
-                        line);
+                        StringUtils::LeftTrim(scanner.getLine()));
                 }
 
-                raw.push_back(r);
-                raw.push_back(g);
-                raw.push_back(b);
+                raw.insert(raw.end(), rgb, rgb + 3);
+
+                ++lineNumber;
             }
 
-            ++lineNumber;
+            entriesStarted = scanner.nextNonEmptyLine();
         }
-        while (nextline(istream, line));
     }
 
     // Interpret the parsed data, validate LUT sizes.
@@ -463,9 +453,8 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyParallel(inputToTarget, &cubeData[0], cubeSize*cubeSize*cubeSize);
 
     const auto & metadata = baker.getFormatMetadata();
     const auto nb = metadata.getNumChildrenElements();
@@ -484,11 +473,13 @@ void LocalFileFormat::bake(const Baker & baker,
     // Set to a fixed 6 decimal precision
     ostream.setf(std::ios::fixed, std::ios::floatfield);
     ostream.precision(6);
+
+    TextLutWriter writer(ostream, 6);
     for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
     {
-        ostream << cubeData[3*i+0] << " "
-                << cubeData[3*i+1] << " "
-                << cubeData[3*i+2] << "\n";
+        writer << cubeData[3*i+0] << " "
+               << cubeData[3*i+1] << " "
+               << cubeData[3*i+2] << "\n";
     }
 }
 
@@ -253,11 +253,10 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     // Apply our conversion from the input space to the output space.
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyParallel(inputToTarget, &cubeData[0], cubeSize*cubeSize*cubeSize);
 
     // Write out the file.
     // For for maximum compatibility with other apps, we will
@@ -272,14 +271,16 @@ void LocalFileFormat::bake(const Baker & baker,
     // Set to a fixed 6 decimal precision
     ostream.setf(std::ios::fixed, std::ios::floatfield);
     ostream.precision(6);
+
+    TextLutWriter writer(ostream, 6);
     for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
     {
         float r = cubeData[3*i+0];
         float g = cubeData[3*i+1];
         float b = cubeData[3*i+2];
-        ostream << r << " " << g << " " << b << "\n";
+        writer << r << " " << g << " " << b << "\n";
     }
-    ostream << "\n";
+    writer << "\n";
 }
 
 
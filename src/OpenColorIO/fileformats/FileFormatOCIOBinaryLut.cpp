@@ -0,0 +1,897 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include <Imath/half.h>
+#include <zlib.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BakingUtils.h"
+#include "fileformats/FileFormatUtils.h"
+#include "Logging.h"
+#include "OpBuilders.h"
+#include "ops/lut1d/Lut1DOp.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/matrix/MatrixOp.h"
+#include "ops/range/RangeOp.h"
+#include "Platform.h"
+#include "transforms/FileTransform.h"
+
+
+/*
+
+OpenColorIO binary LUT (.olut)
+
+A compact container for a chain of Matrix, Range, Lut1D & Lut3D ops, meant to replace the
+text LUT formats when the load time matters (e.g. a LUT library converted once). All the
+values are little-endian.
+
+Header (64 bytes):
+
+    char     magic[8]        'OCIOBLUT'
+    uint16   versionMajor    1
+    uint16   versionMinor    0
+    uint32   flags           FLAG_COMPRESSED if the payload is zlib compressed
+    uint32   numOps          Number of op records in the payload
+    uint32   headerSize      64
+    uint64   payloadSize     Size of the (uncompressed) payload
+    uint64   storedSize      Size of the payload as stored after the header
+    uint32   checksum        CRC-32 of the stored payload
+    (zero padding up to 64 bytes)
+
+Payload, one record per op:
+
+    uint32   opType          OP_MATRIX, OP_RANGE, OP_LUT1D or OP_LUT3D
+    uint32   opFlags         OP_FLAG_INVERSE, OP_FLAG_HALF_DOMAIN, OP_FLAG_RAW_HALFS,
+                             OP_FLAG_HUE_DW3
+    uint32   interpolation   Interpolation enum value (LUTs only)
+    uint32   valueType       VALUE_F64, VALUE_F32 or VALUE_F16
+    uint32   dimension       Lut1D length or Lut3D grid size (0 otherwise)
+    uint32   numComponents   Lut1D number of channels (0 otherwise)
+    uint64   dataSize        Size of the data following the record header
+
+    Matrix:  16 + 4 float64 (i.e. the 4x4 matrix in row-major order then the offsets)
+    Range:   4 float64 (i.e. minIn, maxIn, minOut, maxOut where NaN means unset)
+    Lut1D:   length x 3 values, with the red, green & blue values interleaved
+    Lut3D:   gridSize^3 x 3 values, blue changing fastest
+
+The data size of each record is padded to a multiple of 16 bytes so that all the arrays of
+an uncompressed file are 16-byte aligned from the start of the file i.e. a memory mapped
+file could directly be used.
+
+*/
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+constexpr char MAGIC[8] = { 'O', 'C', 'I', 'O', 'B', 'L', 'U', 'T' };
+
+constexpr uint16_t VERSION_MAJOR = 1;
+constexpr uint16_t VERSION_MINOR = 0;
+
+constexpr uint32_t HEADER_SIZE    = 64;
+constexpr uint32_t DATA_ALIGNMENT = 16;
+
+constexpr uint32_t FLAG_COMPRESSED = 0x1;
+
+constexpr uint32_t OP_MATRIX = 1;
+constexpr uint32_t OP_RANGE  = 2;
+constexpr uint32_t OP_LUT1D  = 3;
+constexpr uint32_t OP_LUT3D  = 4;
+
+constexpr uint32_t OP_FLAG_INVERSE     = 0x1;
+constexpr uint32_t OP_FLAG_HALF_DOMAIN = 0x2;
+constexpr uint32_t OP_FLAG_RAW_HALFS   = 0x4;
+constexpr uint32_t OP_FLAG_HUE_DW3     = 0x8;
+
+constexpr uint32_t VALUE_F64 = 1;
+constexpr uint32_t VALUE_F32 = 2;
+constexpr uint32_t VALUE_F16 = 3;
+
+constexpr char FORMAT_NAME[]            = "ocio_binary_lut";
+constexpr char FORMAT_NAME_HALF[]       = "ocio_binary_lut_half";
+constexpr char FORMAT_NAME_COMPRESSED[] = "ocio_binary_lut_compressed";
+constexpr char FORMAT_EXTENSION[]       = "olut";
+
+inline uint64_t AlignedSize(uint64_t size)
+{
+    return (size + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+}
+
+// Serialize the values to little-endian bytes.
+class BinaryWriter
+{
+public:
+    explicit BinaryWriter(std::vector<uint8_t> & buffer) : m_buffer(buffer) {}
+
+    void putU16(uint16_t v)
+    {
+        putBytes<2>(v);
+    }
+
+    void putU32(uint32_t v)
+    {
+        putBytes<4>(v);
+    }
+
+    void putU64(uint64_t v)
+    {
+        putBytes<8>(v);
+    }
+
+    void putF64(double v)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        putU64(bits);
+    }
+
+    void putFloats(const float * values, size_t numValues, uint32_t valueType)
+    {
+        if (valueType == VALUE_F16)
+        {
+            for (size_t idx = 0; idx < numValues; ++idx)
+            {
+                putU16(half(values[idx]).bits());
+            }
+        }
+        else
+        {
+#if OCIO_LITTLE_ENDIAN
+            const uint8_t * bytes = reinterpret_cast<const uint8_t *>(values);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + numValues * sizeof(float));
+#else
+            for (size_t idx = 0; idx < numValues; ++idx)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &values[idx], sizeof(bits));
+                putU32(bits);
+            }
+#endif
+        }
+    }
+
+    void pad(size_t alignment)
+    {
+        m_buffer.resize((m_buffer.size() + alignment - 1) / alignment * alignment, 0);
+    }
+
+private:
+    template<int N, typename T>
+    void putBytes(T v)
+    {
+        for (int idx = 0; idx < N; ++idx)
+        {
+            m_buffer.push_back(uint8_t((v >> (8 * idx)) & 0xFF));
+        }
+    }
+
+    std::vector<uint8_t> & m_buffer;
+};
+
+// Read little-endian values from a memory buffer, throwing if reading past its end.
+class BinaryReader
+{
+public:
+    BinaryReader(const uint8_t * data, size_t size, const std::string & fileName)
+        :   m_data(data)
+        ,   m_size(size)
+        ,   m_fileName(fileName)
+    {
+    }
+
+    uint16_t getU16() { return getBytes<uint16_t, 2>(); }
+    uint32_t getU32() { return getBytes<uint32_t, 4>(); }
+    uint64_t getU64() { return getBytes<uint64_t, 8>(); }
+
+    double getF64()
+    {
+        const uint64_t bits = getU64();
+        double v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    void getFloats(float * values, size_t numValues, uint32_t valueType)
+    {
+        if (valueType == VALUE_F16)
+        {
+            checkAvailable(numValues * 2);
+            for (size_t idx = 0; idx < numValues; ++idx)
+            {
+                half h;
+                h.setBits(getU16());
+                values[idx] = h;
+            }
+        }
+        else if (valueType == VALUE_F32)
+        {
+            checkAvailable(numValues * 4);
+#if OCIO_LITTLE_ENDIAN
+            std::memcpy(values, m_data + m_pos, numValues * sizeof(float));
+            m_pos += numValues * sizeof(float);
+#else
+            for (size_t idx = 0; idx < numValues; ++idx)
+            {
+                const uint32_t bits = getU32();
+                std::memcpy(&values[idx], &bits, sizeof(float));
+            }
+#endif
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "Unsupported LUT value type '" << valueType << "'.";
+            throwError(oss.str());
+        }
+    }
+
+    void getChars(char * values, size_t numValues)
+    {
+        checkAvailable(numValues);
+        std::memcpy(values, m_data + m_pos, numValues);
+        m_pos += numValues;
+    }
+
+    void skip(size_t numBytes)
+    {
+        checkAvailable(numBytes);
+        m_pos += numBytes;
+    }
+
+    size_t position() const { return m_pos; }
+
+    void checkAvailable(size_t numBytes) const
+    {
+        if (numBytes > m_size - m_pos)
+        {
+            throwError("Unexpected end of file.");
+        }
+    }
+
+    [[noreturn]] void throwError(const std::string & error) const
+    {
+        std::ostringstream oss;
+        oss << "Error parsing OCIO binary LUT file (" << m_fileName << "). " << error;
+        throw Exception(oss.str().c_str());
+    }
+
+private:
+    template<typename T, int N>
+    T getBytes()
+    {
+        checkAvailable(N);
+        T v = 0;
+        for (int idx = 0; idx < N; ++idx)
+        {
+            v |= T(m_data[m_pos + idx]) << (8 * idx);
+        }
+        m_pos += N;
+        return v;
+    }
+
+    const uint8_t * m_data;
+    size_t m_size;
+    size_t m_pos{ 0 };
+    const std::string & m_fileName;
+};
+
+class LocalCachedFile : public CachedFile
+{
+public:
+    LocalCachedFile() = default;
+    ~LocalCachedFile() = default;
+
+    // The ops in the forward direction of the file.
+    ConstOpDataVec m_ops;
+};
+
+typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
+
+
+class LocalFileFormat : public FileFormat
+{
+public:
+    LocalFileFormat() = default;
+    ~LocalFileFormat() = default;
+
+    void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
+
+    CachedFileRcPtr read(std::istream & istream,
+                         const std::string & fileName,
+                         Interpolation interp) const override;
+
+    void bake(const Baker & baker,
+              const std::string & formatName,
+              std::ostream & ostream) const override;
+
+    void write(const ConstConfigRcPtr & config,
+               const ConstContextRcPtr & context,
+               const GroupTransform & group,
+               const std::string & formatName,
+               std::ostream & ostream) const override;
+
+    void buildFileOps(OpRcPtrVec & ops,
+                      const Config & config,
+                      const ConstContextRcPtr & context,
+                      CachedFileRcPtr untypedCachedFile,
+                      const FileTransform & fileTransform,
+                      TransformDirection dir) const override;
+
+    bool isBinary() const override
+    {
+        return true;
+    }
+
+private:
+    static void WriteOps(const OpRcPtrVec & ops,
+                         const std::string & formatName,
+                         std::ostream & ostream);
+};
+
+void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
+{
+    FormatInfo info;
+    info.name = FORMAT_NAME;
+    info.extension = FORMAT_EXTENSION;
+    info.capabilities = FormatCapabilityFlags(FORMAT_CAPABILITY_READ |
+                                              FORMAT_CAPABILITY_BAKE |
+                                              FORMAT_CAPABILITY_WRITE);
+    info.bake_capabilities = FormatBakeFlags(FORMAT_BAKE_CAPABILITY_3DLUT |
+                                             FORMAT_BAKE_CAPABILITY_1DLUT |
+                                             FORMAT_BAKE_CAPABILITY_1D_3D_LUT);
+    formatInfoVec.push_back(info);
+
+    // The variants only differ in the way the values are stored, any of the variants is read
+    // by the same reader.
+
+    FormatInfo infoHalf = info;
+    infoHalf.name = FORMAT_NAME_HALF;
+    infoHalf.capabilities = FormatCapabilityFlags(FORMAT_CAPABILITY_BAKE |
+                                                  FORMAT_CAPABILITY_WRITE);
+    formatInfoVec.push_back(infoHalf);
+
+    FormatInfo infoCompressed = infoHalf;
+    infoCompressed.name = FORMAT_NAME_COMPRESSED;
+    formatInfoVec.push_back(infoCompressed);
+}
+
+CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
+                                      const std::string & fileName,
+                                      Interpolation interp) const
+{
+    // This shouldn't happen.
+    if (!istream)
+    {
+        throw Exception("File stream empty when trying to read OCIO binary LUT.");
+    }
+
+    std::string content;
+    ReadStreamContent(istream, content);
+
+    BinaryReader header(reinterpret_cast<const uint8_t *>(content.data()),
+                        content.size(),
+                        fileName);
+
+    char magic[sizeof(MAGIC)];
+    if (content.size() < HEADER_SIZE)
+    {
+        header.throwError("File is too small to be a binary LUT.");
+    }
+    header.getChars(magic, sizeof(MAGIC));
+    if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        header.throwError("Missing the 'OCIOBLUT' file signature.");
+    }
+
+    const uint16_t versionMajor = header.getU16();
+    const uint16_t versionMinor = header.getU16();
+    if (versionMajor != VERSION_MAJOR)
+    {
+        std::ostringstream oss;
+        oss << "Unsupported file version '" << versionMajor << "." << versionMinor << "'.";
+        header.throwError(oss.str());
+    }
+
+    const uint32_t flags       = header.getU32();
+    const uint32_t numOps      = header.getU32();
+    const uint32_t headerSize  = header.getU32();
+    const uint64_t payloadSize = header.getU64();
+    const uint64_t storedSize  = header.getU64();
+    const uint32_t checksum    = header.getU32();
+
+    if (headerSize < HEADER_SIZE || headerSize > content.size()
+        || storedSize != content.size() - headerSize)
+    {
+        header.throwError("Invalid header, the file might be truncated.");
+    }
+
+    const uint8_t * stored = reinterpret_cast<const uint8_t *>(content.data()) + headerSize;
+
+    if (uint32_t(crc32(0L, stored, uInt(storedSize))) != checksum)
+    {
+        header.throwError("Checksum mismatch, the file is corrupted.");
+    }
+
+    std::vector<uint8_t> uncompressed;
+    const uint8_t * payload = stored;
+    if (flags & FLAG_COMPRESSED)
+    {
+        uncompressed.resize(size_t(payloadSize));
+        uLongf destSize = uLongf(payloadSize);
+        if (uncompress(uncompressed.data(), &destSize, stored, uLong(storedSize)) != Z_OK
+            || destSize != payloadSize)
+        {
+            header.throwError("Failed to decompress the LUT data.");
+        }
+        payload = uncompressed.data();
+    }
+    else if (payloadSize != storedSize)
+    {
+        header.throwError("Invalid payload size.");
+    }
+
+    BinaryReader reader(payload, size_t(payloadSize), fileName);
+
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+    cachedFile->m_ops.reserve(numOps);
+
+    for (uint32_t opIdx = 0; opIdx < numOps; ++opIdx)
+    {
+        const uint32_t opType        = reader.getU32();
+        const uint32_t opFlags       = reader.getU32();
+        const uint32_t opInterp      = reader.getU32();
+        const uint32_t valueType     = reader.getU32();
+        const uint32_t dimension     = reader.getU32();
+        const uint32_t numComponents = reader.getU32();
+        const uint64_t dataSize      = reader.getU64();
+
+        reader.checkAvailable(size_t(dataSize));
+        const size_t dataEnd = reader.position() + size_t(dataSize);
+
+        const TransformDirection dir = (opFlags & OP_FLAG_INVERSE) ? TRANSFORM_DIR_INVERSE
+                                                                   : TRANSFORM_DIR_FORWARD;
+
+        // Use the file interpolation unless the LUT was written with a specific one.
+        Interpolation lutInterp = Interpolation(opInterp);
+        if (lutInterp == INTERP_DEFAULT)
+        {
+            lutInterp = interp;
+        }
+
+        if (opType == OP_MATRIX)
+        {
+            MatrixOpDataRcPtr mat = std::make_shared<MatrixOpData>(dir);
+            for (unsigned long idx = 0; idx < 16; ++idx)
+            {
+                mat->setArrayValue(idx, reader.getF64());
+            }
+            for (unsigned long idx = 0; idx < 4; ++idx)
+            {
+                mat->setOffsetValue(idx, reader.getF64());
+            }
+            mat->setFileOutputBitDepth(BIT_DEPTH_F32);
+            cachedFile->m_ops.push_back(mat);
+        }
+        else if (opType == OP_RANGE)
+        {
+            const double minIn  = reader.getF64();
+            const double maxIn  = reader.getF64();
+            const double minOut = reader.getF64();
+            const double maxOut = reader.getF64();
+            RangeOpDataRcPtr range
+                = std::make_shared<RangeOpData>(minIn, maxIn, minOut, maxOut, dir);
+            range->setFileOutputBitDepth(BIT_DEPTH_F32);
+            cachedFile->m_ops.push_back(range);
+        }
+        else if (opType == OP_LUT1D)
+        {
+            if (numComponents != 1 && numComponents != 3)
+            {
+                reader.throwError("Invalid number of LUT 1D components.");
+            }
+
+            const Lut1DOpData::HalfFlags halfFlags = Lut1DOpData::HalfFlags(
+                ((opFlags & OP_FLAG_HALF_DOMAIN) ? Lut1DOpData::LUT_INPUT_HALF_CODE : 0) |
+                ((opFlags & OP_FLAG_RAW_HALFS) ? Lut1DOpData::LUT_OUTPUT_HALF_CODE : 0));
+
+            Lut1DOpDataRcPtr lut = std::make_shared<Lut1DOpData>(halfFlags, dimension, false);
+            lut->setDirection(dir);
+            if (Lut1DOpData::IsValidInterpolation(lutInterp))
+            {
+                lut->setInterpolation(lutInterp);
+            }
+            if (opFlags & OP_FLAG_HUE_DW3)
+            {
+                lut->setHueAdjust(HUE_DW3);
+            }
+            lut->setFileOutputBitDepth(BIT_DEPTH_F32);
+
+            Array & lutArray = lut->getArray();
+            lutArray.resize(dimension, numComponents);
+            reader.getFloats(lutArray.getValues().data(), lutArray.getValues().size(), valueType);
+
+            cachedFile->m_ops.push_back(lut);
+        }
+        else if (opType == OP_LUT3D)
+        {
+            Lut3DOpDataRcPtr lut = std::make_shared<Lut3DOpData>(dimension);
+            lut->setDirection(dir);
+            if (Lut3DOpData::IsValidInterpolation(lutInterp))
+            {
+                lut->setInterpolation(lutInterp);
+            }
+            lut->setFileOutputBitDepth(BIT_DEPTH_F32);
+
+            Array & lutArray = lut->getArray();
+            reader.getFloats(lutArray.getValues().data(), lutArray.getValues().size(), valueType);
+
+            cachedFile->m_ops.push_back(lut);
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "Unsupported op type '" << opType << "'.";
+            reader.throwError(oss.str());
+        }
+
+        if (reader.position() > dataEnd)
+        {
+            reader.throwError("Invalid op data size.");
+        }
+        reader.skip(dataEnd - reader.position());
+    }
+
+    for (const auto & op : cachedFile->m_ops)
+    {
+        op->validate();
+    }
+
+    return cachedFile;
+}
+
+void LocalFileFormat::WriteOps(const OpRcPtrVec & ops,
+                               const std::string & formatName,
+                               std::ostream & ostream)
+{
+    uint32_t valueType = VALUE_F32;
+    bool compress = false;
+
+    if (formatName == FORMAT_NAME_HALF)
+    {
+        valueType = VALUE_F16;
+    }
+    else if (formatName == FORMAT_NAME_COMPRESSED)
+    {
+        compress = true;
+    }
+    else if (formatName != FORMAT_NAME)
+    {
+        std::ostringstream os;
+        os << "Unknown OCIO binary LUT format name, '" << formatName << "'.";
+        throw Exception(os.str().c_str());
+    }
+
+    std::vector<uint8_t> payload;
+    BinaryWriter writer(payload);
+
+    for (ConstOpRcPtr op : ops)
+    {
+        ConstOpDataRcPtr opData = op->data();
+
+        uint32_t opType = 0;
+        uint32_t opFlags = 0;
+        uint32_t opInterp = INTERP_DEFAULT;
+        uint32_t opValueType = VALUE_F64;
+        uint32_t dimension = 0;
+        uint32_t numComponents = 0;
+        uint64_t dataSize = 0;
+
+        ConstMatrixOpDataRcPtr mat;
+        ConstRangeOpDataRcPtr range;
+        ConstLut1DOpDataRcPtr lut1D;
+        ConstLut3DOpDataRcPtr lut3D;
+
+        const size_t valueSize = valueType == VALUE_F16 ? 2 : 4;
+
+        if (opData->getType() == OpData::MatrixType)
+        {
+            mat = DynamicPtrCast<const MatrixOpData>(opData);
+            opType = OP_MATRIX;
+            opFlags = mat->getDirection() == TRANSFORM_DIR_INVERSE ? OP_FLAG_INVERSE : 0;
+            dataSize = 20 * sizeof(double);
+        }
+        else if (opData->getType() == OpData::RangeType)
+        {
+            range = DynamicPtrCast<const RangeOpData>(opData);
+            opType = OP_RANGE;
+            opFlags = range->getDirection() == TRANSFORM_DIR_INVERSE ? OP_FLAG_INVERSE : 0;
+            dataSize = 4 * sizeof(double);
+        }
+        else if (opData->getType() == OpData::Lut1DType)
+        {
+            lut1D = DynamicPtrCast<const Lut1DOpData>(opData);
+            opType = OP_LUT1D;
+            opFlags = (lut1D->getDirection() == TRANSFORM_DIR_INVERSE ? OP_FLAG_INVERSE : 0)
+                    | (lut1D->isInputHalfDomain() ? OP_FLAG_HALF_DOMAIN : 0)
+                    | (lut1D->isOutputRawHalfs() ? OP_FLAG_RAW_HALFS : 0)
+                    | (lut1D->getHueAdjust() == HUE_DW3 ? OP_FLAG_HUE_DW3 : 0);
+            opInterp = lut1D->getInterpolation();
+            opValueType = valueType;
+            dimension = lut1D->getArray().getLength();
+            numComponents = lut1D->getArray().getNumColorComponents();
+            dataSize = lut1D->getArray().getValues().size() * valueSize;
+        }
+        else if (opData->getType() == OpData::Lut3DType)
+        {
+            lut3D = DynamicPtrCast<const Lut3DOpData>(opData);
+            opType = OP_LUT3D;
+            opFlags = lut3D->getDirection() == TRANSFORM_DIR_INVERSE ? OP_FLAG_INVERSE : 0;
+            opInterp = lut3D->getInterpolation();
+            opValueType = valueType;
+            dimension = lut3D->getArray().getLength();
+            dataSize = lut3D->getArray().getValues().size() * valueSize;
+        }
+        else
+        {
+            std::ostringstream os;
+            os << "The OCIO binary LUT format only supports Matrix, Range, Lut1D and Lut3D ops,"
+               << " the op '" << op->getInfo() << "' needs to be baked first.";
+            throw Exception(os.str().c_str());
+        }
+
+        writer.putU32(opType);
+        writer.putU32(opFlags);
+        writer.putU32(opInterp);
+        writer.putU32(opValueType);
+        writer.putU32(dimension);
+        writer.putU32(numComponents);
+        writer.putU64(AlignedSize(dataSize));
+
+        if (mat)
+        {
+            const ArrayDouble::Values & values = mat->getArray().getValues();
+            for (unsigned long idx = 0; idx < 16; ++idx)
+            {
+                writer.putF64(values[idx]);
+            }
+            for (unsigned long idx = 0; idx < 4; ++idx)
+            {
+                writer.putF64(mat->getOffsetValue(idx));
+            }
+        }
+        else if (range)
+        {
+            writer.putF64(range->getMinInValue());
+            writer.putF64(range->getMaxInValue());
+            writer.putF64(range->getMinOutValue());
+            writer.putF64(range->getMaxOutValue());
+        }
+        else if (lut1D)
+        {
+            const Array::Values & values = lut1D->getArray().getValues();
+            writer.putFloats(values.data(), values.size(), valueType);
+        }
+        else if (lut3D)
+        {
+            const Array::Values & values = lut3D->getArray().getValues();
+            writer.putFloats(values.data(), values.size(), valueType);
+        }
+
+        writer.pad(DATA_ALIGNMENT);
+    }
+
+    const uint64_t payloadSize = payload.size();
+
+    std::vector<uint8_t> compressed;
+    const std::vector<uint8_t> * stored = &payload;
+    if (compress)
+    {
+        uLongf destSize = compressBound(uLong(payloadSize));
+        compressed.resize(destSize);
+        if (compress2(compressed.data(), &destSize, payload.data(), uLong(payloadSize),
+                      Z_DEFAULT_COMPRESSION) != Z_OK)
+        {
+            throw Exception("Failed to compress the OCIO binary LUT data.");
+        }
+        compressed.resize(destSize);
+        stored = &compressed;
+    }
+
+    std::vector<uint8_t> header;
+    header.reserve(HEADER_SIZE);
+    header.insert(header.end(), MAGIC, MAGIC + sizeof(MAGIC));
+
+    BinaryWriter headerWriter(header);
+    headerWriter.putU16(VERSION_MAJOR);
+    headerWriter.putU16(VERSION_MINOR);
+    headerWriter.putU32(compress ? FLAG_COMPRESSED : 0);
+    headerWriter.putU32(uint32_t(ops.size()));
+    headerWriter.putU32(HEADER_SIZE);
+    headerWriter.putU64(payloadSize);
+    headerWriter.putU64(stored->size());
+    headerWriter.putU32(uint32_t(crc32(0L, stored->data(), uInt(stored->size()))));
+    headerWriter.pad(HEADER_SIZE);
+
+    ostream.write(reinterpret_cast<const char *>(header.data()), header.size());
+    ostream.write(reinterpret_cast<const char *>(stored->data()), stored->size());
+}
+
+void LocalFileFormat::write(const ConstConfigRcPtr & config,
+                            const ConstContextRcPtr & context,
+                            const GroupTransform & group,
+                            const std::string & formatName,
+                            std::ostream & ostream) const
+{
+    OpRcPtrVec ops;
+    BuildGroupOps(ops, *config, context, group, TRANSFORM_DIR_FORWARD);
+
+    ops.finalize();
+
+    // Remove the no-op types (e.g. allocation, file no-ops) which have no representation in
+    // the file.
+    ops.optimize(OPTIMIZATION_NONE);
+
+    WriteOps(ops, formatName, ostream);
+}
+
+// The baker follows the CLF one i.e. a half-domain Lut1D shaper (when no shaper size is
+// requested) followed by a Lut3D, or a single Lut1D when there is no channel crosstalk.
+void LocalFileFormat::bake(const Baker & baker,
+                           const std::string & formatName,
+                           std::ostream & ostream) const
+{
+    static constexpr int DEFAULT_1D_SIZE = 4096;
+    static constexpr int DEFAULT_3D_SIZE = 64;
+
+    int onedSize = baker.getCubeSize();
+    if (onedSize == -1)
+    {
+        onedSize = DEFAULT_1D_SIZE;
+    }
+
+    int cubeSize = baker.getCubeSize();
+    if (cubeSize == -1)
+    {
+        cubeSize = DEFAULT_3D_SIZE;
+    }
+    cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
+
+    const std::string shaperSpace = baker.getShaperSpace();
+
+    ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
+
+    const bool needs3D = inputToTarget->hasChannelCrosstalk();
+    const bool needsShaper = needs3D && !shaperSpace.empty();
+
+    OpRcPtrVec ops;
+
+    float fromInStart = 0.0f;
+    float fromInEnd = 1.0f;
+
+    if (needsShaper)
+    {
+        Lut1DOpDataRcPtr shaperLut;
+
+        const auto shaperSizeRequest = baker.getShaperSize();
+        if (shaperSizeRequest == -1)
+        {
+            shaperLut = std::make_shared<Lut1DOpData>(Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                                      65536, true);
+        }
+        else
+        {
+            GetShaperRange(baker, fromInStart, fromInEnd);
+
+            shaperLut = std::make_shared<Lut1DOpData>(shaperSizeRequest);
+            if (fromInStart != 0.f || fromInEnd != 1.0f)
+            {
+                GenerateLinearScaleLut1D(shaperLut->getArray().getValues().data(),
+                                         shaperSizeRequest, 3, fromInStart, fromInEnd);
+            }
+        }
+
+        const auto shaperSize = shaperLut->getArray().getLength();
+        ApplyParallel(GetInputToShaperProcessor(baker),
+                      shaperLut->getArray().getValues().data(),
+                      shaperSize);
+
+        if (fromInStart != 0.f || fromInEnd != 1.0f)
+        {
+            CreateRangeOp(ops, fromInStart, fromInEnd, 0, 1, TRANSFORM_DIR_FORWARD);
+        }
+        CreateLut1DOp(ops, shaperLut, TRANSFORM_DIR_FORWARD);
+    }
+
+    if (needs3D)
+    {
+        Lut3DOpDataRcPtr lut3D = std::make_shared<Lut3DOpData>((unsigned long)cubeSize);
+        float * values = lut3D->getArray().getValues().data();
+
+        GenerateIdentityLut3D(values, cubeSize, 3, LUT3DORDER_FAST_BLUE);
+
+        ConstCPUProcessorRcPtr cubeProc
+            = needsShaper ? GetShaperToTargetProcessor(baker) : inputToTarget;
+        ApplyParallel(cubeProc, values, cubeSize * cubeSize * cubeSize);
+
+        CreateLut3DOp(ops, lut3D, TRANSFORM_DIR_FORWARD);
+    }
+    else
+    {
+        Lut1DOpDataRcPtr lut1D = std::make_shared<Lut1DOpData>((unsigned long)onedSize);
+        float * values = lut1D->getArray().getValues().data();
+
+        if (!shaperSpace.empty())
+        {
+            GetShaperRange(baker, fromInStart, fromInEnd);
+            GenerateLinearScaleLut1D(values, onedSize, 3, fromInStart, fromInEnd);
+            if (fromInStart != 0.f || fromInEnd != 1.0f)
+            {
+                CreateRangeOp(ops, fromInStart, fromInEnd, 0, 1, TRANSFORM_DIR_FORWARD);
+            }
+        }
+
+        ApplyParallel(inputToTarget, values, onedSize);
+
+        CreateLut1DOp(ops, lut1D, TRANSFORM_DIR_FORWARD);
+    }
+
+    WriteOps(ops, formatName, ostream);
+}
+
+void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
+                                   const Config & /*config*/,
+                                   const ConstContextRcPtr & /*context*/,
+                                   CachedFileRcPtr untypedCachedFile,
+                                   const FileTransform & fileTransform,
+                                   TransformDirection dir) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+
+    // This should never happen.
+    if (!cachedFile)
+    {
+        throw Exception("Cannot build OCIO binary LUT ops. Invalid cache type.");
+    }
+
+    const auto newDir = CombineTransformDirections(dir, fileTransform.getDirection());
+
+    switch (newDir)
+    {
+    case TRANSFORM_DIR_FORWARD:
+    {
+        for (const auto & opData : cachedFile->m_ops)
+        {
+            CreateOpVecFromOpData(ops, opData, newDir);
+        }
+        break;
+    }
+    case TRANSFORM_DIR_INVERSE:
+    {
+        for (auto it = cachedFile->m_ops.rbegin(); it != cachedFile->m_ops.rend(); ++it)
+        {
+            CreateOpVecFromOpData(ops, *it, newDir);
+        }
+        break;
+    }
+    }
+}
+
+} // anonymous namespace
+
+FileFormat * CreateFileFormatOCIOBinaryLut()
+{
+    return new LocalFileFormat();
+}
+
+} // namespace OCIO_NAMESPACE
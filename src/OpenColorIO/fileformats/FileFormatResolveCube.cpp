@@ -584,9 +584,8 @@ void LocalFileFormat::bake(const Baker & baker,
         GenerateLinearScaleLut1D(
             shaperData.data(), shaperSize, 3, fromInStart, fromInEnd);
 
-        PackedImageDesc shaperImg(&shaperData[0], shaperSize, 1, 3);
         ConstCPUProcessorRcPtr inputToShaper = GetInputToShaperProcessor(baker);
-        inputToShaper->apply(shaperImg);
+        ApplyParallel(inputToShaper, &shaperData[0], shaperSize);
     }
 
     //
@@ -598,7 +597,6 @@ void LocalFileFormat::bake(const Baker & baker,
     {
         cubeData.resize(cubeSize*cubeSize*cubeSize*3);
         GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
         ConstCPUProcessorRcPtr cubeProc;
         if(required_lut == CUBE_1D_3D)
@@ -611,7 +609,7 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTarget;
         }
 
-        cubeProc->apply(cubeImg);
+        ApplyParallel(cubeProc, &cubeData[0], cubeSize*cubeSize*cubeSize);
     }
 
     //
@@ -634,8 +632,7 @@ void LocalFileFormat::bake(const Baker & baker,
             GenerateIdentityLut1D(&onedData[0], onedSize, 3);
         }
 
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-        inputToTarget->apply(onedImg);
+        ApplyParallel(inputToTarget, &onedData[0], onedSize);
     }
 
     //
@@ -683,23 +680,25 @@ void LocalFileFormat::bake(const Baker & baker,
         //ostream << "LUT_3D_INPUT_RANGE 0.0 1.0\n";
     }
 
+    TextLutWriter writer(ostream, 6);
+
     // Write 1D data
     if(required_lut == CUBE_1D)
     {
         for(int i=0; i<onedSize; ++i)
         {
-            ostream << onedData[3*i+0] << " "
-                    << onedData[3*i+1] << " "
-                    << onedData[3*i+2] << "\n";
+            writer << onedData[3*i+0] << " "
+                   << onedData[3*i+1] << " "
+                   << onedData[3*i+2] << "\n";
         }
     }
     else if(required_lut == CUBE_1D_3D)
     {
         for(int i=0; i<shaperSize; ++i)
         {
-            ostream << shaperData[3*i+0] << " "
-                    << shaperData[3*i+1] << " "
-                    << shaperData[3*i+2] << "\n";
+            writer << shaperData[3*i+0] << " "
+                   << shaperData[3*i+1] << " "
+                   << shaperData[3*i+2] << "\n";
         }
     }
 
@@ -708,9 +707,9 @@ void LocalFileFormat::bake(const Baker & baker,
     {
         for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
         {
-            ostream << cubeData[3*i+0] << " "
-                    << cubeData[3*i+1] << " "
-                    << cubeData[3*i+2] << "\n";
+            writer << cubeData[3*i+0] << " "
+                   << cubeData[3*i+1] << " "
+                   << cubeData[3*i+2] << "\n";
         }
     }
 }
@@ -353,9 +353,8 @@ void LocalFileFormat::bake(const Baker & baker,
         GenerateIdentityLut1D(&onedData[0], onedSize, 3);
     }
 
-    PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(onedImg);
+    ApplyParallel(inputToTarget, &onedData[0], onedSize);
 
     //
     // Write LUT
@@ -372,17 +371,19 @@ void LocalFileFormat::bake(const Baker & baker,
     ostream << "Components 3" << "\n";
     ostream << "{" << "\n";
 
+    TextLutWriter writer(ostream, 6);
+
     // Write 1D data
     for(int i=0; i<onedSize; ++i)
     {
-        ostream << "    "
-                << onedData[3*i+0] << " "
-                << onedData[3*i+1] << " "
-                << onedData[3*i+2] << "\n";
+        writer << "    "
+               << onedData[3*i+0] << " "
+               << onedData[3*i+1] << " "
+               << onedData[3*i+2] << "\n";
     }
 
     // Footer
-    ostream << "}" << "\n";
+    writer << "}" << "\n";
 }
 
 void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
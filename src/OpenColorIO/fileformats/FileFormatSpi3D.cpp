@@ -13,7 +13,6 @@
 #include "BakingUtils.h"
 #include "transforms/FileTransform.h"
 #include "utils/StringUtils.h"
-#include "utils/NumberUtils.h"
 
 
 /*
@@ -144,34 +143,21 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     Array & lutArray = lut3d->getArray();
     unsigned long numVal = lutArray.getNumValues();
     std::vector<bool> indexDefined(numVal, false);
-    while (istream.good() && entriesRemaining > 0)
+
+    // Parse the remaining lines in place (i.e. without copying them).
+    TextLutScanner scanner(istream);
+    while (entriesRemaining > 0 && scanner.nextLine())
     {
-        istream.getline(lineBuffer, MAX_LINE_SIZE);
-
-        char redValueS[64] = "";
-        char greenValueS[64] = "";
-        char blueValueS[64] = "";
-
-#ifdef _WIN32
-        if (sscanf(lineBuffer,
-            "%d %d %d %s %s %s",
-            &rIndex, &gIndex, &bIndex,
-            redValueS, 64,
-            greenValueS, 64,
-            blueValueS, 64) == 6)
-#else
-        if (sscanf(lineBuffer, "%d %d %d %s %s %s",
-            &rIndex, &gIndex, &bIndex,
-            redValueS, greenValueS, blueValueS) == 6)
-#endif
+        // Lines which are not made of 3 indices and 3 values are ignored.
+        TextLutScanner::Token tokens[6];
+        if (scanner.getTokens(tokens, 6) >= 6
+            && TextLutScanner::ParseInt(tokens[0], rIndex)
+            && TextLutScanner::ParseInt(tokens[1], gIndex)
+            && TextLutScanner::ParseInt(tokens[2], bIndex))
         {
-            const auto redValueAnswer = NumberUtils::from_chars(redValueS, redValueS + 64, redValue);
-            const auto greenValueAnswer = NumberUtils::from_chars(greenValueS, greenValueS + 64, greenValue);
-            const auto blueValueAnswer = NumberUtils::from_chars(blueValueS, blueValueS + 64, blueValue);
-
-            if (redValueAnswer.ec != std::errc()
-                || greenValueAnswer.ec != std::errc()
-                || blueValueAnswer.ec != std::errc())
+            if (!TextLutScanner::ParseFloat(tokens[3], redValue)
+                || !TextLutScanner::ParseFloat(tokens[4], greenValue)
+                || !TextLutScanner::ParseFloat(tokens[5], blueValue))
             {
                 std::ostringstream os;
                 os << "Error parsing .spi3d file (";
@@ -179,7 +165,9 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 os << "). ";
                 os << "Data is invalid. ";
                 os << "A color value is specified (";
-                os << redValueS << " " << greenValueS << " " << blueValueS;
+                os << std::string(tokens[3].m_begin, tokens[3].m_end) << " "
+                   << std::string(tokens[4].m_begin, tokens[4].m_end) << " "
+                   << std::string(tokens[5].m_begin, tokens[5].m_end);
                 os << ") that cannot be parsed as a floating-point triplet.";
                 throw Exception(os.str().c_str());
             }
@@ -278,9 +266,8 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyParallel(inputToTarget, &cubeData[0], cubeSize*cubeSize*cubeSize);
 
     ostream << "SPILUT 1.0\n";
     ostream << "3 3\n";
@@ -289,14 +276,16 @@ void LocalFileFormat::bake(const Baker & baker,
     // Set to a fixed 6 decimal precision
     ostream.setf(std::ios::fixed, std::ios::floatfield);
     ostream.precision(6);
+
+    TextLutWriter writer(ostream, 6);
     for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
     {
-        ostream << ((i / cubeSize) / cubeSize) % cubeSize << " "
-                << (i / cubeSize) % cubeSize << " "
-                << i % cubeSize << " "
-                << cubeData[3*i+0] << " "
-                << cubeData[3*i+1] << " "
-                << cubeData[3*i+2] << "\n";
+        writer << ((i / cubeSize) / cubeSize) % cubeSize << " "
+               << (i / cubeSize) % cubeSize << " "
+               << i % cubeSize << " "
+               << cubeData[3*i+0] << " "
+               << cubeData[3*i+1] << " "
+               << cubeData[3*i+2] << "\n";
     }
 }
 
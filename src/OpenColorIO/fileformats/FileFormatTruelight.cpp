@@ -290,11 +290,10 @@ LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     // Apply processor to LUT data
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyParallel(inputToTarget, &cubeData[0], cubeSize*cubeSize*cubeSize);
 
     int shaperSize = baker.getShaperSize();
     if (shaperSize==-1) shaperSize = DEFAULT_SHAPER_SIZE;
@@ -325,13 +324,14 @@ LocalFileFormat::bake(const Baker & baker,
     ostream << "\n";
 
     // Write the cube
-    ostream << "# Cube\n";
+    TextLutWriter writer(ostream, 6);
+    writer << "# Cube\n";
     for (int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
     {
-        ostream << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
+        writer << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
     }
 
-    ostream << "# end\n";
+    writer << "# end\n";
 }
 
 void
@@ -2,9 +2,17 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <locale>
+#include <sstream>
+
 #include "fileformats/FileFormatUtils.h"
 
 #include "Logging.h"
+#include "utils/NumberUtils.h"
+#include "utils/StringUtils.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -64,4 +72,322 @@ void LogWarningInterpolationNotUsed(Interpolation interp, const FileTransform &
     oss << std::string(fileTransform.getSrc()) << "'.";
     LogWarning(oss.str());
 }
+
+void ReadStreamContent(std::istream & istream, std::string & content)
+{
+    content.clear();
+
+    // Use the remaining size when the stream is seekable.
+    const std::streampos start = istream.tellg();
+    if (start != std::streampos(-1))
+    {
+        istream.seekg(0, std::ios_base::end);
+        const std::streampos end = istream.tellg();
+        istream.seekg(start);
+
+        if (end != std::streampos(-1) && end > start)
+        {
+            content.resize(static_cast<size_t>(end - start));
+            istream.read(&content[0], static_cast<std::streamsize>(content.size()));
+            // Note: The text mode could remove some characters (i.e. '\r' on Windows).
+            content.resize(static_cast<size_t>(istream.gcount()));
+        }
+    }
+    else
+    {
+        std::ostringstream oss;
+        oss << istream.rdbuf();
+        content = oss.str();
+    }
+}
+
+TextLutScanner::TextLutScanner(std::istream & istream)
+{
+    ReadStreamContent(istream, m_content);
+    m_next = m_content.data();
+}
+
+bool TextLutScanner::nextLine() noexcept
+{
+    const char * contentEnd = m_content.data() + m_content.size();
+    if (m_next >= contentEnd)
+    {
+        return false;
+    }
+
+    const char * eol = static_cast<const char *>(
+        std::memchr(m_next, '\n', static_cast<size_t>(contentEnd - m_next)));
+
+    m_lineBegin = m_next;
+    m_lineEnd   = eol ? eol : contentEnd;
+    m_next      = eol ? eol + 1 : contentEnd;
+
+    if (m_lineEnd > m_lineBegin && m_lineEnd[-1] == '\r')
+    {
+        --m_lineEnd;
+    }
+
+    return true;
+}
+
+bool TextLutScanner::nextNonEmptyLine() noexcept
+{
+    while (nextLine())
+    {
+        for (const char * c = m_lineBegin; c < m_lineEnd; ++c)
+        {
+            if (!StringUtils::IsSpace(*c))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+size_t TextLutScanner::getTokens(Token * tokens, size_t maxTokens) const noexcept
+{
+    size_t numTokens = 0;
+
+    const char * c = m_lineBegin;
+    while (true)
+    {
+        while (c < m_lineEnd && StringUtils::IsSpace(*c))
+        {
+            ++c;
+        }
+
+        if (c == m_lineEnd)
+        {
+            break;
+        }
+
+        const char * tokenBegin = c;
+        while (c < m_lineEnd && !StringUtils::IsSpace(*c))
+        {
+            ++c;
+        }
+
+        if (numTokens < maxTokens)
+        {
+            tokens[numTokens] = Token{ tokenBegin, c };
+        }
+        ++numTokens;
+    }
+
+    return numTokens;
+}
+
+bool TextLutScanner::getFloats(float * values, size_t numValues) const noexcept
+{
+    size_t numFound = 0;
+
+    const char * c = m_lineBegin;
+    while (true)
+    {
+        while (c < m_lineEnd && StringUtils::IsSpace(*c))
+        {
+            ++c;
+        }
+
+        if (c == m_lineEnd)
+        {
+            break;
+        }
+
+        const char * tokenBegin = c;
+        while (c < m_lineEnd && !StringUtils::IsSpace(*c))
+        {
+            ++c;
+        }
+
+        if (numFound == numValues || !ParseFloat(Token{ tokenBegin, c }, values[numFound]))
+        {
+            return false;
+        }
+        ++numFound;
+    }
+
+    return numFound == numValues;
+}
+
+bool TextLutScanner::ParseFloat(const Token & token, float & value) noexcept
+{
+    float x = 0.f;
+    const auto result = NumberUtils::from_chars(token.m_begin, token.m_end, x);
+    if (result.ec != std::errc())
+    {
+        return false;
+    }
+
+    value = x;
+    return true;
+}
+
+bool TextLutScanner::ParseInt(const Token & token, int & value) noexcept
+{
+    const char * first = token.m_begin;
+    if (first < token.m_end && *first == '+')
+    {
+        ++first;
+        if (first < token.m_end && *first == '-')
+        {
+            return false;
+        }
+    }
+
+    int x = 0;
+    const auto result = std::from_chars(first, token.m_end, x);
+    if (result.ec != std::errc() || result.ptr != token.m_end)
+    {
+        return false;
+    }
+
+    value = x;
+    return true;
+}
+
+namespace
+{
+// Size of the blocks written to the stream.
+constexpr size_t WRITER_BLOCK_SIZE = 64 * 1024;
+// Largest text of a float or int (the largest float in fixed notation with 9 decimals is less
+// than 60 characters).
+constexpr size_t WRITER_MAX_NUMBER_SIZE = 64;
+// Above that value, the scaled float could overflow the 64-bit integer.
+constexpr double WRITER_MAX_INT_VALUE = 1e9;
+}
+
+TextLutWriter::TextLutWriter(std::ostream & ostream, int precision)
+    :   m_ostream(ostream)
+    ,   m_precision(precision)
+    ,   m_scale(1.0)
+    ,   m_intScale(1)
+{
+    if (precision < 0 || precision > 9)
+    {
+        throw Exception("TextLutWriter: the precision must be in [0, 9].");
+    }
+
+    for (int i = 0; i < precision; ++i)
+    {
+        m_scale    *= 10.0;
+        m_intScale *= 10;
+    }
+
+    m_buffer.resize(WRITER_BLOCK_SIZE + WRITER_MAX_NUMBER_SIZE);
+}
+
+TextLutWriter::~TextLutWriter()
+{
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+void TextLutWriter::flush()
+{
+    if (m_size > 0)
+    {
+        m_ostream.write(m_buffer.data(), m_size);
+        m_size = 0;
+    }
+}
+
+void TextLutWriter::reserve(size_t size)
+{
+    if (m_size + size > m_buffer.size())
+    {
+        flush();
+    }
+}
+
+TextLutWriter & TextLutWriter::operator<<(float value)
+{
+    reserve(WRITER_MAX_NUMBER_SIZE);
+
+    const double absValue = std::fabs(double(value));
+    if (!std::isfinite(value) || absValue >= WRITER_MAX_INT_VALUE)
+    {
+        std::ostringstream oss;
+        oss.imbue(std::locale::classic());
+        oss.setf(std::ios::fixed, std::ios::floatfield);
+        oss.precision(m_precision);
+        oss << value;
+        return *this << oss.str().c_str();
+    }
+
+    // The product is exact in double precision (i.e. a float mantissa has 24 bits and 10^9 is
+    // 2^9 x 5^9 where 5^9 needs 21 bits) so the rounding to nearest, ties to even, gives the same
+    // digits as printf().
+    const unsigned long long scaled
+        = static_cast<unsigned long long>(std::nearbyint(absValue * m_scale));
+
+    char * ptr = &m_buffer[m_size];
+    char * end = ptr + WRITER_MAX_NUMBER_SIZE;
+
+    if (std::signbit(value))
+    {
+        *ptr++ = '-';
+    }
+
+    ptr = std::to_chars(ptr, end, scaled / m_intScale).ptr;
+
+    if (m_precision > 0)
+    {
+        *ptr++ = '.';
+
+        // Zero-padded decimals.
+        unsigned long long decimals = scaled % m_intScale;
+        for (int i = m_precision - 1; i >= 0; --i)
+        {
+            ptr[i] = char('0' + decimals % 10);
+            decimals /= 10;
+        }
+        ptr += m_precision;
+    }
+
+    m_size = ptr - m_buffer.data();
+    return *this;
+}
+
+TextLutWriter & TextLutWriter::operator<<(int value)
+{
+    reserve(WRITER_MAX_NUMBER_SIZE);
+
+    char * ptr = &m_buffer[m_size];
+    ptr = std::to_chars(ptr, ptr + WRITER_MAX_NUMBER_SIZE, value).ptr;
+    m_size = ptr - m_buffer.data();
+    return *this;
+}
+
+TextLutWriter & TextLutWriter::operator<<(const char * str)
+{
+    const size_t length = std::strlen(str);
+    reserve(length);
+
+    if (length > m_buffer.size())
+    {
+        m_ostream.write(str, length);
+    }
+    else
+    {
+        std::memcpy(&m_buffer[m_size], str, length);
+        m_size += length;
+    }
+    return *this;
+}
+
+TextLutWriter & TextLutWriter::operator<<(char c)
+{
+    reserve(1);
+    m_buffer[m_size++] = c;
+    return *this;
+}
+
 } // OCIO_NAMESPACE
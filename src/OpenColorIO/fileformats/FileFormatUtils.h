@@ -5,6 +5,10 @@
 #ifndef INCLUDED_OCIO_FILEFORMAT_UTILS_H
 #define INCLUDED_OCIO_FILEFORMAT_UTILS_H
 
+#include <istream>
+#include <ostream>
+#include <string>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ops/lut1d/Lut1DOpData.h"
@@ -21,6 +25,93 @@ Lut3DOpDataRcPtr HandleLUT3D(const Lut3DOpDataRcPtr & fileLut3D,
                              bool & fileInterpUsed);
 
 void LogWarningInterpolationNotUsed(Interpolation interp, const FileTransform & fileTransform);
+
+// Read the remaining content of the stream at once.
+void ReadStreamContent(std::istream & istream, std::string & content);
+
+// Line & number scanner shared by the text LUT formats (e.g. .cube, .3dl, .spi3d, .csp).
+//
+// The remaining content of the stream is read at once, the lines are then located using
+// memchr() (which is vectorized by the C runtime libraries) and the numbers are parsed in place
+// with NumberUtils::from_chars() i.e. without any intermediate string or string stream.
+class TextLutScanner
+{
+public:
+    struct Token
+    {
+        const char * m_begin;
+        const char * m_end;
+    };
+
+    TextLutScanner() = delete;
+    TextLutScanner(const TextLutScanner &) = delete;
+    TextLutScanner & operator=(const TextLutScanner &) = delete;
+
+    explicit TextLutScanner(std::istream & istream);
+
+    // Move to the next line (empty lines included). Return false at the end of the content.
+    bool nextLine() noexcept;
+    // Move to the next line which is not empty nor only white spaces i.e. same as nextline().
+    bool nextNonEmptyLine() noexcept;
+
+    // The current line, without the end of line character(s).
+    const char * getLineBegin() const noexcept { return m_lineBegin; }
+    const char * getLineEnd() const noexcept { return m_lineEnd; }
+    std::string getLine() const { return std::string(m_lineBegin, m_lineEnd); }
+
+    // Split the current line using white spaces. Store up to maxTokens tokens and return the
+    // total number of tokens of the line.
+    size_t getTokens(Token * tokens, size_t maxTokens) const noexcept;
+
+    // Parse the current line which must contain exactly numValues floats.
+    bool getFloats(float * values, size_t numValues) const noexcept;
+
+    // Same behavior as StringToFloat() i.e. trailing characters are ignored.
+    static bool ParseFloat(const Token & token, float & value) noexcept;
+    // Same behavior as StringToInt(..., true) i.e. the complete token must be a decimal integer.
+    static bool ParseInt(const Token & token, int & value) noexcept;
+
+private:
+    std::string  m_content;
+    const char * m_next      = nullptr; // Start of the next line.
+    const char * m_lineBegin = nullptr;
+    const char * m_lineEnd   = nullptr;
+};
+
+// Text writer shared by the text LUT formats, the counterpart of the TextLutScanner.
+//
+// The floats are formatted in fixed notation (i.e. same text as an ostream using std::fixed and
+// the same precision) without any iostream machinery, and the text is written to the stream in
+// large blocks. The remaining text is written by flush() or the destructor.
+class TextLutWriter
+{
+public:
+    TextLutWriter() = delete;
+    TextLutWriter(const TextLutWriter &) = delete;
+    TextLutWriter & operator=(const TextLutWriter &) = delete;
+
+    // The precision is the number of decimals of the floats and must be in [0, 9].
+    TextLutWriter(std::ostream & ostream, int precision);
+    ~TextLutWriter();
+
+    TextLutWriter & operator<<(float value);
+    TextLutWriter & operator<<(int value);
+    TextLutWriter & operator<<(const char * str);
+    TextLutWriter & operator<<(char c);
+
+    // Write the pending text to the stream.
+    void flush();
+
+private:
+    void reserve(size_t size);
+
+    std::ostream &     m_ostream;
+    const int          m_precision;
+    double             m_scale;    // 10^precision
+    unsigned long long m_intScale; // 10^precision
+    std::string        m_buffer;
+    size_t             m_size = 0; // Number of used characters of the buffer.
+};
 } // OCIO_NAMESPACE
 
 #endif // INCLUDED_OCIO_FILEFORMAT_UTILS_H
\ No newline at end of file
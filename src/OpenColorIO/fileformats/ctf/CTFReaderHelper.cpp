@@ -357,24 +357,37 @@ void CTFReaderArrayElt::setRawData(const char * s,
                                    unsigned int/*xmlLine*/)
 {
     const unsigned long maxValues = m_array->getNumValues();
-    size_t pos(0);
 
     //
-    // using GetNextNumber here instead of GetNumbers to leverage the loop
-    // needed here to process each value from the strings.  This function
-    // is the most used when reading in large transforms.
+    // This function is the most used when reading in large transforms so the
+    // values are scanned & parsed in place (i.e. no string nor vector copies)
+    // and written directly in the preallocated array.
     //
 
-    pos = FindNextTokenStart(s, len, 0);
-    while (pos != len)
+    const char * const end = s + len;
+    const char * token = s;
+    while (true)
     {
-        double data(0.);
+        while (token < end && IsNumberDelimiter(*token))
+        {
+            ++token;
+        }
 
-        try
+        if (token == end)
         {
-            GetNextNumber(s, len, pos, data);
+            break;
         }
-        catch (Exception& /*ce*/)
+
+        const char * tokenEnd = token;
+        while (tokenEnd < end && !IsNumberDelimiter(*tokenEnd))
+        {
+            ++tokenEnd;
+        }
+
+        // Same validation as ParseNumber().
+        double data(0.);
+        const auto result = NumberUtils::from_chars(token, tokenEnd, data);
+        if (result.ec == std::errc::invalid_argument || result.ptr != tokenEnd)
         {
             ThrowM(*this, "Illegal values '", TruncateString(s, len),
                    "' in array of ", getTypeName(), ".");
@@ -409,6 +422,8 @@ void CTFReaderArrayElt::setRawData(const char * s,
             ThrowM(*this, "Expected ", arg.str(),
                    " Array, found too many values in array of '", getTypeName(), "'.");
         }
+
+        token = tokenEnd;
     }
 }
 
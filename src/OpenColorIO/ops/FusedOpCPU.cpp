@@ -0,0 +1,446 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/FusedOpCPU.h"
+#include "ops/gamma/GammaOpCPU.h"
+#include "ops/log/LogOpCPU.h"
+#include "ops/matrix/MatrixOpCPU.h"
+#include "ops/range/RangeOpCPU.h"
+#include "Platform.h"
+#include "SSE.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+#if OCIO_USE_SSE2
+
+namespace
+{
+
+// The fused renderer applies the kernels one after the other to four pixels at a time, the
+// pixels being held in one register per channel.  The kernel types being template arguments,
+// the whole sequence is inlined in one loop.
+template<typename... Kernels>
+class FusedRenderer : public OpCPU
+{
+public:
+    FusedRenderer() = delete;
+    FusedRenderer(const FusedRenderer &) = delete;
+    explicit FusedRenderer(const Kernels &... kernels)
+        :   OpCPU()
+        ,   m_kernels(kernels...)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Only when all the ops ignore the alpha for the red, green and blue results.
+    bool hasRGBApply() const override { return (Kernels::HasRGBApply && ...); }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
+private:
+    // Process four pixels.  The alpha mask is null for a missing alpha, processed as 0 by each
+    // unfused op (i.e. the alpha result of an op is not seen by the next one).
+    OCIO_FLATTEN void process(__m128 & r, __m128 & g, __m128 & b, __m128 & a,
+                              __m128 alphaMask) const
+    {
+        std::apply([&](const Kernels &... kernels)
+                   {
+                       ((a = _mm_and_ps(a, alphaMask), kernels.apply(r, g, b, a)), ...);
+                   },
+                   m_kernels);
+    }
+
+    std::tuple<Kernels...> m_kernels;
+};
+
+// The entry points process an incomplete last block through a small buffer in the same loop,
+// so the kernels are only inlined once.
+
+template<typename... Kernels>
+void FusedRenderer<Kernels...>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+    OCIO_ALIGN(float buf[16]);
+
+    for (long idx = 0; idx < numPixels; idx += 4)
+    {
+        const long count = std::min(numPixels - idx, 4L);
+
+        // NB: 'in' and 'out' could be pointers to the same memory buffer.
+        const float * src = in;
+        float * dst = out;
+        if (count < 4)
+        {
+            std::fill(buf, buf + 16, 0.f);
+            std::memcpy(buf, in, count * 4 * sizeof(float));
+            src = dst = buf;
+        }
+
+        __m128 r = _mm_loadu_ps(src);
+        __m128 g = _mm_loadu_ps(src + 4);
+        __m128 b = _mm_loadu_ps(src + 8);
+        __m128 a = _mm_loadu_ps(src + 12);
+
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+        process(r, g, b, a, alphaMask);
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+
+        _mm_storeu_ps(dst,      r);
+        _mm_storeu_ps(dst + 4,  g);
+        _mm_storeu_ps(dst + 8,  b);
+        _mm_storeu_ps(dst + 12, a);
+
+        if (count < 4)
+        {
+            std::memcpy(out, buf, count * 4 * sizeof(float));
+        }
+
+        in  += 16;
+        out += 16;
+    }
+}
+
+template<typename... Kernels>
+void FusedRenderer<Kernels...>::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    OCIO_ALIGN(float buf[12]);
+
+    for (long idx = 0; idx < numPixels; idx += 4)
+    {
+        const long count = std::min(numPixels - idx, 4L);
+
+        if (count < 4)
+        {
+            std::fill(buf, buf + 12, 0.f);
+        }
+        for (long i = 0; i < count; ++i)
+        {
+            buf[i]     = in[3 * i];
+            buf[4 + i] = in[3 * i + 1];
+            buf[8 + i] = in[3 * i + 2];
+        }
+
+        __m128 r = _mm_load_ps(buf);
+        __m128 g = _mm_load_ps(buf + 4);
+        __m128 b = _mm_load_ps(buf + 8);
+        __m128 a = _mm_setzero_ps();
+
+        process(r, g, b, a, _mm_setzero_ps());
+
+        _mm_store_ps(buf,     r);
+        _mm_store_ps(buf + 4, g);
+        _mm_store_ps(buf + 8, b);
+
+        for (long i = 0; i < count; ++i)
+        {
+            out[3 * i]     = buf[i];
+            out[3 * i + 1] = buf[4 + i];
+            out[3 * i + 2] = buf[8 + i];
+        }
+
+        in  += 12;
+        out += 12;
+    }
+}
+
+template<typename... Kernels>
+void FusedRenderer<Kernels...>::applyPlanar(float * r, float * g, float * b, float * a,
+                                            long numPixels) const
+{
+    const __m128 alphaMask = a ? _mm_castsi128_ps(_mm_set1_epi32(-1)) : _mm_setzero_ps();
+
+    OCIO_ALIGN(float buf[16]);
+    float * planes[4] = { r, g, b, a };
+
+    for (long idx = 0; idx < numPixels; idx += 4)
+    {
+        const long count = std::min(numPixels - idx, 4L);
+
+        float * ptr[4] = { r + idx, g + idx, b + idx, a ? a + idx : buf + 12 };
+        if (count < 4)
+        {
+            std::fill(buf, buf + 16, 0.f);
+            for (int c = 0; c < 4; ++c)
+            {
+                if (planes[c]) std::copy(planes[c] + idx, planes[c] + numPixels, buf + 4 * c);
+                ptr[c] = buf + 4 * c;
+            }
+        }
+
+        __m128 rv = _mm_loadu_ps(ptr[0]);
+        __m128 gv = _mm_loadu_ps(ptr[1]);
+        __m128 bv = _mm_loadu_ps(ptr[2]);
+        __m128 av = a ? _mm_loadu_ps(ptr[3]) : _mm_setzero_ps();
+
+        process(rv, gv, bv, av, alphaMask);
+
+        _mm_storeu_ps(ptr[0], rv);
+        _mm_storeu_ps(ptr[1], gv);
+        _mm_storeu_ps(ptr[2], bv);
+        _mm_storeu_ps(ptr[3], av);
+
+        if (count < 4)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                if (planes[c]) std::copy(buf + 4 * c, buf + 4 * c + count, planes[c] + idx);
+            }
+        }
+    }
+}
+
+// The visitors check whether an op has a kernel and call a function with the kernel of
+// the op, so that the fused renderers are instantiated for all the kernel combinations.
+
+struct RangeVisitor
+{
+    static bool Accepts(const ConstOpDataRcPtr & data)
+    {
+        return data->getType() == OpData::RangeType
+               && DynamicPtrCast<const RangeOpData>(data)->getDirection() == TRANSFORM_DIR_FORWARD;
+    }
+
+    // Refer to GetRangeRenderer().
+    template<typename Func>
+    static void Visit(const ConstOpDataRcPtr & data, const Func & func)
+    {
+        ConstRangeOpDataRcPtr range = DynamicPtrCast<const RangeOpData>(data);
+
+        if (range->minIsEmpty())
+        {
+            func(RangeKernelSSE<false, false, true>(range));
+        }
+        else if (range->maxIsEmpty())
+        {
+            func(RangeKernelSSE<false, true, false>(range));
+        }
+        else if (!range->scales())
+        {
+            func(RangeKernelSSE<false, true, true>(range));
+        }
+        else
+        {
+            func(RangeKernelSSE<true, true, true>(range));
+        }
+    }
+};
+
+// Refer to GetMatrixRenderer().
+template<bool WithDiagonal>
+struct MatrixVisitorT
+{
+    static bool Accepts(const ConstOpDataRcPtr & data)
+    {
+        if (data->getType() != OpData::MatrixType)
+        {
+            return false;
+        }
+
+        ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(data);
+        return mat->getDirection() == TRANSFORM_DIR_FORWARD && (WithDiagonal || !mat->isDiagonal());
+    }
+
+    template<typename Func>
+    static void Visit(const ConstOpDataRcPtr & data, const Func & func)
+    {
+        ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(data);
+
+        if (WithDiagonal && mat->isDiagonal())
+        {
+            func(ScaleKernelSSE(mat));
+        }
+        else
+        {
+            func(MatrixKernelSSE(mat));
+        }
+    }
+};
+
+// All the matrices, or only the non diagonal ones (i.e. the color space conversions) to limit
+// the number of combinations.
+using MatrixVisitor        = MatrixVisitorT<true>;
+using GeneralMatrixVisitor = MatrixVisitorT<false>;
+
+struct LogVisitor
+{
+    static bool Accepts(const ConstOpDataRcPtr & data)
+    {
+        return data->getType() == OpData::LogType;
+    }
+
+    // Refer to GetLogRenderer().
+    template<typename Func>
+    static void Visit(const ConstOpDataRcPtr & data, const Func & func)
+    {
+        ConstLogOpDataRcPtr log = DynamicPtrCast<const LogOpData>(data);
+
+        const bool forward = log->getDirection() == TRANSFORM_DIR_FORWARD;
+        if (log->isLog2() || log->isLog10())
+        {
+            if (forward) func(LogKernelSSE(log));
+            else         func(AntiLogKernelSSE(log));
+        }
+        else if (log->isCamera())
+        {
+            if (forward) func(CameraLin2LogKernelSSE(log));
+            else         func(CameraLog2LinKernelSSE(log));
+        }
+        else
+        {
+            if (forward) func(Lin2LogKernelSSE(log));
+            else         func(Log2LinKernelSSE(log));
+        }
+    }
+};
+
+struct GammaVisitor
+{
+    static bool Accepts(const ConstOpDataRcPtr & data)
+    {
+        return data->getType() == OpData::GammaType;
+    }
+
+    // Refer to GetGammaRenderer().
+    template<typename Func>
+    static void Visit(const ConstOpDataRcPtr & data, const Func & func)
+    {
+        ConstGammaOpDataRcPtr gamma = DynamicPtrCast<const GammaOpData>(data);
+
+        switch (gamma->getStyle())
+        {
+            case GammaOpData::MONCURVE_FWD:
+                func(GammaMoncurveKernelSSE<GammaMoncurveFwdSSE>(gamma));
+                break;
+            case GammaOpData::MONCURVE_REV:
+                func(GammaMoncurveKernelSSE<GammaMoncurveRevSSE>(gamma));
+                break;
+            case GammaOpData::MONCURVE_MIRROR_FWD:
+                func(GammaMoncurveKernelSSE<GammaMoncurveMirrorFwdSSE>(gamma));
+                break;
+            case GammaOpData::MONCURVE_MIRROR_REV:
+                func(GammaMoncurveKernelSSE<GammaMoncurveMirrorRevSSE>(gamma));
+                break;
+            case GammaOpData::BASIC_FWD:
+            case GammaOpData::BASIC_REV:
+                func(GammaBasicKernelSSE<GammaBasicSSE>(gamma));
+                break;
+            case GammaOpData::BASIC_MIRROR_FWD:
+            case GammaOpData::BASIC_MIRROR_REV:
+                func(GammaBasicKernelSSE<GammaBasicMirrorSSE>(gamma));
+                break;
+            case GammaOpData::BASIC_PASS_THRU_FWD:
+            case GammaOpData::BASIC_PASS_THRU_REV:
+                func(GammaBasicKernelSSE<GammaBasicPassThruSSE>(gamma));
+                break;
+        }
+    }
+};
+
+// Create the fused renderer of the ops, each visitor adding the kernel of its op to the
+// kernels of the previous ones.
+template<typename Visitor, typename... Visitors, typename... Kernels>
+ConstOpCPURcPtr CreateFusedRenderer(const ConstOpDataRcPtr * data, const Kernels &... kernels)
+{
+    ConstOpCPURcPtr renderer;
+
+    Visitor::Visit(data[0], [&](const auto & kernel)
+    {
+        if constexpr (sizeof...(Visitors) == 0)
+        {
+            using Kernel = std::decay_t<decltype(kernel)>;
+            renderer = std::make_shared<FusedRenderer<Kernels..., Kernel>>(kernels..., kernel);
+        }
+        else
+        {
+            renderer = CreateFusedRenderer<Visitors...>(data + 1, kernels..., kernel);
+        }
+    });
+
+    return renderer;
+}
+
+template<typename... Visitors>
+bool FuseOps(const OpRcPtrVec & ops, size_t idx, ConstOpCPURcPtr & renderer,
+             size_t & numFusedOps)
+{
+    constexpr size_t numOps = sizeof...(Visitors);
+    if (idx + numOps > ops.size())
+    {
+        return false;
+    }
+
+    ConstOpDataRcPtr data[numOps];
+    for (size_t i = 0; i < numOps; ++i)
+    {
+        ConstOpRcPtr op = ops[idx + i];
+        data[i] = op->data();
+    }
+
+    size_t i = 0;
+    if (!(Visitors::Accepts(data[i++]) && ...))
+    {
+        return false;
+    }
+
+    renderer    = CreateFusedRenderer<Visitors...>(data);
+    numFusedOps = numOps;
+
+    return true;
+}
+
+} // anon.
+
+#endif // OCIO_USE_SSE2
+
+ConstOpCPURcPtr GetFusedRenderer(const OpRcPtrVec & ops, size_t idx, bool fastLogExpPow,
+                                 size_t & numFusedOps)
+{
+    ConstOpCPURcPtr renderer;
+    numFusedOps = 0;
+
+#if OCIO_USE_SSE2
+    if (FuseOps<RangeVisitor, GeneralMatrixVisitor, RangeVisitor>(ops, idx, renderer, numFusedOps))
+    {
+        return renderer;
+    }
+
+    // The fused renderers use the fast log, exp & pow of the SSE renderers.
+    if (fastLogExpPow)
+    {
+        if (FuseOps<MatrixVisitor, LogVisitor>(ops, idx, renderer, numFusedOps)
+            || FuseOps<LogVisitor, MatrixVisitor>(ops, idx, renderer, numFusedOps)
+            || FuseOps<MatrixVisitor, GammaVisitor>(ops, idx, renderer, numFusedOps)
+            || FuseOps<GammaVisitor, MatrixVisitor>(ops, idx, renderer, numFusedOps))
+        {
+            return renderer;
+        }
+    }
+#else
+    std::ignore = ops;
+    std::ignore = idx;
+    std::ignore = fastLogExpPow;
+#endif
+
+    return renderer;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FUSEDOP_CPU_H
+#define INCLUDED_OCIO_FUSEDOP_CPU_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Get a renderer processing in one pass the sequence of ops starting at ops[idx] when it is
+// one of the common sequences of the display chains i.e. Range -> Matrix -> Range (with a
+// non diagonal matrix), Matrix -> Log, Log -> Matrix, Matrix -> Gamma and Gamma -> Matrix.
+// The Log and Gamma sequences are only fused when the fast log, exp & pow are allowed, as
+// the fused renderers give the same results as the SSE renderers.
+//
+// The renderer processes 32-bit float pixels, the pixels staying in registers between the
+// ops.  Returns a null pointer (and numFusedOps = 0) when no sequence is recognized.
+ConstOpCPURcPtr GetFusedRenderer(const OpRcPtrVec & ops, size_t idx, bool fastLogExpPow,
+                                 size_t & numFusedOps);
+
+} // namespace OCIO_NAMESPACE
+
+
+#endif
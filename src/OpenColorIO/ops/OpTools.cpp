@@ -1,6 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
@@ -8,41 +13,123 @@
 
 namespace OCIO_NAMESPACE
 {
+
+namespace
+{
+
+// Render the pixels [start, end) through the CPU ops, a block at a time so the intermediate
+// RGBA buffer stays in the cache while going through all the ops.
+void EvalPixels(const float * in,
+                float * out,
+                long start,
+                long end,
+                const ConstOpCPURcPtrVec & cpuOps)
+{
+    static constexpr long BLOCK_SIZE = 4096;
+
+    std::vector<float> tmp(std::min(BLOCK_SIZE, end - start) * 4);
+
+    for (long blockStart = start; blockStart < end; blockStart += BLOCK_SIZE)
+    {
+        const long numPixels = std::min(BLOCK_SIZE, end - blockStart);
+
+        const float * values = in + 3 * blockStart;
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            tmp[4 * idx + 0] = values[0];
+            tmp[4 * idx + 1] = values[1];
+            tmp[4 * idx + 2] = values[2];
+            tmp[4 * idx + 3] = 1.0f;
+
+            values += 3;
+        }
+
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(&tmp[0], &tmp[0], numPixels);
+        }
+
+        float * result = out + 3 * blockStart;
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            result[0] = tmp[4 * idx + 0];
+            result[1] = tmp[4 * idx + 1];
+            result[2] = tmp[4 * idx + 2];
+
+            result += 3;
+        }
+    }
+}
+
+} // anon.
+
 void EvalTransform(const float * in,
                     float * out,
                     long numPixels,
                     OpRcPtrVec & ops)
 {
-    std::vector<float> tmp(numPixels * 4);
+    ops.finalize();
+    ops.optimize(OPTIMIZATION_NONE);
 
-    // Render the LUT entries (domain) through the ops.
-    const float * values = in;
-    for (long idx = 0; idx<numPixels; ++idx)
+    // The CPU ops are created once and shared by all the threads.
+    ConstOpCPURcPtrVec cpuOps;
+    for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
     {
-        tmp[4 * idx + 0] = values[0];
-        tmp[4 * idx + 1] = values[1];
-        tmp[4 * idx + 2] = values[2];
-        tmp[4 * idx + 3] = 1.0f;
+        cpuOps.push_back(ops[i]->getCPUOp(false));
+    }
 
-        values += 3;
+    // Below that size, the thread creation costs more than the processing.
+    static constexpr long MIN_PIXELS_PER_THREAD = 16 * 1024;
+
+    const long numCores = std::max(1L, (long)std::thread::hardware_concurrency());
+    const long numThreads = std::min(numCores, numPixels / MIN_PIXELS_PER_THREAD);
+
+    if (numThreads <= 1)
+    {
+        EvalPixels(in, out, 0, numPixels, cpuOps);
+        return;
     }
 
-    ops.finalize();
-    ops.optimize(OPTIMIZATION_NONE);
+    // Render the LUT entries (domain) through the ops, each thread processing a contiguous range
+    // of entries i.e. a set of slices of the LUT.
+    const long chunkSize = (numPixels + numThreads - 1) / numThreads;
 
-    for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
+    std::vector<std::exception_ptr> errors(numThreads);
+
+    auto evalChunk = [&](long idx)
+    {
+        try
+        {
+            const long start = idx * chunkSize;
+            const long end   = std::min(start + chunkSize, numPixels);
+            EvalPixels(in, out, start, end, cpuOps);
+        }
+        catch (...)
+        {
+            errors[idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (long idx = 1; idx < numThreads; ++idx)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        threads.emplace_back(evalChunk, idx);
     }
+    evalChunk(0);
 
-    float * result = out;
-    for (long idx = 0; idx<numPixels; ++idx)
+    for (auto & thread : threads)
     {
-        result[0] = tmp[4 * idx + 0];
-        result[1] = tmp[4 * idx + 1];
-        result[2] = tmp[4 * idx + 2];
+        thread.join();
+    }
 
-        result += 3;
+    for (const auto & error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
     }
 }
+
 } // namespace OCIO_NAMESPACE
@@ -170,6 +170,23 @@ inline void ApplySaturation(__m128& pix, const __m128 saturation)
     pix = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(pix, luma)));
 }
 
+// Apply the saturation component to four pixels of a planar image, the luma being summed
+// in the same order as above.
+inline void ApplySaturation(__m128 & red, __m128 & grn, __m128 & blu, const __m128 saturation)
+{
+    static const __m128 LumaWeightR = _mm_set1_ps(0.2126f);
+    static const __m128 LumaWeightG = _mm_set1_ps(0.7152f);
+    static const __m128 LumaWeightB = _mm_set1_ps(0.0722f);
+
+    const __m128 luma = _mm_add_ps(_mm_add_ps(_mm_mul_ps(red, LumaWeightR),
+                                              _mm_mul_ps(grn, LumaWeightG)),
+                                   _mm_mul_ps(blu, LumaWeightB));
+
+    red = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(red, luma)));
+    grn = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(grn, luma)));
+    blu = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(blu, luma)));
+}
+
 #endif // OCIO_USE_SSE2
 
 inline void ApplyScale(float * pix, const float scale)
@@ -267,6 +284,9 @@ public:
     CDLOpCPU() = delete;
     CDLOpCPU(ConstCDLOpDataRcPtr & cdl);
 
+    // The alpha is left unchanged.
+    bool hasPlanarApply() const override { return true; }
+
 protected:
     RenderParams m_renderParams;
 };
@@ -281,6 +301,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 
 #if OCIO_USE_SSE2
@@ -294,6 +315,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 #endif
 
@@ -307,6 +329,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 
 #if OCIO_USE_SSE2
@@ -320,6 +343,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 #endif
 
@@ -373,6 +397,41 @@ void CDLRendererFwdSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+template<bool CLAMP>
+void CDLRendererFwdSSE<CLAMP>::applyPlanar(float * r, float * g, float * b, float *,
+                                           long numPixels) const
+{
+    const float * slopes  = this->m_renderParams.getSlope();
+    const float * offsets = this->m_renderParams.getOffset();
+    const float * powers  = this->m_renderParams.getPower();
+
+    const __m128 slope[3]  = { _mm_set1_ps(slopes[0]), _mm_set1_ps(slopes[1]),
+                               _mm_set1_ps(slopes[2]) };
+    const __m128 offset[3] = { _mm_set1_ps(offsets[0]), _mm_set1_ps(offsets[1]),
+                               _mm_set1_ps(offsets[2]) };
+    const __m128 power[3]  = { _mm_set1_ps(powers[0]), _mm_set1_ps(powers[1]),
+                               _mm_set1_ps(powers[2]) };
+    const __m128 saturation = _mm_set1_ps(this->m_renderParams.getSaturation());
+
+    sseApplyToPlanes(r, g, b, numPixels, [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        __m128 * pix[3] = { &red, &grn, &blu };
+        for (int c = 0; c < 3; ++c)
+        {
+            *pix[c] = _mm_mul_ps(*pix[c], slope[c]);
+            *pix[c] = _mm_add_ps(*pix[c], offset[c]);
+
+            ApplyPower<CLAMP>(*pix[c], power[c]);
+        }
+
+        ApplySaturation(red, grn, blu, saturation);
+
+        ApplyClamp<CLAMP>(red);
+        ApplyClamp<CLAMP>(grn);
+        ApplyClamp<CLAMP>(blu);
+    });
+}
 #endif
 
 template<bool CLAMP>
@@ -406,6 +465,28 @@ void CDLRendererFwd<CLAMP>::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+template<bool CLAMP>
+void CDLRendererFwd<CLAMP>::applyPlanar(float * r, float * g, float * b, float *,
+                                        long numPixels) const
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float pix[3] = { r[idx], g[idx], b[idx] };
+
+        ApplySlope(pix, m_renderParams.getSlope());
+        ApplyOffset(pix, m_renderParams.getOffset());
+
+        ApplyPower<CLAMP>(pix, m_renderParams.getPower());
+
+        ApplySaturation(pix, m_renderParams.getSaturation());
+        ApplyClamp<CLAMP>(pix);
+
+        r[idx] = pix[0];
+        g[idx] = pix[1];
+        b[idx] = pix[2];
+    }
+}
+
 #if OCIO_USE_SSE2
 template<bool CLAMP>
 void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
@@ -437,6 +518,42 @@ void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+template<bool CLAMP>
+void CDLRendererRevSSE<CLAMP>::applyPlanar(float * r, float * g, float * b, float *,
+                                           long numPixels) const
+{
+    const float * slopes  = this->m_renderParams.getSlope();
+    const float * offsets = this->m_renderParams.getOffset();
+    const float * powers  = this->m_renderParams.getPower();
+
+    const __m128 slopeRev[3]  = { _mm_set1_ps(slopes[0]), _mm_set1_ps(slopes[1]),
+                                  _mm_set1_ps(slopes[2]) };
+    const __m128 offsetRev[3] = { _mm_set1_ps(offsets[0]), _mm_set1_ps(offsets[1]),
+                                  _mm_set1_ps(offsets[2]) };
+    const __m128 powerRev[3]  = { _mm_set1_ps(powers[0]), _mm_set1_ps(powers[1]),
+                                  _mm_set1_ps(powers[2]) };
+    const __m128 saturationRev = _mm_set1_ps(this->m_renderParams.getSaturation());
+
+    sseApplyToPlanes(r, g, b, numPixels, [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        ApplyClamp<CLAMP>(red);
+        ApplyClamp<CLAMP>(grn);
+        ApplyClamp<CLAMP>(blu);
+
+        ApplySaturation(red, grn, blu, saturationRev);
+
+        __m128 * pix[3] = { &red, &grn, &blu };
+        for (int c = 0; c < 3; ++c)
+        {
+            ApplyPower<CLAMP>(*pix[c], powerRev[c]);
+
+            *pix[c] = _mm_add_ps(*pix[c], offsetRev[c]);
+            *pix[c] = _mm_mul_ps(*pix[c], slopeRev[c]);
+            ApplyClamp<CLAMP>(*pix[c]);
+        }
+    });
+}
 #endif
 
 template<bool CLAMP>
@@ -468,6 +585,29 @@ void CDLRendererRev<CLAMP>::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+template<bool CLAMP>
+void CDLRendererRev<CLAMP>::applyPlanar(float * r, float * g, float * b, float *,
+                                        long numPixels) const
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float pix[3] = { r[idx], g[idx], b[idx] };
+
+        ApplyClamp<CLAMP>(pix);
+        ApplySaturation(pix, m_renderParams.getSaturation());
+
+        ApplyPower<CLAMP>(pix, m_renderParams.getPower());
+
+        ApplyOffset(pix, m_renderParams.getOffset());
+        ApplySlope(pix, m_renderParams.getSlope());
+        ApplyClamp<CLAMP>(pix);
+
+        r[idx] = pix[0];
+        g[idx] = pix[1];
+        b[idx] = pix[2];
+    }
+}
+
 // Note that if power is 1, the optimizer is able to convert the CDL op into a pair of matrices and
 // clamp (when needed).  So by default, the following will only get called when power is not 1.
 ConstOpCPURcPtr GetCDLCPURenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower)
@@ -29,10 +29,22 @@ public:
     explicit GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 
+    // Applies func(value, gamma) to the planes.
+    template<typename Func>
+    void applyToPlanes(float * r, float * g, float * b, float * a, long numPixels,
+                       const Func & func) const;
+#if OCIO_USE_SSE2
+    template<typename Func>
+    void applyToPlanesSSE(float * r, float * g, float * b, float * a, long numPixels,
+                          const Func & func) const;
+#endif
+
 protected:
     float m_redGamma;
     float m_grnGamma;
@@ -50,6 +62,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -61,6 +74,7 @@ public:
     explicit GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 
 #if OCIO_USE_SSE2
@@ -73,6 +87,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -84,6 +99,7 @@ public:
     explicit GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 
 #if OCIO_USE_SSE2
@@ -96,14 +112,28 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
 class GammaMoncurveOpCPU : public OpCPU
 {
+public:
+    bool hasPlanarApply() const override { return true; }
+
 protected:
     explicit GammaMoncurveOpCPU(ConstGammaOpDataRcPtr &) : OpCPU() {}
 
+    // Applies func(value, params) to the planes.
+    template<typename Func>
+    void applyToPlanes(float * r, float * g, float * b, float * a, long numPixels,
+                       const Func & func) const;
+#if OCIO_USE_SSE2
+    template<typename Func>
+    void applyToPlanesSSE(float * r, float * g, float * b, float * a, long numPixels,
+                          const Func & func) const;
+#endif
+
 protected:
     RendererParams m_red;
     RendererParams m_green;
@@ -117,6 +147,7 @@ public:
     explicit GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -132,6 +163,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -141,6 +173,7 @@ public:
     explicit GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -157,6 +190,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -166,6 +200,7 @@ public:
     explicit GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -181,6 +216,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -190,6 +226,7 @@ public:
     explicit GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -205,6 +242,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -292,6 +330,91 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 }
 
 
+// Per value computations, shared by the packed and the planar processing.
+
+inline float GammaBasic(float v, float gamma)
+{
+    return std::pow(std::max(0.0f, v), gamma);
+}
+
+inline float GammaBasicMirror(float v, float gamma)
+{
+    return std::copysign(1.0f, v) * std::pow(std::fabs(v), gamma);
+}
+
+inline float GammaBasicPassThru(float v, float gamma)
+{
+    return v > 0.f ? std::pow(v, gamma) : v;
+}
+
+inline float GammaMoncurveFwd(float v, const RendererParams & p)
+{
+    const float data = std::pow(v * p.scale + p.offset, p.gamma);
+    return v <= p.breakPnt ? v * p.slope : data;
+}
+
+inline float GammaMoncurveRev(float v, const RendererParams & p)
+{
+    const float data = std::pow(v, p.gamma) * p.scale - p.offset;
+    return v <= p.breakPnt ? v * p.slope : data;
+}
+
+inline float GammaMoncurveMirrorFwd(float v, const RendererParams & p)
+{
+    return std::copysign(1.0f, v) * GammaMoncurveFwd(std::fabs(v), p);
+}
+
+inline float GammaMoncurveMirrorRev(float v, const RendererParams & p)
+{
+    return std::copysign(1.0f, v) * GammaMoncurveRev(std::fabs(v), p);
+}
+
+#if OCIO_USE_SSE2
+
+// Applies a function of four values and their parameters to four RGBA pixels.
+template<typename Func, typename Params>
+inline void ApplyToPixelsSSE(const void * inImg, void * outImg, long numPixels,
+                             const Func & func, const Params & params)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+
+        _mm_storeu_ps(out, func(pixel, params));
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+#endif // OCIO_USE_SSE2
+
+// Applies a function of a value and its parameters to each channel of RGBA pixels.
+template<typename Func, typename Params>
+inline void ApplyToPixels(const void * inImg, void * outImg, long numPixels,
+                          const Func & func, const Params & red, const Params & grn,
+                          const Params & blu, const Params & alp)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float pixel[4] = { in[0], in[1], in[2], in[3] };
+
+        out[0] = func(pixel[0], red);
+        out[1] = func(pixel[1], grn);
+        out[2] = func(pixel[2], blu);
+        out[3] = func(pixel[3], alp);
+
+        in  += 4;
+        out += 4;
+    }
+}
+
 GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
     :   OpCPU()
     ,   m_redGamma(0.0f)
@@ -302,7 +425,7 @@ GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
     update(gamma);
 }
 
-void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
+void ComputeBasicPowers(ConstGammaOpDataRcPtr & gamma, float powers[4])
 {
     // The gamma calculations are done in normalized space.
     const auto style = gamma->getStyle();
@@ -311,54 +434,79 @@ void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
                          (style == GammaOpData::BASIC_PASS_THRU_FWD);
 
     // Calculate the actual power used in the function.
-    m_redGamma = (float)(forward ? gamma->getRedParams()[0]   : 1. / gamma->getRedParams()[0]);
-    m_grnGamma = (float)(forward ? gamma->getGreenParams()[0] : 1. / gamma->getGreenParams()[0]);
-    m_bluGamma = (float)(forward ? gamma->getBlueParams()[0]  : 1. / gamma->getBlueParams()[0]);
-    m_alpGamma = (float)(forward ? gamma->getAlphaParams()[0] : 1. / gamma->getAlphaParams()[0]);
+    powers[0] = (float)(forward ? gamma->getRedParams()[0]   : 1. / gamma->getRedParams()[0]);
+    powers[1] = (float)(forward ? gamma->getGreenParams()[0] : 1. / gamma->getGreenParams()[0]);
+    powers[2] = (float)(forward ? gamma->getBlueParams()[0]  : 1. / gamma->getBlueParams()[0]);
+    powers[3] = (float)(forward ? gamma->getAlphaParams()[0] : 1. / gamma->getAlphaParams()[0]);
 }
 
-#if OCIO_USE_SSE2
-void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    float powers[4];
+    ComputeBasicPowers(gamma, powers);
 
-    const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
+    m_redGamma = powers[0];
+    m_grnGamma = powers[1];
+    m_bluGamma = powers[2];
+    m_alpGamma = powers[3];
+}
 
-    for(long idx=0; idx<numPixels; ++idx)
+template<typename Func>
+void GammaBasicOpCPU::applyToPlanes(float * r, float * g, float * b, float * a, long numPixels,
+                                    const Func & func) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        if (!planes[c]) continue;
 
-        pixel = ssePower(pixel, gamma);
+        const float gamma = gammas[c];
+        ApplyToPlane(planes[c], numPixels, [&func, gamma](float v) { return func(v, gamma); });
+    }
+}
 
-        _mm_storeu_ps(out, pixel);
+#if OCIO_USE_SSE2
+template<typename Func>
+void GammaBasicOpCPU::applyToPlanesSSE(float * r, float * g, float * b, float * a,
+                                       long numPixels, const Func & func) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
 
-        in  += 4;
-        out += 4;
+    for (int c = 0; c < 4; ++c)
+    {
+        if (!planes[c]) continue;
+
+        const __m128 gamma = _mm_set1_ps(gammas[c]);
+        sseApplyToPlane(planes[c], numPixels, [&func, gamma](__m128 v) { return func(v, gamma); });
     }
 }
+
+void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
+    ApplyToPixelsSSE(inImg, outImg, numPixels, GammaBasicSSE, gamma);
+}
+
+void GammaBasicOpCPUSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                     long numPixels) const
+{
+    applyToPlanesSSE(r, g, b, a, numPixels, GammaBasicSSE);
+}
 #endif // OCIO_USE_SSE2
 
 void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-    
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        const float pixel[4] = { std::max(0.0f, in[0]), 
-                                 std::max(0.0f, in[1]), 
-                                 std::max(0.0f, in[2]),
-                                 std::max(0.0f, in[3]) };
-
-        out[0] = std::pow(pixel[0], m_redGamma);
-        out[1] = std::pow(pixel[1], m_grnGamma);
-        out[2] = std::pow(pixel[2], m_bluGamma);
-        out[3] = std::pow(pixel[3], m_alpGamma);
+    ApplyToPixels(inImg, outImg, numPixels, GammaBasic,
+                  m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaBasicOpCPU::applyPlanar(float * r, float * g, float * b, float * a,
+                                  long numPixels) const
+{
+    applyToPlanes(r, g, b, a, numPixels, GammaBasic);
 }
 
 GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
@@ -369,48 +517,27 @@ GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
+    ApplyToPixelsSSE(inImg, outImg, numPixels, GammaBasicMirrorSSE, gamma);
+}
 
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-        __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
-        __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
-
-        pixel = ssePower(abs_pix, gamma);
-        pixel = _mm_or_ps(sign_pix, pixel);
-
-        _mm_storeu_ps(out, pixel);
-
-        in += 4;
-        out += 4;
-    }
+void GammaBasicMirrorOpCPUSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    applyToPlanesSSE(r, g, b, a, numPixels, GammaBasicMirrorSSE);
 }
 #endif
 
 void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
-        const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
-
-        out[0] = sign[0] * std::pow(pixel[0], m_redGamma);
-        out[1] = sign[1] * std::pow(pixel[1], m_grnGamma);
-        out[2] = sign[2] * std::pow(pixel[2], m_bluGamma);
-        out[3] = sign[3] * std::pow(pixel[3], m_alpGamma);
+    ApplyToPixels(inImg, outImg, numPixels, GammaBasicMirror,
+                  m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma);
+}
 
-        in += 4;
-        out += 4;
-    }
+void GammaBasicMirrorOpCPU::applyPlanar(float * r, float * g, float * b, float * a,
+                                        long numPixels) const
+{
+    applyToPlanes(r, g, b, a, numPixels, GammaBasicMirror);
 }
 
 GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
@@ -421,50 +548,62 @@ GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
-    const __m128 breakPnt = _mm_set_ps(0.0, 0.f, 0.f, 0.f);
+    ApplyToPixelsSSE(inImg, outImg, numPixels, GammaBasicPassThruSSE, gamma);
+}
 
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-        __m128 data = pixel;
+void GammaBasicPassThruOpCPUSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                             long numPixels) const
+{
+    applyToPlanesSSE(r, g, b, a, numPixels, GammaBasicPassThruSSE);
+}
+#endif
 
-        data = ssePower(data, gamma);
+void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyToPixels(inImg, outImg, numPixels, GammaBasicPassThru,
+                  m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma);
+}
 
-        __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+void GammaBasicPassThruOpCPU::applyPlanar(float * r, float * g, float * b, float * a,
+                                          long numPixels) const
+{
+    applyToPlanes(r, g, b, a, numPixels, GammaBasicPassThru);
+}
 
-        data = _mm_or_ps(_mm_and_ps(flag, data),
-                         _mm_andnot_ps(flag, pixel));
+template<typename Func>
+void GammaMoncurveOpCPU::applyToPlanes(float * r, float * g, float * b, float * a,
+                                       long numPixels, const Func & func) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
 
-        _mm_storeu_ps(out, data);
+    for (int c = 0; c < 4; ++c)
+    {
+        if (!planes[c]) continue;
 
-        in += 4;
-        out += 4;
+        const RendererParams & p = *params[c];
+        ApplyToPlane(planes[c], numPixels, [&func, &p](float v) { return func(v, p); });
     }
 }
-#endif
 
-void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+#if OCIO_USE_SSE2
+template<typename Func>
+void GammaMoncurveOpCPU::applyToPlanesSSE(float * r, float * g, float * b, float * a,
+                                          long numPixels, const Func & func) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
 
-    for (long idx = 0; idx<numPixels; ++idx)
+    for (int c = 0; c < 4; ++c)
     {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
+        if (!planes[c]) continue;
 
-        out[0] = pixel[0] > 0.f ? std::pow(pixel[0], m_redGamma) : pixel[0];
-        out[1] = pixel[1] > 0.f ? std::pow(pixel[1], m_grnGamma) : pixel[1];
-        out[2] = pixel[2] > 0.f ? std::pow(pixel[2], m_bluGamma) : pixel[2];
-        out[3] = pixel[3] > 0.f ? std::pow(pixel[3], m_alpGamma) : pixel[3];
-
-        in += 4;
-        out += 4;
+        const MoncurveParamsSSE p(*params[c]);
+        sseApplyToPlane(planes[c], numPixels, [&func, &p](__m128 v) { return func(v, p); });
     }
 }
+#endif
 
 GammaMoncurveOpCPUFwd::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
@@ -483,76 +622,26 @@ void GammaMoncurveOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
-                                    m_green.scale, m_red.scale);
-
-    const __m128 offset = _mm_set_ps(m_alpha.offset, m_blue.offset,
-                                     m_green.offset, m_red.offset);
-
-    const __m128 gamma = _mm_set_ps(m_alpha.gamma, m_blue.gamma,
-                                    m_green.gamma, m_red.gamma);
-
-    const __m128 breakPnt = _mm_set_ps(m_alpha.breakPnt, m_blue.breakPnt,
-                                       m_green.breakPnt, m_red.breakPnt);
-
-    const __m128 slope = _mm_set_ps(m_alpha.slope, m_blue.slope,
-                                    m_green.slope, m_red.slope);
-
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-
-        __m128 data = _mm_add_ps(_mm_mul_ps(pixel, scale), offset);
-
-        data = ssePower(data, gamma);
-
-        __m128 flag = _mm_cmpgt_ps( pixel, breakPnt);
-
-        data = _mm_or_ps(_mm_and_ps(flag, data),
-                         _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope )));
-
-        _mm_storeu_ps(out, data);
+    const MoncurveParamsSSE params(m_red, m_green, m_blue, m_alpha);
+    ApplyToPixelsSSE(inImg, outImg, numPixels, GammaMoncurveFwdSSE, params);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaMoncurveOpCPUFwdSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    applyToPlanesSSE(r, g, b, a, numPixels, GammaMoncurveFwdSSE);
 }
 #endif // OCIO_USE_SSE2
 
 void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const float red[5] = { m_red.scale,  m_red.offset,
-                           m_red.gamma,  m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.scale, m_green.offset, 
-                           m_green.gamma, m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.scale,  m_blue.offset,
-                           m_blue.gamma,  m_blue.breakPnt, m_blue.slope };
-    const float alp[5] = { m_alpha.scale, m_alpha.offset, 
-                           m_alpha.gamma, m_alpha.breakPnt, m_alpha.slope };
-
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
-
-        const float data[4] = { std::pow(pixel[0] * red[0] + red[1], red[2]),
-                                std::pow(pixel[1] * grn[0] + grn[1], grn[2]),
-                                std::pow(pixel[2] * blu[0] + blu[1], blu[2]),
-                                std::pow(pixel[3] * alp[0] + alp[1], alp[2]) };
-
-        out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
-        out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
-        out[2] = pixel[2]<=blu[3] ? pixel[2] * blu[4] : data[2];
-        out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
+    ApplyToPixels(inImg, outImg, numPixels, GammaMoncurveFwd, m_red, m_green, m_blue, m_alpha);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaMoncurveOpCPUFwd::applyPlanar(float * r, float * g, float * b, float * a,
+                                        long numPixels) const
+{
+    applyToPlanes(r, g, b, a, numPixels, GammaMoncurveFwd);
 }
 
 GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
@@ -572,76 +661,26 @@ void GammaMoncurveOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
-                                    m_green.scale, m_red.scale);
-
-    const __m128 offset = _mm_set_ps(m_alpha.offset, m_blue.offset,
-                                     m_green.offset, m_red.offset);
-
-    const __m128 gamma = _mm_set_ps(m_alpha.gamma, m_blue.gamma,
-                                    m_green.gamma, m_red.gamma);
-
-    const __m128 breakPnt = _mm_set_ps(m_alpha.breakPnt, m_blue.breakPnt,
-                                       m_green.breakPnt, m_red.breakPnt);
-
-    const __m128 slope = _mm_set_ps(m_alpha.slope, m_blue.slope,
-                                    m_green.slope, m_red.slope);
-
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-
-        __m128 data = ssePower(pixel, gamma);
-
-        data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
-
-        __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
-
-        data = _mm_or_ps(_mm_and_ps(flag, data),
-                         _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope)));
-
-        _mm_storeu_ps(out, data);
+    const MoncurveParamsSSE params(m_red, m_green, m_blue, m_alpha);
+    ApplyToPixelsSSE(inImg, outImg, numPixels, GammaMoncurveRevSSE, params);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaMoncurveOpCPURevSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    applyToPlanesSSE(r, g, b, a, numPixels, GammaMoncurveRevSSE);
 }
 #endif
 
 void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const float red[5] = { m_red.gamma,  m_red.scale,
-                           m_red.offset, m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.gamma, m_green.scale, 
-                           m_green.offset,m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.gamma,  m_blue.scale,
-                           m_blue.offset, m_blue.breakPnt, m_blue.slope  };
-    const float alp[5] = { m_alpha.gamma,  m_alpha.scale, 
-                           m_alpha.offset, m_alpha.breakPnt, m_alpha.slope };
-
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        const float pixel[4] = { in[0], in[1], in[2], in[3] };
-
-        const float data[4] = { std::pow(pixel[0], red[0]) * red[1] - red[2],
-                                std::pow(pixel[1], grn[0]) * grn[1] - grn[2],
-                                std::pow(pixel[2], blu[0]) * blu[1] - blu[2],
-                                std::pow(pixel[3], alp[0]) * alp[1] - alp[2] };
-
-        out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
-        out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
-        out[2] = pixel[2]<=blu[3] ? pixel[2] * blu[4] : data[2];
-        out[3] = pixel[3]<=alp[3] ? pixel[3] * alp[4] : data[3];
+    ApplyToPixels(inImg, outImg, numPixels, GammaMoncurveRev, m_red, m_green, m_blue, m_alpha);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaMoncurveOpCPURev::applyPlanar(float * r, float * g, float * b, float * a,
+                                        long numPixels) const
+{
+    applyToPlanes(r, g, b, a, numPixels, GammaMoncurveRev);
 }
 
 GammaMoncurveMirrorOpCPUFwd::GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
@@ -659,85 +698,30 @@ void GammaMoncurveMirrorOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #if OCIO_USE_SSE2
-void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg,
+                                           long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
-                                    m_green.scale, m_red.scale);
-
-    const __m128 offset = _mm_set_ps(m_alpha.offset, m_blue.offset,
-                                     m_green.offset, m_red.offset);
-
-    const __m128 gamma = _mm_set_ps(m_alpha.gamma, m_blue.gamma,
-                                    m_green.gamma, m_red.gamma);
-
-    const __m128 breakPnt = _mm_set_ps(m_alpha.breakPnt, m_blue.breakPnt,
-                                       m_green.breakPnt, m_red.breakPnt);
-
-    const __m128 slope = _mm_set_ps(m_alpha.slope, m_blue.slope,
-                                    m_green.slope, m_red.slope);
-
-    for (long idx = 0; idx < numPixels; ++idx)
-    {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-        __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
-        __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
-
-        __m128 data = _mm_add_ps(_mm_mul_ps(abs_pix, scale), offset);
-
-        data = ssePower(data, gamma);
-
-        __m128 flagbrk = _mm_cmpgt_ps(abs_pix, breakPnt);
-
-        data = _mm_or_ps(_mm_and_ps(flagbrk, data),
-                         _mm_andnot_ps(flagbrk, _mm_mul_ps(abs_pix, slope)));
-
-        data = _mm_or_ps(sign_pix, data);
-
-        _mm_storeu_ps(out, data);
+    const MoncurveParamsSSE params(m_red, m_green, m_blue, m_alpha);
+    ApplyToPixelsSSE(inImg, outImg, numPixels, GammaMoncurveMirrorFwdSSE, params);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaMoncurveMirrorOpCPUFwdSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                                 long numPixels) const
+{
+    applyToPlanesSSE(r, g, b, a, numPixels, GammaMoncurveMirrorFwdSSE);
 }
 #endif
 
 void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-    const float red[5] = { m_red.scale,  m_red.offset,
-                           m_red.gamma,  m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.scale, m_green.offset,
-                           m_green.gamma, m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.scale,  m_blue.offset,
-                           m_blue.gamma,  m_blue.breakPnt, m_blue.slope };
-    const float alp[5] = { m_alpha.scale, m_alpha.offset,
-                           m_alpha.gamma, m_alpha.breakPnt, m_alpha.slope };
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
-
-        const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
-
-        const float data[4] = { std::pow(pixel[0] * red[0] + red[1], red[2]),
-                                std::pow(pixel[1] * grn[0] + grn[1], grn[2]),
-                                std::pow(pixel[2] * blu[0] + blu[1], blu[2]),
-                                std::pow(pixel[3] * alp[0] + alp[1], alp[2]) };
-
-        out[0] = sign[0] * (pixel[0] <= red[3] ? pixel[0] * red[4] : data[0]);
-        out[1] = sign[1] * (pixel[1] <= grn[3] ? pixel[1] * grn[4] : data[1]);
-        out[2] = sign[2] * (pixel[2] <= blu[3] ? pixel[2] * blu[4] : data[2]);
-        out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
+    ApplyToPixels(inImg, outImg, numPixels, GammaMoncurveMirrorFwd,
+                  m_red, m_green, m_blue, m_alpha);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaMoncurveMirrorOpCPUFwd::applyPlanar(float * r, float * g, float * b, float * a,
+                                              long numPixels) const
+{
+    applyToPlanes(r, g, b, a, numPixels, GammaMoncurveMirrorFwd);
 }
 
 GammaMoncurveMirrorOpCPURev::GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma)
@@ -755,86 +739,30 @@ void GammaMoncurveMirrorOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #if OCIO_USE_SSE2
-void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
+void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg,
+                                           long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 scale = _mm_set_ps(m_alpha.scale, m_blue.scale,
-                                    m_green.scale, m_red.scale);
-
-    const __m128 offset = _mm_set_ps(m_alpha.offset, m_blue.offset,
-                                     m_green.offset, m_red.offset);
-
-    const __m128 gamma = _mm_set_ps(m_alpha.gamma, m_blue.gamma,
-                                    m_green.gamma, m_red.gamma);
-
-    const __m128 breakPnt = _mm_set_ps(m_alpha.breakPnt, m_blue.breakPnt,
-                                       m_green.breakPnt, m_red.breakPnt);
-
-    const __m128 slope = _mm_set_ps(m_alpha.slope, m_blue.slope,
-                                    m_green.slope, m_red.slope);
-
-    for (long idx = 0; idx < numPixels; ++idx)
-    {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-        __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
-        __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
-
-        __m128 data = ssePower(abs_pix, gamma);
-
-        data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
-
-        __m128 flagbrk = _mm_cmpgt_ps(abs_pix, breakPnt);
-
-        data = _mm_or_ps(_mm_and_ps(flagbrk, data),
-                         _mm_andnot_ps(flagbrk, _mm_mul_ps(abs_pix, slope)));
-
-        data = _mm_or_ps(sign_pix, data);
-
-        _mm_storeu_ps(out, data);
+    const MoncurveParamsSSE params(m_red, m_green, m_blue, m_alpha);
+    ApplyToPixelsSSE(inImg, outImg, numPixels, GammaMoncurveMirrorRevSSE, params);
+}
 
-        in += 4;
-        out += 4;
-    }
+void GammaMoncurveMirrorOpCPURevSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                                 long numPixels) const
+{
+    applyToPlanesSSE(r, g, b, a, numPixels, GammaMoncurveMirrorRevSSE);
 }
 #endif
 
 void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const float red[5] = { m_red.gamma,  m_red.scale,
-                           m_red.offset, m_red.breakPnt, m_red.slope };
-    const float grn[5] = { m_green.gamma, m_green.scale,
-                           m_green.offset,m_green.breakPnt, m_green.slope };
-    const float blu[5] = { m_blue.gamma,  m_blue.scale,
-                           m_blue.offset, m_blue.breakPnt, m_blue.slope };
-    const float alp[5] = { m_alpha.gamma,  m_alpha.scale,
-                           m_alpha.offset, m_alpha.breakPnt, m_alpha.slope };
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
-
-        const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
-                                 std::fabs(in[2]), std::fabs(in[3]) };
-
-        const float data[4] = { std::pow(pixel[0], red[0]) * red[1] - red[2],
-                                std::pow(pixel[1], grn[0]) * grn[1] - grn[2],
-                                std::pow(pixel[2], blu[0]) * blu[1] - blu[2],
-                                std::pow(pixel[3], alp[0]) * alp[1] - alp[2] };
-
-        out[0] = sign[0] * (pixel[0] <= red[3] ? pixel[0] * red[4] : data[0]);
-        out[1] = sign[1] * (pixel[1] <= grn[3] ? pixel[1] * grn[4] : data[1]);
-        out[2] = sign[2] * (pixel[2] <= blu[3] ? pixel[2] * blu[4] : data[2]);
-        out[3] = sign[3] * (pixel[3] <= alp[3] ? pixel[3] * alp[4] : data[3]);
+    ApplyToPixels(inImg, outImg, numPixels, GammaMoncurveMirrorRev,
+                  m_red, m_green, m_blue, m_alpha);
+}
 
-        in  += 4;
-        out += 4;
-    }
+void GammaMoncurveMirrorOpCPURev::applyPlanar(float * r, float * g, float * b, float * a,
+                                              long numPixels) const
+{
+    applyToPlanes(r, g, b, a, numPixels, GammaMoncurveMirrorRev);
 }
 
 } // namespace OCIO_NAMESPACE
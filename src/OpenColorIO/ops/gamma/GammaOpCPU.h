@@ -10,6 +10,8 @@
 
 #include "Op.h"
 #include "ops/gamma/GammaOpData.h"
+#include "ops/gamma/GammaOpUtils.h"
+#include "SSE.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -17,7 +19,201 @@ namespace OCIO_NAMESPACE
 // Get the Gamma dedicated renderer.
 ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower);
 
+// Compute the red, green, blue and alpha powers of the basic styles.
+void ComputeBasicPowers(ConstGammaOpDataRcPtr & gamma, float powers[4]);
+
+#if OCIO_USE_SSE2
+
+// The parameters of the monitor curves, per channel for the packed processing and the same
+// for the four values of the planar processing.
+struct MoncurveParamsSSE
+{
+    MoncurveParamsSSE(const RendererParams & r, const RendererParams & g,
+                      const RendererParams & b, const RendererParams & a)
+        :   scale   (_mm_set_ps(a.scale,    b.scale,    g.scale,    r.scale))
+        ,   offset  (_mm_set_ps(a.offset,   b.offset,   g.offset,   r.offset))
+        ,   gamma   (_mm_set_ps(a.gamma,    b.gamma,    g.gamma,    r.gamma))
+        ,   breakPnt(_mm_set_ps(a.breakPnt, b.breakPnt, g.breakPnt, r.breakPnt))
+        ,   slope   (_mm_set_ps(a.slope,    b.slope,    g.slope,    r.slope))
+    {
+    }
+
+    explicit MoncurveParamsSSE(const RendererParams & p)
+        :   MoncurveParamsSSE(p, p, p, p)
+    {
+    }
+
+    __m128 scale;
+    __m128 offset;
+    __m128 gamma;
+    __m128 breakPnt;
+    __m128 slope;
+};
+
+inline __m128 GammaBasicSSE(__m128 pixel, __m128 gamma)
+{
+    return ssePower(pixel, gamma);
+}
+
+inline __m128 GammaBasicMirrorSSE(__m128 pixel, __m128 gamma)
+{
+    __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+    __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+    pixel = ssePower(abs_pix, gamma);
+    return _mm_or_ps(sign_pix, pixel);
+}
+
+inline __m128 GammaBasicPassThruSSE(__m128 pixel, __m128 gamma)
+{
+    __m128 data = ssePower(pixel, gamma);
+
+    __m128 flag = _mm_cmpgt_ps(pixel, EZERO);
+
+    return _mm_or_ps(_mm_and_ps(flag, data),
+                     _mm_andnot_ps(flag, pixel));
+}
+
+inline __m128 GammaMoncurveFwdSSE(__m128 pixel, const MoncurveParamsSSE & p)
+{
+    __m128 data = _mm_add_ps(_mm_mul_ps(pixel, p.scale), p.offset);
+
+    data = ssePower(data, p.gamma);
+
+    __m128 flag = _mm_cmpgt_ps(pixel, p.breakPnt);
+
+    return _mm_or_ps(_mm_and_ps(flag, data),
+                     _mm_andnot_ps(flag, _mm_mul_ps(pixel, p.slope)));
+}
+
+inline __m128 GammaMoncurveRevSSE(__m128 pixel, const MoncurveParamsSSE & p)
+{
+    __m128 data = ssePower(pixel, p.gamma);
+
+    data = _mm_sub_ps(_mm_mul_ps(data, p.scale), p.offset);
+
+    __m128 flag = _mm_cmpgt_ps(pixel, p.breakPnt);
+
+    return _mm_or_ps(_mm_and_ps(flag, data),
+                     _mm_andnot_ps(flag, _mm_mul_ps(pixel, p.slope)));
+}
+
+inline __m128 GammaMoncurveMirrorFwdSSE(__m128 pixel, const MoncurveParamsSSE & p)
+{
+    __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+    __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+    __m128 data = _mm_add_ps(_mm_mul_ps(abs_pix, p.scale), p.offset);
+
+    data = ssePower(data, p.gamma);
+
+    __m128 flagbrk = _mm_cmpgt_ps(abs_pix, p.breakPnt);
+
+    data = _mm_or_ps(_mm_and_ps(flagbrk, data),
+                     _mm_andnot_ps(flagbrk, _mm_mul_ps(abs_pix, p.slope)));
+
+    return _mm_or_ps(sign_pix, data);
+}
+
+inline __m128 GammaMoncurveMirrorRevSSE(__m128 pixel, const MoncurveParamsSSE & p)
+{
+    __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+    __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+    __m128 data = ssePower(abs_pix, p.gamma);
+
+    data = _mm_sub_ps(_mm_mul_ps(data, p.scale), p.offset);
+
+    __m128 flagbrk = _mm_cmpgt_ps(abs_pix, p.breakPnt);
+
+    data = _mm_or_ps(_mm_and_ps(flagbrk, data),
+                     _mm_andnot_ps(flagbrk, _mm_mul_ps(abs_pix, p.slope)));
+
+    return _mm_or_ps(sign_pix, data);
+}
+
+// The kernels process four pixels held in one register per channel (i.e. the red of the
+// four pixels in r, etc.) and give the same results as the SSE renderers.  They are used
+// by the renderers fusing several ops (refer to ops/FusedOpCPU.h).
+
+template<__m128 (*Func)(__m128, __m128)>
+class GammaBasicKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit GammaBasicKernelSSE(ConstGammaOpDataRcPtr & gamma)
+    {
+        float powers[4];
+        ComputeBasicPowers(gamma, powers);
+
+        for (int c = 0; c < 4; ++c)
+        {
+            m_gamma[c] = _mm_set1_ps(powers[c]);
+        }
+    }
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 & a) const
+    {
+        r = Func(r, m_gamma[0]);
+        g = Func(g, m_gamma[1]);
+        b = Func(b, m_gamma[2]);
+        a = Func(a, m_gamma[3]);
+    }
+
+private:
+    __m128 m_gamma[4];
+};
+
+template<__m128 (*Func)(__m128, const MoncurveParamsSSE &)>
+class GammaMoncurveKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit GammaMoncurveKernelSSE(ConstGammaOpDataRcPtr & gamma)
+        :   m_red  (ComputeParams(gamma, gamma->getRedParams()))
+        ,   m_green(ComputeParams(gamma, gamma->getGreenParams()))
+        ,   m_blue (ComputeParams(gamma, gamma->getBlueParams()))
+        ,   m_alpha(ComputeParams(gamma, gamma->getAlphaParams()))
+    {
+    }
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 & a) const
+    {
+        r = Func(r, m_red);
+        g = Func(g, m_green);
+        b = Func(b, m_blue);
+        a = Func(a, m_alpha);
+    }
+
+private:
+    static RendererParams ComputeParams(ConstGammaOpDataRcPtr & gamma,
+                                        const GammaOpData::Params & gParams)
+    {
+        const auto style = gamma->getStyle();
+
+        RendererParams params;
+        if (style == GammaOpData::MONCURVE_FWD || style == GammaOpData::MONCURVE_MIRROR_FWD)
+        {
+            ComputeParamsFwd(gParams, params);
+        }
+        else
+        {
+            ComputeParamsRev(gParams, params);
+        }
+        return params;
+    }
+
+    MoncurveParamsSSE m_red;
+    MoncurveParamsSSE m_green;
+    MoncurveParamsSSE m_blue;
+    MoncurveParamsSSE m_alpha;
+};
+
+#endif // OCIO_USE_SSE2
+
 } // namespace OCIO_NAMESPACE
 
 
-#endif
\ No newline at end of file
+#endif
@@ -28,6 +28,9 @@ public:
 
     explicit LogOpCPU(ConstLogOpDataRcPtr & log);
 
+    // The RGB channels are independent and the alpha is left unchanged.
+    bool hasPlanarApply() const override { return true; }
+
 protected:
     // Update renderer parameters.
     virtual void updateData(ConstLogOpDataRcPtr & log);
@@ -56,6 +59,7 @@ public:
     explicit Log2LinRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -64,6 +68,10 @@ protected:
     float m_minuskb[3];
     float m_minusb[3];
     float m_minv[3];
+
+#if OCIO_USE_SSE2
+    friend class Log2LinKernelSSE;
+#endif
 };
 
 #if OCIO_USE_SSE2
@@ -73,6 +81,7 @@ public:
     explicit Log2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -83,6 +92,7 @@ public:
     explicit Lin2LogRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -91,6 +101,10 @@ protected:
     float m_b[3];
     float m_klog[3];
     float m_kb[3];
+
+#if OCIO_USE_SSE2
+    friend class Lin2LogKernelSSE;
+#endif
 };
 
 #if OCIO_USE_SSE2
@@ -100,6 +114,7 @@ public:
     explicit Lin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -124,6 +139,7 @@ public:
     explicit CameraLog2LinRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -134,6 +150,10 @@ protected:
     float m_minv[3];
     float m_linsinv[3];
     float m_minuslino[3];
+
+#if OCIO_USE_SSE2
+    friend class CameraLog2LinKernelSSE;
+#endif
 };
 
 #if OCIO_USE_SSE2
@@ -143,6 +163,7 @@ public:
     explicit CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -153,6 +174,7 @@ public:
     explicit CameraLin2LogRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -162,6 +184,10 @@ protected:
     float m_klog[3];
     float m_kb[3];
     float m_linb[3];
+
+#if OCIO_USE_SSE2
+    friend class CameraLin2LogKernelSSE;
+#endif
 };
 
 #if OCIO_USE_SSE2
@@ -171,6 +197,7 @@ public:
     explicit CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -181,9 +208,14 @@ public:
     explicit LogRenderer(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     float m_logScale;
+
+#if OCIO_USE_SSE2
+    friend class LogKernelSSE;
+#endif
 };
 
 #if OCIO_USE_SSE2
@@ -193,6 +225,7 @@ public:
     explicit LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -203,9 +236,14 @@ public:
     explicit AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     float m_log2_base;
+
+#if OCIO_USE_SSE2
+    friend class AntiLogKernelSSE;
+#endif
 };
 
 #if OCIO_USE_SSE2
@@ -215,6 +253,7 @@ public:
     explicit AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -388,6 +427,7 @@ inline void ApplyExp2(float * pix)
     pix[2] = exp2(pix[2]);
 }
 
+
 void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
     static constexpr float minValue = std::numeric_limits<float>::min();
@@ -413,6 +453,20 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
     }
 }
 
+void LogRenderer::applyPlanar(float * r, float * g, float * b, float *, long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    for (float * plane : { r, g, b })
+    {
+        ApplyToPlane(plane, numPixels, [this](float v)
+        {
+            v = log2(std::max(minValue, v));
+            return v * m_logScale;
+        });
+    }
+}
+
 #if OCIO_USE_SSE2
 LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
@@ -436,9 +490,7 @@ void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) co
     for (long idx = 0; idx<numPixels; ++idx)
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_logScale);
+        mm_pixel = LogSSE(mm_pixel, mm_minValue, mm_logScale);
 
         const float alphares = in[3];
 
@@ -449,6 +501,22 @@ void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) co
         out += 4;
     }
 }
+
+void LogRendererSSE::applyPlanar(float * r, float * g, float * b, float *, long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+    const __m128 mm_logScale = _mm_set1_ps(m_logScale);
+
+    for (float * plane : { r, g, b })
+    {
+        sseApplyToPlane(plane, numPixels, [&](__m128 pixel)
+        {
+            return LogSSE(pixel, mm_minValue, mm_logScale);
+        });
+    }
+}
 #endif
 
 // Renderer for AntiLog10 and AntiLog2 operations
@@ -481,6 +549,14 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void AntiLogRenderer::applyPlanar(float * r, float * g, float * b, float *, long numPixels) const
+{
+    for (float * plane : { r, g, b })
+    {
+        ApplyToPlane(plane, numPixels, [this](float v) -> float { return exp2(v * m_log2_base); });
+    }
+}
+
 #if OCIO_USE_SSE2
 AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
@@ -507,7 +583,7 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     for (long idx = 0; idx<numPixels; ++idx)
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
+        mm_pixel = AntiLogSSE(mm_pixel, mm_log2_base);
 
         const float alphares = in[3];
 
@@ -518,6 +594,20 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         out += 4;
     }
 }
+
+void AntiLogRendererSSE::applyPlanar(float * r, float * g, float * b, float *,
+                                     long numPixels) const
+{
+    const __m128 mm_log2_base = _mm_set1_ps(m_log2_base);
+
+    for (float * plane : { r, g, b })
+    {
+        sseApplyToPlane(plane, numPixels, [&](__m128 pixel)
+        {
+            return AntiLogSSE(pixel, mm_log2_base);
+        });
+    }
+}
 #endif
 
 // Renderer for LogToLin operations
@@ -571,6 +661,20 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void Log2LinRenderer::applyPlanar(float * r, float * g, float * b, float *, long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        ApplyToPlane(planes[c], numPixels, [this, c](float v)
+        {
+            v = exp2((v + m_minuskb[c]) * m_kinv[c]);
+            return (v + m_minusb[c]) * m_minv[c];
+        });
+    }
+}
+
 #if OCIO_USE_SSE2
 Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
@@ -603,11 +707,7 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     for (long idx = 0; idx < numPixels; ++idx)
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
+        mm_pixel = Log2LinSSE(mm_pixel, mm_minuskb, mm_kinv, mm_minusb, mm_minv);
 
         const float alphares = in[3];
 
@@ -618,6 +718,25 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         in  += 4;
     }
 }
+
+void Log2LinRendererSSE::applyPlanar(float * r, float * g, float * b, float *,
+                                     long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_kinv = _mm_set1_ps(m_kinv[c]);
+        const __m128 mm_minuskb = _mm_set1_ps(m_minuskb[c]);
+        const __m128 mm_minusb = _mm_set1_ps(m_minusb[c]);
+        const __m128 mm_minv = _mm_set1_ps(m_minv[c]);
+
+        sseApplyToPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            return Log2LinSSE(pixel, mm_minuskb, mm_kinv, mm_minusb, mm_minv);
+        });
+    }
+}
 #endif
 
 // Renderer for Lin2Log operations
@@ -673,6 +792,23 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void Lin2LogRenderer::applyPlanar(float * r, float * g, float * b, float *, long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        ApplyToPlane(planes[c], numPixels, [this, c](float v)
+        {
+            v = std::max(minValue, v * m_m[c] + m_b[c]);
+            v = log2(v);
+            return v * m_klog[c] + m_kb[c];
+        });
+    }
+}
+
 #if OCIO_USE_SSE2
 Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
@@ -702,12 +838,7 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     for (long idx = 0; idx<numPixels; ++idx)
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_b);
-        mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
+        mm_pixel = Lin2LogSSE(mm_pixel, mm_m, mm_b, mm_minValue, mm_klog, mm_kb);
 
         const float alphares = in[3];
 
@@ -718,6 +849,29 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         in  += 4;
     }
 }
+
+void Lin2LogRendererSSE::applyPlanar(float * r, float * g, float * b, float *,
+                                     long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_m = _mm_set1_ps(m_m[c]);
+        const __m128 mm_b = _mm_set1_ps(m_b[c]);
+        const __m128 mm_klog = _mm_set1_ps(m_klog[c]);
+        const __m128 mm_kb = _mm_set1_ps(m_kb[c]);
+
+        sseApplyToPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            return Lin2LogSSE(pixel, mm_m, mm_b, mm_minValue, mm_klog, mm_kb);
+        });
+    }
+}
 #endif
 
 CameraL2LBaseRenderer::CameraL2LBaseRenderer(ConstLogOpDataRcPtr & log)
@@ -801,6 +955,26 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void CameraLog2LinRenderer::applyPlanar(float * r, float * g, float * b, float *,
+                                        long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        ApplyToPlane(planes[c], numPixels, [this, c](float v)
+        {
+            if (v < m_logSideBreak[c])
+            {
+                return m_linsinv[c] * (v + m_minuslino[c]);
+            }
+
+            v = exp2((v + m_minuskb[c]) * m_kinv[c]);
+            return (v + m_minusb[c]) * m_minv[c];
+        });
+    }
+}
+
 #if OCIO_USE_SSE2
 CameraLog2LinRendererSSE::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLog2LinRenderer(log)
@@ -839,14 +1013,9 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
         mm_pixel_lin = _mm_add_ps(mm_pixel, mm_linoinv);
         mm_pixel_lin = _mm_mul_ps(mm_pixel_lin, mm_linsinv);
 
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
+        mm_pixel = Log2LinSSE(mm_pixel, mm_minuskb, mm_kinv, mm_minusb, mm_minv);
 
-        mm_pixel = _mm_or_ps(_mm_and_ps(flag, mm_pixel),
-                             _mm_andnot_ps(flag, mm_pixel_lin));
+        mm_pixel = SelectSSE(flag, mm_pixel, mm_pixel_lin);
 
         const float alphares = in[3];
 
@@ -857,6 +1026,33 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
         in += 4;
     }
 }
+
+void CameraLog2LinRendererSSE::applyPlanar(float * r, float * g, float * b, float *,
+                                           long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_kinv = _mm_set1_ps(m_kinv[c]);
+        const __m128 mm_minuskb = _mm_set1_ps(m_minuskb[c]);
+        const __m128 mm_minusb = _mm_set1_ps(m_minusb[c]);
+        const __m128 mm_minv = _mm_set1_ps(m_minv[c]);
+        const __m128 breakPnt = _mm_set1_ps(m_logSideBreak[c]);
+        const __m128 mm_linoinv = _mm_set1_ps(m_minuslino[c]);
+        const __m128 mm_linsinv = _mm_set1_ps(m_linsinv[c]);
+
+        sseApplyToPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            const __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+            const __m128 pixel_lin = _mm_mul_ps(_mm_add_ps(pixel, mm_linoinv), mm_linsinv);
+
+            pixel = Log2LinSSE(pixel, mm_minuskb, mm_kinv, mm_minusb, mm_minv);
+
+            return SelectSSE(flag, pixel, pixel_lin);
+        });
+    }
+}
 #endif
 
 CameraLin2LogRenderer::CameraLin2LogRenderer(ConstLogOpDataRcPtr & log)
@@ -919,6 +1115,29 @@ void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void CameraLin2LogRenderer::applyPlanar(float * r, float * g, float * b, float *,
+                                        long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        ApplyToPlane(planes[c], numPixels, [this, c](float v)
+        {
+            if (v < m_linb[c])
+            {
+                return m_linearSlope[c] * v + m_linearOffset[c];
+            }
+
+            v = std::max(minValue, v * m_m[c] + m_b[c]);
+            v = log2(v);
+            return v * m_klog[c] + m_kb[c];
+        });
+    }
+}
+
 #if OCIO_USE_SSE2
 CameraLin2LogRendererSSE::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLin2LogRenderer(log)
@@ -960,15 +1179,9 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
         mm_pixel_lin = _mm_mul_ps(mm_pixel, mm_lins);
         mm_pixel_lin = _mm_add_ps(mm_pixel_lin, mm_lino);
 
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_b);
-        mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
+        mm_pixel = Lin2LogSSE(mm_pixel, mm_m, mm_b, mm_minValue, mm_klog, mm_kb);
 
-        mm_pixel = _mm_or_ps(_mm_and_ps(flag, mm_pixel),
-                             _mm_andnot_ps(flag, mm_pixel_lin));
+        mm_pixel = SelectSSE(flag, mm_pixel, mm_pixel_lin);
 
         const float alphares = in[3];
 
@@ -979,7 +1192,120 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
         in += 4;
     }
 }
+
+void CameraLin2LogRendererSSE::applyPlanar(float * r, float * g, float * b, float *,
+                                           long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_m = _mm_set1_ps(m_m[c]);
+        const __m128 mm_b = _mm_set1_ps(m_b[c]);
+        const __m128 mm_klog = _mm_set1_ps(m_klog[c]);
+        const __m128 mm_kb = _mm_set1_ps(m_kb[c]);
+        const __m128 mm_lins = _mm_set1_ps(m_linearSlope[c]);
+        const __m128 mm_lino = _mm_set1_ps(m_linearOffset[c]);
+        const __m128 breakPnt = _mm_set1_ps(m_linb[c]);
+
+        sseApplyToPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            const __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+            const __m128 pixel_lin = _mm_add_ps(_mm_mul_ps(pixel, mm_lins), mm_lino);
+
+            pixel = Lin2LogSSE(pixel, mm_m, mm_b, mm_minValue, mm_klog, mm_kb);
+
+            return SelectSSE(flag, pixel, pixel_lin);
+        });
+    }
+}
 #endif
 
-} // namespace OCIO_NAMESPACE
+#if OCIO_USE_SSE2
+
+// The kernels take their parameters from the renderers.
+
+LogKernelSSE::LogKernelSSE(ConstLogOpDataRcPtr & log)
+{
+    const LogRenderer renderer(log, log->isLog2() ? 1.0f : LOG10_2);
+
+    m_minValue = _mm_set1_ps(std::numeric_limits<float>::min());
+    m_logScale = _mm_set1_ps(renderer.m_logScale);
+}
+
+AntiLogKernelSSE::AntiLogKernelSSE(ConstLogOpDataRcPtr & log)
+{
+    const AntiLogRenderer renderer(log, log->isLog2() ? 1.0f : LOG2_10);
+
+    m_log2_base = _mm_set1_ps(renderer.m_log2_base);
+}
+
+Log2LinKernelSSE::Log2LinKernelSSE(ConstLogOpDataRcPtr & log)
+{
+    const Log2LinRenderer renderer(log);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        m_kinv[c]    = _mm_set1_ps(renderer.m_kinv[c]);
+        m_minuskb[c] = _mm_set1_ps(renderer.m_minuskb[c]);
+        m_minusb[c]  = _mm_set1_ps(renderer.m_minusb[c]);
+        m_minv[c]    = _mm_set1_ps(renderer.m_minv[c]);
+    }
+}
+
+Lin2LogKernelSSE::Lin2LogKernelSSE(ConstLogOpDataRcPtr & log)
+{
+    const Lin2LogRenderer renderer(log);
+
+    m_minValue = _mm_set1_ps(std::numeric_limits<float>::min());
+
+    for (int c = 0; c < 3; ++c)
+    {
+        m_m[c]    = _mm_set1_ps(renderer.m_m[c]);
+        m_b[c]    = _mm_set1_ps(renderer.m_b[c]);
+        m_klog[c] = _mm_set1_ps(renderer.m_klog[c]);
+        m_kb[c]   = _mm_set1_ps(renderer.m_kb[c]);
+    }
+}
 
+CameraLog2LinKernelSSE::CameraLog2LinKernelSSE(ConstLogOpDataRcPtr & log)
+{
+    const CameraLog2LinRenderer renderer(log);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        m_kinv[c]         = _mm_set1_ps(renderer.m_kinv[c]);
+        m_minuskb[c]      = _mm_set1_ps(renderer.m_minuskb[c]);
+        m_minusb[c]       = _mm_set1_ps(renderer.m_minusb[c]);
+        m_minv[c]         = _mm_set1_ps(renderer.m_minv[c]);
+        m_logSideBreak[c] = _mm_set1_ps(renderer.m_logSideBreak[c]);
+        m_minuslino[c]    = _mm_set1_ps(renderer.m_minuslino[c]);
+        m_linsinv[c]      = _mm_set1_ps(renderer.m_linsinv[c]);
+    }
+}
+
+CameraLin2LogKernelSSE::CameraLin2LogKernelSSE(ConstLogOpDataRcPtr & log)
+{
+    const CameraLin2LogRenderer renderer(log);
+
+    m_minValue = _mm_set1_ps(std::numeric_limits<float>::min());
+
+    for (int c = 0; c < 3; ++c)
+    {
+        m_m[c]            = _mm_set1_ps(renderer.m_m[c]);
+        m_b[c]            = _mm_set1_ps(renderer.m_b[c]);
+        m_klog[c]         = _mm_set1_ps(renderer.m_klog[c]);
+        m_kb[c]           = _mm_set1_ps(renderer.m_kb[c]);
+        m_linearSlope[c]  = _mm_set1_ps(renderer.m_linearSlope[c]);
+        m_linearOffset[c] = _mm_set1_ps(renderer.m_linearOffset[c]);
+        m_linb[c]         = _mm_set1_ps(renderer.m_linb[c]);
+    }
+}
+
+#endif // OCIO_USE_SSE2
+
+} // namespace OCIO_NAMESPACE
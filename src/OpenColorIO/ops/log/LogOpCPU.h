@@ -8,11 +8,221 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ops/log/LogOpData.h"
+#include "SSE.h"
 
 namespace OCIO_NAMESPACE
 {
 ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp);
 
+#if OCIO_USE_SSE2
+
+// The SSE computations are shared by the packed processing, where each lane holds a channel of
+// a pixel, and by the planar processing, where the four lanes hold the same channel.
+
+inline __m128 LogSSE(__m128 pixel, __m128 minValue, __m128 logScale)
+{
+    pixel = _mm_max_ps(pixel, minValue);
+    pixel = sseLog2(pixel);
+    return _mm_mul_ps(pixel, logScale);
+}
+
+inline __m128 AntiLogSSE(__m128 pixel, __m128 log2_base)
+{
+    return sseExp2(_mm_mul_ps(pixel, log2_base));
+}
+
+inline __m128 Log2LinSSE(__m128 pixel, __m128 minuskb, __m128 kinv, __m128 minusb, __m128 minv)
+{
+    pixel = _mm_add_ps(pixel, minuskb);
+    pixel = _mm_mul_ps(pixel, kinv);
+    pixel = sseExp2(pixel);
+    pixel = _mm_add_ps(pixel, minusb);
+    return _mm_mul_ps(pixel, minv);
+}
+
+inline __m128 Lin2LogSSE(__m128 pixel, __m128 m, __m128 b, __m128 minValue,
+                         __m128 klog, __m128 kb)
+{
+    pixel = _mm_mul_ps(pixel, m);
+    pixel = _mm_add_ps(pixel, b);
+    pixel = _mm_max_ps(pixel, minValue);
+    pixel = sseLog2(pixel);
+    pixel = _mm_mul_ps(pixel, klog);
+    return _mm_add_ps(pixel, kb);
+}
+
+inline __m128 SelectSSE(__m128 flag, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(flag, a), _mm_andnot_ps(flag, b));
+}
+
+// The kernels process four pixels held in one register per channel (i.e. the red of the
+// four pixels in r, etc.) and give the same results as the SSE renderers, the alpha being
+// left unchanged.  They are used by the renderers fusing several ops (refer to
+// ops/FusedOpCPU.h).  The parameters come from the renderers.
+
+class LogKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit LogKernelSSE(ConstLogOpDataRcPtr & log);
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 &) const
+    {
+        r = LogSSE(r, m_minValue, m_logScale);
+        g = LogSSE(g, m_minValue, m_logScale);
+        b = LogSSE(b, m_minValue, m_logScale);
+    }
+
+private:
+    __m128 m_minValue;
+    __m128 m_logScale;
+};
+
+class AntiLogKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit AntiLogKernelSSE(ConstLogOpDataRcPtr & log);
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 &) const
+    {
+        r = AntiLogSSE(r, m_log2_base);
+        g = AntiLogSSE(g, m_log2_base);
+        b = AntiLogSSE(b, m_log2_base);
+    }
+
+private:
+    __m128 m_log2_base;
+};
+
+class Log2LinKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit Log2LinKernelSSE(ConstLogOpDataRcPtr & log);
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 &) const
+    {
+        r = process(r, 0);
+        g = process(g, 1);
+        b = process(b, 2);
+    }
+
+private:
+    __m128 process(__m128 pixel, int c) const
+    {
+        return Log2LinSSE(pixel, m_minuskb[c], m_kinv[c], m_minusb[c], m_minv[c]);
+    }
+
+    __m128 m_kinv[3];
+    __m128 m_minuskb[3];
+    __m128 m_minusb[3];
+    __m128 m_minv[3];
+};
+
+class Lin2LogKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit Lin2LogKernelSSE(ConstLogOpDataRcPtr & log);
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 &) const
+    {
+        r = process(r, 0);
+        g = process(g, 1);
+        b = process(b, 2);
+    }
+
+private:
+    __m128 process(__m128 pixel, int c) const
+    {
+        return Lin2LogSSE(pixel, m_m[c], m_b[c], m_minValue, m_klog[c], m_kb[c]);
+    }
+
+    __m128 m_minValue;
+    __m128 m_m[3];
+    __m128 m_b[3];
+    __m128 m_klog[3];
+    __m128 m_kb[3];
+};
+
+class CameraLog2LinKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit CameraLog2LinKernelSSE(ConstLogOpDataRcPtr & log);
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 &) const
+    {
+        r = process(r, 0);
+        g = process(g, 1);
+        b = process(b, 2);
+    }
+
+private:
+    __m128 process(__m128 pixel, int c) const
+    {
+        const __m128 flag = _mm_cmpgt_ps(pixel, m_logSideBreak[c]);
+        const __m128 pixel_lin = _mm_mul_ps(_mm_add_ps(pixel, m_minuslino[c]), m_linsinv[c]);
+
+        pixel = Log2LinSSE(pixel, m_minuskb[c], m_kinv[c], m_minusb[c], m_minv[c]);
+
+        return SelectSSE(flag, pixel, pixel_lin);
+    }
+
+    __m128 m_kinv[3];
+    __m128 m_minuskb[3];
+    __m128 m_minusb[3];
+    __m128 m_minv[3];
+    __m128 m_logSideBreak[3];
+    __m128 m_minuslino[3];
+    __m128 m_linsinv[3];
+};
+
+class CameraLin2LogKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = false;
+
+    explicit CameraLin2LogKernelSSE(ConstLogOpDataRcPtr & log);
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 &) const
+    {
+        r = process(r, 0);
+        g = process(g, 1);
+        b = process(b, 2);
+    }
+
+private:
+    __m128 process(__m128 pixel, int c) const
+    {
+        const __m128 flag = _mm_cmpgt_ps(pixel, m_linb[c]);
+        const __m128 pixel_lin = _mm_add_ps(_mm_mul_ps(pixel, m_linearSlope[c]),
+                                            m_linearOffset[c]);
+
+        pixel = Lin2LogSSE(pixel, m_m[c], m_b[c], m_minValue, m_klog[c], m_kb[c]);
+
+        return SelectSSE(flag, pixel, pixel_lin);
+    }
+
+    __m128 m_minValue;
+    __m128 m_m[3];
+    __m128 m_b[3];
+    __m128 m_klog[3];
+    __m128 m_kb[3];
+    __m128 m_linearSlope[3];
+    __m128 m_linearOffset[3];
+    __m128 m_linb[3];
+};
+
+#endif // OCIO_USE_SSE2
+
 } // namespace OCIO_NAMESPACE
 
-#endif
\ No newline at end of file
+#endif
@@ -48,6 +48,7 @@ public:
     bool hasChannelCrosstalk() const override;
     void finalize() override;
     std::string getCacheID() const override;
+    CacheIDDigest getCacheIDDigest() const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -148,6 +149,11 @@ std::string Lut1DOp::getCacheID() const
     return cacheIDStream.str();
 }
 
+CacheIDDigest Lut1DOp::getCacheIDDigest() const
+{
+    return lut1DData()->getCacheIDDigest();
+}
+
 ConstOpCPURcPtr Lut1DOp::getCPUOp(bool /*fastLogExpPow*/) const
 {
     ConstLut1DOpDataRcPtr data = lut1DData();
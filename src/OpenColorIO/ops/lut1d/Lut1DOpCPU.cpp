@@ -2,6 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <math.h>
 #include <memory>
 #include <stdint.h>
@@ -65,6 +68,30 @@ struct LookupLut
 };
 
 
+// Reads a LUT value stored as a float or as a finite half float.  The half float conversion
+// avoids the 256 KB conversion table of the half type, which would defeat the purpose of
+// a smaller LUT.
+inline float GetLutValue(float val)
+{
+    return val;
+}
+
+inline float GetLutValue(half val)
+{
+    const uint32_t bits = uint32_t(val.bits() & 0x7fff) << 13;
+    const uint32_t sign = uint32_t(val.bits() & 0x8000) << 16;
+
+    float f;
+    memcpy(&f, &bits, sizeof(float));
+    f *= 5.192296858534828e+33f; // 2^112 rebiases the exponent, denormals included.
+
+    uint32_t res;
+    memcpy(&res, &f, sizeof(float));
+    res |= sign;
+    memcpy(&f, &res, sizeof(float));
+    return f;
+}
+
 template<BitDepth inBD, BitDepth outBD>
 class BaseLut1DRenderer : public OpCPU
 {
@@ -77,6 +104,19 @@ public:
     //     that having a way to test it is critical.
     constexpr bool isLookup() const noexcept { return inBD != BIT_DEPTH_F32; }
 
+    bool isHalfStorage() const noexcept { return m_halfStorage; }
+
+    // The alpha channel is only scaled so the F32 renderers also process packed RGB.
+    bool hasRGBApply() const override
+    {
+        return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32;
+    }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        applyRGBWithRGBABuffer(inImg, outImg, numPixels);
+    }
+
 protected:
 
     virtual void update(ConstLut1DOpDataRcPtr & lut);
@@ -103,7 +143,11 @@ protected:
     float m_step = 1.0f;
     float m_dimMinusOne = 0.0f;
 
+    // The interpolated LUT values are stored as half floats instead of floats.
+    bool m_halfStorage = false;
+
     Lut1DOpCPUApplyFunc *m_applyLutFunc = nullptr;
+    Lut1DOpCPUApplyPlaneFunc *m_applyLutPlaneFunc = nullptr;
 
 private:
     BaseLut1DRenderer() = delete;
@@ -134,7 +178,34 @@ public:
     Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth)
         : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
 
+    // With halfStorage, the interpolated LUT is stored as half floats when all its values
+    // are representable.
+    Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut, bool halfStorage)
+        : BaseLut1DRenderer<inBD, outBD>(lut)
+    {
+        if (halfStorage && !this->isLookup())
+        {
+            storeAsHalf();
+        }
+    }
+
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override
+    {
+        return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32;
+    }
+
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
+protected:
+    void storeAsHalf();
+
+    template<typename LutType>
+    void interpolate(const void * inImg, void * outImg, long numPixels) const;
+
+    template<typename LutType>
+    void interpolatePlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -150,6 +221,13 @@ public:
         : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override
+    {
+        return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32;
+    }
+
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -162,6 +240,8 @@ public:
         :  Lut1DRenderer<inBD, outBD>(lut, BIT_DEPTH_F32) {} // HueAdjust needs float processing.
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return false; }
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -174,6 +254,38 @@ public:
         : Lut1DRendererHalfCode<inBD, outBD>(lut, BIT_DEPTH_F32) {} // HueAdjust needs float processing.
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return false; }
+};
+
+// Bracketing table used to narrow the binary search of the inverse evaluation.
+//
+// The [first, last] value range of an (increasing) effective LUT is split into intervals and
+// the table holds, for each interval, the index of the first LUT entry falling in it. As the
+// interval of a value is a monotonic function of the value, the std::lower_bound() of any value
+// lies between the first entries of its interval and of the next one, so searching that
+// sub-range gives exactly the same result as searching the whole LUT.
+//
+// The intervals are either uniform in value, or uniform in the float bit pattern (i.e. roughly
+// logarithmic) which suits LUTs spanning several orders of magnitude such as half domain LUTs.
+// Note: The structure does not own the indices.
+struct LutBrackets
+{
+    const unsigned * indices = nullptr; // numIntervals + 1 entries, relative to the LUT start.
+    unsigned numIntervals    = 1;
+    bool     useBitPattern   = false;
+    float    minValue        = 0.f;     // Uniform intervals.
+    float    scale           = 0.f;
+    uint32_t minKey          = 0;       // Bit pattern intervals.
+    unsigned shift           = 0;
+
+    inline unsigned getInterval(float val) const;
+
+    // Number of indices needed by the table of the [start, end] LUT.
+    static unsigned GetNumIndices(const float * start, const float * end);
+
+    // Build the table of the [start, end] LUT in indices (holding GetNumIndices() entries).
+    void build(const float * start, const float * end, unsigned * storage);
 };
 
 // Holds the parameters of a color component.
@@ -199,6 +311,8 @@ struct ComponentParams
     const float * negLutEnd;  // lutEnd for negative part of half domain LUT.
     float flipSign;           // Flip the sign of value to handle decreasing luts.
     float bisectPoint;        // Point of switching from pos to neg of half domain.
+    LutBrackets brackets;     // Search table for lutStart to lutEnd.
+    LutBrackets negBrackets;  // Search table for negLutStart to negLutEnd.
 
     static void setComponentParams(ComponentParams & params,
                                    const Lut1DOpData::ComponentProperties & properties,
@@ -218,11 +332,24 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBApply() const override
+    {
+        return inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32;
+    }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        applyRGBWithRGBABuffer(inImg, outImg, numPixels);
+    }
+
     void resetData();
 
     virtual void updateData(ConstLut1DOpDataRcPtr & lut);
 
 protected:
+    // Build the search tables once the temporary LUT(s) are filled.
+    void updateBrackets(bool halfDomain);
+
     float m_scale; // Output scaling for the r, g and b components.
 
     ComponentParams m_paramsR;
@@ -233,6 +360,9 @@ protected:
     std::vector<float> m_tmpLutR;
     std::vector<float> m_tmpLutG;
     std::vector<float> m_tmpLutB;
+    std::vector<unsigned> m_bracketsR;
+    std::vector<unsigned> m_bracketsG;
+    std::vector<unsigned> m_bracketsB;
     float              m_alphaScaling;  // Bit-depth scale factor for alpha channel.
 };
 
@@ -283,6 +413,7 @@ BaseLut1DRenderer<inBD, outBD>::BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     if (CPUInfo::instance().hasSSE2())
     {
         m_applyLutFunc = SSE2GetLut1DApplyFunc(inBD, outBD);
+        m_applyLutPlaneFunc = SSE2GetLut1DApplyPlaneFunc();
     }
 #endif
 
@@ -290,6 +421,7 @@ BaseLut1DRenderer<inBD, outBD>::BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     if (CPUInfo::instance().hasAVX())
     {
         m_applyLutFunc = AVXGetLut1DApplyFunc(inBD, outBD);
+        m_applyLutPlaneFunc = AVXGetLut1DApplyPlaneFunc();
     }
 #endif
 
@@ -297,6 +429,7 @@ BaseLut1DRenderer<inBD, outBD>::BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
     {
         m_applyLutFunc = AVX2GetLut1DApplyFunc(inBD, outBD);
+        m_applyLutPlaneFunc = AVX2GetLut1DApplyPlaneFunc();
     }
 #endif
 
@@ -304,6 +437,7 @@ BaseLut1DRenderer<inBD, outBD>::BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     if (CPUInfo::instance().hasAVX512())
     {
         m_applyLutFunc = AVX512GetLut1DApplyFunc(inBD, outBD);
+        m_applyLutPlaneFunc = AVX512GetLut1DApplyPlaneFunc();
     }
 #endif
 }
@@ -477,6 +611,10 @@ void BaseLut1DRenderer<inBD, outBD>::reset()
                 break;
         }
     }
+    else if (m_halfStorage)
+    {
+        resetData<half>();
+    }
     else
     {
         resetData<float>();
@@ -528,41 +666,142 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
             out += 4;
         }
     }
-    else  // Need to interpolate rather than simply lookup.
+    else if (this->m_halfStorage)  // Need to interpolate rather than simply lookup.
     {
-        const float * lutR = (const float *)this->m_tmpLutR;
-        const float * lutG = (const float *)this->m_tmpLutG;
-        const float * lutB = (const float *)this->m_tmpLutB;
+        interpolate<half>(inImg, outImg, numPixels);
+    }
+    else
+    {
+        interpolate<float>(inImg, outImg, numPixels);
+    }
+}
 
-        for(long idx=0; idx<numPixels; ++idx)
+template<BitDepth inBD, BitDepth outBD>
+template<typename LutType>
+void Lut1DRendererHalfCode<inBD, outBD>::interpolate(const void * inImg, void * outImg, long numPixels) const
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    const InType * in = (InType *)inImg;
+    OutType * out = (OutType *)outImg;
+
+    const LutType * lutR = (const LutType *)this->m_tmpLutR;
+    const LutType * lutG = (const LutType *)this->m_tmpLutG;
+    const LutType * lutB = (const LutType *)this->m_tmpLutB;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        const IndexPair redInterVals   = IndexPair::GetEdgeFloatValues(in[0]);
+        const IndexPair greenInterVals = IndexPair::GetEdgeFloatValues(in[1]);
+        const IndexPair blueInterVals  = IndexPair::GetEdgeFloatValues(in[2]);
+
+        // Since fraction is in the domain [0, 1), interpolate using
+        // 1-fraction in order to avoid cases like -/+Inf * 0.
+        out[0] = Converter<outBD>::CastValue(
+                    lerpf(GetLutValue(lutR[redInterVals.valB]),
+                          GetLutValue(lutR[redInterVals.valA]),
+                          1.0f-redInterVals.fraction));
+
+        out[1] = Converter<outBD>::CastValue(
+                    lerpf(GetLutValue(lutG[greenInterVals.valB]),
+                          GetLutValue(lutG[greenInterVals.valA]),
+                          1.0f-greenInterVals.fraction));
+
+        out[2] = Converter<outBD>::CastValue(
+                    lerpf(GetLutValue(lutB[blueInterVals.valB]),
+                          GetLutValue(lutB[blueInterVals.valA]),
+                          1.0f-blueInterVals.fraction));
+
+        out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRendererHalfCode<inBD, outBD>::applyPlanar(float * r, float * g, float * b, float * a,
+                                                     long numPixels) const
+{
+    if (this->m_halfStorage)
+    {
+        interpolatePlanar<half>(r, g, b, a, numPixels);
+    }
+    else
+    {
+        interpolatePlanar<float>(r, g, b, a, numPixels);
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+template<typename LutType>
+void Lut1DRendererHalfCode<inBD, outBD>::interpolatePlanar(float * r, float * g, float * b,
+                                                           float * a, long numPixels) const
+{
+    const LutType * luts[3] = { (const LutType *)this->m_tmpLutR,
+                                (const LutType *)this->m_tmpLutG,
+                                (const LutType *)this->m_tmpLutB };
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const LutType * lut = luts[c];
+        ApplyToPlane(planes[c], numPixels, [lut](float v)
         {
-            const IndexPair redInterVals   = IndexPair::GetEdgeFloatValues(in[0]);
-            const IndexPair greenInterVals = IndexPair::GetEdgeFloatValues(in[1]);
-            const IndexPair blueInterVals  = IndexPair::GetEdgeFloatValues(in[2]);
+            const IndexPair interVals = IndexPair::GetEdgeFloatValues(v);
 
-            // Since fraction is in the domain [0, 1), interpolate using
-            // 1-fraction in order to avoid cases like -/+Inf * 0.
-            out[0] = Converter<outBD>::CastValue(
-                        lerpf(lutR[redInterVals.valB],
-                              lutR[redInterVals.valA],
-                              1.0f-redInterVals.fraction));
+            return Converter<outBD>::CastValue(lerpf(GetLutValue(lut[interVals.valB]),
+                                                     GetLutValue(lut[interVals.valA]),
+                                                     1.0f-interVals.fraction));
+        });
+    }
 
-            out[1] = Converter<outBD>::CastValue(
-                        lerpf(lutG[greenInterVals.valB],
-                              lutG[greenInterVals.valA],
-                              1.0f-greenInterVals.fraction));
+    if (a)
+    {
+        ApplyToPlane(a, numPixels, [this](float v)
+        {
+            return Converter<outBD>::CastValue(v * this->m_alphaScaling);
+        });
+    }
+}
 
-            out[2] = Converter<outBD>::CastValue(
-                        lerpf(lutB[blueInterVals.valB],
-                              lutB[blueInterVals.valA],
-                              1.0f-blueInterVals.fraction));
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRendererHalfCode<inBD, outBD>::storeAsHalf()
+{
+    const float * luts[3] = { (const float *)this->m_tmpLutR,
+                              (const float *)this->m_tmpLutG,
+                              (const float *)this->m_tmpLutB };
 
-            out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+    // The infinite values were sanitized to +/-FLT_MAX, they become +/-HALF_MAX.
+    auto toHalf = [](float v) -> float
+    {
+        return std::fabs(v) == std::numeric_limits<float>::max() ? std::copysign(HALF_MAX, v) : v;
+    };
 
-            in  += 4;
-            out += 4;
+    for (const float * lut : luts)
+    {
+        if (!std::all_of(lut, lut + this->m_dim,
+                         [&toHalf](float v) { return std::fabs(toHalf(v)) <= HALF_MAX; }))
+        {
+            return;
         }
     }
+
+    half * halfLuts[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        halfLuts[c] = new half[this->m_dim];
+        std::transform(luts[c], luts[c] + this->m_dim, halfLuts[c], toHalf);
+    }
+
+    this->template resetData<float>();
+
+    this->m_tmpLutR = halfLuts[0];
+    this->m_tmpLutG = halfLuts[1];
+    this->m_tmpLutB = halfLuts[2];
+
+    this->m_halfStorage = true;
 }
 
 IndexPair IndexPair::GetEdgeFloatValues(float fIn)
@@ -720,6 +959,51 @@ void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long n
     }
 }
 
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRenderer<inBD, outBD>::applyPlanar(float * r, float * g, float * b, float * a,
+                                             long numPixels) const
+{
+    const float * luts[3] = { (const float *)this->m_tmpLutR,
+                              (const float *)this->m_tmpLutG,
+                              (const float *)this->m_tmpLutB };
+    float * planes[3] = { r, g, b };
+
+    // Same processing as the packed images, the SIMD functions leaving the alpha unchanged.
+    if (this->m_applyLutPlaneFunc && numPixels > 1)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            this->m_applyLutPlaneFunc(luts[c], this->m_dim, planes[c], numPixels);
+        }
+        return;
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * lut = luts[c];
+        ApplyToPlane(planes[c], numPixels, [this, lut](float v)
+        {
+            // NaNs become 0
+            const float idx = std::min(std::max(0.f, this->m_step * v), this->m_dimMinusOne);
+
+            const unsigned int lowIdx  = static_cast<unsigned int>(std::floor(idx));
+            const unsigned int highIdx = static_cast<unsigned int>(std::ceil(idx));
+
+            const float delta = (float)highIdx - idx;
+
+            return Converter<outBD>::CastValue(lerpf(lut[highIdx], lut[lowIdx], delta));
+        });
+    }
+
+    if (a)
+    {
+        ApplyToPlane(a, numPixels, [this](float v)
+        {
+            return Converter<outBD>::CastValue(v * this->m_alphaScaling);
+        });
+    }
+}
+
 namespace GamutMapUtils
 {
 // Compute the indices for the smallest, middle, and largest elements of
@@ -998,13 +1282,136 @@ void Lut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * outIm
 
 namespace
 {
-// TODO: Use SSE intrinsics to speed this up.
+
+// Map a float to an unsigned key preserving the float ordering (with -0 == +0).
+inline uint32_t GetOrderedKey(float val)
+{
+    if (val == 0.f)
+    {
+        val = 0.f;
+    }
+
+    uint32_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+// Return the largest number of LUT entries falling in the same interval.
+template<typename Brackets>
+unsigned GetMaxIntervalCount(const Brackets & brackets, const float * start, const float * end)
+{
+    unsigned maxCount = 0;
+    unsigned count    = 0;
+    unsigned current  = 0;
+    for (const float * val = start; val < end; ++val)
+    {
+        const unsigned interval = brackets.getInterval(*val);
+        count = (interval == current) ? count + 1 : 1;
+        current = interval;
+        maxCount = std::max(maxCount, count);
+    }
+    return maxCount;
+}
+
+}
+
+inline unsigned LutBrackets::getInterval(float val) const
+{
+    if (useBitPattern)
+    {
+        // (NaN goes to the first interval, as lower_bound() returns the start for it.)
+        if (IsNan(val))
+        {
+            return 0;
+        }
+        const uint32_t key = GetOrderedKey(val);
+        return key <= minKey ? 0 : std::min((key - minKey) >> shift, numIntervals - 1);
+    }
+
+    const float f = (val - minValue) * scale;
+    // (NaN fails the test and goes to the first interval.)
+    if (!(f > 0.f))
+    {
+        return 0;
+    }
+    return f < (float)numIntervals ? (unsigned)f : numIntervals - 1;
+}
+
+unsigned LutBrackets::GetNumIndices(const float * start, const float * end)
+{
+    // One interval per LUT entry on average.
+    const unsigned numEntries = (unsigned)(end - start);
+    return std::max(numEntries, 1u) + 1;
+}
+
+void LutBrackets::build(const float * start, const float * end, unsigned * storage)
+{
+    // Note that the end entry is excluded from the search (refer to FindLutInv()) but it is
+    // the maximum value after clamping.
+    const unsigned numEntries = (unsigned)(end - start);
+
+    numIntervals  = GetNumIndices(start, end) - 1;
+    useBitPattern = false;
+    minValue      = *start;
+    scale         = 0.f;
+    minKey        = GetOrderedKey(*start);
+    shift         = 0;
+
+    const float range = *end - *start;
+    if (range > 0.f)
+    {
+        // Evaluate both kinds of intervals and keep the one giving the shortest searches.
+
+        LutBrackets bitPattern(*this);
+        bitPattern.useBitPattern = true;
+        const uint32_t keyRange = GetOrderedKey(*end) - minKey;
+        while ((keyRange >> bitPattern.shift) >= numIntervals)
+        {
+            ++bitPattern.shift;
+        }
+
+        if (!std::isfinite(range))
+        {
+            *this = bitPattern;
+        }
+        else
+        {
+            scale = (float)numIntervals / range;
+            if (GetMaxIntervalCount(bitPattern, start, end) < GetMaxIntervalCount(*this, start, end))
+            {
+                *this = bitPattern;
+            }
+        }
+    }
+    // Otherwise all the values are in the first interval i.e. a search over the whole LUT.
+
+    // indices[k] is the first entry whose interval is >= k.
+    unsigned k = 0;
+    for (unsigned i = 0; i < numEntries; ++i)
+    {
+        const unsigned interval = getInterval(start[i]);
+        while (k <= interval)
+        {
+            storage[k++] = i;
+        }
+    }
+    while (k <= numIntervals)
+    {
+        storage[k++] = numEntries;
+    }
+
+    indices = storage;
+}
+
+namespace
+{
 
 // Calculate the inverse of a value resulting from linear interpolation
 // in a 1d LUT.
 // start:       Pointer to the first effective LUT entry (end of flat spot).
 // startOffset: Distance between first LUT entry and start.
 // end:         Pointer to the last effective LUT entry (start of flat spot).
+// brackets:    Search table of the [start, end] LUT.
 // flipSign:    Flips val if we're working with the negative of the orig LUT.
 // scale:       From LUT index units to outDepth units.
 // val:         The value to invert.
@@ -1013,6 +1420,7 @@ namespace
 float FindLutInv(const float * start,
                  const float   startOffset,
                  const float * end,
+                 const LutBrackets & brackets,
                  const float   flipSign,
                  const float   scale,
                  const float   val)
@@ -1030,7 +1438,11 @@ float FindLutInv(const float * start,
     // (NB: This is correct using either end or end+1 since lower_bound will return a
     //  value one greater than the second argument if no values in the array are >= cv.)
     // http://www.sgi.com/tech/stl/lower_bound.html
-    const float* lowbound = std::lower_bound(start, end, cv);
+    // Only search the entries of the interval containing cv (refer to LutBrackets).
+    const unsigned interval = brackets.getInterval(cv);
+    const float * lowbound = std::lower_bound(start + brackets.indices[interval],
+                                              start + brackets.indices[interval + 1],
+                                              cv);
 
     // lower_bound() returns first entry >= val so decrement it unless val == *start.
     if (lowbound > start) {
@@ -1067,6 +1479,7 @@ float FindLutInv(const float * start,
 // start:       Pointer to the first effective LUT entry (end of flat spot).
 // startOffset: Distance between first LUT entry and start.
 // end:         Pointer to the last effective LUT entry (start of flat spot).
+// brackets:    Search table of the [start, end] LUT.
 // flipSign:    Flips val if we're working with the negative of the orig LUT.
 // scale:       From LUT index units to outDepth units.
 // val:         The value to invert.
@@ -1075,6 +1488,7 @@ float FindLutInv(const float * start,
 float FindLutInvHalf(const float * start,
                      const float   startOffset,
                      const float * end,
+                     const LutBrackets & brackets,
                      const float   flipSign,
                      const float   scale,
                      const float   val)
@@ -1086,7 +1500,11 @@ float FindLutInvHalf(const float * start,
     // Clamp the value to the range of the LUT.
     const float cv = std::min( std::max( val * flipSign, *start ), *end );
 
-    const float* lowbound = std::lower_bound(start, end, cv);
+    // Only search the entries of the interval containing cv (refer to LutBrackets).
+    const unsigned interval = brackets.getInterval(cv);
+    const float * lowbound = std::lower_bound(start + brackets.indices[interval],
+                                              start + brackets.indices[interval + 1],
+                                              cv);
 
     // lower_bound() returns first entry >= val so decrement it unless val == *start.
     if (lowbound > start) {
@@ -1165,6 +1583,9 @@ void InvLut1DRenderer<inBD, outBD>::resetData()
     m_tmpLutR.resize(0);
     m_tmpLutG.resize(0);
     m_tmpLutB.resize(0);
+    m_bracketsR.resize(0);
+    m_bracketsG.resize(0);
+    m_bracketsB.resize(0);
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1235,6 +1656,41 @@ void InvLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
     // Converts from index units to inDepth units of the original LUT.
     // (Note that inDepth of the original LUT is outDepth of the inverse LUT.)
     m_scale = outMax / (float) (m_dim - 1);
+
+    updateBrackets(false);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void InvLut1DRenderer<inBD, outBD>::updateBrackets(bool halfDomain)
+{
+    auto buildBrackets = [halfDomain](ComponentParams & params, std::vector<unsigned> & storage)
+    {
+        const unsigned numIndices = LutBrackets::GetNumIndices(params.lutStart, params.lutEnd);
+        storage.resize(numIndices
+                       + (halfDomain ? LutBrackets::GetNumIndices(params.negLutStart,
+                                                                  params.negLutEnd)
+                                     : 0));
+
+        params.brackets.build(params.lutStart, params.lutEnd, storage.data());
+        if (halfDomain)
+        {
+            params.negBrackets.build(params.negLutStart, params.negLutEnd,
+                                     storage.data() + numIndices);
+        }
+    };
+
+    buildBrackets(m_paramsR, m_bracketsR);
+
+    if (m_tmpLutG.empty())
+    {
+        // NB: All pointers refer to m_tmpLutR & m_bracketsR.
+        m_paramsB = m_paramsG = m_paramsR;
+    }
+    else
+    {
+        buildBrackets(m_paramsG, m_bracketsG);
+        buildBrackets(m_paramsB, m_bracketsB);
+    }
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1253,6 +1709,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                     FindLutInv(this->m_paramsR.lutStart,
                                this->m_paramsR.startOffset,
                                this->m_paramsR.lutEnd,
+                               this->m_paramsR.brackets,
                                this->m_paramsR.flipSign,
                                m_scale,
                                (float)in[0]));
@@ -1262,6 +1719,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                     FindLutInv(this->m_paramsG.lutStart,
                                this->m_paramsG.startOffset,
                                this->m_paramsG.lutEnd,
+                               this->m_paramsG.brackets,
                                this->m_paramsG.flipSign,
                                m_scale,
                                (float)in[1]));
@@ -1271,6 +1729,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                     FindLutInv(this->m_paramsB.lutStart,
                                this->m_paramsB.startOffset,
                                this->m_paramsB.lutEnd,
+                               this->m_paramsB.brackets,
                                this->m_paramsB.flipSign,
                                m_scale,
                                (float)in[2]));
@@ -1316,6 +1775,7 @@ void InvLut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * ou
             FindLutInv(this->m_paramsR.lutStart,
                        this->m_paramsR.startOffset,
                        this->m_paramsR.lutEnd,
+                       this->m_paramsR.brackets,
                        this->m_paramsR.flipSign,
                        this->m_scale,
                        RGB[0]),
@@ -1323,6 +1783,7 @@ void InvLut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * ou
             FindLutInv(this->m_paramsG.lutStart,
                        this->m_paramsG.startOffset,
                        this->m_paramsG.lutEnd,
+                       this->m_paramsG.brackets,
                        this->m_paramsG.flipSign,
                        this->m_scale,
                        RGB[1]),
@@ -1330,6 +1791,7 @@ void InvLut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * ou
             FindLutInv(this->m_paramsB.lutStart,
                        this->m_paramsB.startOffset,
                        this->m_paramsB.lutEnd,
+                       this->m_paramsB.brackets,
                        this->m_paramsB.flipSign,
                        this->m_scale,
                        RGB[2])
@@ -1446,6 +1908,8 @@ void InvLut1DRendererHalfCode<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & l
     // between adjacent entries is not constant, we cannot roll it into the
     // scale.
     this->m_scale = outMax;
+
+    this->updateBrackets(true);
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1478,12 +1942,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                 ? FindLutInvHalf(this->m_paramsR.lutStart,
                                  this->m_paramsR.startOffset,
                                  this->m_paramsR.lutEnd,
+                                 this->m_paramsR.brackets,
                                  this->m_paramsR.flipSign,
                                  this->m_scale,
                                  redIn) 
                 : FindLutInvHalf(this->m_paramsR.negLutStart,
                                  this->m_paramsR.negStartOffset,
                                  this->m_paramsR.negLutEnd,
+                                 this->m_paramsR.negBrackets,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  redIn);
@@ -1494,12 +1960,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                 ? FindLutInvHalf(this->m_paramsG.lutStart,
                                  this->m_paramsG.startOffset,
                                  this->m_paramsG.lutEnd,
+                                 this->m_paramsG.brackets,
                                  this->m_paramsG.flipSign,
                                  this->m_scale,
                                  grnIn) 
                 : FindLutInvHalf(this->m_paramsG.negLutStart,
                                  this->m_paramsG.negStartOffset,
                                  this->m_paramsG.negLutEnd,
+                                 this->m_paramsG.negBrackets,
                                  -this->m_paramsG.flipSign,
                                  this->m_scale,
                                  grnIn);
@@ -1510,12 +1978,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                 ? FindLutInvHalf(this->m_paramsB.lutStart,
                                  this->m_paramsB.startOffset,
                                  this->m_paramsB.lutEnd,
+                                 this->m_paramsB.brackets,
                                  this->m_paramsB.flipSign,
                                  this->m_scale,
                                  bluIn)
                 : FindLutInvHalf(this->m_paramsB.negLutStart,
                                  this->m_paramsB.negStartOffset,
                                  this->m_paramsB.negLutEnd,
+                                 this->m_paramsB.negBrackets,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  bluIn);
@@ -1567,12 +2037,14 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
                 ? FindLutInvHalf(this->m_paramsR.lutStart,
                                  this->m_paramsR.startOffset,
                                  this->m_paramsR.lutEnd,
+                                 this->m_paramsR.brackets,
                                  this->m_paramsR.flipSign,
                                  this->m_scale,
                                  RGB[0])
                 : FindLutInvHalf(this->m_paramsR.negLutStart,
                                  this->m_paramsR.negStartOffset,
                                  this->m_paramsR.negLutEnd,
+                                 this->m_paramsR.negBrackets,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  RGB[0]);
@@ -1582,12 +2054,14 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
                 ? FindLutInvHalf(this->m_paramsG.lutStart,
                                  this->m_paramsG.startOffset,
                                  this->m_paramsG.lutEnd,
+                                 this->m_paramsG.brackets,
                                  this->m_paramsG.flipSign,
                                  this->m_scale,
                                  RGB[1]) 
                 : FindLutInvHalf(this->m_paramsG.negLutStart,
                                  this->m_paramsG.negStartOffset,
                                  this->m_paramsG.negLutEnd,
+                                 this->m_paramsG.negBrackets,
                                  -this->m_paramsG.flipSign,
                                  this->m_scale,
                                  RGB[1]);
@@ -1597,12 +2071,14 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
                 ? FindLutInvHalf(this->m_paramsB.lutStart,
                                  this->m_paramsB.startOffset,
                                  this->m_paramsB.lutEnd,
+                                 this->m_paramsB.brackets,
                                  this->m_paramsB.flipSign,
                                  this->m_scale,
                                  RGB[2]) 
                 : FindLutInvHalf(this->m_paramsB.negLutStart,
                                  this->m_paramsB.negStartOffset,
                                  this->m_paramsB.negLutEnd,
+                                 this->m_paramsB.negBrackets,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
                                  RGB[2]);
@@ -1624,7 +2100,7 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
 }
 
 template<BitDepth inBD, BitDepth outBD>
-OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
+OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut, bool halfStorage)
 {
     // NB: Unlike bit-depth, the half domain status of a LUT
     //     may not be changed.
@@ -1632,7 +2108,7 @@ OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     {
         if (lut->getHueAdjust() == HUE_NONE)
         {
-            return std::make_shared< Lut1DRendererHalfCode<inBD, outBD> >(lut);
+            return std::make_shared< Lut1DRendererHalfCode<inBD, outBD> >(lut, halfStorage);
         }
         else
         {
@@ -1655,13 +2131,13 @@ OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
 }
 
 template<BitDepth inBD, BitDepth outBD>
-ConstOpCPURcPtr GetLut1DRenderer_OutBitDepth(ConstLut1DOpDataRcPtr & lut)
+ConstOpCPURcPtr GetLut1DRenderer_OutBitDepth(ConstLut1DOpDataRcPtr & lut, bool halfStorage)
 {
     switch (lut->getDirection())
     {
     case TRANSFORM_DIR_FORWARD:
     {
-        return GetForwardLut1DRenderer<inBD, outBD>(lut);
+        return GetForwardLut1DRenderer<inBD, outBD>(lut, halfStorage);
         break;
     }
     case TRANSFORM_DIR_INVERSE:
@@ -1695,22 +2171,23 @@ ConstOpCPURcPtr GetLut1DRenderer_OutBitDepth(ConstLut1DOpDataRcPtr & lut)
 }
 
 template<BitDepth inBD>
-ConstOpCPURcPtr GetLut1DRenderer_InBitDepth(ConstLut1DOpDataRcPtr & lut, BitDepth outBD)
+ConstOpCPURcPtr GetLut1DRenderer_InBitDepth(ConstLut1DOpDataRcPtr & lut, BitDepth outBD,
+                                            bool halfStorage)
 {
     switch(outBD)
     {
         case BIT_DEPTH_UINT8:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT8>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT8>(lut, halfStorage); break;
         case BIT_DEPTH_UINT10:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT10>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT10>(lut, halfStorage); break;
         case BIT_DEPTH_UINT12:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT12>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT12>(lut, halfStorage); break;
         case BIT_DEPTH_UINT16:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT16>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT16>(lut, halfStorage); break;
         case BIT_DEPTH_F16:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F16>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F16>(lut, halfStorage); break;
         case BIT_DEPTH_F32:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F32>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F32>(lut, halfStorage); break;
 
         case BIT_DEPTH_UINT14:
         case BIT_DEPTH_UINT32:
@@ -1723,22 +2200,23 @@ ConstOpCPURcPtr GetLut1DRenderer_InBitDepth(ConstLut1DOpDataRcPtr & lut, BitDept
     return ConstOpCPURcPtr();
 }
 
-ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth inBD, BitDepth outBD)
+ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth inBD, BitDepth outBD,
+                                 bool halfStorage)
 {
     switch(inBD)
     {
         case BIT_DEPTH_UINT8:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT8>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT8>(lut, outBD, halfStorage); break;
         case BIT_DEPTH_UINT10:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT10>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT10>(lut, outBD, halfStorage); break;
         case BIT_DEPTH_UINT12:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT12>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT12>(lut, outBD, halfStorage); break;
         case BIT_DEPTH_UINT16:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT16>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT16>(lut, outBD, halfStorage); break;
         case BIT_DEPTH_F16:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F16>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F16>(lut, outBD, halfStorage); break;
         case BIT_DEPTH_F32:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F32>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F32>(lut, outBD, halfStorage); break;
 
         case BIT_DEPTH_UINT14:
         case BIT_DEPTH_UINT32:
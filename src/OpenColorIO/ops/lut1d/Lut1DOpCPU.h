@@ -11,7 +11,10 @@
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth in, BitDepth out);
+// With halfStorage, the forward half domain LUT renderer stores the LUT as half floats when
+// the input is F32 and the LUT values are representable.
+ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth in, BitDepth out,
+                                 bool halfStorage = false);
 
 } // namespace OCIO_NAMESPACE
 
@@ -137,6 +137,40 @@ static inline void linear1D(const float *lutR, const float *lutG,const float *lu
     }
 }
 
+static void linear1DPlane(const float *lut, int dim, float *plane, long numValues)
+{
+    const __m256 lut_scale = _mm256_set1_ps((float)dim -1);
+    const __m256 lut_max   = _mm256_set1_ps((float)dim -1);
+
+    int value_count = numValues / 8 * 8;
+    int remainder = numValues - value_count;
+
+    for (int i = 0; i < value_count; i += 8 ) {
+        __m256 v = _mm256_loadu_ps(plane + i);
+        v = apply_lut_avx(lut, v, lut_scale, lut_max);
+        _mm256_storeu_ps(plane + i, v);
+    }
+
+    // handler leftovers values
+    if (remainder) {
+        AVX_ALIGN(float buffer[8]) = {};
+
+        for (int i = 0; i < remainder; ++i)
+        {
+            buffer[i] = plane[value_count + i];
+        }
+
+        __m256 v = _mm256_load_ps(buffer);
+        v = apply_lut_avx(lut, v, lut_scale, lut_max);
+        _mm256_store_ps(buffer, v);
+
+        for (int i = 0; i < remainder; ++i)
+        {
+            plane[value_count + i] = buffer[i];
+        }
+    }
+}
+
 template<BitDepth inBD>
 inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
 {
@@ -194,6 +228,11 @@ Lut1DOpCPUApplyFunc * AVXGetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+Lut1DOpCPUApplyPlaneFunc * AVXGetLut1DApplyPlaneFunc()
+{
+    return linear1DPlane;
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX
\ No newline at end of file
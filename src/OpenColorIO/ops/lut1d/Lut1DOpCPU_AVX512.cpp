@@ -92,6 +92,30 @@ static inline void linear1D(const float *lutR, const float *lutG,const float *lu
     }
 }
 
+static void linear1DPlane(const float *lut, int dim, float *plane, long numValues)
+{
+    const __m512 lut_scale = _mm512_set1_ps((float)dim -1);
+    const __m512 lut_max   = _mm512_set1_ps((float)dim -1);
+
+    int value_count = numValues / 16 * 16;
+    int remainder = numValues - value_count;
+
+    for (int i = 0; i < value_count; i += 16 ) {
+        __m512 v = _mm512_loadu_ps(plane + i);
+        v = apply_lut_avx512(lut, v, lut_scale, lut_max);
+        _mm512_storeu_ps(plane + i, v);
+    }
+
+    // handler leftovers values
+    if (remainder) {
+        const __mmask16 mask = (__mmask16)((1 << remainder) - 1);
+
+        __m512 v = _mm512_maskz_loadu_ps(mask, plane + value_count);
+        v = apply_lut_avx512(lut, v, lut_scale, lut_max);
+        _mm512_mask_storeu_ps(plane + value_count, mask, v);
+    }
+}
+
 template<BitDepth inBD>
 inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
 {
@@ -145,6 +169,11 @@ Lut1DOpCPUApplyFunc * AVX512GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+Lut1DOpCPUApplyPlaneFunc * AVX512GetLut1DApplyPlaneFunc()
+{
+    return linear1DPlane;
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
\ No newline at end of file
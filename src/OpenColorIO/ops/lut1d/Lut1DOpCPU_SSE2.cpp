@@ -150,6 +150,40 @@ static inline void linear1D(const float *lutR, const float *lutG,const float *lu
     }
 }
 
+static void linear1DPlane(const float *lut, int dim, float *plane, long numValues)
+{
+    const __m128 lut_scale = _mm_set1_ps((float)dim -1);
+    const __m128 lut_max   = _mm_set1_ps((float)dim -1);
+
+    int value_count = numValues / 4 * 4;
+    int remainder = numValues - value_count;
+
+    for (int i = 0; i < value_count; i += 4 ) {
+        __m128 v = _mm_loadu_ps(plane + i);
+        v = apply_lut_sse2(lut, v, lut_scale, lut_max);
+        _mm_storeu_ps(plane + i, v);
+    }
+
+    // handler leftovers values
+    if (remainder) {
+        SSE2_ALIGN(float buffer[4]) = {};
+
+        for (int i = 0; i < remainder; ++i)
+        {
+            buffer[i] = plane[value_count + i];
+        }
+
+        __m128 v = _mm_load_ps(buffer);
+        v = apply_lut_sse2(lut, v, lut_scale, lut_max);
+        _mm_store_ps(buffer, v);
+
+        for (int i = 0; i < remainder; ++i)
+        {
+            plane[value_count + i] = buffer[i];
+        }
+    }
+}
+
 template<BitDepth inBD>
 inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
 {
@@ -203,6 +237,11 @@ Lut1DOpCPUApplyFunc * SSE2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+Lut1DOpCPUApplyPlaneFunc * SSE2GetLut1DApplyPlaneFunc()
+{
+    return linear1DPlane;
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_SSE2
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "CPUInfo.h"
 
 typedef void (Lut1DOpCPUApplyFunc)(const float *, const float *, const float *, int, const void *, void *, long);
+typedef void (Lut1DOpCPUApplyPlaneFunc)(const float *, int, float *, long);
 
 #if OCIO_USE_SSE2
 namespace OCIO_NAMESPACE
@@ -16,6 +17,9 @@ namespace OCIO_NAMESPACE
 
 Lut1DOpCPUApplyFunc * SSE2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD);
 
+// Processes in place a 32-bit float plane of a planar image.
+Lut1DOpCPUApplyPlaneFunc * SSE2GetLut1DApplyPlaneFunc();
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_SSE2
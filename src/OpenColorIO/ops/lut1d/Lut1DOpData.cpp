@@ -625,11 +625,29 @@ const char* GetHueAdjustName(Lut1DHueAdjust algo)
 
 }
 
-std::string Lut1DOpData::getCacheID() const
+CacheIDDigest Lut1DOpData::getArrayDigest() const
 {
-    AutoMutex lock(m_mutex);
+    if (m_arrayDigestValid)
+    {
+        return m_arrayDigest;
+    }
 
     const Lut3by1DArray::Values & values = getArray().getValues();
+    const CacheIDDigest digest = CacheIDDigestFromData(&values[0],
+                                                       values.size() * sizeof(values[0]));
+
+    if (m_finalized)
+    {
+        m_arrayDigest      = digest;
+        m_arrayDigestValid = true;
+    }
+
+    return digest;
+}
+
+std::string Lut1DOpData::getCacheID() const
+{
+    AutoMutex lock(m_mutex);
 
     std::ostringstream cacheIDStream;
     if (!getID().empty())
@@ -637,9 +655,7 @@ std::string Lut1DOpData::getCacheID() const
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]), 
-                                 values.size() * sizeof(values[0]))
-                  << " ";
+    cacheIDStream << CacheIDDigestToString(getArrayDigest()) << " ";
 
     cacheIDStream << TransformDirectionToString(m_direction)                   << " ";
     cacheIDStream << InterpolationToString(m_interpolation)                    << " ";
@@ -651,6 +667,23 @@ std::string Lut1DOpData::getCacheID() const
     return cacheIDStream.str();
 }
 
+CacheIDDigest Lut1DOpData::getCacheIDDigest() const
+{
+    AutoMutex lock(m_mutex);
+
+    const int params[] = { getType(), m_direction, m_interpolation,
+                           isInputHalfDomain() ? 1 : 0, m_hueAdjust };
+
+    CacheIDDigest digest = CombineCacheIDDigests(getArrayDigest(),
+                                                 CacheIDDigestFromData(params, sizeof(params)));
+    if (!getID().empty())
+    {
+        digest = CombineCacheIDDigests(digest, CacheIDDigestFromData(getID()));
+    }
+
+    return digest;
+}
+
 //-----------------------------------------------------------------------------
 //
 // Functional composition is a concept from mathematics where two functions
@@ -916,6 +949,11 @@ void Lut1DOpData::finalize()
         initializeFromForward();
     }
     m_array.adjustColorComponentNumber();
+
+    // The LUT values are not expected to change anymore.
+    AutoMutex lock(m_mutex);
+
+    m_finalized = true;
 }
 
 void Lut1DOpData::initializeFromForward()
@@ -115,6 +115,8 @@ public:
 
     std::string getCacheID() const override;
 
+    CacheIDDigest getCacheIDDigest() const override;
+
     // Check if the LUT is using half code indices as its domain.
     // Return returns true if this LUT requires half code indices as input.
     static inline bool IsInputHalfDomain(HalfFlags halfFlags) noexcept
@@ -152,7 +154,7 @@ public:
 
     // Get an array containing the LUT elements.
     // The elements are stored as a vector [r0,g0,b0, r1,g1,b1, r2,g2,b2, ...].
-    inline Array & getArray() noexcept { return m_array; }
+    inline Array & getArray() noexcept { m_finalized = false; m_arrayDigestValid = false; return m_array; }
 
     void validate() const override;
 
@@ -242,6 +244,9 @@ private:
     // Test core parts of LUTs for equality.
     bool haveEqualBasics(const Lut1DOpData & lut) const;
 
+    // Digest of the LUT values. The caller must hold the mutex.
+    CacheIDDigest getArrayDigest() const;
+
     // For inverse LUT.
 
     // Make the array monotonic and prepare params for the renderer.
@@ -265,6 +270,12 @@ private:
     // The LUT scaling for/from the file.
     // Used by MakeFastLut1DFromInverse and for saving to CLF/CTF.
     BitDepth m_fileOutBitDepth = BIT_DEPTH_UNKNOWN;
+
+    // Once finalized, the LUT values are not expected to change so their digest is memoized
+    // the first time it is needed.
+    bool m_finalized = false;
+    mutable CacheIDDigest m_arrayDigest;
+    mutable bool m_arrayDigestValid = false;
 };
 
 bool operator==(const Lut1DOpData & lhs, const Lut1DOpData & rhs);
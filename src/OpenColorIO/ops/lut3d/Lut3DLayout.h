@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_LUT3DLAYOUT_H
+#define INCLUDED_OCIO_LUT3DLAYOUT_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+namespace OCIO_NAMESPACE
+{
+
+// Memory layout of the 3D LUT used by the CPU renderers, each entry holding 'components' floats.
+//
+// The plain layout stores the entries with blue changing fastest.  The bricked layout groups
+// the entries in bricks of brickSize^3 entries, the bricks and the entries of a brick being
+// both stored with blue changing fastest.  The 8 corners of a cube and of its neighbors are then
+// close in memory whatever the axis, at the expense of some padding when the grid size is not
+// a multiple of the brick size.
+//
+// In both cases the offset of an entry is the sum of a per-axis offset i.e.
+//   offset(r, g, b) = axisOffset(0, r) + axisOffset(1, g) + axisOffset(2, b)
+// with
+//   axisOffset(axis, v) = (v / brickSize) * brickStride[axis] + (v % brickSize) * stride[axis]
+//                       = v * stride[axis] + (v / brickSize) * brickStep[axis]
+// which is what the SIMD renderers compute (in float, as the offsets are exact integers).  The
+// plain layout is the brickSize == 1 case, with stride == brickStride and brickStep == 0.
+struct Lut3DLayout
+{
+    int dim        = 0;
+    int components = 0;
+    int brickSize  = 1; // 1 for the plain layout.
+
+    int stride[3]      = { 0, 0, 0 }; // Between consecutive entries of a brick.
+    int brickStride[3] = { 0, 0, 0 }; // Between consecutive bricks.
+    int brickStep[3]   = { 0, 0, 0 }; // brickStride - brickSize * stride.
+
+    long numFloats = 0; // Size of the LUT buffer, padding included.
+
+    bool isBricked() const { return brickSize > 1; }
+
+    int axisOffset(int axis, int v) const
+    {
+        return (v / brickSize) * brickStride[axis] + (v % brickSize) * stride[axis];
+    }
+
+    int offset(int r, int g, int b) const
+    {
+        return axisOffset(0, r) + axisOffset(1, g) + axisOffset(2, b);
+    }
+};
+
+inline Lut3DLayout CreateLut3DLayout(int dim, int components, int brickSize)
+{
+    Lut3DLayout layout;
+    layout.dim        = dim;
+    layout.components = components;
+    layout.brickSize  = brickSize;
+
+    const int numBricks   = (dim + brickSize - 1) / brickSize;
+    const int brickFloats = brickSize * brickSize * brickSize * components;
+
+    layout.brickStride[2] = brickFloats;
+    layout.brickStride[1] = numBricks * brickFloats;
+    layout.brickStride[0] = numBricks * numBricks * brickFloats;
+
+    if (brickSize > 1)
+    {
+        layout.stride[2] = components;
+        layout.stride[1] = brickSize * components;
+        layout.stride[0] = brickSize * brickSize * components;
+    }
+    else
+    {
+        layout.stride[2] = layout.brickStride[2];
+        layout.stride[1] = layout.brickStride[1];
+        layout.stride[0] = layout.brickStride[0];
+    }
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        layout.brickStep[axis] = layout.brickStride[axis] - brickSize * layout.stride[axis];
+    }
+
+    layout.numFloats = long(numBricks) * numBricks * numBricks * brickFloats;
+
+    return layout;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_LUT3DLAYOUT_H
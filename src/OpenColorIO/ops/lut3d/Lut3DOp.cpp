@@ -93,7 +93,9 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
     bool hasChannelCrosstalk() const override;
+    void finalize() override;
     std::string getCacheID() const override;
+    CacheIDDigest getCacheIDDigest() const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -184,6 +186,11 @@ bool Lut3DOp::hasChannelCrosstalk() const
     return lut3DData()->hasChannelCrosstalk();
 }
 
+void Lut3DOp::finalize()
+{
+    lut3DData()->finalize();
+}
+
 std::string Lut3DOp::getCacheID() const
 {
     std::ostringstream cacheIDStream;
@@ -194,6 +201,11 @@ std::string Lut3DOp::getCacheID() const
     return cacheIDStream.str();
 }
 
+CacheIDDigest Lut3DOp::getCacheIDDigest() const
+{
+    return lut3DData()->getCacheIDDigest();
+}
+
 ConstOpCPURcPtr Lut3DOp::getCPUOp(bool /*fastLogExpPow*/) const
 {
     ConstLut3DOpDataRcPtr data = lut3DData();
@@ -232,6 +244,27 @@ void CreateLut3DOp(OpRcPtrVec & ops, Lut3DOpDataRcPtr & lut, TransformDirection
     ops.push_back(std::make_shared<Lut3DOp>(lutData));
 }
 
+void ComposeLut3DOps(OpRcPtrVec & ops, const OpRcPtrVec & lutOps)
+{
+    ConstLut3DOpDataRcPtrVec luts;
+    unsigned long gridSize = 0;
+
+    for (ConstOpRcPtr op : lutOps)
+    {
+        auto lut = DynamicPtrCast<const Lut3DOpData>(op->data());
+        if (!lut)
+        {
+            throw Exception("ComposeLut3DOps: op has to be a Lut3DOp");
+        }
+
+        luts.push_back(lut);
+        gridSize = std::max(gridSize, lut->getArray().getLength());
+    }
+
+    auto composed = Lut3DOpData::Compose(luts, gridSize);
+    ops.push_back(std::make_shared<Lut3DOp>(composed));
+}
+
 void CreateLut3DTransform(GroupTransformRcPtr & group, ConstOpRcPtr & op)
 {
     auto lut = DynamicPtrCast<const Lut3DOp>(op);
@@ -54,6 +54,10 @@ void CreateLut3DOp(OpRcPtrVec & ops,
                     Lut3DOpDataRcPtr & lut,
                     TransformDirection direction);
 
+// Compose the sequence of Lut3D ops in a single pass into one Lut3D op appended to ops.  The
+// grid size of the result is the largest one of the sequence.
+void ComposeLut3DOps(OpRcPtrVec & ops, const OpRcPtrVec & lutOps);
+
 // Create a Lut3DTransform decoupled from op and append it to the GroupTransform.
 void CreateLut3DTransform(GroupTransformRcPtr & group, ConstOpRcPtr & op);
 
@@ -10,6 +10,7 @@
 
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
+#include "ops/lut3d/Lut3DLayout.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
@@ -25,21 +26,47 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
-typedef void (apply_lut_func)(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+typedef void (apply_lut_func)(const float *lut3d, const Lut3DLayout & layout,
+                              const float *src, float *dst, int total_pixel_count);
+
+typedef void (apply_half_lut_func)(const half *lut3d, const Lut3DLayout & layout,
+                                   const float *src, float *dst, int total_pixel_count);
+
+// The tetrahedral renderer stores the LUTs larger than 65x65x65 (i.e. more than 4 MB in RGBA)
+// with the bricked layout.  The corners of the cubes are then gathered from fewer cache lines
+// and pages which pays off once the LUT no longer fits in the caches and the pixel colors are
+// not coherent, while the extra index computation makes it a bit slower for smaller LUTs.
+constexpr unsigned long LUT3D_BRICKED_MIN_DIM = 66;
+constexpr int LUT3D_BRICK_SIZE = 4;
 
 class BaseLut3DRenderer : public OpCPU
 {
 public:
-    explicit BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
+    // The brickSize selects the memory layout of the optimized LUT, see Lut3DLayout.
+    BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut, int brickSize);
     virtual ~BaseLut3DRenderer();
 
+    // The alpha channel is passed through so packed RGB is processed as well.
+    bool hasRGBApply() const override { return true; }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        applyRGBWithRGBABuffer(inImg, outImg, numPixels);
+    }
+
 protected:
-    void updateData(ConstLut3DOpDataRcPtr & lut);
+    void updateData(ConstLut3DOpDataRcPtr & lut, int brickSize);
 
     // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
     // in order to be able to load the LUT using _mm_load_ps.
     float* createOptLut(const Array::Values& lut) const;
 
+    // Offset of the entry (r, g, b) in the optimized LUT.
+    int getLutIndex(int r, int g, int b) const
+    {
+        return m_axisOffsets[r] + m_axisOffsets[m_dim + g] + m_axisOffsets[2 * m_dim + b];
+    }
+
 protected:
     // Keep all these values because they are invariant during the
     // processing. So to slim the processing code, these variables
@@ -48,6 +75,9 @@ protected:
     unsigned long  m_dim;
     float          m_step;
     int            m_components;
+    Lut3DLayout    m_layout;
+    // Offsets of the entries along the R, G and B axes, see Lut3DLayout::axisOffset().
+    std::vector<int> m_axisOffsets;
     apply_lut_func *m_applyLutFunc;
 
 private:
@@ -59,10 +89,21 @@ private:
 class Lut3DTetrahedralRenderer : public BaseLut3DRenderer
 {
 public:
-    explicit Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut);
+    // With halfStorage, the optimized LUT is stored as half floats when a SIMD renderer
+    // supports it and all the LUT values are representable.
+    Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut, bool halfStorage);
     virtual ~Lut3DTetrahedralRenderer();
 
     void apply(const void * inImg, void * outImg, long numPixels) const;
+
+    bool isHalfStorage() const noexcept { return m_optLutHalf != nullptr; }
+
+protected:
+    template<typename LutType>
+    void applyScalar(const LutType * lut, const float * in, float * out, long numPixels) const;
+
+    half *               m_optLutHalf;
+    apply_half_lut_func *m_applyHalfLutFunc;
 };
 
 class Lut3DRenderer : public BaseLut3DRenderer
@@ -299,12 +340,38 @@ inline void lerp_rgb(float* out, float* a, float* b, float* c, float* d,
 }
 #endif
 
-inline int GetLut3DIndexBlueFast(int indexR, int indexG, int indexB, long dim, int components=3)
+// Returns the fastest tetrahedral renderer using a half float LUT, if any.
+apply_half_lut_func * GetTetrahedralHalfLutFunc()
 {
-    return components * (indexB + (int)dim * (indexG + (int)dim * indexR));
+    apply_half_lut_func * func = nullptr;
+
+    #if OCIO_USE_AVX && OCIO_USE_F16C
+    if (CPUInfo::instance().hasAVX() && !CPUInfo::instance().AVXSlow()
+        && CPUInfo::instance().hasF16C())
+    {
+        func = applyTetrahedralAVXHalf;
+    }
+    #endif
+
+    #if OCIO_USE_AVX2 && OCIO_USE_F16C
+    if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather()
+        && CPUInfo::instance().hasF16C())
+    {
+        func = applyTetrahedralAVX2Half;
+    }
+    #endif
+
+    #if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        func = applyTetrahedralAVX512Half;
+    }
+    #endif
+
+    return func;
 }
 
-BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut, int brickSize)
     : OpCPU()
     , m_optLut(0x0)
     , m_dim(0)
@@ -312,7 +379,7 @@ BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
     , m_components(0)
     , m_applyLutFunc(nullptr)
 {
-    updateData(lut);
+    updateData(lut, brickSize);
 }
 
 BaseLut3DRenderer::~BaseLut3DRenderer()
@@ -324,7 +391,7 @@ BaseLut3DRenderer::~BaseLut3DRenderer()
 #endif
 }
 
-void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
+void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut, int brickSize)
 {
     m_dim = lut->getArray().getLength();
 
@@ -337,6 +404,17 @@ void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
     m_components = 3;
     free(m_optLut);
 #endif
+    m_layout = CreateLut3DLayout((int)m_dim, m_components, brickSize);
+
+    m_axisOffsets.resize(3 * m_dim);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        for (unsigned long idx = 0; idx < m_dim; ++idx)
+        {
+            m_axisOffsets[axis * m_dim + idx] = m_layout.axisOffset(axis, (int)idx);
+        }
+    }
+
     m_optLut = createOptLut(lut->getArray().getValues());
 }
 
@@ -345,19 +423,26 @@ void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
 // in order to be able to load the LUT using _mm_load_ps.
 float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 {
-    const long maxEntries = m_dim * m_dim * m_dim;
-
     float *optLut =
-        (float*)Platform::AlignedMalloc(maxEntries * m_components * sizeof(float), 16);
+        (float*)Platform::AlignedMalloc(m_layout.numFloats * sizeof(float), 16);
+
+    // Alpha and the padding of the bricked layout are 0.
+    std::fill(optLut, optLut + m_layout.numFloats, 0.0f);
 
-    float* currentValue = optLut;
-    for (long idx = 0; idx<maxEntries; idx++)
+    const int dim = (int)m_dim;
+    long idx = 0;
+    for (int r = 0; r < dim; ++r)
     {
-        currentValue[0] = SanitizeFloat(lut[idx * 3]);
-        currentValue[1] = SanitizeFloat(lut[idx * 3 + 1]);
-        currentValue[2] = SanitizeFloat(lut[idx * 3 + 2]);
-        currentValue[3] = 0.0f;
-        currentValue += 4;
+        for (int g = 0; g < dim; ++g)
+        {
+            for (int b = 0; b < dim; ++b, idx += 3)
+            {
+                float* currentValue = optLut + getLutIndex(r, g, b);
+                currentValue[0] = SanitizeFloat(lut[idx]);
+                currentValue[1] = SanitizeFloat(lut[idx + 1]);
+                currentValue[2] = SanitizeFloat(lut[idx + 2]);
+            }
+        }
     }
 
     return optLut;
@@ -365,26 +450,37 @@ float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 #else
 float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 {
-    const long maxEntries = m_dim * m_dim * m_dim;
-
     float *optLut =
-        (float*)malloc(maxEntries * m_components * sizeof(float));
+        (float*)malloc(m_layout.numFloats * sizeof(float));
+
+    // The padding of the bricked layout is 0.
+    std::fill(optLut, optLut + m_layout.numFloats, 0.0f);
 
-    float* currentValue = optLut;
-    for (long idx = 0; idx<maxEntries; idx++)
+    const int dim = (int)m_dim;
+    long idx = 0;
+    for (int r = 0; r < dim; ++r)
     {
-        currentValue[0] = SanitizeFloat(lut[idx * 3]);
-        currentValue[1] = SanitizeFloat(lut[idx * 3 + 1]);
-        currentValue[2] = SanitizeFloat(lut[idx * 3 + 2]);
-        currentValue += 3;
+        for (int g = 0; g < dim; ++g)
+        {
+            for (int b = 0; b < dim; ++b, idx += 3)
+            {
+                float* currentValue = optLut + getLutIndex(r, g, b);
+                currentValue[0] = SanitizeFloat(lut[idx]);
+                currentValue[1] = SanitizeFloat(lut[idx + 1]);
+                currentValue[2] = SanitizeFloat(lut[idx + 2]);
+            }
+        }
     }
 
     return optLut;
 }
 #endif
 
-Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut)
-    : BaseLut3DRenderer(lut)
+Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut, bool halfStorage)
+    : BaseLut3DRenderer(lut, lut->getArray().getLength() >= LUT3D_BRICKED_MIN_DIM
+                             ? LUT3D_BRICK_SIZE : 1)
+    , m_optLutHalf(nullptr)
+    , m_applyHalfLutFunc(nullptr)
 {
     #if OCIO_USE_SSE2
     if (CPUInfo::instance().hasSSE2())
@@ -413,10 +509,41 @@ Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut)
         m_applyLutFunc = applyTetrahedralAVX512;
     }
     #endif
+
+    if (halfStorage)
+    {
+        m_applyHalfLutFunc = GetTetrahedralHalfLutFunc();
+    }
+
+    if (m_applyHalfLutFunc)
+    {
+        const float * first = m_optLut;
+        const float * last  = m_optLut + m_layout.numFloats;
+
+        const bool fitsInHalf = std::all_of(first, last, [](float v)
+        {
+            return std::fabs(v) <= HALF_MAX;
+        });
+
+        if (fitsInHalf)
+        {
+            m_optLutHalf = (half*)Platform::AlignedMalloc(m_layout.numFloats * sizeof(half), 16);
+            std::copy(first, last, m_optLutHalf);
+
+            // Only keep the half float LUT.
+            Platform::AlignedFree(m_optLut);
+            m_optLut = nullptr;
+        }
+        else
+        {
+            m_applyHalfLutFunc = nullptr;
+        }
+    }
 }
 
 Lut3DTetrahedralRenderer::~Lut3DTetrahedralRenderer()
 {
+    Platform::AlignedFree(m_optLutHalf);
 }
 
 void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long numPixels) const
@@ -424,207 +551,209 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    if (m_applyLutFunc && numPixels > 1)
+    if (m_optLutHalf)
+    {
+        if (numPixels > 1)
+        {
+            m_applyHalfLutFunc(m_optLutHalf, m_layout, in, out, numPixels);
+        }
+        else
+        {
+            applyScalar(m_optLutHalf, in, out, numPixels);
+        }
+    }
+    else if (m_applyLutFunc && numPixels > 1)
     {
-        m_applyLutFunc(m_optLut, m_dim, in, out, numPixels);
+        m_applyLutFunc(m_optLut, m_layout, in, out, numPixels);
     }
     else
     {
-        const float dimMinusOne = float(m_dim) - 1.f;
+        applyScalar(m_optLut, in, out, numPixels);
+    }
+}
 
-        for (long i = 0; i < numPixels; ++i)
+template<typename LutType>
+void Lut3DTetrahedralRenderer::applyScalar(const LutType * lut, const float * in, float * out,
+                                           long numPixels) const
+{
+    const float dimMinusOne = float(m_dim) - 1.f;
+
+    for (long i = 0; i < numPixels; ++i)
+    {
+        float newAlpha = (float)in[3];
+
+        float idx[3];
+        idx[0] = in[0] * m_step;
+        idx[1] = in[1] * m_step;
+        idx[2] = in[2] * m_step;
+
+        // NaNs become 0.
+        idx[0] = Clamp(idx[0], 0.f, dimMinusOne);
+        idx[1] = Clamp(idx[1], 0.f, dimMinusOne);
+        idx[2] = Clamp(idx[2], 0.f, dimMinusOne);
+
+        int indexLow[3];
+        indexLow[0] = static_cast<int>(std::floor(idx[0]));
+        indexLow[1] = static_cast<int>(std::floor(idx[1]));
+        indexLow[2] = static_cast<int>(std::floor(idx[2]));
+
+        int indexHigh[3];
+        // When the idx is exactly equal to an index (e.g. 0,1,2...)
+        // then the computation of highIdx is wrong. However,
+        // the delta is then equal to zero (e.g. idx-lowIdx),
+        // so the highIdx has no impact.
+        indexHigh[0] = static_cast<int>(std::ceil(idx[0]));
+        indexHigh[1] = static_cast<int>(std::ceil(idx[1]));
+        indexHigh[2] = static_cast<int>(std::ceil(idx[2]));
+
+        float fx = idx[0] - static_cast<float>(indexLow[0]);
+        float fy = idx[1] - static_cast<float>(indexLow[1]);
+        float fz = idx[2] - static_cast<float>(indexLow[2]);
+
+        // Compute index into LUT for surrounding corners
+        const int n000 = getLutIndex(indexLow[0], indexLow[1], indexLow[2]);
+        const int n100 = getLutIndex(indexHigh[0], indexLow[1], indexLow[2]);
+        const int n010 = getLutIndex(indexLow[0], indexHigh[1], indexLow[2]);
+        const int n001 = getLutIndex(indexLow[0], indexLow[1], indexHigh[2]);
+        const int n110 = getLutIndex(indexHigh[0], indexHigh[1], indexLow[2]);
+        const int n101 = getLutIndex(indexHigh[0], indexLow[1], indexHigh[2]);
+        const int n011 = getLutIndex(indexLow[0], indexHigh[1], indexHigh[2]);
+        const int n111 = getLutIndex(indexHigh[0], indexHigh[1], indexHigh[2]);
+
+        if (fx > fy) {
+            if (fy > fz) {
+                out[0] =
+                    (1 - fx)  * lut[n000] +
+                    (fx - fy) * lut[n100] +
+                    (fy - fz) * lut[n110] +
+                    (fz)      * lut[n111];
+
+                out[1] =
+                    (1 - fx)  * lut[n000 + 1] +
+                    (fx - fy) * lut[n100 + 1] +
+                    (fy - fz) * lut[n110 + 1] +
+                    (fz)      * lut[n111 + 1];
+
+                out[2] =
+                    (1 - fx)  * lut[n000 + 2] +
+                    (fx - fy) * lut[n100 + 2] +
+                    (fy - fz) * lut[n110 + 2] +
+                    (fz)      * lut[n111 + 2];
+            }
+            else if (fx > fz)
+            {
+                out[0] =
+                    (1 - fx)  * lut[n000] +
+                    (fx - fz) * lut[n100] +
+                    (fz - fy) * lut[n101] +
+                    (fy)      * lut[n111];
+
+                out[1] =
+                    (1 - fx)  * lut[n000 + 1] +
+                    (fx - fz) * lut[n100 + 1] +
+                    (fz - fy) * lut[n101 + 1] +
+                    (fy)      * lut[n111 + 1];
+
+                out[2] =
+                    (1 - fx)  * lut[n000 + 2] +
+                    (fx - fz) * lut[n100 + 2] +
+                    (fz - fy) * lut[n101 + 2] +
+                    (fy)      * lut[n111 + 2];
+            }
+            else
+            {
+                out[0] =
+                    (1 - fz)  * lut[n000] +
+                    (fz - fx) * lut[n001] +
+                    (fx - fy) * lut[n101] +
+                    (fy)      * lut[n111];
+
+                out[1] =
+                    (1 - fz)  * lut[n000 + 1] +
+                    (fz - fx) * lut[n001 + 1] +
+                    (fx - fy) * lut[n101 + 1] +
+                    (fy)      * lut[n111 + 1];
+
+                out[2] =
+                    (1 - fz)  * lut[n000 + 2] +
+                    (fz - fx) * lut[n001 + 2] +
+                    (fx - fy) * lut[n101 + 2] +
+                    (fy)      * lut[n111 + 2];
+            }
+        }
+        else
         {
-            float newAlpha = (float)in[3];
-
-            float idx[3];
-            idx[0] = in[0] * m_step;
-            idx[1] = in[1] * m_step;
-            idx[2] = in[2] * m_step;
-
-            // NaNs become 0.
-            idx[0] = Clamp(idx[0], 0.f, dimMinusOne);
-            idx[1] = Clamp(idx[1], 0.f, dimMinusOne);
-            idx[2] = Clamp(idx[2], 0.f, dimMinusOne);
-
-            int indexLow[3];
-            indexLow[0] = static_cast<int>(std::floor(idx[0]));
-            indexLow[1] = static_cast<int>(std::floor(idx[1]));
-            indexLow[2] = static_cast<int>(std::floor(idx[2]));
-
-            int indexHigh[3];
-            // When the idx is exactly equal to an index (e.g. 0,1,2...)
-            // then the computation of highIdx is wrong. However,
-            // the delta is then equal to zero (e.g. idx-lowIdx),
-            // so the highIdx has no impact.
-            indexHigh[0] = static_cast<int>(std::ceil(idx[0]));
-            indexHigh[1] = static_cast<int>(std::ceil(idx[1]));
-            indexHigh[2] = static_cast<int>(std::ceil(idx[2]));
-
-            float fx = idx[0] - static_cast<float>(indexLow[0]);
-            float fy = idx[1] - static_cast<float>(indexLow[1]);
-            float fz = idx[2] - static_cast<float>(indexLow[2]);
-
-            // Compute index into LUT for surrounding corners
-            const int n000 =
-                GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexLow[2],
-                                    m_dim, m_components);
-            const int n100 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexLow[2],
-                                    m_dim, m_components);
-            const int n010 =
-                GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexLow[2],
-                                    m_dim, m_components);
-            const int n001 =
-                GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexHigh[2],
-                                    m_dim, m_components);
-            const int n110 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexLow[2],
-                                    m_dim, m_components);
-            const int n101 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexHigh[2],
-                                    m_dim, m_components);
-            const int n011 =
-                GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexHigh[2],
-                                    m_dim, m_components);
-            const int n111 =
-                GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexHigh[2],
-                                    m_dim, m_components);
-
-            if (fx > fy) {
-                if (fy > fz) {
-                    out[0] =
-                        (1 - fx)  * m_optLut[n000] +
-                        (fx - fy) * m_optLut[n100] +
-                        (fy - fz) * m_optLut[n110] +
-                        (fz)      * m_optLut[n111];
-
-                    out[1] =
-                        (1 - fx)  * m_optLut[n000 + 1] +
-                        (fx - fy) * m_optLut[n100 + 1] +
-                        (fy - fz) * m_optLut[n110 + 1] +
-                        (fz)      * m_optLut[n111 + 1];
-
-                    out[2] =
-                        (1 - fx)  * m_optLut[n000 + 2] +
-                        (fx - fy) * m_optLut[n100 + 2] +
-                        (fy - fz) * m_optLut[n110 + 2] +
-                        (fz)      * m_optLut[n111 + 2];
-                }
-                else if (fx > fz)
-                {
-                    out[0] =
-                        (1 - fx)  * m_optLut[n000] +
-                        (fx - fz) * m_optLut[n100] +
-                        (fz - fy) * m_optLut[n101] +
-                        (fy)      * m_optLut[n111];
-
-                    out[1] =
-                        (1 - fx)  * m_optLut[n000 + 1] +
-                        (fx - fz) * m_optLut[n100 + 1] +
-                        (fz - fy) * m_optLut[n101 + 1] +
-                        (fy)      * m_optLut[n111 + 1];
-
-                    out[2] =
-                        (1 - fx)  * m_optLut[n000 + 2] +
-                        (fx - fz) * m_optLut[n100 + 2] +
-                        (fz - fy) * m_optLut[n101 + 2] +
-                        (fy)      * m_optLut[n111 + 2];
-                }
-                else
-                {
-                    out[0] =
-                        (1 - fz)  * m_optLut[n000] +
-                        (fz - fx) * m_optLut[n001] +
-                        (fx - fy) * m_optLut[n101] +
-                        (fy)      * m_optLut[n111];
-
-                    out[1] =
-                        (1 - fz)  * m_optLut[n000 + 1] +
-                        (fz - fx) * m_optLut[n001 + 1] +
-                        (fx - fy) * m_optLut[n101 + 1] +
-                        (fy)      * m_optLut[n111 + 1];
-
-                    out[2] =
-                        (1 - fz)  * m_optLut[n000 + 2] +
-                        (fz - fx) * m_optLut[n001 + 2] +
-                        (fx - fy) * m_optLut[n101 + 2] +
-                        (fy)      * m_optLut[n111 + 2];
-                }
+            if (fz > fy)
+            {
+                out[0] =
+                    (1 - fz)  * lut[n000] +
+                    (fz - fy) * lut[n001] +
+                    (fy - fx) * lut[n011] +
+                    (fx)      * lut[n111];
+
+                out[1] =
+                    (1 - fz)  * lut[n000 + 1] +
+                    (fz - fy) * lut[n001 + 1] +
+                    (fy - fx) * lut[n011 + 1] +
+                    (fx)      * lut[n111 + 1];
+
+                out[2] =
+                    (1 - fz)  * lut[n000 + 2] +
+                    (fz - fy) * lut[n001 + 2] +
+                    (fy - fx) * lut[n011 + 2] +
+                    (fx)      * lut[n111 + 2];
+            }
+            else if (fz > fx)
+            {
+                out[0] =
+                    (1 - fy)  * lut[n000] +
+                    (fy - fz) * lut[n010] +
+                    (fz - fx) * lut[n011] +
+                    (fx)      * lut[n111];
+
+                out[1] =
+                    (1 - fy)  * lut[n000 + 1] +
+                    (fy - fz) * lut[n010 + 1] +
+                    (fz - fx) * lut[n011 + 1] +
+                    (fx)      * lut[n111 + 1];
+
+                out[2] =
+                    (1 - fy)  * lut[n000 + 2] +
+                    (fy - fz) * lut[n010 + 2] +
+                    (fz - fx) * lut[n011 + 2] +
+                    (fx)      * lut[n111 + 2];
             }
             else
             {
-                if (fz > fy)
-                {
-                    out[0] =
-                        (1 - fz)  * m_optLut[n000] +
-                        (fz - fy) * m_optLut[n001] +
-                        (fy - fx) * m_optLut[n011] +
-                        (fx)      * m_optLut[n111];
-
-                    out[1] =
-                        (1 - fz)  * m_optLut[n000 + 1] +
-                        (fz - fy) * m_optLut[n001 + 1] +
-                        (fy - fx) * m_optLut[n011 + 1] +
-                        (fx)      * m_optLut[n111 + 1];
-
-                    out[2] =
-                        (1 - fz)  * m_optLut[n000 + 2] +
-                        (fz - fy) * m_optLut[n001 + 2] +
-                        (fy - fx) * m_optLut[n011 + 2] +
-                        (fx)      * m_optLut[n111 + 2];
-                }
-                else if (fz > fx)
-                {
-                    out[0] =
-                        (1 - fy)  * m_optLut[n000] +
-                        (fy - fz) * m_optLut[n010] +
-                        (fz - fx) * m_optLut[n011] +
-                        (fx)      * m_optLut[n111];
-
-                    out[1] =
-                        (1 - fy)  * m_optLut[n000 + 1] +
-                        (fy - fz) * m_optLut[n010 + 1] +
-                        (fz - fx) * m_optLut[n011 + 1] +
-                        (fx)      * m_optLut[n111 + 1];
-
-                    out[2] =
-                        (1 - fy)  * m_optLut[n000 + 2] +
-                        (fy - fz) * m_optLut[n010 + 2] +
-                        (fz - fx) * m_optLut[n011 + 2] +
-                        (fx)      * m_optLut[n111 + 2];
-                }
-                else
-                {
-                    out[0] =
-                        (1 - fy)  * m_optLut[n000] +
-                        (fy - fx) * m_optLut[n010] +
-                        (fx - fz) * m_optLut[n110] +
-                        (fz)      * m_optLut[n111];
-
-                    out[1] =
-                        (1 - fy)  * m_optLut[n000 + 1] +
-                        (fy - fx) * m_optLut[n010 + 1] +
-                        (fx - fz) * m_optLut[n110 + 1] +
-                        (fz)      * m_optLut[n111 + 1];
-
-                    out[2] =
-                        (1 - fy)  * m_optLut[n000 + 2] +
-                        (fy - fx) * m_optLut[n010 + 2] +
-                        (fx - fz) * m_optLut[n110 + 2] +
-                        (fz)      * m_optLut[n111 + 2];
-                }
+                out[0] =
+                    (1 - fy)  * lut[n000] +
+                    (fy - fx) * lut[n010] +
+                    (fx - fz) * lut[n110] +
+                    (fz)      * lut[n111];
+
+                out[1] =
+                    (1 - fy)  * lut[n000 + 1] +
+                    (fy - fx) * lut[n010 + 1] +
+                    (fx - fz) * lut[n110 + 1] +
+                    (fz)      * lut[n111 + 1];
+
+                out[2] =
+                    (1 - fy)  * lut[n000 + 2] +
+                    (fy - fx) * lut[n010 + 2] +
+                    (fx - fz) * lut[n110 + 2] +
+                    (fz)      * lut[n111 + 2];
             }
+        }
 
-            out[3] = newAlpha;
+        out[3] = newAlpha;
 
-            in  += 4;
-            out += 4;
-        }
+        in  += 4;
+        out += 4;
     }
 }
 
 Lut3DRenderer::Lut3DRenderer(ConstLut3DOpDataRcPtr & lut)
-    : BaseLut3DRenderer(lut)
+    : BaseLut3DRenderer(lut, 1)
 {
 }
 
@@ -774,30 +903,14 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
         delta[2] = idx[2] - static_cast<float>(indexLow[2]);
 
         // Compute index into LUT for surrounding corners
-        const int n000 =
-            GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexLow[2],
-                                  m_dim);
-        const int n100 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexLow[2],
-                                  m_dim);
-        const int n010 =
-            GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexLow[2],
-                                  m_dim);
-        const int n001 =
-            GetLut3DIndexBlueFast(indexLow[0], indexLow[1], indexHigh[2],
-                                  m_dim);
-        const int n110 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexLow[2],
-                                  m_dim);
-        const int n101 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexLow[1], indexHigh[2],
-                                  m_dim);
-        const int n011 =
-            GetLut3DIndexBlueFast(indexLow[0], indexHigh[1], indexHigh[2],
-                                  m_dim);
-        const int n111 =
-            GetLut3DIndexBlueFast(indexHigh[0], indexHigh[1], indexHigh[2],
-                                  m_dim);
+        const int n000 = getLutIndex(indexLow[0], indexLow[1], indexLow[2]);
+        const int n100 = getLutIndex(indexHigh[0], indexLow[1], indexLow[2]);
+        const int n010 = getLutIndex(indexLow[0], indexHigh[1], indexLow[2]);
+        const int n001 = getLutIndex(indexLow[0], indexLow[1], indexHigh[2]);
+        const int n110 = getLutIndex(indexHigh[0], indexHigh[1], indexLow[2]);
+        const int n101 = getLutIndex(indexHigh[0], indexLow[1], indexHigh[2]);
+        const int n011 = getLutIndex(indexLow[0], indexHigh[1], indexHigh[2]);
+        const int n111 = getLutIndex(indexHigh[0], indexHigh[1], indexHigh[2]);
 
         float x[3], y[3], z[3];
         x[0] = delta[0]; x[1] = delta[0]; x[2] = delta[0];
@@ -1733,12 +1846,12 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
-ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfStorage)
 {
     const Interpolation interp = lut->getConcreteInterpolation();
     if (interp == INTERP_TETRAHEDRAL)
     {
-        return std::make_shared<Lut3DTetrahedralRenderer>(lut);
+        return std::make_shared<Lut3DTetrahedralRenderer>(lut, halfStorage);
     }
     else
     {
@@ -1748,12 +1861,12 @@ ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
 
 } // anonymous namspace
 
-ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfStorage)
 {
     switch (lut->getDirection())
     {
     case TRANSFORM_DIR_FORWARD:
-        return GetForwardLut3DRenderer(lut);
+        return GetForwardLut3DRenderer(lut, halfStorage);
         break;
     case TRANSFORM_DIR_INVERSE:
         return std::make_shared<InvLut3DRenderer>(lut);
@@ -12,7 +12,9 @@
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
+// With halfStorage, the tetrahedral renderer stores the LUT as half floats when a SIMD
+// implementation supports it and the LUT values are representable.
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfStorage = false);
 
 } // namespace OCIO_NAMESPACE
 
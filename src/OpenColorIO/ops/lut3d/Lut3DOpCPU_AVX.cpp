@@ -12,11 +12,18 @@ namespace OCIO_NAMESPACE
 {
 namespace {
 
+template<typename LutType>
 struct Lut3DContextAVX {
-    const float *lut;
+    const LutType *lut;
     __m256 lutmax;
     __m256 lutsize;
     __m256 lutsize2;
+
+    // Only used by the bricked layout, see Lut3DLayout.
+    __m256 brickscale;
+    __m256 brickstep_r;
+    __m256 brickstep_g;
+    __m256 brickstep_b;
 };
 
 struct rgbavec_avx {
@@ -39,6 +46,14 @@ static inline __m256 load2_m128_avx(const float *hi, const float *low)
     return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(hi), 1);
 }
 
+#if OCIO_USE_F16C
+static inline __m256 load2_m128_avx(const half *hi, const half *low)
+{
+    return _mm256_cvtph_ps(_mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)low),
+                                              _mm_loadl_epi64((const __m128i *)hi)));
+}
+#endif // OCIO_USE_F16C
+
 #define gather_rgb_avx(src, idx)                                \
     _mm256_store_si256((__m256i *)indices, idx);                \
     row0 = load2_m128_avx(src + indices[4], src + indices[0]);  \
@@ -72,7 +87,15 @@ static inline __m256 blendv_avx(__m256 a, __m256 b, __m256 mask)
 #endif
 }
 
-static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX &ctx, __m256 r, __m256 g, __m256 b, __m256 a)
+// Offset of the entries v along an axis of the bricked layout i.e.
+// v * stride + floor(v / brickSize) * brickStep, see Lut3DLayout.
+static inline __m256 brick_offset_avx(__m256 v, __m256 stride, __m256 brickstep, __m256 brickscale)
+{
+    return fmadd_ps_avx(_mm256_floor_ps(_mm256_mul_ps(v, brickscale)), brickstep, _mm256_mul_ps(v, stride));
+}
+
+template<bool bricked, typename LutType>
+static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX<LutType> &ctx, __m256 r, __m256 g, __m256 b, __m256 a)
 {
     AVX_ALIGN(uint32_t indices[8]);
 
@@ -108,14 +131,28 @@ static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX &ctx, __m
     __m256 next_b = _mm256_min_ps(lut_max, _mm256_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm256_mul_ps(prev_r, lutsize2);
-    next_r = _mm256_mul_ps(next_r, lutsize2);
+    if (bricked)
+    {
+        prev_r = brick_offset_avx(prev_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
+        next_r = brick_offset_avx(next_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
+
+        prev_g = brick_offset_avx(prev_g, lutsize, ctx.brickstep_g, ctx.brickscale);
+        next_g = brick_offset_avx(next_g, lutsize, ctx.brickstep_g, ctx.brickscale);
+
+        prev_b = brick_offset_avx(prev_b, four_f, ctx.brickstep_b, ctx.brickscale);
+        next_b = brick_offset_avx(next_b, four_f, ctx.brickstep_b, ctx.brickscale);
+    }
+    else
+    {
+        prev_r = _mm256_mul_ps(prev_r, lutsize2);
+        next_r = _mm256_mul_ps(next_r, lutsize2);
 
-    prev_g = _mm256_mul_ps(prev_g, lutsize);
-    next_g = _mm256_mul_ps(next_g, lutsize);
+        prev_g = _mm256_mul_ps(prev_g, lutsize);
+        next_g = _mm256_mul_ps(next_g, lutsize);
 
-    prev_b = _mm256_mul_ps(prev_b, four_f);
-    next_b = _mm256_mul_ps(next_b, four_f);
+        prev_b = _mm256_mul_ps(prev_b, four_f);
+        next_b = _mm256_mul_ps(next_b, four_f);
+    }
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -221,8 +258,8 @@ static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX &ctx, __m
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+template<bool bricked, typename LutType, BitDepth inBD, BitDepth outBD>
+static inline void applyTetrahedralAVXFunc(const LutType *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -230,16 +267,23 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
     __m256 r,g,b,a;
     rgbavec_avx c;
 
-    Lut3DContextAVX ctx;
+    Lut3DContextAVX<LutType> ctx;
 
-    float lutmax = (float)dim- 1;
+    const int dim = layout.dim;
+
+    float lutmax = (float)dim - 1;
     __m256 scale = _mm256_set1_ps(lutmax);
     __m256 zero    = _mm256_setzero_ps();
 
     ctx.lut      = lut3d;
     ctx.lutmax   = _mm256_set1_ps(lutmax);
-    ctx.lutsize  = _mm256_set1_ps((float)dim * 4);
-    ctx.lutsize2 = _mm256_set1_ps((float)dim * dim * 4);
+    ctx.lutsize  = _mm256_set1_ps((float)layout.stride[1]);
+    ctx.lutsize2 = _mm256_set1_ps((float)layout.stride[0]);
+
+    ctx.brickscale  = _mm256_set1_ps(1.0f / (float)layout.brickSize);
+    ctx.brickstep_r = _mm256_set1_ps((float)layout.brickStep[0]);
+    ctx.brickstep_g = _mm256_set1_ps((float)layout.brickStep[1]);
+    ctx.brickstep_b = _mm256_set1_ps((float)layout.brickStep[2]);
 
     int pixel_count = total_pixel_count / 8 * 8;
     int remainder = total_pixel_count - pixel_count;
@@ -262,7 +306,7 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx<bricked, LutType>(ctx, r, g, b, a);
 
         AVXRGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -300,7 +344,7 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx<bricked, LutType>(ctx, r, g, b, a);
 
         AVXRGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -317,10 +361,31 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
 
 } // anonymous namespace
 
-void applyTetrahedralAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+void applyTetrahedralAVX(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVXFunc<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    if (layout.isBricked())
+    {
+        applyTetrahedralAVXFunc<true, float, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+    else
+    {
+        applyTetrahedralAVXFunc<false, float, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+}
+
+#if OCIO_USE_F16C
+void applyTetrahedralAVXHalf(const half *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
+{
+    if (layout.isBricked())
+    {
+        applyTetrahedralAVXFunc<true, half, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+    else
+    {
+        applyTetrahedralAVXFunc<false, half, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
 }
+#endif // OCIO_USE_F16C
 
 } // OCIO_NAMESPACE
 
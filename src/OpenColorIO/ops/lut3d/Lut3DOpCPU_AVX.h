@@ -6,13 +6,20 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BitDepthUtils.h"
 #include "CPUInfo.h"
+#include "ops/lut3d/Lut3DLayout.h"
 
 #if OCIO_USE_AVX
 namespace OCIO_NAMESPACE
 {
 
-void applyTetrahedralAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+void applyTetrahedralAVX(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count);
+
+#if OCIO_USE_F16C
+// Same with the LUT values stored as half floats.
+void applyTetrahedralAVXHalf(const half *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count);
+#endif // OCIO_USE_F16C
 
 } // namespace OCIO_NAMESPACE
 
@@ -13,23 +13,63 @@ namespace OCIO_NAMESPACE
 {
 namespace {
 
+template<typename LutType>
 struct Lut3DContextAVX2 {
-    const float *lut;
+    const LutType *lut;
     __m256 lutmax;
     __m256 lutsize;
     __m256 lutsize2;
+
+    // Only used by the bricked layout, see Lut3DLayout.
+    __m256 brickscale;
+    __m256 brickstep_r;
+    __m256 brickstep_g;
+    __m256 brickstep_b;
 };
 
 struct rgbavec_avx2 {
     __m256 r, g, b, a;
 };
 
-#define gather_rgb_avx2(src, idx)                               \
-    sample_r = _mm256_i32gather_ps(src+0, idx, 4);              \
-    sample_g = _mm256_i32gather_ps(src+1, idx, 4);              \
-    sample_b = _mm256_i32gather_ps(src+2, idx, 4)
+static inline void gather_rgb_avx2(const float *src, __m256i idx, __m256& sample_r, __m256& sample_g, __m256& sample_b)
+{
+    sample_r = _mm256_i32gather_ps(src+0, idx, 4);
+    sample_g = _mm256_i32gather_ps(src+1, idx, 4);
+    sample_b = _mm256_i32gather_ps(src+2, idx, 4);
+}
+
+#if OCIO_USE_F16C
+// The half float LUT entries are gathered as RG and BA pairs.
+static inline void gather_rgb_avx2(const half *src, __m256i idx, __m256& sample_r, __m256& sample_g, __m256& sample_b)
+{
+    const __m256i mask = _mm256_set1_epi32(0xffff);
+
+    __m256i rg = _mm256_i32gather_epi32((const int *)(src+0), idx, 2);
+    __m256i ba = _mm256_i32gather_epi32((const int *)(src+2), idx, 2);
+
+    // {r0-r3, g0-g3, r4-r7, g4-g7} -> {r0-r7, g0-g7}
+    __m256i rrgg = _mm256_packus_epi32(_mm256_and_si256(rg, mask), _mm256_srli_epi32(rg, 16));
+    rrgg = _mm256_permute4x64_epi64(rrgg, _MM_SHUFFLE(3, 1, 2, 0));
+
+    // {b0-b3, b0-b3, b4-b7, b4-b7} -> {b0-b7, b0-b7}
+    __m256i bb = _mm256_and_si256(ba, mask);
+    bb = _mm256_permute4x64_epi64(_mm256_packus_epi32(bb, bb), _MM_SHUFFLE(3, 1, 2, 0));
 
-static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx, __m256& r, __m256& g, __m256& b, __m256& a)
+    sample_r = _mm256_cvtph_ps(_mm256_castsi256_si128(rrgg));
+    sample_g = _mm256_cvtph_ps(_mm256_extracti128_si256(rrgg, 1));
+    sample_b = _mm256_cvtph_ps(_mm256_castsi256_si128(bb));
+}
+#endif // OCIO_USE_F16C
+
+// Offset of the entries v along an axis of the bricked layout i.e.
+// v * stride + floor(v / brickSize) * brickStep, see Lut3DLayout.
+static inline __m256 brick_offset_avx2(__m256 v, __m256 stride, __m256 brickstep, __m256 brickscale)
+{
+    return _mm256_fmadd_ps(_mm256_floor_ps(_mm256_mul_ps(v, brickscale)), brickstep, _mm256_mul_ps(v, stride));
+}
+
+template<bool bricked, typename LutType>
+static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2<LutType> &ctx, __m256& r, __m256& g, __m256& b, __m256& a)
 {
     __m256 x0, x1, x2;
     __m256 cxxxa;
@@ -60,14 +100,28 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     __m256 next_b = _mm256_min_ps(lut_max, _mm256_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm256_mul_ps(prev_r, lutsize2);
-    next_r = _mm256_mul_ps(next_r, lutsize2);
+    if (bricked)
+    {
+        prev_r = brick_offset_avx2(prev_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
+        next_r = brick_offset_avx2(next_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
+
+        prev_g = brick_offset_avx2(prev_g, lutsize, ctx.brickstep_g, ctx.brickscale);
+        next_g = brick_offset_avx2(next_g, lutsize, ctx.brickstep_g, ctx.brickscale);
+
+        prev_b = brick_offset_avx2(prev_b, four_f, ctx.brickstep_b, ctx.brickscale);
+        next_b = brick_offset_avx2(next_b, four_f, ctx.brickstep_b, ctx.brickscale);
+    }
+    else
+    {
+        prev_r = _mm256_mul_ps(prev_r, lutsize2);
+        next_r = _mm256_mul_ps(next_r, lutsize2);
 
-    prev_g = _mm256_mul_ps(prev_g, lutsize);
-    next_g = _mm256_mul_ps(next_g, lutsize);
+        prev_g = _mm256_mul_ps(prev_g, lutsize);
+        next_g = _mm256_mul_ps(next_g, lutsize);
 
-    prev_b = _mm256_mul_ps(prev_b, four_f);
-    next_b = _mm256_mul_ps(next_b, four_f);
+        prev_b = _mm256_mul_ps(prev_b, four_f);
+        next_b = _mm256_mul_ps(next_b, four_f);
+    }
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -137,7 +191,7 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     __m256i cxxxb_idx = _mm256_cvttps_epi32(cxxxb);
     __m256i c111_idx  = _mm256_cvttps_epi32(c111);
 
-    gather_rgb_avx2(ctx.lut, c000_idx);
+    gather_rgb_avx2(ctx.lut, c000_idx, sample_r, sample_g, sample_b);
 
     // (1-x0) * c000
     __m256 v = _mm256_sub_ps(one_f, x0);
@@ -145,7 +199,7 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     result.g = _mm256_mul_ps(sample_g, v);
     result.b = _mm256_mul_ps(sample_b, v);
 
-    gather_rgb_avx2(ctx.lut, cxxxa_idx);
+    gather_rgb_avx2(ctx.lut, cxxxa_idx, sample_r, sample_g, sample_b);
 
     // (x0-x1) * cxxxa
     v = _mm256_sub_ps(x0, x1);
@@ -153,7 +207,7 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     result.g = _mm256_fmadd_ps(v, sample_g, result.g);
     result.b = _mm256_fmadd_ps(v, sample_b, result.b);
 
-    gather_rgb_avx2(ctx.lut, cxxxb_idx);
+    gather_rgb_avx2(ctx.lut, cxxxb_idx, sample_r, sample_g, sample_b);
 
     // (x1-x2) * cxxxb
     v = _mm256_sub_ps(x1, x2);
@@ -161,7 +215,7 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     result.g = _mm256_fmadd_ps(v, sample_g, result.g);
     result.b = _mm256_fmadd_ps(v, sample_b, result.b);
 
-    gather_rgb_avx2(ctx.lut, c111_idx);
+    gather_rgb_avx2(ctx.lut, c111_idx, sample_r, sample_g, sample_b);
 
     // x2 * c111
     result.r = _mm256_fmadd_ps(x2, sample_r, result.r);
@@ -173,8 +227,8 @@ static inline rgbavec_avx2 interp_tetrahedral_avx2(const Lut3DContextAVX2 &ctx,
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
+template<bool bricked, typename LutType, BitDepth inBD, BitDepth outBD>
+inline void applyTetrahedralAVX2Func(const LutType *lut3d, const Lut3DLayout & layout, const void *inImg, void *outImg, int numPixels)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -184,7 +238,9 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
     __m256 r,g,b,a;
     rgbavec_avx2 c;
 
-    Lut3DContextAVX2 ctx;
+    Lut3DContextAVX2<LutType> ctx;
+
+    const int dim = layout.dim;
 
     float lutmax = (float)dim - 1;
     __m256 scale   = _mm256_set1_ps(lutmax);
@@ -192,8 +248,13 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
 
     ctx.lut      = lut3d;
     ctx.lutmax   = _mm256_set1_ps(lutmax);
-    ctx.lutsize  = _mm256_set1_ps((float)dim * 4);
-    ctx.lutsize2 = _mm256_set1_ps((float)dim * dim * 4);
+    ctx.lutsize  = _mm256_set1_ps((float)layout.stride[1]);
+    ctx.lutsize2 = _mm256_set1_ps((float)layout.stride[0]);
+
+    ctx.brickscale  = _mm256_set1_ps(1.0f / (float)layout.brickSize);
+    ctx.brickstep_r = _mm256_set1_ps((float)layout.brickStep[0]);
+    ctx.brickstep_g = _mm256_set1_ps((float)layout.brickStep[1]);
+    ctx.brickstep_b = _mm256_set1_ps((float)layout.brickStep[2]);
 
     int pixel_count = numPixels / 8 * 8;
     int remainder = numPixels - pixel_count;
@@ -215,7 +276,7 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx2(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx2<bricked, LutType>(ctx, r, g, b, a);
 
         AVX2RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -253,7 +314,7 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx2(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx2<bricked, LutType>(ctx, r, g, b, a);
 
         AVX2RGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -270,10 +331,31 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
 
 } // anonymous namespace
 
-void applyTetrahedralAVX2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+void applyTetrahedralAVX2(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
+{
+    if (layout.isBricked())
+    {
+        applyTetrahedralAVX2Func<true, float, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+    else
+    {
+        applyTetrahedralAVX2Func<false, float, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+}
+
+#if OCIO_USE_F16C
+void applyTetrahedralAVX2Half(const half *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVX2Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    if (layout.isBricked())
+    {
+        applyTetrahedralAVX2Func<true, half, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+    else
+    {
+        applyTetrahedralAVX2Func<false, half, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
 }
+#endif // OCIO_USE_F16C
 
 } // OCIO_NAMESPACE
 
@@ -13,23 +13,51 @@ namespace OCIO_NAMESPACE
 {
 namespace {
 
+template<typename LutType>
 struct Lut3DContextAVX512 {
-    const float *lut;
+    const LutType *lut;
     __m512 lutmax;
     __m512 lutsize;
     __m512 lutsize2;
+
+    // Only used by the bricked layout, see Lut3DLayout.
+    __m512 brickscale;
+    __m512 brickstep_r;
+    __m512 brickstep_g;
+    __m512 brickstep_b;
 };
 
 struct rgbavec_avx512 {
     __m512 r, g, b, a;
 };
 
-#define gather_rgb_avx512(src, idx)                            \
-    sample_r = _mm512_i32gather_ps(idx, (void * )(src+0), 4);  \
-    sample_g = _mm512_i32gather_ps(idx, (void * )(src+1), 4);  \
-    sample_b = _mm512_i32gather_ps(idx, (void * )(src+2), 4)
+static inline void gather_rgb_avx512(const float *src, __m512i idx, __m512& sample_r, __m512& sample_g, __m512& sample_b)
+{
+    sample_r = _mm512_i32gather_ps(idx, (void * )(src+0), 4);
+    sample_g = _mm512_i32gather_ps(idx, (void * )(src+1), 4);
+    sample_b = _mm512_i32gather_ps(idx, (void * )(src+2), 4);
+}
+
+// The half float LUT entries are gathered as RG and BA pairs.
+static inline void gather_rgb_avx512(const half *src, __m512i idx, __m512& sample_r, __m512& sample_g, __m512& sample_b)
+{
+    __m512i rg = _mm512_i32gather_epi32(idx, (void * )(src+0), 2);
+    __m512i ba = _mm512_i32gather_epi32(idx, (void * )(src+2), 2);
+
+    sample_r = _mm512_cvtph_ps(_mm512_cvtepi32_epi16(rg));
+    sample_g = _mm512_cvtph_ps(_mm512_cvtepi32_epi16(_mm512_srli_epi32(rg, 16)));
+    sample_b = _mm512_cvtph_ps(_mm512_cvtepi32_epi16(ba));
+}
 
-static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512 &ctx, __m512& r, __m512& g, __m512& b, __m512& a)
+// Offset of the entries v along an axis of the bricked layout i.e.
+// v * stride + floor(v / brickSize) * brickStep, see Lut3DLayout.
+static inline __m512 brick_offset_avx512(__m512 v, __m512 stride, __m512 brickstep, __m512 brickscale)
+{
+    return _mm512_fmadd_ps(_mm512_floor_ps(_mm512_mul_ps(v, brickscale)), brickstep, _mm512_mul_ps(v, stride));
+}
+
+template<bool bricked, typename LutType>
+static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512<LutType> &ctx, __m512& r, __m512& g, __m512& b, __m512& a)
 {
     __m512 x0, x1, x2;
     __m512 cxxxa;
@@ -60,14 +88,28 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     __m512 next_b = _mm512_min_ps(lut_max, _mm512_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm512_mul_ps(prev_r, lutsize2);
-    next_r = _mm512_mul_ps(next_r, lutsize2);
+    if (bricked)
+    {
+        prev_r = brick_offset_avx512(prev_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
+        next_r = brick_offset_avx512(next_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
 
-    prev_g = _mm512_mul_ps(prev_g, lutsize);
-    next_g = _mm512_mul_ps(next_g, lutsize);
+        prev_g = brick_offset_avx512(prev_g, lutsize, ctx.brickstep_g, ctx.brickscale);
+        next_g = brick_offset_avx512(next_g, lutsize, ctx.brickstep_g, ctx.brickscale);
 
-    prev_b = _mm512_mul_ps(prev_b, four_f);
-    next_b = _mm512_mul_ps(next_b, four_f);
+        prev_b = brick_offset_avx512(prev_b, four_f, ctx.brickstep_b, ctx.brickscale);
+        next_b = brick_offset_avx512(next_b, four_f, ctx.brickstep_b, ctx.brickscale);
+    }
+    else
+    {
+        prev_r = _mm512_mul_ps(prev_r, lutsize2);
+        next_r = _mm512_mul_ps(next_r, lutsize2);
+
+        prev_g = _mm512_mul_ps(prev_g, lutsize);
+        next_g = _mm512_mul_ps(next_g, lutsize);
+
+        prev_b = _mm512_mul_ps(prev_b, four_f);
+        next_b = _mm512_mul_ps(next_b, four_f);
+    }
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -137,7 +179,7 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     __m512i cxxxb_idx = _mm512_cvttps_epi32(cxxxb);
     __m512i c111_idx  = _mm512_cvttps_epi32(c111);
 
-    gather_rgb_avx512(ctx.lut, c000_idx);
+    gather_rgb_avx512(ctx.lut, c000_idx, sample_r, sample_g, sample_b);
 
     // (1-x0) * c000
     __m512 v = _mm512_sub_ps(one_f, x0);
@@ -145,7 +187,7 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     result.g = _mm512_mul_ps(sample_g, v);
     result.b = _mm512_mul_ps(sample_b, v);
 
-    gather_rgb_avx512(ctx.lut, cxxxa_idx);
+    gather_rgb_avx512(ctx.lut, cxxxa_idx, sample_r, sample_g, sample_b);
 
     // (x0-x1) * cxxxa
     v = _mm512_sub_ps(x0, x1);
@@ -153,7 +195,7 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     result.g = _mm512_fmadd_ps(v, sample_g, result.g);
     result.b = _mm512_fmadd_ps(v, sample_b, result.b);
 
-    gather_rgb_avx512(ctx.lut, cxxxb_idx);
+    gather_rgb_avx512(ctx.lut, cxxxb_idx, sample_r, sample_g, sample_b);
 
     // (x1-x2) * cxxxb
     v = _mm512_sub_ps(x1, x2);
@@ -161,7 +203,7 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     result.g = _mm512_fmadd_ps(v, sample_g, result.g);
     result.b = _mm512_fmadd_ps(v, sample_b, result.b);
 
-    gather_rgb_avx512(ctx.lut, c111_idx);
+    gather_rgb_avx512(ctx.lut, c111_idx, sample_r, sample_g, sample_b);
 
     // x2 * c111
     result.r = _mm512_fmadd_ps(x2, sample_r, result.r);
@@ -173,8 +215,8 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
+template<bool bricked, typename LutType, BitDepth inBD, BitDepth outBD>
+inline void applyTetrahedralAVX512Func(const LutType *lut3d, const Lut3DLayout & layout, const void *inImg, void *outImg, int numPixels)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -184,7 +226,9 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
     __m512 r,g,b,a;
     rgbavec_avx512 c;
 
-    Lut3DContextAVX512 ctx;
+    Lut3DContextAVX512<LutType> ctx;
+
+    const int dim = layout.dim;
 
     float lutmax = (float)dim - 1;
     __m512 scale   = _mm512_set1_ps(lutmax);
@@ -192,8 +236,13 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
 
     ctx.lut      = lut3d;
     ctx.lutmax   = _mm512_set1_ps(lutmax);
-    ctx.lutsize  = _mm512_set1_ps((float)dim * 4);
-    ctx.lutsize2 = _mm512_set1_ps((float)dim * dim * 4);
+    ctx.lutsize  = _mm512_set1_ps((float)layout.stride[1]);
+    ctx.lutsize2 = _mm512_set1_ps((float)layout.stride[0]);
+
+    ctx.brickscale  = _mm512_set1_ps(1.0f / (float)layout.brickSize);
+    ctx.brickstep_r = _mm512_set1_ps((float)layout.brickStep[0]);
+    ctx.brickstep_g = _mm512_set1_ps((float)layout.brickStep[1]);
+    ctx.brickstep_b = _mm512_set1_ps((float)layout.brickStep[2]);
 
     int pixel_count = numPixels / 16 * 16;
     int remainder = numPixels - pixel_count;
@@ -215,7 +264,7 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
         g = _mm512_min_ps(g, ctx.lutmax);
         b = _mm512_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx512(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx512<bricked, LutType>(ctx, r, g, b, a);
 
         AVX512RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -241,7 +290,7 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
         g = _mm512_min_ps(g, ctx.lutmax);
         b = _mm512_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx512(ctx, r, g, b, a);
+        c = interp_tetrahedral_avx512<bricked, LutType>(ctx, r, g, b, a);
 
         AVX512RGBAPack<outBD>::StoreMasked(dst, c.r, c.g, c.b, c.a, remainder);
     }
@@ -249,9 +298,28 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
 
 } // anonymous namespace
 
-void applyTetrahedralAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+void applyTetrahedralAVX512(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
+{
+    if (layout.isBricked())
+    {
+        applyTetrahedralAVX512Func<true, float, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+    else
+    {
+        applyTetrahedralAVX512Func<false, float, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+}
+
+void applyTetrahedralAVX512Half(const half *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVX512Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    if (layout.isBricked())
+    {
+        applyTetrahedralAVX512Func<true, half, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+    else
+    {
+        applyTetrahedralAVX512Func<false, half, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
 }
 
 } // OCIO_NAMESPACE
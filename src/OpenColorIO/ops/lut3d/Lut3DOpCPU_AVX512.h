@@ -6,13 +6,18 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BitDepthUtils.h"
 #include "CPUInfo.h"
+#include "ops/lut3d/Lut3DLayout.h"
 
 #if OCIO_USE_AVX512
 namespace OCIO_NAMESPACE
 {
 
-void applyTetrahedralAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+void applyTetrahedralAVX512(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count);
+
+// Same with the LUT values stored as half floats.
+void applyTetrahedralAVX512Half(const half *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count);
 
 } // namespace OCIO_NAMESPACE
 
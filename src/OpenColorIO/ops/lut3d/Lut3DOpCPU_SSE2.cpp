@@ -16,6 +16,12 @@ struct Lut3DContextSSE2 {
     __m128 lutmax;
     __m128 lutsize;
     __m128 lutsize2;
+
+    // Only used by the bricked layout, see Lut3DLayout.
+    __m128 brickscale;
+    __m128 brickstep_r;
+    __m128 brickstep_g;
+    __m128 brickstep_b;
 };
 
 struct rgbavec_sse2 {
@@ -66,6 +72,14 @@ static inline __m128 fmadd_ps_sse2(__m128 a, __m128 b, __m128 c)
 #endif
 }
 
+// Offset of the entries v along an axis of the bricked layout i.e.
+// v * stride + floor(v / brickSize) * brickStep, see Lut3DLayout.
+static inline __m128 brick_offset_sse2(__m128 v, __m128 stride, __m128 brickstep, __m128 brickscale)
+{
+    return fmadd_ps_sse2(floor_ps_sse2(_mm_mul_ps(v, brickscale)), brickstep, _mm_mul_ps(v, stride));
+}
+
+template<bool bricked>
 static inline rgbavec_sse2 interp_tetrahedral_sse2(const Lut3DContextSSE2 &ctx, __m128 r, __m128 g, __m128 b, __m128 a)
 {
     SSE2_ALIGN(uint32_t indices[4]);
@@ -102,14 +116,28 @@ static inline rgbavec_sse2 interp_tetrahedral_sse2(const Lut3DContextSSE2 &ctx,
     __m128 next_b = _mm_min_ps(lut_max, _mm_add_ps(prev_b, one_f));
 
     // prescale indices
-    prev_r = _mm_mul_ps(prev_r, lutsize2);
-    next_r = _mm_mul_ps(next_r, lutsize2);
+    if (bricked)
+    {
+        prev_r = brick_offset_sse2(prev_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
+        next_r = brick_offset_sse2(next_r, lutsize2, ctx.brickstep_r, ctx.brickscale);
+
+        prev_g = brick_offset_sse2(prev_g, lutsize, ctx.brickstep_g, ctx.brickscale);
+        next_g = brick_offset_sse2(next_g, lutsize, ctx.brickstep_g, ctx.brickscale);
+
+        prev_b = brick_offset_sse2(prev_b, four_f, ctx.brickstep_b, ctx.brickscale);
+        next_b = brick_offset_sse2(next_b, four_f, ctx.brickstep_b, ctx.brickscale);
+    }
+    else
+    {
+        prev_r = _mm_mul_ps(prev_r, lutsize2);
+        next_r = _mm_mul_ps(next_r, lutsize2);
 
-    prev_g = _mm_mul_ps(prev_g, lutsize);
-    next_g = _mm_mul_ps(next_g, lutsize);
+        prev_g = _mm_mul_ps(prev_g, lutsize);
+        next_g = _mm_mul_ps(next_g, lutsize);
 
-    prev_b = _mm_mul_ps(prev_b, four_f);
-    next_b = _mm_mul_ps(next_b, four_f);
+        prev_b = _mm_mul_ps(prev_b, four_f);
+        next_b = _mm_mul_ps(next_b, four_f);
+    }
 
     // This is the tetrahedral blend equation
     // red = (1-x0) * c000.r + (x0-x1) * cxxxa.r + (x1-x2) * cxxxb.r + x2 * c111.r;
@@ -215,8 +243,8 @@ static inline rgbavec_sse2 interp_tetrahedral_sse2(const Lut3DContextSSE2 &ctx,
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+template<bool bricked, BitDepth inBD, BitDepth outBD>
+static inline void applyTetrahedralSSE2Func(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -227,6 +255,8 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
 
     Lut3DContextSSE2 ctx;
 
+    const int dim = layout.dim;
+
     float lutmax = (float)dim - 1;
     __m128 scale_r = _mm_set1_ps(lutmax);
     __m128 scale_g = _mm_set1_ps(lutmax);
@@ -235,8 +265,13 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
 
     ctx.lut      =  lut3d;
     ctx.lutmax   = _mm_set1_ps(lutmax);
-    ctx.lutsize  = _mm_set1_ps((float)dim * 4);
-    ctx.lutsize2 = _mm_set1_ps((float)dim * dim * 4);
+    ctx.lutsize  = _mm_set1_ps((float)layout.stride[1]);
+    ctx.lutsize2 = _mm_set1_ps((float)layout.stride[0]);
+
+    ctx.brickscale  = _mm_set1_ps(1.0f / (float)layout.brickSize);
+    ctx.brickstep_r = _mm_set1_ps((float)layout.brickStep[0]);
+    ctx.brickstep_g = _mm_set1_ps((float)layout.brickStep[1]);
+    ctx.brickstep_b = _mm_set1_ps((float)layout.brickStep[2]);
 
     int pixel_count = total_pixel_count / 4 * 4;
     int remainder = total_pixel_count - pixel_count;
@@ -258,7 +293,7 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
         g = _mm_min_ps(g, ctx.lutmax);
         b = _mm_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_sse2(ctx, r, g, b, a);
+        c = interp_tetrahedral_sse2<bricked>(ctx, r, g, b, a);
 
         SSE2RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -295,7 +330,7 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
         g = _mm_min_ps(g, ctx.lutmax);
         b = _mm_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_sse2(ctx, r, g, b, a);
+        c = interp_tetrahedral_sse2<bricked>(ctx, r, g, b, a);
 
         SSE2RGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -311,9 +346,16 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
 }
 } // anonymous namespace
 
-void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+void applyTetrahedralSSE2(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralSSE2Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    if (layout.isBricked())
+    {
+        applyTetrahedralSSE2Func<true, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
+    else
+    {
+        applyTetrahedralSSE2Func<false, BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, layout, src, dst, total_pixel_count);
+    }
 }
 
 } // OCIO_NAMESPACE
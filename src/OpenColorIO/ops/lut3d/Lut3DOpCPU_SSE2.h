@@ -7,12 +7,13 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CPUInfo.h"
+#include "ops/lut3d/Lut3DLayout.h"
 
 #if OCIO_USE_SSE2
 namespace OCIO_NAMESPACE
 {
 
-void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+void applyTetrahedralSSE2(const float *lut3d, const Lut3DLayout & layout, const float *src, float *dst, int total_pixel_count);
 
 } // namespace OCIO_NAMESPACE
 
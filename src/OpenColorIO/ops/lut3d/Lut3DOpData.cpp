@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -74,81 +75,107 @@ const unsigned long Lut3DOpData::maxSupportedLength = 129;
 Lut3DOpDataRcPtr Lut3DOpData::Compose(ConstLut3DOpDataRcPtr & lutc1,
                                       ConstLut3DOpDataRcPtr & lutc2)
 {
-    // TODO: Composition of LUTs is a potentially lossy operation.
-    // We try to be safe by making the result at least as big as either lut1 or
-    // lut2 but we may want to even increase the resolution further.  However,
-    // currently composition is done pairs at a time and we would want to
-    // determine the increase size once at the start rather than bumping it up
-    // as each pair is done.
-
-    Lut3DOpDataRcPtr lut1 = std::const_pointer_cast<Lut3DOpData>(lutc1);
-    Lut3DOpDataRcPtr lut2 = std::const_pointer_cast<Lut3DOpData>(lutc2);
-    bool restoreInverse = false;
-    if (lut1->getDirection() == TRANSFORM_DIR_INVERSE && lut2->getDirection() == TRANSFORM_DIR_INVERSE)
+    // We try to be safe by making the result at least as big as either lut1 or lut2.
+    const unsigned long gridSize = std::max(lutc1->getArray().getLength(),
+                                            lutc2->getArray().getLength());
+
+    return Compose(ConstLut3DOpDataRcPtrVec{ lutc1, lutc2 }, gridSize);
+}
+
+Lut3DOpDataRcPtr Lut3DOpData::Compose(const ConstLut3DOpDataRcPtrVec & lutcs,
+                                      unsigned long gridSize)
+{
+    // TODO: Composition of LUTs is a potentially lossy operation.  The caller chooses the grid
+    // size of the result once for the whole sequence, but we may want to even increase the
+    // resolution further.
+
+    if (lutcs.empty())
     {
-        // Using the fact that: iInv(l2 x l1) = inv(l1) x inv(l2).
-        // Compute l2 x l1 and inverse the result.
-        lut1.swap(lut2);
+        throw Exception("Cannot compose an empty list of 3D LUTs.");
+    }
 
-        lut1->setDirection(TRANSFORM_DIR_FORWARD);
-        lut2->setDirection(TRANSFORM_DIR_FORWARD);
-        restoreInverse = true;
+    if (gridSize == 0 || gridSize > maxSupportedLength)
+    {
+        std::ostringstream oss;
+        oss << "Cannot compose 3D LUTs with a grid size of '" << gridSize
+            << "'. Maximum supported length is " << maxSupportedLength << ".";
+        throw Exception(oss.str().c_str());
     }
 
-    const long min_sz = lut2->getArray().getLength();
-    const long n = lut1->getArray().getLength();
-    const long domain_size = std::max(min_sz, n);
+    std::vector<Lut3DOpDataRcPtr> luts;
+    luts.reserve(lutcs.size());
+
+    const bool allInverse
+        = std::all_of(lutcs.begin(), lutcs.end(), [](const ConstLut3DOpDataRcPtr & lut)
+                      {
+                          return lut->getDirection() == TRANSFORM_DIR_INVERSE;
+                      });
+
+    if (allInverse && lutcs.size() > 1)
+    {
+        // Using the fact that: inv(ln x ... x l1) = inv(l1) x ... x inv(ln).
+        // Compute ln x ... x l1 and inverse the result.
+        for (auto it = lutcs.rbegin(); it != lutcs.rend(); ++it)
+        {
+            luts.push_back((*it)->inverse());
+        }
+    }
+    else
+    {
+        // We need non-const versions of the LUTs to create the ops.
+        // Ops will not be modified (except by finalize, but that should have been done already).
+        for (const auto & lut : lutcs)
+        {
+            luts.push_back(std::const_pointer_cast<Lut3DOpData>(lut));
+        }
+    }
+
+    Lut3DOpDataRcPtr & lut1 = luts.front();
+
     OpRcPtrVec ops;
 
     Lut3DOpDataRcPtr result;
 
-    if (n >= min_sz && !(lut1->getDirection() == TRANSFORM_DIR_INVERSE))
+    if (lut1->getArray().getLength() == gridSize
+        && !(lut1->getDirection() == TRANSFORM_DIR_INVERSE))
     {
-        // The range of the first LUT becomes the domain to interp in the second.
+        // The range of the first LUT becomes the domain to interp in the next ones.
         // Use the original domain.
         result = lut1->clone();
     }
     else
     {
-        // Since the 2nd LUT is more finely sampled, use its grid size.
-
-        // Create identity with finer domain.
+        // Create identity with the requested domain.
 
-        result = std::make_shared<Lut3DOpData>(lut1->getInterpolation(), domain_size);
+        result = std::make_shared<Lut3DOpData>(lut1->getInterpolation(), gridSize);
 
         auto metadata = lut1->getFormatMetadata();
         result->getFormatMetadata() = metadata;
 
-        // Interpolate through both LUTs in this case (resample).
-        Lut3DOpDataRcPtr nonConstLut1 = std::const_pointer_cast<Lut3DOpData>(lut1);
-        CreateLut3DOp(ops, nonConstLut1, TRANSFORM_DIR_FORWARD);
+        // Interpolate through all the LUTs in this case (resample).
+        CreateLut3DOp(ops, lut1, TRANSFORM_DIR_FORWARD);
     }
 
-    // We need a non-const version of lut2 to create the op.
-    // Op will not be modified (except by finalize, but that should have been done already).
-    Lut3DOpDataRcPtr nonConstLut2 = std::const_pointer_cast<Lut3DOpData>(lut2);
-    CreateLut3DOp(ops, nonConstLut2, TRANSFORM_DIR_FORWARD);
-
-    const BitDepth fileOutBD = lut1->getFileOutputBitDepth();
+    for (size_t idx = 1; idx < luts.size(); ++idx)
+    {
+        CreateLut3DOp(ops, luts[idx], TRANSFORM_DIR_FORWARD);
 
-    // TODO: May want to revisit metadata propagation.
-    result->getFormatMetadata().combine(lut2->getFormatMetadata());
+        // TODO: May want to revisit metadata propagation.
+        result->getFormatMetadata().combine(luts[idx]->getFormatMetadata());
+    }
 
-    result->setFileOutputBitDepth(fileOutBD);
+    result->setFileOutputBitDepth(lut1->getFileOutputBitDepth());
 
     const Array::Values & domain = result->getArray().getValues();
-    const long gridSize = result->getArray().getLength();
-    const long numPixels = gridSize * gridSize * gridSize;
+    const long numPixels = long(gridSize * gridSize * gridSize);
 
     EvalTransform((const float*)(&domain[0]),
                   (float*)(&domain[0]),
                   numPixels,
                   ops);
 
-    if (restoreInverse)
+    if (allInverse && lutcs.size() > 1)
     {
-        lut1->setDirection(TRANSFORM_DIR_INVERSE);
-        lut2->setDirection(TRANSFORM_DIR_INVERSE);
         result->setDirection(TRANSFORM_DIR_INVERSE);
     }
 
@@ -467,11 +494,36 @@ Lut3DOpDataRcPtr Lut3DOpData::inverse() const
     return invLut;
 }
 
-std::string Lut3DOpData::getCacheID() const
+CacheIDDigest Lut3DOpData::getArrayDigest() const
 {
-    AutoMutex lock(m_mutex);
+    if (m_arrayDigestValid)
+    {
+        return m_arrayDigest;
+    }
 
     const Lut3DArray::Values & values = getArray().getValues();
+    const CacheIDDigest digest = CacheIDDigestFromData(&values[0],
+                                                       values.size() * sizeof(values[0]));
+
+    if (m_finalized)
+    {
+        m_arrayDigest      = digest;
+        m_arrayDigestValid = true;
+    }
+
+    return digest;
+}
+
+void Lut3DOpData::finalize()
+{
+    AutoMutex lock(m_mutex);
+
+    m_finalized = true;
+}
+
+std::string Lut3DOpData::getCacheID() const
+{
+    AutoMutex lock(m_mutex);
 
     std::ostringstream cacheIDStream;
     if (!getID().empty())
@@ -479,9 +531,7 @@ std::string Lut3DOpData::getCacheID() const
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]),
-                                 values.size() * sizeof(values[0]))
-                  << " ";
+    cacheIDStream << CacheIDDigestToString(getArrayDigest()) << " ";
 
     cacheIDStream << InterpolationToString(m_interpolation)  << " ";
     cacheIDStream << TransformDirectionToString(m_direction) << " ";
@@ -489,6 +539,22 @@ std::string Lut3DOpData::getCacheID() const
     return cacheIDStream.str();
 }
 
+CacheIDDigest Lut3DOpData::getCacheIDDigest() const
+{
+    AutoMutex lock(m_mutex);
+
+    const int params[] = { getType(), m_interpolation, m_direction };
+
+    CacheIDDigest digest = CombineCacheIDDigests(getArrayDigest(),
+                                                 CacheIDDigestFromData(params, sizeof(params)));
+    if (!getID().empty())
+    {
+        digest = CombineCacheIDDigests(digest, CacheIDDigestFromData(getID()));
+    }
+
+    return digest;
+}
+
 void Lut3DOpData::scale(float scale)
 {
     getArray().scale(scale);
@@ -18,6 +18,7 @@ namespace OCIO_NAMESPACE
 class Lut3DOpData;
 typedef OCIO_SHARED_PTR<Lut3DOpData> Lut3DOpDataRcPtr;
 typedef OCIO_SHARED_PTR<const Lut3DOpData> ConstLut3DOpDataRcPtr;
+typedef std::vector<ConstLut3DOpDataRcPtr> ConstLut3DOpDataRcPtrVec;
 
 class Lut3DOpData : public OpData
 {
@@ -30,6 +31,10 @@ public:
     // approximates the effect of the pair of ops.
     static Lut3DOpDataRcPtr Compose(ConstLut3DOpDataRcPtr & lut1, ConstLut3DOpDataRcPtr & lut2);
 
+    // Compose a sequence of LUTs in a single pass, the result having the requested grid size.
+    // Composing the sequence at once avoids resampling intermediate results.
+    static Lut3DOpDataRcPtr Compose(const ConstLut3DOpDataRcPtrVec & luts, unsigned long gridSize);
+
 public:
     // The gridSize parameter is the length of the cube axis.
     explicit Lut3DOpData(unsigned long gridSize);
@@ -55,7 +60,7 @@ public:
 
     // Note: The Lut3DOpData Array stores the values in blue-fastest order.
     inline const Array & getArray() const { return m_array; }
-    inline Array & getArray() { return m_array; }
+    inline Array & getArray() { m_finalized = false; m_arrayDigestValid = false; return m_array; }
 
     void setArrayFromRedFastestOrder(const std::vector<float> & lut);
 
@@ -85,6 +90,11 @@ public:
 
     std::string getCacheID() const override;
 
+    CacheIDDigest getCacheIDDigest() const override;
+
+    // The LUT values are not expected to change afterwards.
+    void finalize();
+
     inline BitDepth getFileOutputBitDepth() const { return m_fileOutBitDepth; }
     inline void setFileOutputBitDepth(BitDepth out) { m_fileOutBitDepth = out; }
 
@@ -94,6 +104,9 @@ protected:
     // Test core parts of LUTs for equality.
     bool haveEqualBasics(const Lut3DOpData & other) const;
 
+    // Digest of the LUT values. The caller must hold the mutex.
+    CacheIDDigest getArrayDigest() const;
+
 public:
     // Class which encapsulates an array dedicated to a 3D LUT.
     class Lut3DArray : public Array
@@ -135,6 +148,12 @@ private:
     // Out bit-depth to be used for file I/O.
     BitDepth m_fileOutBitDepth = BIT_DEPTH_UNKNOWN;
 
+    // Once finalized, the LUT values are not expected to change so their digest is memoized
+    // the first time it is needed.
+    bool m_finalized = false;
+    mutable CacheIDDigest m_arrayDigest;
+    mutable bool m_arrayDigestValid = false;
+
 };
 
 bool operator==(const Lut3DOpData & lhs, const Lut3DOpData & rhs);
@@ -23,6 +23,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
     float m_scale[4];
 };
@@ -36,6 +42,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
     float m_scale[4];
     float m_offset[4];
@@ -50,6 +62,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
 
     float m_column1[4];
@@ -69,6 +87,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
     float m_column1[4];
     float m_column2[4];
@@ -104,6 +128,39 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ScaleRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = in[0] * m_scale[0];
+        out[1] = in[1] * m_scale[1];
+        out[2] = in[2] * m_scale[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void ScaleRenderer::applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * plane = planes[c];
+        if (!plane) continue;
+
+        const float scale = m_scale[c];
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            plane[idx] = plane[idx] * scale;
+        }
+    }
+}
+
 ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -139,6 +196,41 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void ScaleWithOffsetRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = in[0] * m_scale[0] + m_offset[0];
+        out[1] = in[1] * m_scale[1] + m_offset[1];
+        out[2] = in[2] * m_scale[2] + m_offset[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void ScaleWithOffsetRenderer::applyPlanar(float * r, float * g, float * b, float * a,
+                                          long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * plane = planes[c];
+        if (!plane) continue;
+
+        const float scale  = m_scale[c];
+        const float offset = m_offset[c];
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            plane[idx] = plane[idx] * scale + offset;
+        }
+    }
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -287,6 +379,60 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
+// The missing alpha being 0, the alpha column does not contribute to the RGB result.
+void MatrixWithOffsetRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        out[0] = r*m_column1[0] + g*m_column2[0] + b*m_column3[0] + m_offset[0];
+        out[1] = r*m_column1[1] + g*m_column2[1] + b*m_column3[1] + m_offset[1];
+        out[2] = r*m_column1[2] + g*m_column2[2] + b*m_column3[2] + m_offset[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+// The sums are ordered as in the SSE packed processing for identical results.
+void MatrixWithOffsetRenderer::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    if (a)
+    {
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pix[4] = { r[idx], g[idx], b[idx], a[idx] };
+
+            r[idx] = ((pix[0]*m_column1[0] + pix[1]*m_column2[0])
+                     + (pix[2]*m_column3[0] + pix[3]*m_column4[0])) + m_offset[0];
+            g[idx] = ((pix[0]*m_column1[1] + pix[1]*m_column2[1])
+                     + (pix[2]*m_column3[1] + pix[3]*m_column4[1])) + m_offset[1];
+            b[idx] = ((pix[0]*m_column1[2] + pix[1]*m_column2[2])
+                     + (pix[2]*m_column3[2] + pix[3]*m_column4[2])) + m_offset[2];
+            a[idx] = ((pix[0]*m_column1[3] + pix[1]*m_column2[3])
+                     + (pix[2]*m_column3[3] + pix[3]*m_column4[3])) + m_offset[3];
+        }
+    }
+    else
+    {
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pix[3] = { r[idx], g[idx], b[idx] };
+
+            r[idx] = (pix[0]*m_column1[0] + pix[1]*m_column2[0]) + pix[2]*m_column3[0] + m_offset[0];
+            g[idx] = (pix[0]*m_column1[1] + pix[1]*m_column2[1]) + pix[2]*m_column3[1] + m_offset[1];
+            b[idx] = (pix[0]*m_column1[2] + pix[1]*m_column2[2]) + pix[2]*m_column3[2] + m_offset[2];
+        }
+    }
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -395,6 +541,57 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+void MatrixRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        out[0] = r*m_column1[0] + g*m_column2[0] + b*m_column3[0];
+        out[1] = r*m_column1[1] + g*m_column2[1] + b*m_column3[1];
+        out[2] = r*m_column1[2] + g*m_column2[2] + b*m_column3[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void MatrixRenderer::applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const
+{
+    if (a)
+    {
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pix[4] = { r[idx], g[idx], b[idx], a[idx] };
+
+            r[idx] = (pix[0]*m_column1[0] + pix[1]*m_column2[0])
+                   + (pix[2]*m_column3[0] + pix[3]*m_column4[0]);
+            g[idx] = (pix[0]*m_column1[1] + pix[1]*m_column2[1])
+                   + (pix[2]*m_column3[1] + pix[3]*m_column4[1]);
+            b[idx] = (pix[0]*m_column1[2] + pix[1]*m_column2[2])
+                   + (pix[2]*m_column3[2] + pix[3]*m_column4[2]);
+            a[idx] = (pix[0]*m_column1[3] + pix[1]*m_column2[3])
+                   + (pix[2]*m_column3[3] + pix[3]*m_column4[3]);
+        }
+    }
+    else
+    {
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pix[3] = { r[idx], g[idx], b[idx] };
+
+            r[idx] = (pix[0]*m_column1[0] + pix[1]*m_column2[0]) + pix[2]*m_column3[0];
+            g[idx] = (pix[0]*m_column1[1] + pix[1]*m_column2[1]) + pix[2]*m_column3[1];
+            b[idx] = (pix[0]*m_column1[2] + pix[1]*m_column2[2]) + pix[2]*m_column3[2];
+        }
+    }
+}
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
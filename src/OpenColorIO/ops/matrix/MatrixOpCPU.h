@@ -8,12 +8,104 @@
 
 #include "Op.h"
 #include "ops/matrix/MatrixOpData.h"
+#include "SSE.h"
 
 namespace OCIO_NAMESPACE
 {
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat);
 
+#if OCIO_USE_SSE2
+
+// The kernels process four pixels held in one register per channel (i.e. the red of the
+// four pixels in r, etc.) and give the same results as the renderers, the sums being ordered
+// as in the SSE packed processing.  The offsets are always added (limiting the number of
+// kernel combinations), so a -0 result of a matrix without offsets becomes +0.  They are used
+// by the renderers fusing several ops (refer to ops/FusedOpCPU.h).
+
+class MatrixKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = true;
+
+    explicit MatrixKernelSSE(ConstMatrixOpDataRcPtr & mat)
+    {
+        const unsigned long dim = mat->getArray().getLength();
+        const ArrayDouble::Values & m = mat->getArray().getValues();
+        const MatrixOpData::Offsets & o = mat->getOffsets();
+
+        for (unsigned long row = 0; row < 4; ++row)
+        {
+            for (unsigned long col = 0; col < 4; ++col)
+            {
+                m_matrix[row][col] = _mm_set1_ps((float)m[row * dim + col]);
+            }
+            m_offset[row] = _mm_set1_ps((float)o[row]);
+        }
+    }
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 & a) const
+    {
+        const __m128 red   = process(r, g, b, a, 0);
+        const __m128 green = process(r, g, b, a, 1);
+        const __m128 blue  = process(r, g, b, a, 2);
+        a = process(r, g, b, a, 3);
+        r = red;
+        g = green;
+        b = blue;
+    }
+
+private:
+    __m128 process(__m128 r, __m128 g, __m128 b, __m128 a, int row) const
+    {
+        const __m128 * m = m_matrix[row];
+        const __m128 res = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, m[0]), _mm_mul_ps(g, m[1])),
+                                      _mm_add_ps(_mm_mul_ps(b, m[2]), _mm_mul_ps(a, m[3])));
+        return _mm_add_ps(res, m_offset[row]);
+    }
+
+    __m128 m_matrix[4][4];
+    __m128 m_offset[4];
+};
+
+// Diagonal matrix.
+class ScaleKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = true;
+
+    explicit ScaleKernelSSE(ConstMatrixOpDataRcPtr & mat)
+    {
+        const ArrayDouble::Values & m = mat->getArray().getValues();
+        const MatrixOpData::Offsets & o = mat->getOffsets();
+
+        for (int c = 0; c < 4; ++c)
+        {
+            m_scale[c]  = _mm_set1_ps((float)m[c * 5]);
+            m_offset[c] = _mm_set1_ps((float)o[c]);
+        }
+    }
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 & a) const
+    {
+        r = process(r, 0);
+        g = process(g, 1);
+        b = process(b, 2);
+        a = process(a, 3);
+    }
+
+private:
+    __m128 process(__m128 v, int c) const
+    {
+        return _mm_add_ps(_mm_mul_ps(v, m_scale[c]), m_offset[c]);
+    }
+
+    __m128 m_scale[4];
+    __m128 m_offset[4];
+};
+
+#endif // OCIO_USE_SSE2
+
 } // namespace OCIO_NAMESPACE
 
 #endif
\ No newline at end of file
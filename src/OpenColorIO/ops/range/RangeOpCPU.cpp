@@ -35,6 +35,16 @@ public:
     RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class RangeMinMaxRenderer : public RangeOpCPU
@@ -43,6 +53,16 @@ public:
     RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class RangeMinRenderer : public RangeOpCPU
@@ -51,6 +71,16 @@ public:
     RangeMinRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class RangeMaxRenderer : public RangeOpCPU
@@ -59,6 +89,16 @@ public:
     RangeMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasRGBApply() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
+private:
+    template<int NumChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 
@@ -82,9 +122,29 @@ RangeScaleMinMaxRenderer::RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range
 
 void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeScaleMinMaxRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    process<3>((const float *)inImg, (float *)outImg, numPixels);
+}
 
+void RangeScaleMinMaxRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */, long numPixels) const
+{
+    for (float * plane : { r, g, b })
+    {
+        // NaNs become m_lowerBound.
+        ApplyToPlane(plane, numPixels, [this](float v)
+        {
+            return Clamp(v * m_scale + m_offset, m_lowerBound, m_upperBound);
+        });
+    }
+}
+
+template<int NumChannels>
+void RangeScaleMinMaxRenderer::process(const float * in, float * out, long numPixels) const
+{
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float t[3] = { in[0] * m_scale + m_offset,
@@ -95,10 +155,13 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
         out[0] = Clamp(t[0], m_lowerBound, m_upperBound);
         out[1] = Clamp(t[1], m_lowerBound, m_upperBound);
         out[2] = Clamp(t[2], m_lowerBound, m_upperBound);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
@@ -109,19 +172,42 @@ RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
 
 void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMinMaxRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    process<3>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMinMaxRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */, long numPixels) const
+{
+    for (float * plane : { r, g, b })
+    {
+        // NaNs become m_lowerBound.
+        ApplyToPlane(plane, numPixels, [this](float v)
+        {
+            return Clamp(v, m_lowerBound, m_upperBound);
+        });
+    }
+}
 
+template<int NumChannels>
+void RangeMinMaxRenderer::process(const float * in, float * out, long numPixels) const
+{
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_lowerBound.
         out[0] = Clamp(in[0], m_lowerBound, m_upperBound);
         out[1] = Clamp(in[1], m_lowerBound, m_upperBound);
         out[2] = Clamp(in[2], m_lowerBound, m_upperBound);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
@@ -132,19 +218,39 @@ RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
 
 void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMinRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    process<3>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMinRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */, long numPixels) const
+{
+    for (float * plane : { r, g, b })
+    {
+        // NaNs become m_lowerBound.
+        ApplyToPlane(plane, numPixels, [this](float v) { return std::max(m_lowerBound, v); });
+    }
+}
 
+template<int NumChannels>
+void RangeMinRenderer::process(const float * in, float * out, long numPixels) const
+{
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_lowerBound.
         out[0] = std::max(m_lowerBound, in[0]);
         out[1] = std::max(m_lowerBound, in[1]);
         out[2] = std::max(m_lowerBound, in[2]);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
@@ -155,19 +261,39 @@ RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
 
 void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void RangeMaxRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    process<3>((const float *)inImg, (float *)outImg, numPixels);
+}
 
+void RangeMaxRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */, long numPixels) const
+{
+    for (float * plane : { r, g, b })
+    {
+        // NaNs become m_upperBound.
+        ApplyToPlane(plane, numPixels, [this](float v) { return std::min(m_upperBound, v); });
+    }
+}
+
+template<int NumChannels>
+void RangeMaxRenderer::process(const float * in, float * out, long numPixels) const
+{
     for(long idx=0; idx<numPixels; ++idx)
     {
         // NaNs become m_upperBound.
         out[0] = std::min(m_upperBound, in[0]);
         out[1] = std::min(m_upperBound, in[1]);
         out[2] = std::min(m_upperBound, in[2]);
-        out[3] = in[3];
+        if (NumChannels == 4)
+        {
+            out[3] = in[3];
+        }
 
-        in  += 4;
-        out += 4;
+        in  += NumChannels;
+        out += NumChannels;
     }
 }
 
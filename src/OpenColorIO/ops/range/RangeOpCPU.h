@@ -9,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ops/range/RangeOpData.h"
+#include "SSE.h"
 
 
 namespace OCIO_NAMESPACE
@@ -16,6 +17,64 @@ namespace OCIO_NAMESPACE
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range);
 
+#if OCIO_USE_SSE2
+
+// The kernel processes four pixels held in one register per channel (i.e. the red of the
+// four pixels in r, etc.) and gives the same results as the renderers, NaNs included, the
+// alpha being left unchanged.  The template arguments select the renderer to mimic i.e.
+// <true, true, true> for RangeScaleMinMaxRenderer, <false, true, true> for RangeMinMaxRenderer,
+// <false, true, false> for RangeMinRenderer and <false, false, true> for RangeMaxRenderer.
+// It is used by the renderers fusing several ops (refer to ops/FusedOpCPU.h).
+template<bool Scale, bool HasMin, bool HasMax>
+class RangeKernelSSE
+{
+public:
+    static constexpr bool HasRGBApply = true;
+
+    explicit RangeKernelSSE(ConstRangeOpDataRcPtr & range)
+        : m_scale(_mm_set1_ps((float)range->getScale()))
+        , m_offset(_mm_set1_ps((float)range->getOffset()))
+        , m_lowerBound(_mm_set1_ps((float)range->getMinOutValue()))
+        , m_upperBound(_mm_set1_ps((float)range->getMaxOutValue()))
+    {
+    }
+
+    void apply(__m128 & r, __m128 & g, __m128 & b, __m128 &) const
+    {
+        r = process(r);
+        g = process(g);
+        b = process(b);
+    }
+
+private:
+    __m128 process(__m128 v) const
+    {
+        if (Scale)
+        {
+            v = _mm_add_ps(_mm_mul_ps(v, m_scale), m_offset);
+        }
+
+        // The operand orders match std::max(), std::min() and Clamp() in the renderers for NaNs.
+        if (HasMin)
+        {
+            v = _mm_max_ps(v, m_lowerBound);
+        }
+        if (HasMax)
+        {
+            v = HasMin ? _mm_min_ps(m_upperBound, v) : _mm_min_ps(v, m_upperBound);
+        }
+
+        return v;
+    }
+
+    __m128 m_scale;
+    __m128 m_offset;
+    __m128 m_lowerBound;
+    __m128 m_upperBound;
+};
+
+#endif // OCIO_USE_SSE2
+
 } // namespace OCIO_NAMESPACE
 
 
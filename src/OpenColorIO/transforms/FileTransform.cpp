@@ -342,6 +342,7 @@ FormatRegistry::FormatRegistry()
     registerFileFormat(CreateFileFormatIridasCube());
     registerFileFormat(CreateFileFormatIridasItx());
     registerFileFormat(CreateFileFormatIridasLook());
+    registerFileFormat(CreateFileFormatOCIOBinaryLut());
     registerFileFormat(CreateFileFormatPandora());
     registerFileFormat(CreateFileFormatResolveCube());
     registerFileFormat(CreateFileFormatSpi1D());
@@ -408,7 +409,12 @@ void FormatRegistry::registerFileFormat(FileFormat* format)
 
         m_formatsByName[StringUtils::Lower(formatInfoVec[i].name)] = format;
 
-        m_formatsByExtension[formatInfoVec[i].extension].push_back(format);
+        // A format declaring several names for the same extension is only tried once.
+        FileFormatVector & formats = m_formatsByExtension[formatInfoVec[i].extension];
+        if (std::find(formats.begin(), formats.end(), format) == formats.end())
+        {
+            formats.push_back(format);
+        }
 
         if(formatInfoVec[i].capabilities & FORMAT_CAPABILITY_READ)
         {
@@ -785,6 +791,7 @@ struct FileCacheResult
     bool error = false;
     CachedFileRcPtr cachedFile;
     std::string exceptionText;
+    unsigned revision = 0; // Revision of the file when it was loaded.
 
     FileCacheResult() = default;
 };
@@ -808,6 +815,8 @@ void GetCachedFileAndFormat(FileFormat * & format,
     // the data creation. It was originally done to improve the multi-threaded
     // file lookup.  Refer to PR #309 for details.
 
+    const unsigned revision = GetValidatedFileRevision(filepath);
+
     // Load the file cache ptr from the global map
     FileCacheResultPtr result;
     {
@@ -819,9 +828,12 @@ void GetCachedFileAndFormat(FileFormat * & format,
             // means that the entry does not exist in the cache. So, it provides
             // a fast existence check.
             result = g_fileCache[filepath];
-            if (!result)
+            // Only replace the entry when the file changed since it was loaded, the
+            // previous content stays valid for the processors still using it.
+            if (!result || result->revision != revision)
             {
                 result = std::make_shared<FileCacheResult>();
+                result->revision = revision;
                 g_fileCache[filepath] = result;
             }
         }
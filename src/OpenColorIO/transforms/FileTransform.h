@@ -169,6 +169,7 @@ FileFormat * CreateFileFormatICC();
 FileFormat * CreateFileFormatIridasCube();
 FileFormat * CreateFileFormatIridasItx();
 FileFormat * CreateFileFormatIridasLook();
+FileFormat * CreateFileFormatOCIOBinaryLut();
 FileFormat * CreateFileFormatPandora();
 FileFormat * CreateFileFormatResolveCube();
 FileFormat * CreateFileFormatSpi1D();
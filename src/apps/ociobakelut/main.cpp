@@ -2,11 +2,14 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <thread>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -30,6 +33,207 @@ static int parse_end_args(int argc, const char *argv[])
 
 OCIO::GroupTransformRcPtr parse_luts(int argc, const char *argv[]);
 
+// One LUT to bake from a batch file.
+struct BatchEntry
+{
+    int lineNumber = 0;
+    std::string inputspace;
+    std::string looks;
+    std::string display;
+    std::string view;
+    std::string outputspace;
+    std::string outputfile;
+};
+
+static std::string trim(const std::string & str)
+{
+    const std::string whitespaces(" \t\r\n");
+    const size_t first = str.find_first_not_of(whitespaces);
+    if(first == std::string::npos)
+    {
+        return "";
+    }
+    const size_t last = str.find_last_not_of(whitespaces);
+    return str.substr(first, last - first + 1);
+}
+
+// Each non-empty line (not starting with '#') of a batch file is either
+//     inputspace | looks | display | view | outputfile
+// or
+//     inputspace | looks | outputspace | outputfile
+static bool parse_batch_file(const std::string & filename,
+                             std::vector<BatchEntry> & entries,
+                             std::string & error)
+{
+    std::ifstream f(filename.c_str());
+    if(f.fail())
+    {
+        error = "Cannot read the batch file " + filename + ".";
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while(std::getline(f, line))
+    {
+        ++lineNumber;
+
+        line = trim(line);
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::istringstream iss(line);
+        std::string field;
+        while(std::getline(iss, field, '|'))
+        {
+            fields.push_back(trim(field));
+        }
+
+        BatchEntry entry;
+        entry.lineNumber = lineNumber;
+
+        if(fields.size() == 5)
+        {
+            entry.inputspace = fields[0];
+            entry.looks      = fields[1];
+            entry.display    = fields[2];
+            entry.view       = fields[3];
+            entry.outputfile = fields[4];
+        }
+        else if(fields.size() == 4)
+        {
+            entry.inputspace  = fields[0];
+            entry.looks       = fields[1];
+            entry.outputspace = fields[2];
+            entry.outputfile  = fields[3];
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << filename << ":" << lineNumber << ": expecting 4 or 5 fields separated by '|'.";
+            error = oss.str();
+            return false;
+        }
+
+        if(entry.inputspace.empty() || entry.outputfile.empty()
+            || (entry.outputspace.empty() && (entry.display.empty() || entry.view.empty())))
+        {
+            std::ostringstream oss;
+            oss << filename << ":" << lineNumber << ": missing input space, output or file name.";
+            error = oss.str();
+            return false;
+        }
+
+        entries.push_back(entry);
+    }
+
+    return true;
+}
+
+// Bake all the LUTs of the batch file using several threads.
+static int bake_batch(const OCIO::ConstConfigRcPtr & config,
+                      const std::string & batchfile,
+                      const std::string & format,
+                      const std::string & shaperspace,
+                      int shapersize,
+                      int cubesize,
+                      int jobs,
+                      bool verbose)
+{
+    std::vector<BatchEntry> entries;
+    std::string error;
+    if(!parse_batch_file(batchfile, entries, error))
+    {
+        std::cerr << "\nERROR: " << error << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> errors(entries.size());
+    std::atomic<size_t> nextEntry(0);
+
+    auto worker = [&]()
+    {
+        for(size_t idx = nextEntry++; idx < entries.size(); idx = nextEntry++)
+        {
+            const BatchEntry & entry = entries[idx];
+            try
+            {
+                OCIO::BakerRcPtr baker = OCIO::Baker::Create();
+                baker->setConfig(config);
+                baker->setFormat(format.c_str());
+                baker->setInputSpace(entry.inputspace.c_str());
+                baker->setShaperSpace(shaperspace.c_str());
+                baker->setLooks(entry.looks.c_str());
+                baker->setTargetSpace(entry.outputspace.c_str());
+                baker->setDisplayView(entry.display.c_str(), entry.view.c_str());
+                if(shapersize!=-1) baker->setShaperSize(shapersize);
+                if(cubesize!=-1) baker->setCubeSize(cubesize);
+
+                std::ofstream f(entry.outputfile.c_str(),
+                                std::ios_base::out | std::ios_base::binary);
+                if(f.fail())
+                {
+                    errors[idx] = "Non-writable file path " + entry.outputfile + " specified.";
+                    continue;
+                }
+                baker->bake(f);
+            }
+            catch(std::exception & exception)
+            {
+                errors[idx] = exception.what();
+            }
+            catch(...)
+            {
+                errors[idx] = "Unknown error encountered.";
+            }
+        }
+    };
+
+    if(jobs <= 0)
+    {
+        jobs = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    jobs = std::min(jobs, static_cast<int>(entries.size()));
+
+    if(verbose)
+    {
+        std::cout << "[OpenColorIO INFO]: Baking " << entries.size() << " '" << format
+                  << "' LUTs using " << jobs << " job(s)" << std::endl;
+    }
+
+    std::vector<std::thread> threads;
+    for(int i=1; i<jobs; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for(auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    int status = 0;
+    for(size_t idx = 0; idx < entries.size(); ++idx)
+    {
+        if(!errors[idx].empty())
+        {
+            std::cerr << "ERROR: " << batchfile << ":" << entries[idx].lineNumber << ": "
+                      << errors[idx] << std::endl;
+            status = 1;
+        }
+        else if(verbose)
+        {
+            std::cout << "[OpenColorIO INFO]: Wrote '" << entries[idx].outputfile << "'"
+                      << std::endl;
+        }
+    }
+
+    return status;
+}
+
 int main (int argc, const char* argv[])
 {
 
@@ -46,6 +250,8 @@ int main (int argc, const char* argv[])
     std::string view;
     bool usestdout = false;
     bool verbose = false;
+    std::string batchfile;
+    int jobs = 0;
 
     int whitepointtemp = 6505;
     std::string displayicc;
@@ -78,6 +284,8 @@ int main (int argc, const char* argv[])
                "example:  ociobakelut --inputspace lg10 --outputspace srgb8 --format icc ~/Library/ColorSync/Profiles/test.icc\n"
                "example:  ociobakelut --inputspace lin --shaperspace lg10 --outputspace lg10 --format spi1d lintolog.spi1d\n"
                "example:  ociobakelut --inputspace lg10 --displayview sRGB Film --format spi3d display_view.spi3d\n"
+               "example:  ociobakelut --lut filmlut.3dl --format ocio_binary_lut filmlut.olut\n"
+               "example:  ociobakelut --batch shots.txt --jobs 8 --format resolve_cube\n"
                "example:  ociobakelut --lut filmlut.3dl --lut calibration.3dl --format icc ~/Library/ColorSync/Profiles/test.icc\n\n",
                "%*", parse_end_args, "",
                "<SEPARATOR>", "Using Existing OCIO Configurations",
@@ -103,6 +311,10 @@ int main (int argc, const char* argv[])
                "--shapersize %d", &shapersize, "size of the shaper (default: format specific)",
                "--cubesize %d", &cubesize, "size of the main LUT (3d or 1d) (default: format specific)",
                "--stdout", &usestdout, "Write to stdout (rather than file)",
+               "--batch %s", &batchfile, "a file listing the LUTs to bake, one per line as "
+                                          "'inputspace|looks|display|view|outputfile' or "
+                                          "'inputspace|looks|outputspace|outputfile'",
+               "--jobs %d", &jobs, "number of LUTs baked concurrently with --batch (default: number of cores)",
                "--v", &verbose, "Verbose",
                "--help", &help, "Print help message\n",
                "<SEPARATOR>", "ICC Options",
@@ -198,6 +410,12 @@ int main (int argc, const char* argv[])
             std::cerr << "See --help for more info." << std::endl;
             return 1;
         }
+        if(!batchfile.empty())
+        {
+            std::cerr << "\nERROR: --batch is not allowed when using --lut\n\n";
+            std::cerr << "See --help for more info." << std::endl;
+            return 1;
+        }
 
         OCIO::ConfigRcPtr editableConfig = OCIO::Config::Create();
 
@@ -223,6 +441,19 @@ int main (int argc, const char* argv[])
         editableConfig->addColorSpace(outputColorSpace);
         config = editableConfig;
     }
+    else if(!batchfile.empty())
+    {
+        // The color spaces, looks and output files are read from the batch file.
+
+        if(!inputspace.empty() || !outputspace.empty() || !looks.empty()
+            || !display.empty() || !view.empty())
+        {
+            std::cerr << "\nERROR: --inputspace, --outputspace, --looks and --displayview "
+                      << "are not allowed when using --batch\n\n";
+            std::cerr << "See --help for more info." << std::endl;
+            return 1;
+        }
+    }
     else
     {
 
@@ -247,6 +478,10 @@ int main (int argc, const char* argv[])
             return 1;
         }
 
+    }
+
+    if(groupTransform->getNumTransforms() == 0)
+    {
         if(format.empty())
         {
             std::cerr << "\nERROR: You must specify the LUT format using --format.\n\n";
@@ -278,6 +513,27 @@ int main (int argc, const char* argv[])
         }
     }
 
+    if(!batchfile.empty())
+    {
+        if(format == "icc" || usestdout || !outputfile.empty())
+        {
+            std::cerr << "\nERROR: --batch does not support icc, --stdout or an outputfile.\n\n";
+            std::cerr << "See --help for more info." << std::endl;
+            return 1;
+        }
+
+        try
+        {
+            return bake_batch(config, batchfile, format, shaperspace,
+                              shapersize, cubesize, jobs, verbose);
+        }
+        catch(OCIO::Exception & exception)
+        {
+            std::cerr << "OCIO Error: " << exception.what() << std::endl;
+            return 1;
+        }
+    }
+
     if(outputfile.empty() && !usestdout)
     {
         std::cerr << "\nERROR: You must specify the outputfile or --stdout.\n\n";
@@ -382,7 +638,8 @@ int main (int argc, const char* argv[])
             }
             else
             {
-                std::ofstream f(outputfile.c_str());
+                // Write the bytes as-is, some of the formats are binary.
+                std::ofstream f(outputfile.c_str(), std::ios_base::out | std::ios_base::binary);
                 if(f.fail())
                 {
                     std::cerr << "ERROR: Non-writable file path " << outputfile << " specified." << std::endl;
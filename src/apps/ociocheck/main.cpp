@@ -1,12 +1,17 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <fstream>
 #include <set>
+#include <sstream>
+#include <thread>
 #include <vector>
-#include <algorithm>
 
 #include <OpenColorIO/OpenColorIO.h>
 namespace OCIO = OCIO_NAMESPACE;
@@ -25,7 +30,10 @@ const char * DESC_STRING = "\n\n"
 "All display/view pairs, color spaces, and named transforms are checked,\n"
 "regardless of whether they are active or inactive.\n\n"
 "Ociocheck can also be used to clean up formatting on an existing profile\n"
-"that has been manually edited, using the '-o' option.\n";
+"that has been manually edited, using the '-o' option.\n\n"
+"The transforms are loaded concurrently (refer to the '--jobs' option). The\n"
+"'--timings' option reports the time to build and to apply each of them, and\n"
+"lists the most expensive ones.\n";
 
 
 // returns true if the interopID is valid
@@ -104,10 +112,150 @@ bool isValidInteropID(const std::string& id)
     return true;
 }
 
+// Result of the loading of a transform.
+struct CheckResult
+{
+    bool ok = true;
+    std::string errorText;
+    double buildTime = 0.0; // In milliseconds.
+    double applyTime = 0.0; // In milliseconds.
+};
+
+typedef std::function<OCIO::ConstProcessorRcPtr()> ProcessorGetter;
+
+// Load all the transforms to check (i.e. build their processors which loads any LUTs) using
+// a pool of threads. As the file cache is shared, each LUT is only read once whatever the
+// number of transforms using it.
+class TransformChecker
+{
+public:
+    // Queue a transform to check and return the index of its result.
+    size_t add(const ProcessorGetter & getter)
+    {
+        m_getters.push_back(getter);
+        return m_getters.size() - 1;
+    }
+
+    const CheckResult & result(size_t idx) const { return m_results[idx]; }
+
+    // When measuring the timings, the CPU processors are also created and applied to an image.
+    void run(int numThreads, bool measureTimings)
+    {
+        m_results.assign(m_getters.size(), CheckResult());
+
+        std::atomic<size_t> nextIdx(0);
+        auto worker = [this, &nextIdx, measureTimings]()
+        {
+            for (size_t idx = nextIdx++; idx < m_getters.size(); idx = nextIdx++)
+            {
+                check(idx, measureTimings);
+            }
+        };
+
+        const size_t numWorkers = std::min(m_getters.size(), static_cast<size_t>(numThreads));
+
+        std::vector<std::thread> threads;
+        for (size_t idx = 1; idx < numWorkers; ++idx)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();
+
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    static double elapsedTime(const Clock::time_point & start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void check(size_t idx, bool measureTimings)
+    {
+        CheckResult & result = m_results[idx];
+        try
+        {
+            const Clock::time_point start = Clock::now();
+
+            OCIO::ConstProcessorRcPtr processor = m_getters[idx]();
+            if (processor && measureTimings)
+            {
+                OCIO::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
+                result.buildTime = elapsedTime(start);
+
+                // Apply the processor on a ramp.
+                static constexpr long width  = 256;
+                static constexpr long height = 256;
+
+                std::vector<float> img(width * height * 4);
+                for (size_t pxl = 0; pxl < img.size(); ++pxl)
+                {
+                    img[pxl] = static_cast<float>(pxl % 1021) / 1020.0f;
+                }
+
+                const Clock::time_point applyStart = Clock::now();
+                OCIO::PackedImageDesc desc(&img[0], width, height, 4);
+                cpuProcessor->apply(desc);
+                result.applyTime = elapsedTime(applyStart);
+            }
+        }
+        catch(OCIO::Exception & exception)
+        {
+            result.ok = false;
+            result.errorText = exception.what();
+        }
+    }
+
+    std::vector<ProcessorGetter> m_getters;
+    std::vector<CheckResult> m_results;
+};
+
+// Timings of an item (e.g. a color space) of the config.
+struct ItemTimings
+{
+    std::string label;
+    double buildTime;
+    double applyTime;
+};
+
+// Format the timings of an item having one or two transforms and record them.
+std::string FormatTimings(bool measureTimings,
+                          const std::string & label,
+                          const CheckResult & result1,
+                          const CheckResult * result2,
+                          std::vector<ItemTimings> & timings)
+{
+    if (!measureTimings)
+    {
+        return "";
+    }
+
+    ItemTimings item{ label, result1.buildTime, result1.applyTime };
+    if (result2)
+    {
+        item.buildTime += result2->buildTime;
+        item.applyTime += result2->applyTime;
+    }
+    timings.push_back(item);
+
+    std::ostringstream oss;
+    oss.precision(3);
+    oss << std::fixed << "  (build: " << item.buildTime << " ms, apply: " 
+        << item.applyTime << " ms)";
+    return oss.str();
+}
+
 int main(int argc, const char **argv)
 {
     bool help = false;
+    bool measureTimings = false;
     int errorcount = 0;
+    int jobs = 0;
     std::string inputconfig;
     std::string outputconfig;
 
@@ -117,6 +265,8 @@ int main(int argc, const char **argv)
                "--help", &help, "Print help message",
                "--iconfig %s", &inputconfig, "Input .ocio configuration file (default: $OCIO)",
                "--oconfig %s", &outputconfig, "Output .ocio file",
+               "--jobs %d", &jobs, "Number of transforms loaded concurrently (default: number of cores)",
+               "--timings", &measureTimings, "Report the time to build and to apply each transform",
                NULL);
 
     if (ap.parse(argc, argv) < 0)
@@ -172,6 +322,129 @@ int main(int argc, const char **argv)
         OCIO::ConfigRcPtr config = srcConfig->createEditableCopy();
         config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
 
+        // It's important that the getProcessor call below always loads the transforms
+        // involved in each display/view pair.  However, if the src color space is a
+        // data space or if the view's colorspace happens to be the same as the src
+        // color space, it will effectively bypass the loading of the transform.
+        // The work-around used here is to create a copy of the config and add a unique
+        // src color space that will definitely allow the Processor to be created.
+
+        OCIO::ConfigRcPtr displayTestConfig = config->createEditableCopy();
+        auto testCS = OCIO::ColorSpace::Create(OCIO::REFERENCE_SPACE_SCENE);
+        const std::string srcColorSpace = "ocioCheckTotallyUniqueColorSpaceName";
+        testCS->setName(srcColorSpace.c_str());
+        auto ff = OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_ACES_GLOW_10);
+        testCS->setTransform(ff, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+        displayTestConfig->addColorSpace(testCS);
+
+        // Queue all the transforms to load so they are loaded concurrently, the results are
+        // then reported in the config order.
+
+        TransformChecker checker;
+
+        auto addTransform = [&checker, &config](OCIO::ConstTransformRcPtr t)
+        {
+            return checker.add([config, t]()
+            {
+                return t ? config->getProcessor(t) : OCIO::ConstProcessorRcPtr();
+            });
+        };
+
+        struct DisplayViewCheck
+        {
+            std::string display;
+            std::string view;
+            size_t idx;
+        };
+        std::vector<DisplayViewCheck> displayViewChecks;
+
+        if (config->getNumColorSpaces() > 0)
+        {
+            // Iterate over all displays & views (active & inactive), shared views first.
+            for (int idxDisp = 0; idxDisp < config->getNumDisplaysAll(); ++idxDisp)
+            {
+                const std::string displayName = config->getDisplayAll(idxDisp);
+
+                for (auto type : { OCIO::VIEW_SHARED, OCIO::VIEW_DISPLAY_DEFINED })
+                {
+                    const int numViews = config->getNumViews(type, displayName.c_str());
+                    for (int idxView = 0; idxView < numViews; ++idxView)
+                    {
+                        const std::string viewName
+                            = config->getView(type, displayName.c_str(), idxView);
+
+                        const size_t idx = checker.add(
+                            [displayTestConfig, srcColorSpace, displayName, viewName]()
+                            {
+                                return displayTestConfig->getProcessor(srcColorSpace.c_str(),
+                                                                       displayName.c_str(),
+                                                                       viewName.c_str(),
+                                                                       OCIO::TRANSFORM_DIR_FORWARD);
+                            });
+
+                        displayViewChecks.push_back({ displayName, viewName, idx });
+                    }
+                }
+            }
+        }
+
+        const int numCS = config->getNumColorSpaces(
+            OCIO::SEARCH_REFERENCE_SPACE_ALL,   // Iterate over scene & display color spaces.
+            OCIO::COLORSPACE_ALL);              // Iterate over active & inactive color spaces.
+
+        std::vector<size_t> colorSpaceChecks;
+        for(int i=0; i<numCS; ++i)
+        {
+            OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace(config->getColorSpaceNameByIndex(
+                OCIO::SEARCH_REFERENCE_SPACE_ALL,
+                OCIO::COLORSPACE_ALL,
+                i));
+
+            // Load the transforms for the to_ref & from_ref directions -- this will load any
+            // LUTs.
+            colorSpaceChecks.push_back(
+                addTransform(cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE)));
+            colorSpaceChecks.push_back(
+                addTransform(cs->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE)));
+        }
+
+        // Iterate over active & inactive named transforms.
+        const int numNT = config->getNumNamedTransforms(OCIO::NAMEDTRANSFORM_ALL);
+
+        std::vector<size_t> namedTransformChecks;
+        for(int i = 0; i<numNT; ++i)
+        {
+            OCIO::ConstNamedTransformRcPtr nt = config->getNamedTransform(
+                config->getNamedTransformNameByIndex(OCIO::NAMEDTRANSFORM_ALL, i));
+
+            // Load the transform & the inverse transform -- this will load any LUTs.
+            namedTransformChecks.push_back(
+                addTransform(nt->getTransform(OCIO::TRANSFORM_DIR_FORWARD)));
+            namedTransformChecks.push_back(
+                addTransform(nt->getTransform(OCIO::TRANSFORM_DIR_INVERSE)));
+        }
+
+        const int numL = config->getNumLooks();
+
+        std::vector<size_t> lookChecks;
+        for(int i=0; i<numL; ++i)
+        {
+            OCIO::ConstLookRcPtr look = config->getLook(config->getLookNameByIndex(i));
+
+            // Load the transform & the inverse transform -- this will load any LUTs.
+            lookChecks.push_back(addTransform(look->getTransform()));
+            lookChecks.push_back(addTransform(look->getInverseTransform()));
+        }
+
+        if (jobs <= 0)
+        {
+            jobs = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+
+        checker.run(jobs, measureTimings);
+
+        std::vector<ItemTimings> timings;
+
         std::cout << std::endl;
         std::cout << "** General **" << std::endl;
 
@@ -213,79 +486,25 @@ int main(int argc, const char **argv)
             std::cout << "Default Display: " << config->getDefaultDisplay() << std::endl;
             std::cout << "Default View: " << config->getDefaultView(config->getDefaultDisplay()) << std::endl;
 
-            // It's important that the getProcessor call below always loads the transforms
-            // involved in each display/view pair.  However, if the src color space is a
-            // data space or if the view's colorspace happens to be the same as the src
-            // color space, it will effectively bypass the loading of the transform.
-            // The work-around used here is to create a copy of the config and add a unique
-            // src color space that will definitely allow the Processor to be created.
-
-            OCIO::ConfigRcPtr displayTestConfig = config->createEditableCopy();
-            auto cs = OCIO::ColorSpace::Create(OCIO::REFERENCE_SPACE_SCENE);
-            const std::string srcColorSpace = "ocioCheckTotallyUniqueColorSpaceName";
-            cs->setName(srcColorSpace.c_str());
-            auto ff = OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_ACES_GLOW_10);
-            cs->setTransform(ff, OCIO::COLORSPACE_DIR_TO_REFERENCE);
-            displayTestConfig->addColorSpace(cs);
-
             if (config->getNumColorSpaces() > 0)
             {
                 std::cout << std::endl;
                 std::cout << "** (Display, View) pairs **" << std::endl;
 
-                // Iterate over all displays & views (active & inactive).
-
-                for (int idxDisp = 0; idxDisp < config->getNumDisplaysAll(); ++idxDisp)
+                for (const auto & check : displayViewChecks)
                 {
-                    const char * displayName = config->getDisplayAll(idxDisp);
-
-                    // Iterate over shared views.
-                    int numViews = config->getNumViews(OCIO::VIEW_SHARED, displayName);
-                    for (int idxView = 0; idxView < numViews; ++idxView)
+                    const CheckResult & result = checker.result(check.idx);
+                    if (result.ok)
                     {
-                        const char * viewName = config->getView(OCIO::VIEW_SHARED, 
-                                                                displayName, 
-                                                                idxView);
-                        try
-                        {
-                            OCIO::ConstProcessorRcPtr process 
-                                = displayTestConfig->getProcessor(srcColorSpace.c_str(), 
-                                                                  displayName,
-                                                                  viewName,
-                                                                  OCIO::TRANSFORM_DIR_FORWARD);
-
-                            std::cout << "(" << displayName << ", " << viewName << ")"
-                                      << std::endl;
-                        }
-                        catch(OCIO::Exception & exception)
-                        {
-                            std::cout << "ERROR: " << exception.what() << std::endl;
-                            errorcount += 1;
-                        }
+                        const std::string label = "(" + check.display + ", " + check.view + ")";
+                        std::cout << label
+                                  << FormatTimings(measureTimings, label, result, nullptr, timings)
+                                  << std::endl;
                     }
-
-                    // Iterate over display-defined views.
-                    numViews = config->getNumViews(OCIO::VIEW_DISPLAY_DEFINED, displayName);
-                    for (int idxView = 0; idxView < numViews; ++idxView)
+                    else
                     {
-                        const char * viewName = config->getView(OCIO::VIEW_DISPLAY_DEFINED, 
-                                                                displayName, idxView);
-                        try
-                        {
-                            OCIO::ConstProcessorRcPtr process 
-                                = displayTestConfig->getProcessor(srcColorSpace.c_str(), 
-                                                                  displayName,
-                                                                  viewName,
-                                                                  OCIO::TRANSFORM_DIR_FORWARD);
-
-                            std::cout << "(" << displayName << ", " << viewName << ")"
-                                      << std::endl;
-                        }
-                        catch(OCIO::Exception & exception)
-                        {
-                            std::cout << "ERROR: " << exception.what() << std::endl;
-                            errorcount += 1;
-                        }
+                        std::cout << "ERROR: " << result.errorText << std::endl;
+                        errorcount += 1;
                     }
                 }
             }
@@ -365,10 +584,6 @@ int main(int argc, const char **argv)
             std::cout << std::endl;
             std::cout << "** ColorSpaces **" << std::endl;
 
-            const int numCS = config->getNumColorSpaces(
-                OCIO::SEARCH_REFERENCE_SPACE_ALL,   // Iterate over scene & display color spaces.
-                OCIO::COLORSPACE_ALL);              // Iterate over active & inactive color spaces.
-
             for(int i=0; i<numCS; ++i)
             {
                 OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace(config->getColorSpaceNameByIndex(
@@ -385,59 +600,32 @@ int main(int argc, const char **argv)
                     }
                 }
 
-                // Try to load the transform for the to_ref direction -- this will load any LUTs.
-                bool toRefOK = true;
-                std::string toRefErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    toRefOK = false;
-                    toRefErrorText = exception.what();
-                }
+                const CheckResult & toRef   = checker.result(colorSpaceChecks[2 * i]);
+                const CheckResult & fromRef = checker.result(colorSpaceChecks[2 * i + 1]);
 
-                // Try to load the transform for the from_ref direction -- this will load any LUTs.
-                bool fromRefOK = true;
-                std::string fromRefErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = cs->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    fromRefOK = false;
-                    fromRefErrorText = exception.what();
-                }
-
-                if(!toRefOK || !fromRefOK)
+                if(!toRef.ok || !fromRef.ok)
                 {
                     // There was a problem with one of the color space's transforms.
                     std::cout << cs->getName();
                     std::cout << " -- error" << std::endl;
-                    if(!toRefOK)
+                    if(!toRef.ok)
                     {
-                        std::cout << "\t" << toRefErrorText << std::endl;
+                        std::cout << "\t" << toRef.errorText << std::endl;
                     }
-                    if(!fromRefOK)
+                    if(!fromRef.ok)
                     {
-                        std::cout << "\t" << fromRefErrorText << std::endl;
+                        std::cout << "\t" << fromRef.errorText << std::endl;
                     }
                     errorcount += 1;
                 }
                 else
                 {
                     // The color space's transforms load ok.
-                    std::cout << cs->getName() << std::endl;
+                    std::cout << cs->getName()
+                              << FormatTimings(measureTimings, 
+                                               std::string("ColorSpace: ") + cs->getName(),
+                                               toRef, &fromRef, timings)
+                              << std::endl;
                 }
             }
         }
@@ -446,8 +634,6 @@ int main(int argc, const char **argv)
             std::cout << std::endl;
             std::cout << "** Named Transforms **" << std::endl;
 
-            // Iterate over active & inactive named transforms.
-            const int numNT = config->getNumNamedTransforms(OCIO::NAMEDTRANSFORM_ALL);
             if(numNT==0)
             {
                 std::cout << "no named transforms defined" << std::endl;
@@ -458,59 +644,32 @@ int main(int argc, const char **argv)
                 OCIO::ConstNamedTransformRcPtr nt = config->getNamedTransform(
                     config->getNamedTransformNameByIndex(OCIO::NAMEDTRANSFORM_ALL, i));
 
-                // Try to load the transform -- this will load any LUTs.
-                bool fwdOK = true;
-                std::string fwdErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = nt->getTransform(OCIO::TRANSFORM_DIR_FORWARD);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    fwdOK = false;
-                    fwdErrorText = exception.what();
-                }
-
-                // Try to load the inverse_transform -- this will load any LUTs.
-                bool invOK = true;
-                std::string invErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = nt->getTransform(OCIO::TRANSFORM_DIR_INVERSE);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    invOK = false;
-                    invErrorText = exception.what();
-                }
+                const CheckResult & fwd = checker.result(namedTransformChecks[2 * i]);
+                const CheckResult & inv = checker.result(namedTransformChecks[2 * i + 1]);
 
-                if(!fwdOK || !invOK)
+                if(!fwd.ok || !inv.ok)
                 {
                     // There was a problem with one of the named transform's transforms.
                     std::cout << nt->getName();
                     std::cout << " -- error" << std::endl;
-                    if(!fwdOK)
+                    if(!fwd.ok)
                     {
-                        std::cout << "\t" << fwdErrorText << std::endl;
+                        std::cout << "\t" << fwd.errorText << std::endl;
                     }
-                    if(!invOK)
+                    if(!inv.ok)
                     {
-                        std::cout << "\t" << invErrorText << std::endl;
+                        std::cout << "\t" << inv.errorText << std::endl;
                     }
                     errorcount += 1;
                 }
                 else
                 {
                     // The named transform's transforms load ok.
-                    std::cout << nt->getName() << std::endl;
+                    std::cout << nt->getName()
+                              << FormatTimings(measureTimings, 
+                                               std::string("NamedTransform: ") + nt->getName(),
+                                               fwd, &inv, timings)
+                              << std::endl;
                 }
             }
         }
@@ -519,7 +678,6 @@ int main(int argc, const char **argv)
             std::cout << std::endl;
             std::cout << "** Looks **" << std::endl;
 
-            const int numL = config->getNumLooks();
             if(numL==0)
             {
                 std::cout << "no looks defined" << std::endl;
@@ -529,63 +687,60 @@ int main(int argc, const char **argv)
             {
                 OCIO::ConstLookRcPtr look = config->getLook(config->getLookNameByIndex(i)); 
 
-                // Try to load the transform -- this will load any LUTs.
-                bool fwdOK = true;
-                std::string fwdErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = look->getTransform();
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    fwdOK = false;
-                    fwdErrorText = exception.what();
-                }
-
-                // Try to load the inverse transform -- this will load any LUTs.
-                bool invOK = true;
-                std::string invErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = look->getInverseTransform();
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    invOK = false;
-                    invErrorText = exception.what();
-                }
+                const CheckResult & fwd = checker.result(lookChecks[2 * i]);
+                const CheckResult & inv = checker.result(lookChecks[2 * i + 1]);
 
-                if(!fwdOK || !invOK)
+                if(!fwd.ok || !inv.ok)
                 {
                     // There was a problem with one of the look transform's transforms.
                     std::cout << look->getName();
                     std::cout << " -- error" << std::endl;
-                    if(!fwdOK)
+                    if(!fwd.ok)
                     {
-                        std::cout << "\t" << fwdErrorText << std::endl;
+                        std::cout << "\t" << fwd.errorText << std::endl;
                     }
-                    if(!invOK)
+                    if(!inv.ok)
                     {
-                        std::cout << "\t" << invErrorText << std::endl;
+                        std::cout << "\t" << inv.errorText << std::endl;
                     }
                     errorcount += 1;
                 }
                 else
                 {
                     // The look transform's transforms load ok.
-                    std::cout << look->getName() << std::endl;
+                    std::cout << look->getName()
+                              << FormatTimings(measureTimings, 
+                                               std::string("Look: ") + look->getName(),
+                                               fwd, &inv, timings)
+                              << std::endl;
                 }
             }
         }
 
+        if (measureTimings)
+        {
+            std::cout << std::endl;
+            std::cout << "** Timings **" << std::endl;
+
+            // List the most expensive items to build & apply.
+            static constexpr size_t maxItems = 10;
+            std::sort(timings.begin(), timings.end(),
+                      [](const ItemTimings & a, const ItemTimings & b)
+                      {
+                          return a.buildTime + a.applyTime > b.buildTime + b.applyTime;
+                      });
+
+            const size_t numItems = std::min(timings.size(), maxItems);
+            for (size_t idx = 0; idx < numItems; ++idx)
+            {
+                std::ostringstream oss;
+                oss.precision(3);
+                oss << std::fixed << timings[idx].label << "  (build: " << timings[idx].buildTime
+                    << " ms, apply: " << timings[idx].applyTime << " ms)";
+                std::cout << oss.str() << std::endl;
+            }
+        }
+
         std::cout << std::endl;
         std::cout << "** Validation **" << std::endl;
 
@@ -10,6 +10,7 @@
 #include <chrono>
 #include <cmath>
 #include <limits>
+#include <sstream>
 #include <iostream>
 
 
@@ -175,8 +176,9 @@ int main(int argc, const char **argv)
     std::string transformFile;
     std::string inColorSpace, outColorSpace, display, view;
     std::string inBitDepthStr("f32"), outBitDepthStr("f32");
+    std::string optimizationStr("default");
     unsigned iterations = 50;
-    bool nocache = false, nooptim = false;
+    bool nocache = false, nooptim = false, gpuops = false;
 
     bool useColorspaces = false;
     bool useDisplayview = false;
@@ -218,6 +220,12 @@ int main(int argc, const char **argv)
                                             "Bypass all caches. Default is false",
                "--nooptim",                 &nooptim, 
                                             "Disable the processor optimizations. Default is false",
+               "--optimization %s",         &optimizationStr,
+                                            "Provide the optimization level (i.e. lossless, verygood, good, draft). "\
+                                            "Default is the library default. Use 'good' or 'draft' with --nocache "\
+                                            "to measure the 3D LUT composition",
+               "--gpuops",                  &gpuops,
+                                            "Measure the GPU shader generation of each individual transform. Default is false",
                NULL);
 
     if (ap.parse (argc, argv) < 0)
@@ -420,8 +428,36 @@ int main(int argc, const char **argv)
             throw OCIO::Exception("Missing color transformation description.");
         }
 
+        auto GetOptimizationFromString = [](const std::string & str) -> OCIO::OptimizationFlags
+        {
+            if (str == "default")
+            {
+                return OCIO::OPTIMIZATION_DEFAULT;
+            }
+            else if (str == "lossless")
+            {
+                return OCIO::OPTIMIZATION_LOSSLESS;
+            }
+            else if (str == "verygood")
+            {
+                return OCIO::OPTIMIZATION_VERY_GOOD;
+            }
+            else if (str == "good")
+            {
+                return OCIO::OPTIMIZATION_GOOD;
+            }
+            else if (str == "draft")
+            {
+                return OCIO::OPTIMIZATION_DRAFT;
+            }
+
+            std::string err("Unsupported optimization level: ");
+            err += str;
+            throw OCIO::Exception(err.c_str());
+        };
+
         const OCIO::OptimizationFlags optimFlags
-            = nooptim ? OCIO::OPTIMIZATION_NONE : OCIO::OPTIMIZATION_DEFAULT;
+            = nooptim ? OCIO::OPTIMIZATION_NONE : GetOptimizationFromString(optimizationStr);
 
         auto GetBitDepthFromString = [](const std::string & str) -> OCIO::BitDepth 
         {
@@ -495,6 +531,46 @@ int main(int argc, const char **argv)
             }
         }
 
+        if (gpuops)
+        {
+            // Measure the GPU shader generation of each transform from the optimized processor
+            // to highlight the expensive ones. The shader cache is always bypassed as the goal
+            // is to measure the shader program generation itself.
+
+            OCIO::ConfigRcPtr rawConfig = OCIO::Config::CreateRaw()->createEditableCopy();
+            rawConfig->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+            OCIO::GroupTransformRcPtr group = optProcessor->createGroupTransform();
+            for (int idx = 0; idx < group->getNumTransforms(); ++idx)
+            {
+                OCIO::ConstTransformRcPtr transform = group->getTransform(idx);
+
+                // Extract the transform type name from its serialization e.g. "<MatrixTransform ...>".
+                std::ostringstream oss;
+                oss << *transform;
+                std::string name = oss.str();
+                name = name.substr(1, name.find_first_of(" >") - 1);
+
+                OCIO::ConstGPUProcessorRcPtr gpu
+                    = rawConfig->getProcessor(transform)->getOptimizedGPUProcessor(optimFlags);
+
+                std::ostringstream label;
+                label << "  GPU shader of op " << idx << " (" << name << "):\t";
+
+                CustomMeasure m(label.str().c_str(), iterations);
+
+                for(unsigned iter=0; iter<iterations; ++iter)
+                {
+                    shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+                    shaderDesc->setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_2);
+
+                    m.resume();
+                    gpu->extractGpuShaderInfo(shaderDesc);
+                    m.pause();
+                }
+            }
+        }
+
         // Get the CPU processor.
         OCIO::ConstCPUProcessorRcPtr cpuProcessor;
 
@@ -18,6 +18,47 @@ void ImageDesc_dispose(JNIEnv * env, jobject self)
     DisposeJOCIO<ImageDescJNI>(env, self);
 }
 
+long BitDepth_bytes(BitDepth bitDepth)
+{
+    switch(bitDepth)
+    {
+        case BIT_DEPTH_UINT8:  return 1;
+        case BIT_DEPTH_UINT10:
+        case BIT_DEPTH_UINT12:
+        case BIT_DEPTH_UINT16:
+        case BIT_DEPTH_F16:    return 2;
+        case BIT_DEPTH_F32:    return 4;
+        default:
+            throw Exception("Unsupported bit-depth for a ByteBuffer image.");
+    }
+}
+
+void PackedImageDesc_createFromBytes(JNIEnv * env, jobject self, jobject data,
+    jlong width, jlong height, jlong numChannels, jobject bitDepth,
+    jlong chanStrideBytes, jlong xStrideBytes, jlong yStrideBytes)
+{
+    const BitDepth bd = GetJEnum<BitDepth>(env, bitDepth);
+    const long chanBytes = BitDepth_bytes(bd);
+    if(chanStrideBytes <= 0) chanStrideBytes = chanBytes;
+    if(xStrideBytes <= 0) xStrideBytes = chanStrideBytes * numChannels;
+    if(yStrideBytes <= 0) yStrideBytes = xStrideBytes * width;
+
+    // The image aliases the direct buffer memory, so no pixel is copied in
+    // either direction.
+    void* _data = GetJDirectBuffer(env, data, yStrideBytes * height);
+    ImageDescJNI * jnistruct = new ImageDescJNI();
+    jnistruct->back_ptr = env->NewGlobalRef(self);
+    jnistruct->constcppobj = new ConstImageDescRcPtr();
+    jnistruct->cppobj = new ImageDescRcPtr();
+    *jnistruct->cppobj = ImageDescRcPtr(new PackedImageDesc(_data, (long)width,
+        (long)height, (long)numChannels, bd, (ptrdiff_t)chanStrideBytes,
+        (ptrdiff_t)xStrideBytes, (ptrdiff_t)yStrideBytes), &ImageDesc_deleter);
+    jnistruct->isconst = false;
+    jclass wclass = env->GetObjectClass(self);
+    jfieldID fid = env->GetFieldID(wclass, "m_impl", "J");
+    env->SetLongField(self, fid, (jlong)jnistruct);
+}
+
 }; // end anon namespace
 
 // PackedImageDesc
@@ -64,6 +105,29 @@ Java_org_OpenColorIO_PackedImageDesc_create__Ljava_nio_FloatBuffer_2JJJJJJ(JNIEn
     OCIO_JNITRY_EXIT()
 }
 
+JNIEXPORT void JNICALL
+Java_org_OpenColorIO_PackedImageDesc_create__Ljava_nio_ByteBuffer_2JJJLorg_OpenColorIO_BitDepth_2(
+    JNIEnv * env, jobject self, jobject data, jlong width, jlong height,
+    jlong numChannels, jobject bitDepth)
+{
+    OCIO_JNITRY_ENTER()
+    PackedImageDesc_createFromBytes(env, self, data, width, height, numChannels,
+        bitDepth, 0, 0, 0);
+    OCIO_JNITRY_EXIT()
+}
+
+JNIEXPORT void JNICALL
+Java_org_OpenColorIO_PackedImageDesc_create__Ljava_nio_ByteBuffer_2JJJLorg_OpenColorIO_BitDepth_2JJJ(
+    JNIEnv * env, jobject self, jobject data, jlong width, jlong height,
+    jlong numChannels, jobject bitDepth, jlong chanStrideBytes,
+    jlong xStrideBytes, jlong yStrideBytes)
+{
+    OCIO_JNITRY_ENTER()
+    PackedImageDesc_createFromBytes(env, self, data, width, height, numChannels,
+        bitDepth, chanStrideBytes, xStrideBytes, yStrideBytes);
+    OCIO_JNITRY_EXIT()
+}
+
 JNIEXPORT void JNICALL
 Java_org_OpenColorIO_PackedImageDesc_dispose(JNIEnv * env, jobject self)
 {
@@ -83,6 +147,26 @@ Java_org_OpenColorIO_PackedImageDesc_getData(JNIEnv * env, jobject self)
     OCIO_JNITRY_EXIT(NULL)
 }
 
+JNIEXPORT jobject JNICALL
+Java_org_OpenColorIO_PackedImageDesc_getByteData(JNIEnv * env, jobject self)
+{
+    OCIO_JNITRY_ENTER()
+    ConstImageDescRcPtr img = GetConstJOCIO<ConstImageDescRcPtr, ImageDescJNI>(env, self);
+    ConstPackedImageDescRcPtr ptr = DynamicPtrCast<const PackedImageDesc>(img);
+    jlong size = (jlong)ptr->getYStrideBytes() * ptr->getHeight();
+    return env->NewDirectByteBuffer(ptr->getData(), size);
+    OCIO_JNITRY_EXIT(NULL)
+}
+
+JNIEXPORT jobject JNICALL
+Java_org_OpenColorIO_PackedImageDesc_getBitDepth(JNIEnv * env, jobject self)
+{
+    OCIO_JNITRY_ENTER()
+    ConstImageDescRcPtr img = GetConstJOCIO<ConstImageDescRcPtr, ImageDescJNI>(env, self);
+    return BuildJEnum(env, "org/OpenColorIO/BitDepth", img->getBitDepth());
+    OCIO_JNITRY_EXIT(NULL)
+}
+
 JNIEXPORT jlong JNICALL
 Java_org_OpenColorIO_PackedImageDesc_getWidth(JNIEnv * env, jobject self)
 {
@@ -1,8 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <exception>
 #include <string>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include "OpenColorIO/OpenColorIO.h"
@@ -10,6 +13,72 @@
 #include "JNIUtil.h"
 using namespace OCIO_NAMESPACE;
 
+namespace
+{
+
+// Build an image covering rows [y, y+numRows) of img that aliases its memory.
+ImageDescRcPtr ImageDesc_band(const ImageDesc & img, long y, long numRows)
+{
+    const ptrdiff_t offset = (ptrdiff_t)y * img.getYStrideBytes();
+    if(const PackedImageDesc * packed = dynamic_cast<const PackedImageDesc *>(&img))
+    {
+        return ImageDescRcPtr(new PackedImageDesc(
+            (char *)packed->getData() + offset, packed->getWidth(), numRows,
+            packed->getChannelOrder(), packed->getBitDepth(),
+            packed->getChanStrideBytes(), packed->getXStrideBytes(),
+            packed->getYStrideBytes()));
+    }
+    char * a = (char *)img.getAData();
+    return ImageDescRcPtr(new PlanarImageDesc(
+        (char *)img.getRData() + offset, (char *)img.getGData() + offset,
+        (char *)img.getBData() + offset, a ? a + offset : nullptr,
+        img.getWidth(), numRows, img.getBitDepth(),
+        img.getXStrideBytes(), img.getYStrideBytes()));
+}
+
+void Processor_applyParallel(ConstCPUProcessorRcPtr cpu, const ImageDesc & img,
+                             int numThreads)
+{
+    const long height = img.getHeight();
+    if(numThreads <= 0) numThreads = (int)std::thread::hardware_concurrency();
+    numThreads = (int)std::max(1L, std::min((long)numThreads, height));
+
+    if(numThreads == 1)
+    {
+        cpu->apply(img);
+        return;
+    }
+
+    const long rowsPerBand = (height + numThreads - 1) / numThreads;
+
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(numThreads);
+    for(int t = 0; t < numThreads; ++t)
+    {
+        const long y = t * rowsPerBand;
+        const long numRows = std::min(rowsPerBand, height - y);
+        if(numRows <= 0) break;
+        workers.emplace_back([&cpu, &img, &errors, t, y, numRows]()
+        {
+            try
+            {
+                cpu->apply(*ImageDesc_band(img, y, numRows));
+            }
+            catch(...)
+            {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    for(auto & w : workers) w.join();
+    for(auto & e : errors)
+    {
+        if(e) std::rethrow_exception(e);
+    }
+}
+
+}; // end anon namespace
+
 JNIEXPORT jobject JNICALL
 Java_org_OpenColorIO_Processor_Create(JNIEnv * env, jobject self) {
     OCIO_JNITRY_ENTER()
@@ -44,6 +113,17 @@ Java_org_OpenColorIO_Processor_apply(JNIEnv * env, jobject self, jobject img) {
     OCIO_JNITRY_EXIT()
 }
 
+JNIEXPORT void JNICALL
+Java_org_OpenColorIO_Processor_applyParallel(JNIEnv * env, jobject self, jobject img,
+                                             jint numThreads) {
+    OCIO_JNITRY_ENTER()
+    ConstProcessorRcPtr ptr = GetConstJOCIO<ConstProcessorRcPtr, ProcessorJNI>(env, self);
+    ImageDescRcPtr _img = GetEditableJOCIO<ImageDescRcPtr, ImageDescJNI>(env, img);
+    // The worker threads only touch native memory, the JNIEnv stays on this thread.
+    Processor_applyParallel(ptr->getDefaultCPUProcessor(), *_img.get(), (int)numThreads);
+    OCIO_JNITRY_EXIT()
+}
+
 JNIEXPORT void JNICALL
 Java_org_OpenColorIO_Processor_applyRGB(JNIEnv * env, jobject self, jfloatArray pixel) {
     OCIO_JNITRY_ENTER()
@@ -35,6 +35,26 @@ float* GetJFloatBuffer(JNIEnv * env, jobject buffer, int32_t len) {
     return (float*)env->GetDirectBufferAddress(buffer);
 }
 
+void* GetJDirectBuffer(JNIEnv * env, jobject buffer, int64_t minBytes) {
+    // Unlike GetJFloatBuffer the buffer may be larger than needed, so that a
+    // single direct allocation can be reused across frames of varying size.
+    void* ptr = env->GetDirectBufferAddress(buffer);
+    if(!ptr) {
+        std::ostringstream err;
+        err << "the ByteBuffer object is not 'direct' it needs to be created ";
+        err << "from a ByteBuffer.allocateDirect(..) call.";
+        throw Exception(err.str().c_str());
+    }
+    if(env->GetDirectBufferCapacity(buffer) < minBytes) {
+        std::ostringstream err;
+        err << "the ByteBuffer object is too small, it needs to be at least ";
+        err << minBytes << " bytes but is ";
+        err << env->GetDirectBufferCapacity(buffer) << ".";
+        throw Exception(err.str().c_str());
+    }
+    return ptr;
+}
+
 const char* GetOCIOTClass(ConstTransformRcPtr tran) {
     if(ConstAllocationTransformRcPtr at = DynamicPtrCast<const AllocationTransform>(tran))
         return "org/OpenColorIO/AllocationTransform";
@@ -244,6 +244,7 @@ private:
 
 jobject NewJFloatBuffer(JNIEnv * env, float* ptr, int32_t len);
 float* GetJFloatBuffer(JNIEnv * env, jobject buffer, int32_t len);
+void* GetJDirectBuffer(JNIEnv * env, jobject buffer, int64_t minBytes);
 const char* GetOCIOTClass(ConstTransformRcPtr tran);
 void JNI_Handle_Exception(JNIEnv * env);
 
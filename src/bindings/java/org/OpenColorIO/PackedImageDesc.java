@@ -3,6 +3,7 @@
 
 package org.OpenColorIO;
 import org.OpenColorIO.*;
+import java.nio.ByteBuffer;
 import java.nio.FloatBuffer;
 
 public class PackedImageDesc extends ImageDesc
@@ -18,13 +19,37 @@ public class PackedImageDesc extends ImageDesc
         super();
         create(data, width, height, numChannels, chanStrideBytes, xStrideBytes, yStrideBytes);
     }
+    // The ByteBuffer must be direct; the image aliases its memory so no pixel
+    // data is copied. A stride of 0 means that it is computed from the
+    // bit-depth, the number of channels and the width.
+    public PackedImageDesc(ByteBuffer data, long width, long height, long numChannels,
+                           BitDepth bitDepth)
+    {
+        super();
+        create(data, width, height, numChannels, bitDepth);
+    }
+    public PackedImageDesc(ByteBuffer data, long width, long height, long numChannels,
+                           BitDepth bitDepth, long chanStrideBytes, long xStrideBytes,
+                           long yStrideBytes)
+    {
+        super();
+        create(data, width, height, numChannels, bitDepth,
+               chanStrideBytes, xStrideBytes, yStrideBytes);
+    }
     protected PackedImageDesc(long impl) { super(impl); }
     protected native void create(FloatBuffer data, long width, long height, long numChannels);
     protected native void create(FloatBuffer data, long width, long height, long numChannels,
                                  long chanStrideBytes, long xStrideBytes, long yStrideBytes);
+    protected native void create(ByteBuffer data, long width, long height, long numChannels,
+                                 BitDepth bitDepth);
+    protected native void create(ByteBuffer data, long width, long height, long numChannels,
+                                 BitDepth bitDepth, long chanStrideBytes, long xStrideBytes,
+                                 long yStrideBytes);
     public native void dispose();
     protected void finalize() { dispose(); }
     public native FloatBuffer getData();
+    public native ByteBuffer getByteData();
+    public native BitDepth getBitDepth();
     public native long getWidth();
     public native long getHeight();
     public native long getNumChannels();
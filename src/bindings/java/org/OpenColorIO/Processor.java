@@ -15,6 +15,9 @@ public class Processor extends LoadLibrary
     public native boolean isNoOp();
     public native boolean hasChannelCrosstalk();
     public native void apply(ImageDesc img);
+    // Split the image into bands of rows processed concurrently. A numThreads
+    // of 0 uses the number of hardware threads.
+    public native void applyParallel(ImageDesc img, int numThreads);
     public native void applyRGB(float[] pixel);
     public native void applyRGBA(float[] pixel);
     public native String getCpuCacheID();
@@ -279,7 +279,11 @@ void bindPyGpuShaderDesc(py::module & m)
                                  { self.m_height * self.m_width * numChannels },
                                  { sizeof(float) }, 
                                  values);
-            }, DOC(GpuShaderDesc, getTextureValues));
+            }, DOC(GpuShaderDesc, getTextureValues))
+        .def("getCacheID", [](Texture & self)
+            {
+                return self.m_shaderDesc->getTextureCacheID(self.m_index);
+            }, DOC(GpuShaderDesc, getTextureCacheID));
 
     clsTextureIterator
         .def("__len__", [](TextureIterator & it) 
@@ -340,7 +344,11 @@ void bindPyGpuShaderDesc(py::module & m)
                                  { self.m_edgelen * self.m_edgelen * self.m_edgelen * 3 },
                                  { sizeof(float) }, 
                                  values);
-            }, DOC(GpuShaderDesc, get3DTextureValues));
+            }, DOC(GpuShaderDesc, get3DTextureValues))
+        .def("getCacheID", [](Texture3D & self)
+            {
+                return self.m_shaderDesc->get3DTextureCacheID(self.m_index);
+            }, DOC(GpuShaderDesc, get3DTextureCacheID));
 
     clsTexture3DIterator
         .def("__len__", [](Texture3DIterator & it) 
@@ -40,6 +40,12 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+    m.def("ClearChangedFileCaches", &ClearChangedFileCaches,
+          DOC(PyOpenColorIO, ClearChangedFileCaches));
+    m.def("IsFileCacheValidationEnabled", &IsFileCacheValidationEnabled,
+          DOC(PyOpenColorIO, IsFileCacheValidationEnabled));
+    m.def("SetFileCacheValidation", &SetFileCacheValidation, "enable"_a,
+          DOC(PyOpenColorIO, SetFileCacheValidation));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
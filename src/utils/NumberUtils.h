@@ -15,9 +15,17 @@
 // correctly and the check starts passing with gcc 11, clang 12,
 // msvc 2019 (16.4). It correctly does not pass on apple clang 15,
 // since it does not implement from_chars for floats.
+//
+// Note that the feature test macro is defined by the library headers
+// so <charconv> must be included before the check, otherwise the slow
+// strtod_l() path is silently used depending on the previous includes.
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
 #if __cpp_lib_to_chars >= 201611L
 #define USE_CHARCONV_FROM_CHARS
-#include <charconv>
 #endif
 
 #if defined(_MSC_VER)
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "AsyncRequest.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+OCIO::ConstConfigRcPtr CreateConfig()
+{
+    constexpr const char * CONFIG{ R"(ocio_profile_version: 2
+
+search_path: .
+
+roles:
+  default: raw
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: raw}
+
+displays:
+  sRGB:
+    - !<View> {name: Gamma, colorspace: srgb}
+    - !<View> {name: Missing, colorspace: missing}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+
+  - !<ColorSpace>
+    name: srgb
+    from_scene_reference: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1], direction: inverse}
+
+  - !<ColorSpace>
+    name: missing
+    from_scene_reference: !<FileTransform> {src: missing_file.spi1d}
+)" };
+
+    std::istringstream is(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    return config;
+}
+
+// Queue the tasks instead of running them, and restore the default executor on exit.
+class ManualExecutor
+{
+public:
+    ManualExecutor()
+    {
+        OCIO::SetAsyncExecutor([this](const std::function<void()> & task)
+        {
+            m_tasks.push_back(task);
+        });
+    }
+
+    ~ManualExecutor()
+    {
+        OCIO::ResetToDefaultAsyncExecutor();
+    }
+
+    size_t getNumTasks() const { return m_tasks.size(); }
+
+    void runAll()
+    {
+        std::vector<std::function<void()>> tasks;
+        tasks.swap(m_tasks);
+        for (auto & task : tasks)
+        {
+            task();
+        }
+    }
+
+private:
+    std::vector<std::function<void()>> m_tasks;
+};
+
+} // anon.
+
+OCIO_ADD_TEST(AsyncRequest, default_executor)
+{
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    OCIO::ProcessorRequestRcPtr request;
+    OCIO_CHECK_NO_THROW(request = OCIO::Config::GetProcessorAsync(
+        config, context, "raw", "sRGB", "Gamma", OCIO::TRANSFORM_DIR_FORWARD,
+        [](const OCIO::ConstProcessorRcPtr & processor, const char * error)
+        {
+            OCIO_CHECK_ASSERT(processor);
+            OCIO_CHECK_ASSERT(!error);
+        }));
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = request->get());
+    OCIO_REQUIRE_ASSERT(processor);
+    OCIO_CHECK_ASSERT(request->isReady());
+    OCIO_CHECK_ASSERT(!request->isCanceled());
+
+    // The processor is now in the cache of the config.
+    OCIO_CHECK_EQUAL(processor.get(),
+                     config->getProcessor("raw", "sRGB", "Gamma",
+                                          OCIO::TRANSFORM_DIR_FORWARD).get());
+
+    // A cached processor makes the request immediately ready, and the callback is called from
+    // the calling thread.
+    int numSyncCalls = 0;
+    OCIO_CHECK_NO_THROW(request = OCIO::Config::GetProcessorAsync(
+        config, context, "raw", "sRGB", "Gamma", OCIO::TRANSFORM_DIR_FORWARD,
+        [&numSyncCalls](const OCIO::ConstProcessorRcPtr &, const char *) { ++numSyncCalls; }));
+    OCIO_CHECK_ASSERT(request->isReady());
+    OCIO_CHECK_EQUAL(numSyncCalls, 1);
+    OCIO_CHECK_EQUAL(request->get().get(), processor.get());
+
+    // The CPU processor.
+    OCIO::CPUProcessorRequestRcPtr cpuRequest;
+    OCIO_CHECK_NO_THROW(cpuRequest = OCIO::Processor::GetOptimizedCPUProcessorAsync(
+        processor, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, OCIO::OPTIMIZATION_DEFAULT));
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = cpuRequest->get());
+    OCIO_CHECK_EQUAL(cpuProcessor.get(), processor->getDefaultCPUProcessor().get());
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Config::GetProcessorAsync(config, context, OCIO::ConstTransformRcPtr(),
+                                                          OCIO::TRANSFORM_DIR_FORWARD),
+                          OCIO::Exception, "Transform is null");
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::GetOptimizedCPUProcessorAsync(
+                              OCIO::ConstProcessorRcPtr(), OCIO::BIT_DEPTH_F32,
+                              OCIO::BIT_DEPTH_F32, OCIO::OPTIMIZATION_DEFAULT),
+                          OCIO::Exception, "Processor is null");
+}
+
+OCIO_ADD_TEST(AsyncRequest, custom_executor_and_cancel)
+{
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    ManualExecutor executor;
+
+    int numCalls = 0;
+    std::string lastError;
+    auto callback = [&numCalls, &lastError](const OCIO::ConstProcessorRcPtr &, const char * error)
+    {
+        ++numCalls;
+        lastError = error ? error : "";
+    };
+
+    OCIO::ProcessorRequestRcPtr canceled = OCIO::Config::GetProcessorAsync(
+        config, context, "raw", "sRGB", "Gamma", OCIO::TRANSFORM_DIR_FORWARD, callback);
+    OCIO::ProcessorRequestRcPtr request = OCIO::Config::GetProcessorAsync(
+        config, context, "raw", "sRGB", "Gamma", OCIO::TRANSFORM_DIR_INVERSE, callback);
+    OCIO::ProcessorRequestRcPtr failing = OCIO::Config::GetProcessorAsync(
+        config, context, "raw", "sRGB", "Missing", OCIO::TRANSFORM_DIR_FORWARD, callback);
+
+    OCIO_CHECK_EQUAL(executor.getNumTasks(), 3);
+    OCIO_CHECK_ASSERT(!request->isReady());
+    OCIO_CHECK_ASSERT(!request->waitFor(1));
+
+    // A canceled request is immediately ready.
+    canceled->cancel();
+    OCIO_CHECK_ASSERT(canceled->isReady());
+    OCIO_CHECK_ASSERT(canceled->isCanceled());
+    OCIO_CHECK_THROW_WHAT(canceled->get(), OCIO::Exception, "was canceled");
+
+    executor.runAll();
+
+    // No callback for the canceled request.
+    OCIO_CHECK_EQUAL(numCalls, 2);
+    OCIO_CHECK_NE(lastError.find("missing_file.spi1d"), std::string::npos);
+
+    OCIO_CHECK_ASSERT(request->isReady());
+    OCIO_CHECK_ASSERT(request->get());
+    // Cancel has no effect once ready.
+    request->cancel();
+    OCIO_CHECK_ASSERT(!request->isCanceled());
+
+    OCIO_CHECK_ASSERT(failing->isReady());
+    OCIO_CHECK_THROW_WHAT(failing->get(), OCIO::Exception, "missing_file.spi1d");
+
+    // The canceled processor was not built so it is not in the cache.
+    OCIO_CHECK_ASSERT(!OCIO::Config::GetProcessorAsync(config, context, "raw", "sRGB", "Gamma",
+                                                       OCIO::TRANSFORM_DIR_FORWARD)->isReady());
+    OCIO_CHECK_EQUAL(executor.getNumTasks(), 1);
+}
+
+OCIO_ADD_TEST(AsyncRequest, shared_build)
+{
+    OCIO::ConstConfigRcPtr config = CreateConfig();
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    // Concurrent synchronous and asynchronous requests get the same processor.
+    constexpr size_t numThreads = 4;
+    std::vector<OCIO::ConstProcessorRcPtr> processors(numThreads);
+    std::vector<OCIO::ProcessorRequestRcPtr> requests(numThreads);
+    std::vector<std::thread> threads;
+    for (size_t idx = 0; idx < numThreads; ++idx)
+    {
+        threads.emplace_back([&, idx]()
+        {
+            requests[idx] = OCIO::Config::GetProcessorAsync(config, context, "raw", "sRGB",
+                                                            "Gamma", OCIO::TRANSFORM_DIR_FORWARD);
+            processors[idx] = config->getProcessor(context, "raw", "sRGB", "Gamma",
+                                                   OCIO::TRANSFORM_DIR_FORWARD);
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t idx = 0; idx < numThreads; ++idx)
+    {
+        OCIO_CHECK_EQUAL(processors[idx].get(), processors[0].get());
+        OCIO_CHECK_EQUAL(requests[idx]->get().get(), processors[0].get());
+    }
+
+    // Concurrent failing builds all report the error.
+    threads.clear();
+    std::atomic<int> numErrors{ 0 };
+    for (size_t idx = 0; idx < numThreads; ++idx)
+    {
+        threads.emplace_back([&]()
+        {
+            try
+            {
+                config->getProcessor(context, "raw", "sRGB", "Missing",
+                                     OCIO::TRANSFORM_DIR_FORWARD);
+            }
+            catch (const OCIO::Exception &)
+            {
+                ++numErrors;
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    OCIO_CHECK_EQUAL(numErrors, int(numThreads));
+}
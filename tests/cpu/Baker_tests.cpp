@@ -5,6 +5,7 @@
 #include "Baker.cpp"
 
 #include "testutils/UnitTest.h"
+#include "ops/lut3d/Lut3DOp.h"
 #include "ParseUtils.h"
 #include "UnitTestUtils.h"
 #include "utils/StringUtils.h"
@@ -164,7 +165,7 @@ OCIO_ADD_TEST(Baker, bake_3dlut)
             }
         }
 
-        OCIO_CHECK_EQUAL(12, bake->getNumFormats());
+        OCIO_CHECK_EQUAL(15, bake->getNumFormats());
         OCIO_CHECK_EQUAL("cinespace", std::string(bake->getFormatNameByIndex(4)));
         OCIO_CHECK_EQUAL("3dl", std::string(bake->getFormatExtensionByIndex(1)));
     }
@@ -578,3 +579,33 @@ OCIO_ADD_TEST(Baker, baking_validation)
     OCIO_CHECK_THROW_WHAT(bake->bake(os), OCIO::Exception,
         "Could not find target colorspace 'Log2NT'.");
 }
+
+OCIO_ADD_TEST(Baker, apply_parallel)
+{
+    // The lattice of large LUTs is processed using several threads, the result must be
+    // identical to a single apply() call.
+
+    OCIO::ExponentWithLinearTransformRcPtr transform = OCIO::ExponentWithLinearTransform::Create();
+    transform->setGamma({ 2.4, 2.2, 2.0, 1.0 });
+    transform->setOffset({ 0.055, 0.099, 0.1, 0.0 });
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::ConstCPUProcessorRcPtr proc
+        = config->getProcessor(transform)->getDefaultCPUProcessor();
+
+    for (const int size : { 2, 33, 65 })
+    {
+        const long numPixels = size * size * size;
+
+        std::vector<float> expected(numPixels * 3);
+        OCIO::GenerateIdentityLut3D(expected.data(), size, 3, OCIO::LUT3DORDER_FAST_BLUE);
+        std::vector<float> values(expected);
+
+        OCIO::PackedImageDesc img(expected.data(), numPixels, 1, 3);
+        proc->apply(img);
+
+        OCIO::ApplyParallel(proc, values.data(), numPixels);
+
+        OCIO_CHECK_ASSERT(values == expected);
+    }
+}
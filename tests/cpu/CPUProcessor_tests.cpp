@@ -4,11 +4,17 @@
 
 #include "CPUProcessor.cpp"
 
+#include <cmath>
+#include <cstring>
+
+#include "ops/log/LogOp.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
+#include "ops/range/RangeOp.h"
 #include "ScanlineHelper.h"
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
+#include "utils/StringUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -2908,3 +2914,722 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
                                                                __LINE__);
     }
 }
+
+namespace
+{
+
+template<OCIO::BitDepth inBD>
+std::vector<typename OCIO::BitDepthInfo<inBD>::Type> BuildCastInput()
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+
+    std::vector<InType> values;
+
+    if (OCIO::BitDepthInfo<inBD>::isFloat)
+    {
+        // All the half values, which include Inf & NaN.
+        for (unsigned bits = 0; bits < 0x10000; ++bits)
+        {
+            half h;
+            h.setBits(static_cast<unsigned short>(bits));
+            values.push_back(InType(float(h)));
+        }
+
+        // The values around the rounding thresholds of the integer bit-depths.
+        for (const float maxValue : { 255.0f, 1023.0f, 4095.0f, 65535.0f })
+        {
+            for (float v = 0.0f; v <= maxValue; v += std::max(1.0f, maxValue / 1000.0f))
+            {
+                const float threshold = (v + 0.5f) / maxValue;
+                values.push_back(InType(threshold));
+                values.push_back(InType(std::nextafter(threshold, 0.0f)));
+                values.push_back(InType(std::nextafter(threshold, 2.0f)));
+            }
+        }
+    }
+    else
+    {
+        for (unsigned v = 0; v <= OCIO::BitDepthInfo<inBD>::maxValue; ++v)
+        {
+            values.push_back(InType(v));
+        }
+    }
+
+    // Use a pixel count that also exercises the leftover pixels of the vectorized code.
+    while (values.size() % 4 != 0 || (values.size() / 4) % 16 != 7)
+    {
+        values.push_back(InType(0));
+    }
+
+    return values;
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidateBitDepthCast(unsigned lineNo)
+{
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    const auto in = BuildCastInput<inBD>();
+    const long numPixels = long(in.size() / 4);
+
+    // Scalar reference.
+    const float scale = float(OCIO::BitDepthInfo<outBD>::maxValue)
+                        / float(OCIO::BitDepthInfo<inBD>::maxValue);
+
+    std::vector<OutType> ref(in.size());
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        ref[idx] = OCIO::Converter<outBD>::CastValue(in[idx] * scale);
+    }
+
+    // The cast uses the vectorized code when the CPU supports it.
+    OCIO::ConstOpCPURcPtr op = OCIO::CreateGenericBitDepthHelper(inBD, outBD);
+
+    std::vector<OutType> out(in.size());
+    op->apply(in.data(), out.data(), numPixels);
+
+    OCIO_CHECK_EQUAL_FROM(std::memcmp(out.data(), ref.data(), out.size() * sizeof(OutType)), 0,
+                          lineNo);
+}
+
+template<OCIO::BitDepth inBD>
+void ValidateBitDepthCasts(unsigned lineNo)
+{
+    ValidateBitDepthCast<inBD, OCIO::BIT_DEPTH_UINT8>(lineNo);
+    ValidateBitDepthCast<inBD, OCIO::BIT_DEPTH_UINT10>(lineNo);
+    ValidateBitDepthCast<inBD, OCIO::BIT_DEPTH_UINT12>(lineNo);
+    ValidateBitDepthCast<inBD, OCIO::BIT_DEPTH_UINT16>(lineNo);
+    ValidateBitDepthCast<inBD, OCIO::BIT_DEPTH_F16>(lineNo);
+    ValidateBitDepthCast<inBD, OCIO::BIT_DEPTH_F32>(lineNo);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, bit_depth_cast)
+{
+    // The vectorized bit-depth casts must be bit-exact with the scalar code.
+
+    ValidateBitDepthCasts<OCIO::BIT_DEPTH_UINT8>(__LINE__);
+    ValidateBitDepthCasts<OCIO::BIT_DEPTH_UINT10>(__LINE__);
+    ValidateBitDepthCasts<OCIO::BIT_DEPTH_UINT12>(__LINE__);
+    ValidateBitDepthCasts<OCIO::BIT_DEPTH_UINT16>(__LINE__);
+    ValidateBitDepthCasts<OCIO::BIT_DEPTH_F16>(__LINE__);
+    ValidateBitDepthCasts<OCIO::BIT_DEPTH_F32>(__LINE__);
+}
+
+namespace
+{
+
+void ValidatePackedRGB(OCIO::ConstGroupTransformRcPtr group, int lineNo)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW_FROM(proc = config->getProcessor(group), lineNo);
+
+    for (const auto oFlags : { OCIO::OPTIMIZATION_NONE, OCIO::OPTIMIZATION_DEFAULT })
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW_FROM(cpu = proc->getOptimizedCPUProcessor(oFlags), lineNo);
+
+        // Odd sizes, with some padding at the end of the RGB lines.
+        constexpr long width  = 37;
+        constexpr long height = 5;
+        constexpr long lineFloats = 3 * width + 2;
+
+        std::vector<float> rgba(4 * width * height);
+        std::vector<float> rgb(lineFloats * height, -1.0f);
+        for (long y = 0; y < height; ++y)
+        {
+            for (long x = 0; x < width; ++x)
+            {
+                const long pix = y * width + x;
+                for (long c = 0; c < 3; ++c)
+                {
+                    const float v = float((pix * 3 + c) % 41) / 30.0f - 0.2f;
+                    rgba[4 * pix + c] = v;
+                    rgb[y * lineFloats + 3 * x + c] = v;
+                }
+                // A missing alpha is processed as 0.
+                rgba[4 * pix + 3] = 0.0f;
+            }
+        }
+
+        OCIO::PackedImageDesc rgbaDesc(&rgba[0], width, height, 4);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(rgbaDesc), lineNo);
+
+        // In place.
+        std::vector<float> inPlace(rgb);
+        OCIO::PackedImageDesc inPlaceDesc(&inPlace[0], width, height,
+                                          OCIO::CHANNEL_ORDERING_RGB, OCIO::BIT_DEPTH_F32,
+                                          OCIO::AutoStride, OCIO::AutoStride,
+                                          lineFloats * sizeof(float));
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(inPlaceDesc), lineNo);
+
+        // From a source to a destination image, the destination without padding.
+        std::vector<float> dst(3 * width * height, -1.0f);
+        OCIO::PackedImageDesc srcDesc(&rgb[0], width, height,
+                                      OCIO::CHANNEL_ORDERING_RGB, OCIO::BIT_DEPTH_F32,
+                                      OCIO::AutoStride, OCIO::AutoStride,
+                                      lineFloats * sizeof(float));
+        OCIO::PackedImageDesc dstDesc(&dst[0], width, height, 3);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(srcDesc, dstDesc), lineNo);
+
+        for (long y = 0; y < height; ++y)
+        {
+            for (long x = 0; x < width; ++x)
+            {
+                const long pix = y * width + x;
+                for (long c = 0; c < 3; ++c)
+                {
+                    OCIO_CHECK_EQUAL_FROM(inPlace[y * lineFloats + 3 * x + c],
+                                          rgba[4 * pix + c], lineNo);
+                    OCIO_CHECK_EQUAL_FROM(dst[3 * pix + c], rgba[4 * pix + c], lineNo);
+                }
+            }
+            // The padding is untouched.
+            OCIO_CHECK_EQUAL_FROM(inPlace[y * lineFloats + 3 * width], -1.0f, lineNo);
+        }
+    }
+}
+
+}
+
+OCIO_ADD_TEST(CPUProcessor, packed_rgb)
+{
+    // The packed RGB 32-bit float images are processed without the RGBA buffer when all the ops
+    // allow it, the results must be identical to the RGBA processing with a zero alpha.
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 1.1, 0.2, 0.3, 0.4,
+                             0.1, 0.9, 0.1, 0.5,
+                             0.0, 0.2, 1.2, 0.6,
+                             0.0, 0.0, 0.0, 1.0 };
+    const double offset[4] = { 0.01, -0.02, 0.03, 0.0 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(-0.1);
+    range->setMaxInValue(1.5);
+    range->setMinOutValue(0.0);
+    range->setMaxOutValue(1.0);
+
+    OCIO::Lut3DTransformRcPtr lut3d = OCIO::Lut3DTransform::Create(5);
+    for (unsigned long r = 0; r < 5; ++r)
+    {
+        for (unsigned long g = 0; g < 5; ++g)
+        {
+            for (unsigned long b = 0; b < 5; ++b)
+            {
+                lut3d->setValue(r, g, b, std::sqrt(r / 4.0f), g * g / 16.0f, (b + r) / 8.0f);
+            }
+        }
+    }
+
+    OCIO::Lut1DTransformRcPtr lut1d = OCIO::Lut1DTransform::Create(17, false);
+    for (unsigned long idx = 0; idx < 17; ++idx)
+    {
+        const float v = std::pow(idx / 16.0f, 2.2f);
+        lut1d->setValue(idx, v, v * 0.9f, v * 1.1f);
+    }
+
+    // Only ops having a packed RGB processing.
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(lut1d);
+        group->appendTransform(matrix);
+        group->appendTransform(range);
+        group->appendTransform(lut3d);
+        ValidatePackedRGB(group, __LINE__);
+    }
+
+    // Scales with and without offsets.
+    for (const bool withOffset : { false, true })
+    {
+        OCIO::MatrixTransformRcPtr scale = OCIO::MatrixTransform::Create();
+        const double s4[4] = { 2.0, 0.5, 1.5, 1.0 };
+        double m[16];
+        double o[4];
+        OCIO::MatrixTransform::Scale(m, o, s4);
+        scale->setMatrix(m);
+        scale->setOffset(withOffset ? offset : o);
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(scale);
+        ValidatePackedRGB(group, __LINE__);
+    }
+
+    // A range without scaling.
+    {
+        OCIO::RangeTransformRcPtr clamp = OCIO::RangeTransform::Create();
+        clamp->setMinInValue(0.1);
+        clamp->setMinOutValue(0.1);
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(clamp);
+        ValidatePackedRGB(group, __LINE__);
+    }
+
+    // An op without the packed RGB processing falls back to the RGBA buffer.
+    {
+        OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+        const double e[4] = { 2.2, 2.0, 1.8, 1.0 };
+        exponent->setValue(e);
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(exponent);
+        group->appendTransform(lut3d);
+        ValidatePackedRGB(group, __LINE__);
+    }
+}
+
+namespace
+{
+
+void ValidatePlanarFloat(OCIO::ConstGroupTransformRcPtr group, int lineNo)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW_FROM(proc = config->getProcessor(group), lineNo);
+
+    for (const auto oFlags : { OCIO::OPTIMIZATION_NONE, OCIO::OPTIMIZATION_DEFAULT })
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW_FROM(cpu = proc->getOptimizedCPUProcessor(oFlags), lineNo);
+
+        for (const bool withAlpha : { false, true })
+        {
+            // Odd sizes, with some padding at the end of the plane lines.
+            constexpr long width  = 37;
+            constexpr long height = 5;
+            constexpr long lineFloats = width + 3;
+
+            std::vector<float> rgba(4 * width * height);
+            std::vector<std::vector<float>> planes(4, std::vector<float>(lineFloats * height, -1.0f));
+            for (long y = 0; y < height; ++y)
+            {
+                for (long x = 0; x < width; ++x)
+                {
+                    const long pix = y * width + x;
+                    for (long c = 0; c < 3; ++c)
+                    {
+                        const float v = float((pix * 3 + c) % 41) / 30.0f - 0.2f;
+                        rgba[4 * pix + c] = v;
+                        planes[c][y * lineFloats + x] = v;
+                    }
+                    // A missing alpha is processed as 0.
+                    rgba[4 * pix + 3] = withAlpha ? float(pix % 7) / 6.0f : 0.0f;
+                    planes[3][y * lineFloats + x] = rgba[4 * pix + 3];
+                }
+            }
+
+            OCIO::PackedImageDesc rgbaDesc(&rgba[0], width, height, 4);
+            OCIO_CHECK_NO_THROW_FROM(cpu->apply(rgbaDesc), lineNo);
+
+            // In place.
+            std::vector<std::vector<float>> inPlace(planes);
+            OCIO::PlanarImageDesc inPlaceDesc(&inPlace[0][0], &inPlace[1][0], &inPlace[2][0],
+                                              withAlpha ? &inPlace[3][0] : nullptr,
+                                              width, height, OCIO::BIT_DEPTH_F32,
+                                              OCIO::AutoStride, lineFloats * sizeof(float));
+            OCIO_CHECK_NO_THROW_FROM(cpu->apply(inPlaceDesc), lineNo);
+
+            // From a source to a destination image, the destination without padding but always
+            // with an alpha.
+            std::vector<std::vector<float>> dst(4, std::vector<float>(width * height, -1.0f));
+            OCIO::PlanarImageDesc srcDesc(&planes[0][0], &planes[1][0], &planes[2][0],
+                                          withAlpha ? &planes[3][0] : nullptr,
+                                          width, height, OCIO::BIT_DEPTH_F32,
+                                          OCIO::AutoStride, lineFloats * sizeof(float));
+            OCIO::PlanarImageDesc dstDesc(&dst[0][0], &dst[1][0], &dst[2][0], &dst[3][0],
+                                          width, height);
+            OCIO_CHECK_NO_THROW_FROM(cpu->apply(srcDesc, dstDesc), lineNo);
+
+            for (long y = 0; y < height; ++y)
+            {
+                for (long x = 0; x < width; ++x)
+                {
+                    const long pix = y * width + x;
+                    for (long c = 0; c < 4; ++c)
+                    {
+                        if (c < 3 || withAlpha)
+                        {
+                            OCIO_CHECK_EQUAL_FROM(inPlace[c][y * lineFloats + x],
+                                                  rgba[4 * pix + c], lineNo);
+                        }
+                        OCIO_CHECK_EQUAL_FROM(dst[c][pix], rgba[4 * pix + c], lineNo);
+                    }
+                }
+                // The padding is untouched.
+                OCIO_CHECK_EQUAL_FROM(inPlace[0][y * lineFloats + width], -1.0f, lineNo);
+            }
+        }
+    }
+}
+
+}
+
+OCIO_ADD_TEST(CPUProcessor, planar_float)
+{
+    // The planar 32-bit float images are processed directly on the planes when all the ops
+    // allow it, the results must be identical to the packed RGBA processing.
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 1.1, 0.2, 0.3, 0.4,
+                             0.1, 0.9, 0.1, 0.5,
+                             0.0, 0.2, 1.2, 0.6,
+                             0.0, 0.0, 0.1, 1.0 };
+    const double offset[4] = { 0.01, -0.02, 0.03, 0.04 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(-0.1);
+    range->setMaxInValue(1.5);
+    range->setMinOutValue(0.0);
+    range->setMaxOutValue(1.0);
+
+    OCIO::Lut1DTransformRcPtr lut1d = OCIO::Lut1DTransform::Create(17, false);
+    for (unsigned long idx = 0; idx < 17; ++idx)
+    {
+        const float v = std::pow(idx / 16.0f, 2.2f);
+        lut1d->setValue(idx, v, v * 0.9f, v * 1.1f);
+    }
+
+    // Matrices, ranges and 1D LUTs.
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(lut1d);
+        group->appendTransform(matrix);
+        group->appendTransform(range);
+        ValidatePlanarFloat(group, __LINE__);
+    }
+
+    // A half domain 1D LUT.
+    {
+        OCIO::Lut1DTransformRcPtr halfLut = OCIO::Lut1DTransform::Create(65536, true);
+        for (unsigned long idx = 0; idx < 65536; ++idx)
+        {
+            half h;
+            h.setBits(static_cast<unsigned short>(idx));
+            const float v = h;
+            const float s = std::isfinite(v) ? v * 0.5f + 0.1f : 0.0f;
+            halfLut->setValue(idx, s, s * s, -s);
+        }
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(halfLut);
+        ValidatePlanarFloat(group, __LINE__);
+    }
+
+    // Logarithms.
+    for (const auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+    {
+        OCIO::LogTransformRcPtr log10 = OCIO::LogTransform::Create();
+        log10->setBase(10.0);
+        log10->setDirection(dir);
+
+        OCIO::LogTransformRcPtr log2 = OCIO::LogTransform::Create();
+        log2->setBase(2.0);
+        log2->setDirection(dir);
+
+        OCIO::LogAffineTransformRcPtr logAffine = OCIO::LogAffineTransform::Create();
+        const double linSlope[3]  = { 1.2, 1.1, 0.9 };
+        const double linOffset[3] = { 0.1, 0.2, 0.05 };
+        const double logSlope[3]  = { 0.25, 0.3, 0.2 };
+        const double logOffset[3] = { 0.5, 0.4, 0.6 };
+        logAffine->setLinSideSlopeValue(linSlope);
+        logAffine->setLinSideOffsetValue(linOffset);
+        logAffine->setLogSideSlopeValue(logSlope);
+        logAffine->setLogSideOffsetValue(logOffset);
+        logAffine->setDirection(dir);
+
+        const double linBreak[3] = { 0.1, 0.2, 0.15 };
+        OCIO::LogCameraTransformRcPtr logCamera = OCIO::LogCameraTransform::Create(linBreak);
+        logCamera->setLinSideSlopeValue(linSlope);
+        logCamera->setLinSideOffsetValue(linOffset);
+        logCamera->setLogSideSlopeValue(logSlope);
+        logCamera->setLogSideOffsetValue(logOffset);
+        logCamera->setDirection(dir);
+
+        for (const OCIO::ConstTransformRcPtr & log : std::vector<OCIO::ConstTransformRcPtr>
+                { log10, log2, logAffine, logCamera })
+        {
+            OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+            group->appendTransform(range);
+            group->appendTransform(log->createEditableCopy());
+            ValidatePlanarFloat(group, __LINE__);
+        }
+    }
+
+    // Gammas.
+    for (const auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+    {
+        for (const auto style : { OCIO::NEGATIVE_CLAMP, OCIO::NEGATIVE_MIRROR,
+                                  OCIO::NEGATIVE_PASS_THRU })
+        {
+            OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+            const double e[4] = { 2.2, 2.0, 1.8, 1.5 };
+            exponent->setValue(e);
+            exponent->setNegativeStyle(style);
+            exponent->setDirection(dir);
+
+            OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+            group->appendTransform(exponent);
+            ValidatePlanarFloat(group, __LINE__);
+        }
+
+        for (const auto style : { OCIO::NEGATIVE_LINEAR, OCIO::NEGATIVE_MIRROR })
+        {
+            OCIO::ExponentWithLinearTransformRcPtr moncurve
+                = OCIO::ExponentWithLinearTransform::Create();
+            const double g[4] = { 2.4, 2.2, 2.0, 1.8 };
+            const double o[4] = { 0.055, 0.09, 0.1, 0.05 };
+            moncurve->setGamma(g);
+            moncurve->setOffset(o);
+            moncurve->setNegativeStyle(style);
+            moncurve->setDirection(dir);
+
+            OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+            group->appendTransform(moncurve);
+            ValidatePlanarFloat(group, __LINE__);
+        }
+    }
+
+    // CDLs.
+    for (const auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+    {
+        for (const auto style : { OCIO::CDL_ASC, OCIO::CDL_NO_CLAMP })
+        {
+            OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+            const double slope[3]  = { 1.1, 0.9, 1.2 };
+            const double offsetCDL[3] = { 0.05, -0.02, 0.01 };
+            const double power[3]  = { 1.2, 0.8, 1.1 };
+            cdl->setSlope(slope);
+            cdl->setOffset(offsetCDL);
+            cdl->setPower(power);
+            cdl->setSat(1.3);
+            cdl->setStyle(style);
+            cdl->setDirection(dir);
+
+            OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+            group->appendTransform(cdl);
+            ValidatePlanarFloat(group, __LINE__);
+        }
+    }
+
+    // An op without the planar processing falls back to the RGBA buffer.
+    {
+        OCIO::Lut3DTransformRcPtr lut3d = OCIO::Lut3DTransform::Create(5);
+        for (unsigned long r = 0; r < 5; ++r)
+        {
+            for (unsigned long g = 0; g < 5; ++g)
+            {
+                for (unsigned long b = 0; b < 5; ++b)
+                {
+                    lut3d->setValue(r, g, b, std::sqrt(r / 4.0f), g * g / 16.0f, (b + r) / 8.0f);
+                }
+            }
+        }
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(lut3d);
+        ValidatePlanarFloat(group, __LINE__);
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, fused_ops)
+{
+    // The common sequences of ops are processed by one fused renderer, the bit-depth casts
+    // staying outside of it.
+
+    OCIO::OpRcPtrVec ops;
+    const double m44[16] = { 1.1, 0.2, 0.3, 0.0,
+                             0.1, 0.9, 0.1, 0.0,
+                             0.0, 0.2, 1.2, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateLogOp(ops, 10., OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateRangeOp(ops, 0., 1., 0., 1., OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateRangeOp(ops, 0., 1., 0., 1., OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    const auto isFused = [](const OCIO::ConstOpCPURcPtr & op)
+    {
+        const OCIO::OpCPU & c = *op;
+        return StringUtils::Find(typeid(c).name(), "FusedRenderer") != std::string::npos;
+    };
+
+    {
+        OCIO::ConstOpCPURcPtr inOp, outOp;
+        OCIO::ConstOpCPURcPtrVec cpuOps;
+        OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                              OCIO::OPTIMIZATION_DEFAULT, inOp, cpuOps, outOp);
+
+#if OCIO_USE_SSE2
+        // Matrix -> Log and Range -> Matrix -> Range.
+        OCIO_CHECK_ASSERT(isFused(inOp));
+        OCIO_CHECK_EQUAL(cpuOps.size(), 0);
+        OCIO_CHECK_ASSERT(isFused(outOp));
+#else
+        OCIO_CHECK_EQUAL(cpuOps.size(), 3);
+#endif
+    }
+
+    {
+        OCIO::ConstOpCPURcPtr inOp, outOp;
+        OCIO::ConstOpCPURcPtrVec cpuOps;
+        OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT16,
+                              OCIO::OPTIMIZATION_DEFAULT, inOp, cpuOps, outOp);
+
+        OCIO_CHECK_ASSERT(!isFused(inOp));
+        OCIO_CHECK_ASSERT(!isFused(outOp));
+#if OCIO_USE_SSE2
+        OCIO_REQUIRE_EQUAL(cpuOps.size(), 2);
+        OCIO_CHECK_ASSERT(isFused(cpuOps[0]));
+        OCIO_CHECK_ASSERT(isFused(cpuOps[1]));
+#else
+        OCIO_CHECK_EQUAL(cpuOps.size(), 5);
+#endif
+    }
+
+    {
+        // Without the fast log, only the last three ops are fused.
+        OCIO::ConstOpCPURcPtr inOp, outOp;
+        OCIO::ConstOpCPURcPtrVec cpuOps;
+        OCIO::CreateCPUEngine(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                              OCIO::OPTIMIZATION_NONE, inOp, cpuOps, outOp);
+
+        OCIO_CHECK_ASSERT(!isFused(inOp));
+        OCIO_REQUIRE_EQUAL(cpuOps.size(), 1);
+        OCIO_CHECK_ASSERT(!isFused(cpuOps[0]));
+#if OCIO_USE_SSE2
+        OCIO_CHECK_ASSERT(isFused(outOp));
+#else
+        OCIO_CHECK_ASSERT(!isFused(outOp));
+#endif
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, apply_points)
+{
+    // The scattered points are processed by chunks, the results must be identical to the
+    // single pixel processing.
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 1.1, 0.2, 0.3, 0.4,
+                             0.1, 0.9, 0.1, 0.5,
+                             0.0, 0.2, 1.2, 0.6,
+                             0.0, 0.0, 0.1, 1.0 };
+    const double offset[4] = { 0.01, -0.02, 0.03, 0.04 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset);
+
+    OCIO::Lut1DTransformRcPtr lut1d = OCIO::Lut1DTransform::Create(17, false);
+    for (unsigned long idx = 0; idx < 17; ++idx)
+    {
+        const float v = std::pow(idx / 16.0f, 2.2f);
+        lut1d->setValue(idx, v, v * 0.9f, v * 1.1f);
+    }
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(matrix);
+    group->appendTransform(lut1d);
+    group->appendTransform(OCIO::ExponentTransform::Create());
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = proc->getDefaultCPUProcessor());
+
+    // A struct array with some padding between the points.
+    struct Point
+    {
+        int    m_id;
+        double m_rgba[4];
+        float  m_pad;
+    };
+
+    for (const long numPoints : { 1L, 5L, 256L, 600L })
+    {
+        std::vector<float> expectedRGB(3 * numPoints), expectedRGBA(4 * numPoints);
+        std::vector<Point> points(numPoints);
+        for (long idx = 0; idx < numPoints; ++idx)
+        {
+            for (long c = 0; c < 4; ++c)
+            {
+                const float v = float((idx * 4 + c) % 37) / 30.0f - 0.1f;
+                points[idx].m_rgba[c] = v;
+                expectedRGBA[4 * idx + c] = v;
+                if (c < 3) expectedRGB[3 * idx + c] = v;
+            }
+
+            OCIO_CHECK_NO_THROW(cpu->applyRGB(&expectedRGB[3 * idx]));
+            OCIO_CHECK_NO_THROW(cpu->applyRGBA(&expectedRGBA[4 * idx]));
+        }
+
+        // Packed float points, in place.
+        {
+            std::vector<float> rgb(3 * numPoints), rgba(4 * numPoints);
+            for (long idx = 0; idx < numPoints; ++idx)
+            {
+                for (long c = 0; c < 4; ++c)
+                {
+                    rgba[4 * idx + c] = float(points[idx].m_rgba[c]);
+                    if (c < 3) rgb[3 * idx + c] = float(points[idx].m_rgba[c]);
+                }
+            }
+
+            OCIO_CHECK_NO_THROW(cpu->applyPoints(rgb.data(), rgb.data(), numPoints, 3,
+                                                 OCIO::AutoStride, OCIO::AutoStride));
+            OCIO_CHECK_NO_THROW(cpu->applyPoints(rgba.data(), rgba.data(), numPoints, 4,
+                                                 OCIO::AutoStride, OCIO::AutoStride));
+
+            for (long idx = 0; idx < 3 * numPoints; ++idx)
+            {
+                OCIO_CHECK_CLOSE(rgb[idx], expectedRGB[idx], 1e-6f);
+            }
+            for (long idx = 0; idx < 4 * numPoints; ++idx)
+            {
+                OCIO_CHECK_CLOSE(rgba[idx], expectedRGBA[idx], 1e-6f);
+            }
+        }
+
+        // Strided double points, to a packed buffer.
+        for (const long numChannels : { 3L, 4L })
+        {
+            const std::vector<float> & expected = numChannels == 3 ? expectedRGB : expectedRGBA;
+
+            std::vector<double> out(numChannels * numPoints, -1.0);
+            OCIO_CHECK_NO_THROW(cpu->applyPoints(&points[0].m_rgba[0], out.data(), numPoints,
+                                                 numChannels, sizeof(Point), OCIO::AutoStride));
+
+            for (long idx = 0; idx < numChannels * numPoints; ++idx)
+            {
+                OCIO_CHECK_CLOSE(out[idx], expected[idx], 1e-6);
+            }
+        }
+    }
+
+    // Faulty parameters.
+    float rgba[4]{ 0.1f, 0.2f, 0.3f, 1.0f };
+    OCIO_CHECK_THROW_WHAT(cpu->applyPoints(rgba, rgba, 1, 2, OCIO::AutoStride, OCIO::AutoStride),
+                          OCIO::Exception, "only supports RGB and RGBA points");
+    OCIO_CHECK_THROW_WHAT(cpu->applyPoints(rgba, rgba, -1, 4, OCIO::AutoStride, OCIO::AutoStride),
+                          OCIO::Exception, "cannot be negative");
+    OCIO_CHECK_NO_THROW(cpu->applyPoints(rgba, rgba, 0, 4, OCIO::AutoStride, OCIO::AutoStride));
+
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                             OCIO::BIT_DEPTH_F32,
+                                                             OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_THROW_WHAT(cpu->applyPoints(rgba, rgba, 1, 4, OCIO::AutoStride, OCIO::AutoStride),
+                          OCIO::Exception, "needs 32-bit float input and output bit-depths");
+}
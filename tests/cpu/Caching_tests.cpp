@@ -2,6 +2,8 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <fstream>
+
 #include "Caching.cpp"
 
 #include "testutils/UnitTest.h"
@@ -244,4 +246,110 @@ OCIO_ADD_TEST(Caching, processor_cache)
             OCIO_CHECK_EQUAL(procA, procB); 
         }
     }
-}
\ No newline at end of file
+}
+namespace
+{
+
+void WriteLut(const std::string & filePath, const std::string & maxValue)
+{
+    std::ofstream ofs(filePath, std::ios_base::out | std::ios_base::trunc);
+    ofs << "Version 1\n"
+           "From 0.0 1.0\n"
+           "Length 2\n"
+           "Components 1\n"
+           "{\n"
+           "0.0\n"
+        << maxValue << "\n"
+           "}\n";
+}
+
+float ApplyLut(const OCIO::ConstConfigRcPtr & config, const std::string & filePath)
+{
+    OCIO::FileTransformRcPtr fileTransform = OCIO::FileTransform::Create();
+    fileTransform->setSrc(filePath.c_str());
+    fileTransform->setInterpolation(OCIO::INTERP_LINEAR);
+
+    float rgb[3] = { 1.0f, 1.0f, 1.0f };
+    config->getProcessor(fileTransform)->getDefaultCPUProcessor()->applyRGB(rgb);
+    return rgb[0];
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Caching, changed_files)
+{
+    // Check that only the cache entries depending on the changed files are invalidated.
+
+    const std::string directory = OCIO::CreateTemporaryDirectory("caching_changed_files");
+    const std::string filePathA = directory + "/a.spi1d";
+    const std::string filePathB = directory + "/b.spi1d";
+
+    WriteLut(filePathA, "0.5");
+    WriteLut(filePathB, "0.5");
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setSearchPath(directory.c_str());
+
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("lutA");
+    OCIO::FileTransformRcPtr fileTransform = OCIO::FileTransform::Create();
+    fileTransform->setSrc("a.spi1d");
+    cs->setTransform(fileTransform, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    config->addColorSpace(cs);
+
+    // Note that the 'raw' color space is a data color space.
+    cs = OCIO::ColorSpace::Create();
+    cs->setName("ref");
+    config->addColorSpace(cs);
+
+    OCIO_CHECK_EQUAL(ApplyLut(config, filePathA), 0.5f);
+    OCIO_CHECK_EQUAL(ApplyLut(config, filePathB), 0.5f);
+
+    OCIO::ConstProcessorRcPtr procA = config->getProcessor("lutA", "ref");
+    const std::string cacheID = config->getCacheID(config->getCurrentContext());
+
+    OCIO_CHECK_EQUAL(OCIO::ClearChangedFileCaches(), 0);
+
+    // The file change is not detected without a check.
+
+    WriteLut(filePathA, "0.25");
+
+    OCIO_CHECK_EQUAL(ApplyLut(config, filePathA), 0.5f);
+    OCIO_CHECK_EQUAL(procA.get(), config->getProcessor("lutA", "ref").get());
+
+    OCIO_CHECK_EQUAL(OCIO::ClearChangedFileCaches(), 1);
+
+    // Only the cache entries using the changed file are rebuilt.
+
+    OCIO_CHECK_EQUAL(ApplyLut(config, filePathA), 0.25f);
+    OCIO_CHECK_EQUAL(ApplyLut(config, filePathB), 0.5f);
+    OCIO_CHECK_NE(procA.get(), config->getProcessor("lutA", "ref").get());
+    OCIO_CHECK_NE(cacheID, std::string(config->getCacheID(config->getCurrentContext())));
+
+    // The processors already in use are not impacted.
+    float rgb[3] = { 1.0f, 1.0f, 1.0f };
+    procA->getDefaultCPUProcessor()->applyRGB(rgb);
+    OCIO_CHECK_EQUAL(rgb[0], 0.5f);
+
+    // With the file cache validation, the changes are detected for each cache access.
+
+    OCIO_CHECK_ASSERT(!OCIO::IsFileCacheValidationEnabled());
+    OCIO::SetFileCacheValidation(true);
+    OCIO_CHECK_ASSERT(OCIO::IsFileCacheValidationEnabled());
+
+    const std::string cacheID2 = config->getCacheID(config->getCurrentContext());
+    OCIO::ConstProcessorRcPtr procA2 = config->getProcessor("lutA", "ref");
+    OCIO_CHECK_EQUAL(procA2.get(), config->getProcessor("lutA", "ref").get());
+
+    WriteLut(filePathA, "0.125");
+    WriteLut(filePathB, "0.75");
+
+    OCIO_CHECK_EQUAL(ApplyLut(config, filePathA), 0.125f);
+    OCIO_CHECK_EQUAL(ApplyLut(config, filePathB), 0.75f);
+    OCIO_CHECK_NE(procA2.get(), config->getProcessor("lutA", "ref").get());
+    OCIO_CHECK_NE(cacheID2, std::string(config->getCacheID(config->getCurrentContext())));
+
+    OCIO::SetFileCacheValidation(false);
+
+    OCIO::RemoveTemporaryDirectory(directory);
+}
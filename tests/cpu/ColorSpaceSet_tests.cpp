@@ -314,3 +314,66 @@ OCIO_ADD_TEST(ColorSpaceSet, operations_on_set)
 
     OCIO_CHECK_EQUAL(css4->getNumColorSpaces(), 0);
 }
+
+OCIO_ADD_TEST(ColorSpaceSet, name_index)
+{
+    // The case-insensitive name & alias index has to follow the adds, replaces & removes.
+
+    OCIO::ColorSpaceSetRcPtr css = OCIO::ColorSpaceSet::Create();
+
+    for (int idx = 0; idx < 100; ++idx)
+    {
+        const std::string name = "cs" + std::to_string(idx);
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName(name.c_str());
+        cs->addAlias(("Alias_" + name).c_str());
+        OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    }
+    OCIO_REQUIRE_EQUAL(css->getNumColorSpaces(), 100);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("CS42"), 42);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias_cs42"), 42);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs100"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(""), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(nullptr), -1);
+
+    // Replace a color space with a different alias.
+    OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+    cs->setName("CS10");
+    cs->addAlias("new_alias");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), 100);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("new_alias"), 10);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias_cs10"), -1);
+    OCIO_CHECK_EQUAL(std::string(css->getColorSpace("cs10")->getName()), "CS10");
+
+    // The replaced alias is free again.
+    cs->setName("other");
+    cs->clearAliases();
+    cs->addAlias("alias_cs10");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias_cs10"), 100);
+
+    // Conflicts are still detected.
+    cs->setName("alias_cs20");
+    cs->clearAliases();
+    OCIO_CHECK_THROW_WHAT(css->addColorSpace(cs), OCIO::Exception,
+                          "existing color space, 'cs20' is using this name as an alias");
+
+    // An alias does not remove a color space and the positions are updated after a removal.
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("alias_cs0"));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), 101);
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("Cs0"));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), 100);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs0"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias_cs0"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs42"), 41);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("ALIAS_CS99"), 98);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("other"), 99);
+
+    // Copies have their own index.
+    OCIO::ColorSpaceSetRcPtr copy = css->createEditableCopy();
+    OCIO_CHECK_NO_THROW(css->clearColorSpaces());
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs42"), -1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("cs42"), 41);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias_cs10"), 99);
+}
@@ -2070,3 +2070,115 @@ OCIO_ADD_TEST(FileRules, isDefault)
     const auto config = OCIO::Config::CreateRaw();
     OCIO_CHECK_ASSERT(config->getFileRules()->isDefault());
 }
+
+OCIO_ADD_TEST(FileRules, glob_matcher)
+{
+    // The matcher must give the same results as the std::regex evaluation.
+
+    const std::vector<std::pair<std::string, std::string>> globs = {
+        { "*", "*" },
+        { "", "" },
+        { "*", "exr" },
+        { "*", "[eE][xX][r]" },
+        { "*ga?ma*", "*" },
+        { "*g[!a-d]mma*", "jp[gG]" },
+        { "g[!a-d][\\*][e-g]mma", "*" },
+        { "*[^]*", "?pg" },
+        { "*(name)*", "JPG" },
+        { "/mnt/*/shot_?" "?/*", "dpx" },
+        { "*.1.0v4*", "*" },
+    };
+
+    const std::vector<std::string> paths = {
+        "", ".", "a.exr", "a.EXR", "a.eXr", "/mnt/media/image.Jpg", "/mnt/me^ia/image.Jpg",
+        "/mnt/(name)/image.jpg", "/An/gamma/Path/MyFile.exr", "/An/gemma/Path/MyFile.jpg",
+        "ge*fmma.exr", "/mnt/show/shot_01/plate.0001.dpx", "/mnt/show/shot_1/plate.0001.dpx",
+        "/mnt/show/shot_01/plate.0001.DPX", "line\nfeed.exr", "ocio-images.1.0v4/file.exr",
+        "/An/gamma/Path\n/MyFile.exr", "noext", "a.b.c.d",
+    };
+
+    for (const auto & glob : globs)
+    {
+        const std::string exp = OCIO::BuildRegularExpression(glob.first.c_str(),
+                                                             glob.second.c_str());
+        OCIO::GlobMatcher matcher;
+        OCIO_REQUIRE_ASSERT(matcher.compile(exp));
+
+        const std::regex reg(exp);
+        for (const auto & path : paths)
+        {
+            OCIO_CHECK_EQUAL(matcher.matches(path.c_str()), std::regex_match(path, reg));
+        }
+    }
+
+    // Simple regular expressions are also supported.
+    {
+        OCIO::GlobMatcher matcher;
+        OCIO_REQUIRE_ASSERT(matcher.compile(R"(^.*[/\\]plates[/\\].*\.(exr)$)"));
+        OCIO_CHECK_ASSERT(matcher.matches("/mnt/show/plates/a.exr"));
+        OCIO_CHECK_ASSERT(matcher.matches("C:\\show\\plates\\a.exr"));
+        OCIO_CHECK_ASSERT(!matcher.matches("/mnt/show/plate/a.exr"));
+        OCIO_CHECK_ASSERT(!matcher.matches("/mnt/show/plates/a.exr.bak"));
+    }
+
+    // Unsupported expressions use std::regex.
+    for (const char * exp : { R"((.*)(\bmine\b|\byours\b)(.*))", "a+", "(ab)*", "a{2}", 
+                              ".*?", "[^]", "(?:a)" })
+    {
+        OCIO::GlobMatcher matcher;
+        OCIO_CHECK_ASSERT(!matcher.compile(exp));
+    }
+}
+
+OCIO_ADD_TEST(FileRules, rule_index_cache)
+{
+    // The memoized rule indices must follow the rule changes.
+
+    auto rules = OCIO::FileRules::Create();
+    OCIO_CHECK_NO_THROW(rules->insertRule(0, "exr", "raw", "*", "exr"));
+
+    auto config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    size_t ruleIndex = 0;
+    auto getRule = [&config, &rules, &ruleIndex](const char * path) -> std::string
+    {
+        config->setFileRules(rules);
+        return config->getColorSpaceFromFilepath(path, ruleIndex);
+    };
+
+    getRule("/mnt/a.exr");
+    OCIO_CHECK_EQUAL(ruleIndex, 0);
+    getRule("/mnt/a.exr");
+    OCIO_CHECK_EQUAL(ruleIndex, 0);
+
+    OCIO_CHECK_NO_THROW(rules->setExtension(0, "dpx"));
+    getRule("/mnt/a.exr");
+    OCIO_CHECK_EQUAL(ruleIndex, 1);
+
+    OCIO_CHECK_NO_THROW(rules->insertRule(0, "all", "raw", "/mnt/*", "*"));
+    getRule("/mnt/a.exr");
+    OCIO_CHECK_EQUAL(ruleIndex, 0);
+
+    OCIO_CHECK_NO_THROW(rules->decreaseRulePriority(0));
+    OCIO_CHECK_NO_THROW(rules->setExtension(1, "exr"));
+    getRule("/mnt/a.dpx");
+    OCIO_CHECK_EQUAL(ruleIndex, 0);
+    getRule("/mnt/a.exr");
+    OCIO_CHECK_EQUAL(ruleIndex, 1);
+
+    OCIO_CHECK_NO_THROW(rules->removeRule(0));
+    getRule("/mnt/a.dpx");
+    OCIO_CHECK_EQUAL(ruleIndex, 1);
+
+    // The results of the ColorSpaceNamePathSearch rule depend on the config color spaces.
+    OCIO_CHECK_NO_THROW(rules->insertPathSearchRule(0));
+    getRule("/mnt/lin_cs.dpx");
+    OCIO_CHECK_EQUAL(ruleIndex, 2);
+
+    auto cs = OCIO::ColorSpace::Create();
+    cs->setName("lin_cs");
+    config->addColorSpace(cs);
+    OCIO_CHECK_EQUAL(config->getColorSpaceFromFilepath("/mnt/lin_cs.dpx", ruleIndex),
+                     std::string("lin_cs"));
+    OCIO_CHECK_EQUAL(ruleIndex, 0);
+}
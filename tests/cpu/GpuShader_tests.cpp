@@ -1354,3 +1354,144 @@ float4 OCIOMain(
     
     OCIO_CHECK_EQUAL(expected, text);
 }
+
+OCIO_ADD_TEST(GpuShader, shader_cache)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create();
+    lut->setLength(16);
+    for (unsigned long idx = 0; idx < 16; ++idx)
+    {
+        const float val = float(idx) / 15.f;
+        lut->setValue(idx, val * val, val, std::sqrt(val));
+    }
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(lut);
+    group->appendTransform(ec);
+
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(group);
+    OCIO::ConstGPUProcessorRcPtr gpu = processor->getDefaultGPUProcessor();
+
+    OCIO::GpuShaderDescRcPtr desc1 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(desc1));
+
+    // The second extraction reuses the cached shader program.
+    OCIO::GpuShaderDescRcPtr desc2 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(desc2));
+
+    OCIO_CHECK_EQUAL(std::string(desc1->getShaderText()), std::string(desc2->getShaderText()));
+    OCIO_CHECK_EQUAL(std::string(desc1->getCacheID()), std::string(desc2->getCacheID()));
+
+    OCIO_REQUIRE_EQUAL(desc1->getNumTextures(), 1);
+    OCIO_REQUIRE_EQUAL(desc2->getNumTextures(), 1);
+    OCIO_CHECK_EQUAL(desc1->getNum3DTextures(), desc2->getNum3DTextures());
+    OCIO_CHECK_EQUAL(desc1->getNumUniforms(), desc2->getNumUniforms());
+    OCIO_CHECK_EQUAL(desc1->getUniformBufferSize(), desc2->getUniformBufferSize());
+
+    const float * values1 = nullptr;
+    const float * values2 = nullptr;
+    OCIO_CHECK_NO_THROW(desc1->getTextureValues(0, values1));
+    OCIO_CHECK_NO_THROW(desc2->getTextureValues(0, values2));
+    OCIO_CHECK_EQUAL(values1, values2);
+    for (size_t idx = 0; idx < 16 * 3; ++idx)
+    {
+        OCIO_CHECK_EQUAL(values1[idx], values2[idx]);
+    }
+
+    // The dynamic property is still shared with the processor.
+    OCIO_REQUIRE_ASSERT(desc2->hasDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+    OCIO_CHECK_EQUAL(desc1->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE),
+                     desc2->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+
+    // Different shader creator settings produce a different shader program.
+    OCIO::GpuShaderDescRcPtr desc3 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    desc3->setResourcePrefix("other");
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(desc3));
+    OCIO_CHECK_NE(std::string(desc1->getShaderText()), std::string(desc3->getShaderText()));
+    OCIO_CHECK_NE(std::string(desc3->getShaderText()).find("other_"), std::string::npos);
+
+    // Extracting into a shader description already containing a shader program
+    // appends to it as before.
+    OCIO_CHECK_THROW_WHAT(gpu->extractGpuShaderInfo(desc2),
+                          OCIO::Exception,
+                          "Dynamic property already here");
+
+    // The cache is disabled with the processor caches.
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+    processor = config->getProcessor(group);
+    gpu = processor->getDefaultGPUProcessor();
+
+    OCIO::GpuShaderDescRcPtr desc4 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(desc4));
+    OCIO_CHECK_EQUAL(std::string(desc1->getShaderText()), std::string(desc4->getShaderText()));
+}
+
+OCIO_ADD_TEST(GpuShader, shared_texture_values)
+{
+    const float values1[6] = { 0.1f, 0.2f, 0.3f,  0.4f, 0.5f, 0.6f };
+    const float values2[6] = { 0.1f, 0.2f, 0.3f,  0.4f, 0.5f, 0.7f };
+
+    OCIO::GpuShaderDescRcPtr shaderDesc1 = OCIO::GenericGpuShaderDesc::Create();
+    OCIO::GpuShaderDescRcPtr shaderDesc2 = OCIO::GenericGpuShaderDesc::Create();
+
+    OCIO_CHECK_NO_THROW(shaderDesc1->addTexture("lut1", "lut1Sampler", 2, 1,
+                                                OCIO::GpuShaderDesc::TEXTURE_RGB_CHANNEL,
+                                                OCIO::GpuShaderDesc::TEXTURE_1D,
+                                                OCIO::INTERP_LINEAR, values1));
+    OCIO_CHECK_NO_THROW(shaderDesc2->addTexture("lut2", "lut2Sampler", 2, 1,
+                                                OCIO::GpuShaderDesc::TEXTURE_RGB_CHANNEL,
+                                                OCIO::GpuShaderDesc::TEXTURE_1D,
+                                                OCIO::INTERP_LINEAR, values1));
+    OCIO_CHECK_NO_THROW(shaderDesc2->addTexture("lut3", "lut3Sampler", 2, 1,
+                                                OCIO::GpuShaderDesc::TEXTURE_RGB_CHANNEL,
+                                                OCIO::GpuShaderDesc::TEXTURE_1D,
+                                                OCIO::INTERP_LINEAR, values2));
+
+    // Identical values are shared across shader descriptions.
+
+    const float * vals1 = nullptr;
+    const float * vals2 = nullptr;
+    const float * vals3 = nullptr;
+    OCIO_CHECK_NO_THROW(shaderDesc1->getTextureValues(0, vals1));
+    OCIO_CHECK_NO_THROW(shaderDesc2->getTextureValues(0, vals2));
+    OCIO_CHECK_NO_THROW(shaderDesc2->getTextureValues(1, vals3));
+    OCIO_CHECK_NE(vals1, values1);
+    OCIO_CHECK_EQUAL(vals1, vals2);
+    OCIO_CHECK_NE(vals1, vals3);
+    OCIO_CHECK_EQUAL(vals3[5], 0.7f);
+
+    const std::string id1(shaderDesc1->getTextureCacheID(0));
+    OCIO_CHECK_ASSERT(!id1.empty());
+    OCIO_CHECK_EQUAL(id1, std::string(shaderDesc2->getTextureCacheID(0)));
+    OCIO_CHECK_NE(id1, std::string(shaderDesc2->getTextureCacheID(1)));
+    OCIO_CHECK_THROW_WHAT(shaderDesc2->getTextureCacheID(2),
+                          OCIO::Exception,
+                          "1D LUT access error");
+
+    // The values outlive the shader description that created them.
+
+    shaderDesc1.reset();
+    OCIO_CHECK_NO_THROW(shaderDesc2->getTextureValues(0, vals2));
+    OCIO_CHECK_EQUAL(vals2[5], 0.6f);
+
+    // 3D textures.
+
+    std::vector<float> lut3d(2 * 2 * 2 * 3, 0.5f);
+    OCIO_CHECK_NO_THROW(shaderDesc2->add3DTexture("lut4", "lut4Sampler", 2,
+                                                  OCIO::INTERP_TETRAHEDRAL, lut3d.data()));
+    lut3d[0] = 0.f;
+    OCIO_CHECK_NO_THROW(shaderDesc2->add3DTexture("lut5", "lut5Sampler", 2,
+                                                  OCIO::INTERP_TETRAHEDRAL, lut3d.data()));
+
+    OCIO_CHECK_NE(std::string(shaderDesc2->get3DTextureCacheID(0)),
+                  std::string(shaderDesc2->get3DTextureCacheID(1)));
+    OCIO_CHECK_THROW_WHAT(shaderDesc2->get3DTextureCacheID(2),
+                          OCIO::Exception,
+                          "3D LUT access error");
+}
@@ -208,6 +208,28 @@ OCIO_ADD_TEST(NamedTransform, alias)
                               "Cannot add 'newName' named transform, it has 'aliasB' alias and "
                               "existing named transform, 'other' is using the same alias");
     }
+
+    // Removing a named transform also removes its name and aliases from the lookups.
+    {
+        OCIO::ConfigRcPtr copy = config->createEditableCopy();
+
+        OCIO_CHECK_NO_THROW(config->removeNamedTransform("NAME"));
+        OCIO_CHECK_EQUAL(config->getNumNamedTransforms(), 1);
+        OCIO_CHECK_ASSERT(!config->getNamedTransform("name"));
+        OCIO_CHECK_ASSERT(!config->getNamedTransform(AliasA));
+        auto ntcfg = config->getNamedTransform(AliasB);
+        OCIO_REQUIRE_ASSERT(ntcfg);
+        OCIO_CHECK_EQUAL(std::string(ntcfg->getName()), "other");
+
+        OCIO_CHECK_NO_THROW(config->clearNamedTransforms());
+        OCIO_CHECK_ASSERT(!config->getNamedTransform(AliasB));
+
+        // The copy is not affected.
+        OCIO_CHECK_EQUAL(copy->getNumNamedTransforms(), 2);
+        ntcfg = copy->getNamedTransform(AliasA);
+        OCIO_REQUIRE_ASSERT(ntcfg);
+        OCIO_CHECK_EQUAL(std::string(ntcfg->getName()), "name");
+    }
 }
 
 OCIO_ADD_TEST(NamedTransform, static_get_transform)
@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include "OpenColorIO/OpenColorIO.h"
+#include "OCIOZArchive.h"
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
 
@@ -640,4 +641,141 @@ OCIO_ADD_TEST(OCIOZArchive, extract_config_and_compare_to_original)
             streamToConfigFromExtractedArchive.str()
         );
     }
-}
\ No newline at end of file
+}
+
+namespace
+{
+    void PutUInt16(std::string & buffer, uint16_t value)
+    {
+        buffer += char(value & 0xFF);
+        buffer += char(value >> 8);
+    }
+
+    void PutUInt32(std::string & buffer, uint32_t value)
+    {
+        PutUInt16(buffer, uint16_t(value & 0xFFFF));
+        PutUInt16(buffer, uint16_t(value >> 16));
+    }
+} //anon.
+
+OCIO_ADD_TEST(OCIOZArchive, archive_reader)
+{
+    // 1 - Read the deflated entries of an archive.
+
+    std::vector<std::string> paths = { 
+        std::string(OCIO::GetTestFilesDir()),
+        std::string("configs"),
+        std::string("context_test1"),
+        std::string("context_test1_windows.ocioz"),
+    };                    
+    const std::string archivePath = pystring::os::path::normpath(
+        pystring::os::path::join(paths)
+    );
+
+    {
+        OCIO::ArchiveReader reader(archivePath);
+        OCIO_CHECK_EQUAL(reader.getEntries().size(), 10);
+
+        // The lookups ignore the case and the slash differences in platforms.
+        const OCIO::ArchiveEntry * entry = reader.findEntry("SHOT1\\LUT1.clf");
+        OCIO_REQUIRE_ASSERT(entry);
+        OCIO_CHECK_EQUAL(entry->m_filename, std::string("shot1/lut1.clf"));
+        OCIO_CHECK_EQUAL(entry->m_method, 8);
+        OCIO_CHECK_ASSERT(entry->isDirectlyReadable());
+
+        const std::vector<uint8_t> buffer = reader.readEntry(*entry);
+        OCIO_REQUIRE_EQUAL(buffer.size(), 233);
+        OCIO_CHECK_EQUAL(std::string(buffer.begin(), buffer.begin() + 38),
+                         std::string("<?xml version=\"1.0\" encoding=\"UTF-8\"?>"));
+
+        OCIO_CHECK_ASSERT(!reader.findEntry("shot1/lut2.clf"));
+    }
+
+    // 2 - Read the stored entries of an archive.
+
+    FileCreationGuard fGuard(__LINE__);
+    {
+        const std::string content = "Hello OCIOZ";
+        const std::string filename = "Dir\\File.txt";
+
+        std::string zip;
+        PutUInt32(zip, 0x04034b50);         // Local file header.
+        PutUInt16(zip, 10);
+        PutUInt16(zip, 0);
+        PutUInt16(zip, 0);                  // Stored i.e. no compression.
+        PutUInt32(zip, 0);
+        PutUInt32(zip, 0xa7951d28);         // CRC32 of the content.
+        PutUInt32(zip, uint32_t(content.size()));
+        PutUInt32(zip, uint32_t(content.size()));
+        PutUInt16(zip, uint16_t(filename.size()));
+        PutUInt16(zip, 0);
+        zip += filename + content;
+
+        const uint32_t cdOffset = uint32_t(zip.size());
+        PutUInt32(zip, 0x02014b50);         // Central directory header.
+        PutUInt16(zip, 10);
+        PutUInt16(zip, 10);
+        PutUInt16(zip, 0);
+        PutUInt16(zip, 0);
+        PutUInt32(zip, 0);
+        PutUInt32(zip, 0xa7951d28);
+        PutUInt32(zip, uint32_t(content.size()));
+        PutUInt32(zip, uint32_t(content.size()));
+        PutUInt16(zip, uint16_t(filename.size()));
+        PutUInt16(zip, 0);
+        PutUInt16(zip, 0);
+        PutUInt16(zip, 0);
+        PutUInt16(zip, 0);
+        PutUInt32(zip, 0);
+        PutUInt32(zip, 0);                  // Local header offset.
+        zip += filename;
+
+        const uint32_t cdSize = uint32_t(zip.size()) - cdOffset;
+        PutUInt32(zip, 0x06054b50);         // End of central directory record.
+        PutUInt16(zip, 0);
+        PutUInt16(zip, 0);
+        PutUInt16(zip, 1);
+        PutUInt16(zip, 1);
+        PutUInt32(zip, cdSize);
+        PutUInt32(zip, cdOffset);
+        PutUInt16(zip, 0);
+
+        std::ofstream stream(fGuard.m_filename, std::ios_base::out | std::ios_base::binary);
+        OCIO_REQUIRE_ASSERT(stream.is_open());
+        stream << zip;
+        stream.close();
+
+        OCIO::ArchiveReader reader(fGuard.m_filename);
+        OCIO_REQUIRE_EQUAL(reader.getEntries().size(), 1);
+
+        const OCIO::ArchiveEntry * entry = reader.findEntry("dir/file.txt");
+        OCIO_REQUIRE_ASSERT(entry);
+        OCIO_CHECK_EQUAL(entry->m_method, 0);
+
+        const std::vector<uint8_t> buffer = reader.readEntry(*entry);
+        OCIO_CHECK_EQUAL(std::string(buffer.begin(), buffer.end()), content);
+
+        // Corrupt the content.
+        zip[30 + filename.size()] = 'h';
+        stream.open(fGuard.m_filename, std::ios_base::out | std::ios_base::binary);
+        stream << zip;
+        stream.close();
+
+        OCIO::ArchiveReader corruptedReader(fGuard.m_filename);
+        OCIO_CHECK_THROW_WHAT(corruptedReader.readEntry(corruptedReader.getEntries()[0]),
+                              OCIO::Exception,
+                              "CRC error for 'Dir\\File.txt'");
+    }
+
+    // 3 - Not an archive.
+
+    {
+        std::ofstream stream(fGuard.m_filename, std::ios_base::out | std::ios_base::binary);
+        stream << "This text file is not a zip archive.";
+        stream.close();
+
+        OCIO_CHECK_THROW_WHAT(OCIO::ArchiveReader reader(fGuard.m_filename),
+                              OCIO::Exception,
+                              "the end of central directory record is missing.");
+    }
+}
@@ -379,6 +379,42 @@ OCIO_ADD_TEST(OpOptimizers, combine_ops)
     }
 }
 
+OCIO_ADD_TEST(OpOptimizers, combine_lut3d_sequence)
+{
+    auto AddLut = [](OCIO::OpRcPtrVec & ops, unsigned long gridSize, float power)
+    {
+        OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(gridSize);
+        for (auto & val : lut->getArray().getValues())
+        {
+            val = std::pow(val, power);
+        }
+        OCIO::CreateLut3DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD);
+    };
+
+    OCIO::OpRcPtrVec ops;
+    AddLut(ops, 9, 1.2f);
+    AddLut(ops, 17, 0.8f);
+    AddLut(ops, 33, 1.1f);
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    OCIO::OpRcPtrVec original = ops.clone();
+
+    OCIO_CHECK_EQUAL(ops.size(), 3);
+    OCIO::CombineOps(ops, AllBut(OCIO::OPTIMIZATION_COMP_LUT3D));
+    OCIO_CHECK_EQUAL(ops.size(), 3);
+
+    // The adjacent 3D LUTs are all composed at once, using the largest grid size.
+    OCIO_CHECK_EQUAL(OCIO::CombineOps(ops, OCIO::OPTIMIZATION_ALL), 1);
+    OCIO_REQUIRE_EQUAL(ops.size(), 1);
+
+    OCIO::ConstOpRcPtr op = ops[0];
+    auto lut = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op->data());
+    OCIO_REQUIRE_ASSERT(lut);
+    OCIO_CHECK_EQUAL(lut->getArray().getLength(), 33);
+
+    CompareRender(original, ops, __LINE__, 1e-3f, true);
+}
+
 OCIO_ADD_TEST(OpOptimizers, prefer_pair_inverse_over_combine)
 {
     // When a pair of forward / inverse LUTs with non 0 to 1 domain are used
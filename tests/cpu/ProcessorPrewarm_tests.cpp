@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "ProcessorPrewarm.cpp"
+
+#include "Platform.h"
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// Write a small identity spi1d LUT in a temporary file, removed with the instance.
+struct TempLut
+{
+    TempLut()
+    {
+        m_filename = OCIO::Platform::CreateTempFilename(".spi1d");
+        std::ofstream ofs(m_filename.c_str());
+        ofs << "Version 1\nFrom 0.0 1.0\nLength 2\nComponents 1\n{\n0.0\n1.0\n}\n";
+    }
+
+    ~TempLut()
+    {
+        std::remove(m_filename.c_str());
+    }
+
+    std::string m_filename;
+};
+
+OCIO::ConstConfigRcPtr CreateConfig(const std::string & lutA, const std::string & lutB)
+{
+    std::ostringstream oss;
+    oss << "ocio_profile_version: 2\n"
+           "\n"
+           "search_path: .\n"
+           "\n"
+           "roles:\n"
+           "  default: raw\n"
+           "\n"
+           "file_rules:\n"
+           "  - !<Rule> {name: Default, colorspace: raw}\n"
+           "\n"
+           "displays:\n"
+           "  sRGB:\n"
+           "    - !<View> {name: A, colorspace: lut_a}\n"
+           "    - !<View> {name: B, colorspace: lut_b}\n"
+           "    - !<View> {name: Film, colorspace: srgb, looks: grade}\n"
+           "  P3:\n"
+           "    - !<View> {name: Film, colorspace: srgb}\n"
+           "\n"
+           "active_displays: [sRGB]\n"
+           "\n"
+           "looks:\n"
+           "  - !<Look>\n"
+           "    name: grade\n"
+           "    process_space: raw\n"
+           "    transform: !<ExponentTransform> {value: [1.1, 1.1, 1.1, 1]}\n"
+           "  - !<Look>\n"
+           "    name: other\n"
+           "    process_space: raw\n"
+           "    transform: !<CDLTransform> {slope: [1.1, 1, 1]}\n"
+           "\n"
+           "colorspaces:\n"
+           "  - !<ColorSpace>\n"
+           "    name: raw\n"
+           "  - !<ColorSpace>\n"
+           "    name: srgb\n"
+           "    from_scene_reference: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1], direction: inverse}\n"
+           "  - !<ColorSpace>\n"
+           "    name: lut_a\n"
+           "    from_scene_reference: !<FileTransform> {src: " << lutA << "}\n"
+           "  - !<ColorSpace>\n"
+           "    name: lut_b\n"
+           "    from_scene_reference: !<FileTransform> {src: " << lutB << "}\n";
+
+    std::istringstream is(oss.str());
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_CHECK_NO_THROW(config->validate());
+    return config;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(ProcessorPrewarm, active_display_views)
+{
+    OCIO::ConstConfigRcPtr config;
+    {
+        TempLut lutA, lutB;
+        config = CreateConfig(lutA.m_filename, lutB.m_filename);
+
+        OCIO::ProcessorPrewarmRcPtr prewarm = OCIO::ProcessorPrewarm::Create(config);
+        OCIO_CHECK_ASSERT(prewarm->isDefaultCPUProcessorEnabled());
+        OCIO_CHECK_ASSERT(prewarm->isDefaultGPUProcessorEnabled());
+
+        // Only the sRGB display is active.
+        OCIO_CHECK_NO_THROW(prewarm->addActiveDisplayViews("raw"));
+        OCIO_CHECK_EQUAL(prewarm->getNumItems(), 3);
+
+        std::atomic<size_t> numCalls{ 0 };
+        prewarm->setProgressCallback([&numCalls](size_t numCompleted, size_t numItems)
+        {
+            ++numCalls;
+            OCIO_CHECK_ASSERT(numCompleted <= numItems);
+        });
+
+        prewarm->setNumThreads(2);
+        OCIO_CHECK_ASSERT(!prewarm->isDone());
+        OCIO_CHECK_NO_THROW(prewarm->start());
+        OCIO_CHECK_NO_THROW(prewarm->wait());
+
+        OCIO_CHECK_ASSERT(prewarm->isDone());
+        OCIO_CHECK_ASSERT(!prewarm->isCanceled());
+        OCIO_CHECK_EQUAL(prewarm->getNumCompleted(), 3);
+        OCIO_CHECK_EQUAL(numCalls, 3);
+        OCIO_CHECK_EQUAL(prewarm->getNumErrors(), 0);
+
+        OCIO_CHECK_THROW_WHAT(prewarm->start(), OCIO::Exception, "already started");
+        OCIO_CHECK_THROW_WHAT(prewarm->addActiveDisplayViews("raw"), OCIO::Exception,
+                              "cannot add items once started");
+
+        // The LUT files are removed here.
+    }
+
+    // The processors of the pre-warmed views are in the cache of the config.
+    OCIO_CHECK_NO_THROW(config->getProcessor("raw", "sRGB", "A", OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(config->getProcessor("raw", "sRGB", "B", OCIO::TRANSFORM_DIR_FORWARD));
+}
+
+OCIO_ADD_TEST(ProcessorPrewarm, display_views)
+{
+    OCIO::ConstConfigRcPtr config;
+    {
+        TempLut lutA, lutB;
+        config = CreateConfig(lutA.m_filename, lutB.m_filename);
+
+        OCIO::ProcessorPrewarmRcPtr prewarm = OCIO::ProcessorPrewarm::Create(config);
+        prewarm->setDefaultGPUProcessorEnabled(false);
+
+        OCIO_CHECK_NO_THROW(prewarm->addDisplayView("raw", "sRGB", "A", nullptr,
+                                                    OCIO::TRANSFORM_DIR_FORWARD));
+        // Inactive displays may be requested too.
+        OCIO_CHECK_NO_THROW(prewarm->addDisplayView("raw", "P3", "Film", nullptr,
+                                                    OCIO::TRANSFORM_DIR_INVERSE));
+        OCIO_CHECK_NO_THROW(prewarm->addDisplayView("raw", "sRGB", "Film", "other",
+                                                    OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(prewarm->addTransform(OCIO::MatrixTransform::Create(),
+                                                  OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_THROW_WHAT(prewarm->addDisplayView("raw", "", "A", nullptr,
+                                                      OCIO::TRANSFORM_DIR_FORWARD),
+                              OCIO::Exception, "empty display name");
+        OCIO_CHECK_EQUAL(prewarm->getNumItems(), 4);
+
+        OCIO_CHECK_NO_THROW(prewarm->start());
+        OCIO_CHECK_NO_THROW(prewarm->wait());
+        OCIO_CHECK_EQUAL(prewarm->getNumCompleted(), 4);
+        OCIO_CHECK_EQUAL(prewarm->getNumErrors(), 0);
+    }
+
+    OCIO_CHECK_NO_THROW(config->getProcessor("raw", "sRGB", "A", OCIO::TRANSFORM_DIR_FORWARD));
+
+    // That view was not pre-warmed so its LUT file is needed.
+    OCIO_CHECK_THROW_WHAT(config->getProcessor("raw", "sRGB", "B", OCIO::TRANSFORM_DIR_FORWARD),
+                          OCIO::Exception, "could not be located");
+}
+
+OCIO_ADD_TEST(ProcessorPrewarm, errors_and_cancel)
+{
+    TempLut lutA;
+    OCIO::ConstConfigRcPtr config = CreateConfig(lutA.m_filename, "missing_file.spi1d");
+
+    // A failing item does not stop the others.
+    {
+        OCIO::ProcessorPrewarmRcPtr prewarm = OCIO::ProcessorPrewarm::Create(config);
+        OCIO_CHECK_NO_THROW(prewarm->addActiveDisplayViews("raw"));
+        OCIO_CHECK_NO_THROW(prewarm->start());
+        OCIO_CHECK_NO_THROW(prewarm->wait());
+
+        OCIO_CHECK_EQUAL(prewarm->getNumCompleted(), 3);
+        OCIO_REQUIRE_EQUAL(prewarm->getNumErrors(), 1);
+        OCIO_CHECK_NE(std::string(prewarm->getError(0)).find("missing_file.spi1d"),
+                      std::string::npos);
+        OCIO_CHECK_EQUAL(std::string(prewarm->getError(1)), "");
+    }
+
+    // The canceled items are skipped.
+    {
+        OCIO::ProcessorPrewarmRcPtr prewarm = OCIO::ProcessorPrewarm::Create(config);
+        OCIO_CHECK_NO_THROW(prewarm->addActiveDisplayViews("raw"));
+        prewarm->cancel();
+        OCIO_CHECK_NO_THROW(prewarm->start());
+        OCIO_CHECK_NO_THROW(prewarm->wait());
+
+        OCIO_CHECK_ASSERT(prewarm->isCanceled());
+        OCIO_CHECK_ASSERT(prewarm->isDone());
+        OCIO_CHECK_EQUAL(prewarm->getNumCompleted(), 3);
+        OCIO_CHECK_EQUAL(prewarm->getNumErrors(), 0);
+    }
+
+    // Nothing to build.
+    {
+        OCIO::ProcessorPrewarmRcPtr prewarm = OCIO::ProcessorPrewarm::Create(config);
+        OCIO_CHECK_NO_THROW(prewarm->wait());
+        OCIO_CHECK_ASSERT(!prewarm->isDone());
+        OCIO_CHECK_NO_THROW(prewarm->start());
+        OCIO_CHECK_NO_THROW(prewarm->wait());
+        OCIO_CHECK_ASSERT(prewarm->isDone());
+    }
+
+    OCIO_CHECK_THROW_WHAT(OCIO::ProcessorPrewarm::Create(OCIO::ConstConfigRcPtr()),
+                          OCIO::Exception, "the config is null");
+}
@@ -34,26 +34,26 @@ OCIO_ADD_TEST(Processor, basic_cache)
 
     auto processorMat = config->getProcessor(mat);
     OCIO_CHECK_EQUAL(processorMat->getNumTransforms(), 1);
-    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "1b1880136f7669351adb0dcae0f4f9fd");
+    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "194f16a1beafc35b779fb2d143117b97");
 
     // Check behaviour of the cacheID
 
     offset[0] = 0.0;
     mat->setOffset(offset);
     processorMat = config->getProcessor(mat);
-    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "675ca29c0f7d28fbdc865818c8cf5c4c");
+    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "ee8e29d65d79c554eb294568962e43a");
 
     matrix[0] = 2.0;
     mat->setMatrix(matrix);
     processorMat = config->getProcessor(mat);
-    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "1ebac7d1c2d833943e1d1d3c26a7eb18");
+    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "350931181c799d2fec3242060c3f83a2");
 
     offset[0] = 0.1;
     matrix[0] = 1.0;
     mat->setOffset(offset);
     mat->setMatrix(matrix);
     processorMat = config->getProcessor(mat);
-    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "1b1880136f7669351adb0dcae0f4f9fd");
+    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "194f16a1beafc35b779fb2d143117b97");
 }
 
 OCIO_ADD_TEST(Processor, basic_cache_lut)
@@ -71,19 +71,19 @@ OCIO_ADD_TEST(Processor, basic_cache_lut)
 
     auto processorLut = config->getProcessor(lut);
     OCIO_CHECK_EQUAL(processorLut->getNumTransforms(), 1);
-    OCIO_CHECK_EQUAL(std::string(processorLut->getCacheID()), "2b26d0097cdcf8f141fe3b3d6e21b5ec");
+    OCIO_CHECK_EQUAL(std::string(processorLut->getCacheID()), "149dac426a9268f91e039adc95742076");
 
     // Check behaviour of the cacheID
 
     // Change a value and check that the cacheID changes.
     lut->setValue(2, 2, 2, 1.f, 3.f, 4.f);
     processorLut = config->getProcessor(lut);
-    OCIO_CHECK_EQUAL(std::string(processorLut->getCacheID()), "288ec8ea132adaca5b5aed24a296a1a2");
+    OCIO_CHECK_EQUAL(std::string(processorLut->getCacheID()), "99dfbb971d01dcb7e9b62272dbf70780");
 
     // Restore the original value, check that the cache ID matches what it used to be.
     lut->setValue(2, 2, 2, 2.f, 3.f, 4.f);
     processorLut = config->getProcessor(lut);
-    OCIO_CHECK_EQUAL(std::string(processorLut->getCacheID()), "2b26d0097cdcf8f141fe3b3d6e21b5ec");
+    OCIO_CHECK_EQUAL(std::string(processorLut->getCacheID()), "149dac426a9268f91e039adc95742076");
 }
 
 OCIO_ADD_TEST(Processor, unique_dynamic_properties)
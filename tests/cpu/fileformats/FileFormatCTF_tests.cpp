@@ -1127,6 +1127,58 @@ OCIO_ADD_TEST(FileFormatCTF, lut3d_unequal_size)
                           "Illegal array dimensions 2 2 3 3");
 }
 
+OCIO_ADD_TEST(FileFormatCTF, lut3d_large_array)
+{
+    // The file content is given to the XML parser in blocks, check that the values and the line
+    // numbers are not affected by the block boundaries.
+
+    static constexpr unsigned long dim = 33;
+
+    std::ostringstream oss;
+    oss << R"(<?xml version="1.0" encoding="UTF-8"?>
+<ProcessList compCLFversion="3" id="large">
+    <LUT3D inBitDepth="32f" outBitDepth="32f">
+        <Array dim=")" << dim << " " << dim << " " << dim << R"( 3">
+)";
+    for (unsigned long idx = 0; idx < dim * dim * dim; ++idx)
+    {
+        oss << ((idx * 3 + 0) % 4096) * 0.125 << " "
+            << ((idx * 3 + 1) % 4096) * 0.125 << ", "
+            << ((idx * 3 + 2) % 4096) * 0.125 << "\n";
+    }
+    oss << R"(        </Array>
+    </LUT3D>
+</ProcessList>
+)";
+
+    OCIO::LocalCachedFileRcPtr cachedFile;
+    OCIO_CHECK_NO_THROW(cachedFile = ParseString(oss.str()));
+    OCIO_REQUIRE_ASSERT(cachedFile);
+
+    const OCIO::ConstOpDataVec & opList = cachedFile->m_transform->getOps();
+    OCIO_REQUIRE_EQUAL(opList.size(), 1);
+    auto pLut = std::dynamic_pointer_cast<const OCIO::Lut3DOpData>(opList[0]);
+    OCIO_REQUIRE_ASSERT(pLut);
+
+    const OCIO::Array::Values & values = pLut->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(values.size(), dim * dim * dim * 3);
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        OCIO_REQUIRE_EQUAL(values[idx], (float)(idx % 4096) * 0.125f);
+    }
+
+    // The line number of an error found after several blocks.
+    const unsigned long lastLine = dim * dim * dim + 7;
+    std::string str = oss.str();
+    str.replace(str.rfind("</LUT3D>"), 8, "</LUT1D>");
+    OCIO_CHECK_THROW_WHAT(ParseString(str), OCIO::Exception,
+                          "no closing tag for 'LUT3D').. At line (" + std::to_string(lastLine - 1));
+
+    str = oss.str();
+    str.replace(str.rfind("2 "), 2, "2x ");
+    OCIO_CHECK_THROW_WHAT(ParseString(str), OCIO::Exception, "Illegal values");
+}
+
 OCIO_ADD_TEST(FileFormatCTF, tabluation_support)
 {
     OCIO::LocalCachedFileRcPtr cachedFile;
@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "fileformats/FileFormatOCIOBinaryLut.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(FileFormatOCIOBinaryLut, format_info)
+{
+    OCIO::FormatInfoVec formatInfoVec;
+    OCIO::LocalFileFormat tester;
+    tester.getFormatInfo(formatInfoVec);
+
+    OCIO_REQUIRE_EQUAL(3, formatInfoVec.size());
+    OCIO_CHECK_EQUAL("ocio_binary_lut", formatInfoVec[0].name);
+    OCIO_CHECK_EQUAL("olut", formatInfoVec[0].extension);
+    OCIO_CHECK_EQUAL(OCIO::FORMAT_CAPABILITY_READ | OCIO::FORMAT_CAPABILITY_BAKE |
+                     OCIO::FORMAT_CAPABILITY_WRITE,
+                     formatInfoVec[0].capabilities);
+
+    OCIO_CHECK_EQUAL("ocio_binary_lut_half", formatInfoVec[1].name);
+    OCIO_CHECK_EQUAL("olut", formatInfoVec[1].extension);
+    OCIO_CHECK_EQUAL(OCIO::FORMAT_CAPABILITY_BAKE | OCIO::FORMAT_CAPABILITY_WRITE,
+                     formatInfoVec[1].capabilities);
+
+    OCIO_CHECK_EQUAL("ocio_binary_lut_compressed", formatInfoVec[2].name);
+    OCIO_CHECK_EQUAL("olut", formatInfoVec[2].extension);
+    OCIO_CHECK_EQUAL(OCIO::FORMAT_CAPABILITY_BAKE | OCIO::FORMAT_CAPABILITY_WRITE,
+                     formatInfoVec[2].capabilities);
+
+    OCIO::FileFormatVector formats;
+    OCIO::FormatRegistry::GetInstance().getFileFormatForExtension("olut", formats);
+    OCIO_CHECK_EQUAL(1, formats.size());
+}
+
+namespace
+{
+
+OCIO::LocalCachedFileRcPtr ReadBinaryLut(const std::string & fileContent)
+{
+    std::istringstream is(fileContent, std::ios_base::in | std::ios_base::binary);
+
+    OCIO::LocalFileFormat tester;
+    OCIO::CachedFileRcPtr cachedFile = tester.read(is, "Memory File", OCIO::INTERP_DEFAULT);
+
+    return OCIO::DynamicPtrCast<OCIO::LocalCachedFile>(cachedFile);
+}
+
+OCIO::GroupTransformRcPtr CreateTestGroup()
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    const double m44[16] = { 1.1,  0.2, -0.1, 0.,
+                             0.05, 0.9,  0.1, 0.,
+                            -0.02, 0.3,  1.2, 0.,
+                             0.,   0.,   0.,  1. };
+    const double offset4[4] = { 0.01, -0.02, 0.03, 0. };
+    OCIO::MatrixTransformRcPtr mat = OCIO::MatrixTransform::Create();
+    mat->setMatrix(m44);
+    mat->setOffset(offset4);
+    group->appendTransform(mat);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(-0.1);
+    range->setMinOutValue(-0.1);
+    group->appendTransform(range);
+
+    OCIO::Lut1DTransformRcPtr lut1D = OCIO::Lut1DTransform::Create(17, false);
+    for (unsigned long idx = 0; idx < 17; ++idx)
+    {
+        const float v = float(idx) / 16.f;
+        lut1D->setValue(idx, v * v, std::sqrt(v), v * 0.5f);
+    }
+    lut1D->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    group->appendTransform(lut1D);
+
+    OCIO::Lut3DTransformRcPtr lut3D = OCIO::Lut3DTransform::Create(5);
+    for (unsigned long r = 0; r < 5; ++r)
+    {
+        for (unsigned long g = 0; g < 5; ++g)
+        {
+            for (unsigned long b = 0; b < 5; ++b)
+            {
+                lut3D->setValue(r, g, b,
+                                (r * 0.25f + g * 0.05f) / 1.3f,
+                                g * 0.25f,
+                                (b * 0.25f + r * 0.1f) / 1.4f);
+            }
+        }
+    }
+    lut3D->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    group->appendTransform(lut3D);
+
+    return group;
+}
+
+}
+
+OCIO_ADD_TEST(FileFormatOCIOBinaryLut, write_read)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::GroupTransformRcPtr group = CreateTestGroup();
+
+    OCIO::ConstProcessorRcPtr refProc = config->getProcessor(group);
+    OCIO::ConstCPUProcessorRcPtr refCPU = refProc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+
+    size_t plainSize = 0;
+    for (const std::string formatName : { "ocio_binary_lut",
+                                          "ocio_binary_lut_half",
+                                          "ocio_binary_lut_compressed" })
+    {
+        std::ostringstream os(std::ios_base::out | std::ios_base::binary);
+        OCIO_CHECK_NO_THROW(group->write(config, formatName.c_str(), os));
+        const std::string content = os.str();
+
+        if (formatName == "ocio_binary_lut")
+        {
+            // Header, then the matrix, range, lut1d (padded to 16 bytes) & lut3d records.
+            plainSize = content.size();
+            OCIO_CHECK_EQUAL(plainSize, 64 + (32 + 160) + (32 + 32)
+                                        + (32 + 208) + (32 + 1504));
+            OCIO_CHECK_EQUAL(content.substr(0, 8), "OCIOBLUT");
+        }
+        else
+        {
+            OCIO_CHECK_LT(content.size(), plainSize);
+        }
+
+        OCIO::LocalCachedFileRcPtr cachedFile;
+        OCIO_CHECK_NO_THROW(cachedFile = ReadBinaryLut(content));
+        OCIO_REQUIRE_ASSERT(cachedFile);
+        OCIO_REQUIRE_EQUAL(cachedFile->m_ops.size(), 4);
+
+        auto mat = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(cachedFile->m_ops[0]);
+        OCIO_REQUIRE_ASSERT(mat);
+        OCIO_CHECK_EQUAL(mat->getArray().getValues()[1], 0.2);
+        OCIO_CHECK_EQUAL(mat->getOffsetValue(2), 0.03);
+
+        auto range = OCIO::DynamicPtrCast<const OCIO::RangeOpData>(cachedFile->m_ops[1]);
+        OCIO_REQUIRE_ASSERT(range);
+        OCIO_CHECK_EQUAL(range->getMinInValue(), -0.1);
+        OCIO_CHECK_ASSERT(!range->hasMaxInValue());
+        OCIO_CHECK_ASSERT(!range->hasMaxOutValue());
+
+        auto lut1D = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(cachedFile->m_ops[2]);
+        OCIO_REQUIRE_ASSERT(lut1D);
+        OCIO_CHECK_EQUAL(lut1D->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+        OCIO_CHECK_EQUAL(lut1D->getArray().getLength(), 17);
+        OCIO_CHECK_ASSERT(!lut1D->isInputHalfDomain());
+
+        auto lut3D = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(cachedFile->m_ops[3]);
+        OCIO_REQUIRE_ASSERT(lut3D);
+        OCIO_CHECK_EQUAL(lut3D->getGridSize(), 5);
+        OCIO_CHECK_EQUAL(lut3D->getInterpolation(), OCIO::INTERP_TETRAHEDRAL);
+
+        // Compare the processing.
+
+        OCIO::OpRcPtrVec ops;
+        OCIO::LocalFileFormat tester;
+        OCIO::FileTransformRcPtr fileTransform = OCIO::FileTransform::Create();
+        OCIO_CHECK_NO_THROW(tester.buildFileOps(ops, *config, config->getCurrentContext(),
+                                                cachedFile, *fileTransform,
+                                                OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_REQUIRE_EQUAL(ops.size(), 4);
+        OCIO_CHECK_NO_THROW(ops.finalize());
+
+        const float tolerance = formatName == "ocio_binary_lut_half" ? 1e-3f : 1e-6f;
+
+        for (float v : { -0.05f, 0.0f, 0.13f, 0.5f, 0.77f, 1.0f })
+        {
+            float ref[4] = { v, 1.0f - v, v * 0.5f, 1.0f };
+            float res[4] = { ref[0], ref[1], ref[2], ref[3] };
+
+            refCPU->applyRGBA(ref);
+            for (const auto & op : ops)
+            {
+                op->apply(res, res, 1);
+            }
+
+            OCIO_CHECK_CLOSE(res[0], ref[0], tolerance);
+            OCIO_CHECK_CLOSE(res[1], ref[1], tolerance);
+            OCIO_CHECK_CLOSE(res[2], ref[2], tolerance);
+        }
+
+        // The inverse direction reverses the op order.
+
+        OCIO::OpRcPtrVec invOps;
+        OCIO_CHECK_NO_THROW(tester.buildFileOps(invOps, *config, config->getCurrentContext(),
+                                                cachedFile, *fileTransform,
+                                                OCIO::TRANSFORM_DIR_INVERSE));
+        OCIO_REQUIRE_EQUAL(invOps.size(), 4);
+        OCIO::ConstOpRcPtr firstOp = invOps[0];
+        OCIO::ConstOpRcPtr lastOp = invOps[3];
+        OCIO_CHECK_EQUAL(firstOp->data()->getType(), OCIO::OpData::Lut3DType);
+        OCIO_CHECK_EQUAL(lastOp->data()->getType(), OCIO::OpData::MatrixType);
+    }
+}
+
+OCIO_ADD_TEST(FileFormatOCIOBinaryLut, write_errors)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(OCIO::ExponentTransform::Create());
+
+    std::ostringstream os;
+    OCIO_CHECK_THROW_WHAT(group->write(config, "ocio_binary_lut", os), OCIO::Exception,
+                          "needs to be baked first");
+
+    OCIO::LocalFileFormat tester;
+    OCIO_CHECK_THROW_WHAT(tester.write(config, config->getCurrentContext(), *group,
+                                       "unknown", os),
+                          OCIO::Exception, "Unknown OCIO binary LUT format name");
+}
+
+OCIO_ADD_TEST(FileFormatOCIOBinaryLut, read_errors)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::GroupTransformRcPtr group = CreateTestGroup();
+
+    for (const std::string formatName : { "ocio_binary_lut", "ocio_binary_lut_compressed" })
+    {
+        std::ostringstream os(std::ios_base::out | std::ios_base::binary);
+        group->write(config, formatName.c_str(), os);
+        const std::string content = os.str();
+
+        OCIO_CHECK_THROW_WHAT(ReadBinaryLut(content.substr(0, 40)), OCIO::Exception,
+                              "File is too small to be a binary LUT");
+
+        OCIO_CHECK_THROW_WHAT(ReadBinaryLut(content.substr(0, content.size() - 4)),
+                              OCIO::Exception, "Invalid header, the file might be truncated");
+
+        std::string corrupted = content;
+        corrupted[0] = 'X';
+        OCIO_CHECK_THROW_WHAT(ReadBinaryLut(corrupted), OCIO::Exception,
+                              "Missing the 'OCIOBLUT' file signature");
+
+        corrupted = content;
+        corrupted[corrupted.size() - 10] ^= 0x5A;
+        OCIO_CHECK_THROW_WHAT(ReadBinaryLut(corrupted), OCIO::Exception,
+                              "Checksum mismatch, the file is corrupted");
+
+        corrupted = content;
+        corrupted[8] = 2;
+        OCIO_CHECK_THROW_WHAT(ReadBinaryLut(corrupted), OCIO::Exception,
+                              "Unsupported file version '2.0'");
+    }
+}
+
+OCIO_ADD_TEST(FileFormatOCIOBinaryLut, bake_and_file_transform)
+{
+    constexpr const char * CONFIG{ R"(ocio_profile_version: 2
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: input}
+
+colorspaces:
+  - !<ColorSpace>
+    name: input
+
+  - !<ColorSpace>
+    name: shaper
+    from_scene_reference: !<ExponentTransform> {value: 2.2, direction: inverse}
+
+  - !<ColorSpace>
+    name: target
+    from_scene_reference: !<GroupTransform>
+      children:
+        - !<MatrixTransform> {matrix: [0.8, 0.15, 0.05, 0, 0.1, 0.8, 0.1, 0, 0.05, 0.1, 0.85, 0, 0, 0, 0, 1]}
+        - !<ExponentTransform> {value: 2.2, direction: inverse}
+)" };
+
+    std::istringstream is(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+
+    OCIO::ConstCPUProcessorRcPtr refCPU
+        = config->getProcessor("input", "target")->getDefaultCPUProcessor();
+
+    const std::string directory = OCIO::CreateTemporaryDirectory("binary_lut_bake");
+
+    for (const std::string shaperSpace : { "", "shaper" })
+    {
+        OCIO::BakerRcPtr baker = OCIO::Baker::Create();
+        baker->setConfig(config);
+        baker->setFormat("ocio_binary_lut");
+        baker->setInputSpace("input");
+        baker->setShaperSpace(shaperSpace.c_str());
+        baker->setTargetSpace("target");
+        baker->setCubeSize(33);
+
+        const std::string filePath = directory + "/baked.olut";
+        {
+            std::ofstream ofs(filePath, std::ios_base::out | std::ios_base::binary);
+            OCIO_CHECK_NO_THROW(baker->bake(ofs));
+        }
+
+        OCIO::ClearAllCaches();
+
+        OCIO::FileTransformRcPtr fileTransform = OCIO::FileTransform::Create();
+        fileTransform->setSrc(filePath.c_str());
+
+        OCIO::ConstCPUProcessorRcPtr bakedCPU;
+        OCIO_CHECK_NO_THROW(bakedCPU = config->getProcessor(fileTransform)->getDefaultCPUProcessor());
+        OCIO_REQUIRE_ASSERT(bakedCPU);
+
+        for (float v : { 0.0f, 0.125f, 0.5f, 1.0f })
+        {
+            float ref[3] = { v, v * 0.5f, 1.0f - v };
+            float res[3] = { ref[0], ref[1], ref[2] };
+
+            refCPU->applyRGB(ref);
+            bakedCPU->applyRGB(res);
+
+            OCIO_CHECK_CLOSE(res[0], ref[0], 2e-3f);
+            OCIO_CHECK_CLOSE(res[1], ref[1], 2e-3f);
+            OCIO_CHECK_CLOSE(res[2], ref[2], 2e-3f);
+        }
+    }
+
+    OCIO::RemoveTemporaryDirectory(directory);
+}
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <limits>
+
+#include "fileformats/FileFormatUtils.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(TextLutScanner, lines)
+{
+    std::istringstream iss;
+    iss.str("first line\r\n"
+            "\n"
+            "  \t \r\n"
+            "  last line");
+
+    OCIO::TextLutScanner scanner(iss);
+
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_EQUAL(scanner.getLine(), "first line");
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_EQUAL(scanner.getLine(), "");
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_EQUAL(scanner.getLine(), "  \t ");
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_EQUAL(scanner.getLine(), "  last line");
+    OCIO_CHECK_ASSERT(!scanner.nextLine());
+    OCIO_CHECK_ASSERT(!scanner.nextLine());
+
+    // The empty lines are skipped.
+    iss.clear();
+    iss.str("\n\n1 2 3\n   \n\n4 5 6\n\n");
+
+    OCIO::TextLutScanner scanner2(iss);
+
+    OCIO_REQUIRE_ASSERT(scanner2.nextNonEmptyLine());
+    OCIO_CHECK_EQUAL(scanner2.getLine(), "1 2 3");
+    OCIO_REQUIRE_ASSERT(scanner2.nextNonEmptyLine());
+    OCIO_CHECK_EQUAL(scanner2.getLine(), "4 5 6");
+    OCIO_CHECK_ASSERT(!scanner2.nextNonEmptyLine());
+
+    // Only the remaining content of the stream is read.
+    iss.clear();
+    iss.str("header\ndata");
+    std::string header;
+    std::getline(iss, header);
+
+    OCIO::TextLutScanner scanner3(iss);
+
+    OCIO_REQUIRE_ASSERT(scanner3.nextNonEmptyLine());
+    OCIO_CHECK_EQUAL(scanner3.getLine(), "data");
+    OCIO_CHECK_ASSERT(!scanner3.nextNonEmptyLine());
+}
+
+OCIO_ADD_TEST(TextLutScanner, tokens)
+{
+    std::istringstream iss;
+    iss.str("  0.5\t-1e-3  +2 0x10 3d -7 \n");
+
+    OCIO::TextLutScanner scanner(iss);
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+
+    OCIO::TextLutScanner::Token tokens[4];
+    OCIO_REQUIRE_EQUAL(scanner.getTokens(tokens, 4), 6);
+    OCIO_CHECK_EQUAL(std::string(tokens[0].m_begin, tokens[0].m_end), "0.5");
+    OCIO_CHECK_EQUAL(std::string(tokens[3].m_begin, tokens[3].m_end), "0x10");
+
+    float val = 0.f;
+    OCIO_CHECK_ASSERT(OCIO::TextLutScanner::ParseFloat(tokens[0], val));
+    OCIO_CHECK_EQUAL(val, 0.5f);
+    OCIO_CHECK_ASSERT(OCIO::TextLutScanner::ParseFloat(tokens[1], val));
+    OCIO_CHECK_EQUAL(val, -1e-3f);
+    OCIO_CHECK_ASSERT(OCIO::TextLutScanner::ParseFloat(tokens[2], val));
+    OCIO_CHECK_EQUAL(val, 2.f);
+
+    // The complete token must be a decimal integer.
+    int ival = 0;
+    OCIO_CHECK_ASSERT(OCIO::TextLutScanner::ParseInt(tokens[2], ival));
+    OCIO_CHECK_EQUAL(ival, 2);
+    OCIO_CHECK_ASSERT(!OCIO::TextLutScanner::ParseInt(tokens[0], ival));
+    OCIO_CHECK_ASSERT(!OCIO::TextLutScanner::ParseInt(tokens[3], ival));
+    OCIO_CHECK_EQUAL(ival, 2);
+
+    // Only the token count is returned.
+    OCIO_CHECK_EQUAL(scanner.getTokens(nullptr, 0), 6);
+
+    OCIO::TextLutScanner::Token allTokens[6];
+    OCIO_REQUIRE_EQUAL(scanner.getTokens(allTokens, 6), 6);
+    OCIO_CHECK_ASSERT(!OCIO::TextLutScanner::ParseInt(allTokens[4], ival));
+    OCIO_CHECK_ASSERT(OCIO::TextLutScanner::ParseInt(allTokens[5], ival));
+    OCIO_CHECK_EQUAL(ival, -7);
+}
+
+OCIO_ADD_TEST(TextLutScanner, floats)
+{
+    std::istringstream iss;
+    iss.str("0.1 0.2 0.3\n"
+            "0.1 0.2\n"
+            "0.1 0.2 0.3 0.4\n"
+            "0.1 abc 0.3\n");
+
+    OCIO::TextLutScanner scanner(iss);
+
+    float values[3] = { 0.f, 0.f, 0.f };
+
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_ASSERT(scanner.getFloats(values, 3));
+    OCIO_CHECK_EQUAL(values[0], 0.1f);
+    OCIO_CHECK_EQUAL(values[1], 0.2f);
+    OCIO_CHECK_EQUAL(values[2], 0.3f);
+
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_ASSERT(!scanner.getFloats(values, 3));
+
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_ASSERT(!scanner.getFloats(values, 3));
+
+    OCIO_REQUIRE_ASSERT(scanner.nextLine());
+    OCIO_CHECK_ASSERT(!scanner.getFloats(values, 3));
+}
+
+OCIO_ADD_TEST(TextLutWriter, floats)
+{
+    // The writer must produce the same text as an ostream using std::fixed.
+    std::vector<float> values{ 0.f, -0.f, 1.f, -1.f, 0.5f, 0.1f, -0.1f, 1e-7f, -1e-7f,
+                               0.0000005f, 0.0000015f, 0.0000025f, -0.0000025f, 0.9999996f,
+                               123.456789f, -65504.f, 16777216.f, 1e12f, -3e20f,
+                               std::numeric_limits<float>::max(),
+                               std::numeric_limits<float>::denorm_min(),
+                               std::numeric_limits<float>::infinity(),
+                               -std::numeric_limits<float>::infinity() };
+
+    // Exact ties to check the rounding.
+    for (int i = 0; i < 64; ++i)
+    {
+        values.push_back(float(i) / 128.f);
+        values.push_back(-float(i) / 1024.f);
+    }
+
+    // Pseudo random values.
+    unsigned int seed = 1;
+    for (int i = 0; i < 10000; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        values.push_back((float(seed >> 8) / float(1 << 24) - 0.25f) * 4.f);
+    }
+
+    for (int precision : { 0, 3, 6, 9 })
+    {
+        std::ostringstream expected;
+        expected.setf(std::ios::fixed, std::ios::floatfield);
+        expected.precision(precision);
+
+        std::ostringstream result;
+        {
+            OCIO::TextLutWriter writer(result, precision);
+            for (const float value : values)
+            {
+                expected << value << " " << 42 << "\n";
+                writer << value << " " << 42 << '\n';
+            }
+        }
+
+        OCIO_CHECK_EQUAL(result.str(), expected.str());
+    }
+
+    std::ostringstream oss;
+    OCIO_CHECK_THROW_WHAT(OCIO::TextLutWriter(oss, 10), OCIO::Exception,
+                          "the precision must be in [0, 9]");
+}
+
+OCIO_ADD_TEST(TextLutWriter, blocks)
+{
+    // The text is written to the stream in blocks and the remaining text on flush().
+
+    std::ostringstream oss;
+    OCIO::TextLutWriter writer(oss, 6);
+
+    writer << "header\n";
+    OCIO_CHECK_ASSERT(oss.str().empty());
+    writer.flush();
+    OCIO_CHECK_EQUAL(oss.str(), "header\n");
+
+    std::string expected = "header\n";
+    for (int i = 0; i < 100000; ++i)
+    {
+        writer << i << '\n';
+        expected += std::to_string(i) + "\n";
+    }
+    OCIO_CHECK_ASSERT(!oss.str().empty());
+
+    const std::string longStr(200000, 'a');
+    writer << longStr.c_str();
+    expected += longStr;
+
+    writer.flush();
+    OCIO_CHECK_EQUAL(oss.str(), expected);
+}
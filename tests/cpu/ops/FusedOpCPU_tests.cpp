@@ -0,0 +1,342 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cmath>
+#include <limits>
+
+#include "ops/FusedOpCPU.cpp"
+
+#include "ops/gamma/GammaOp.h"
+#include "ops/log/LogOp.h"
+#include "ops/matrix/MatrixOp.h"
+#include "ops/range/RangeOp.h"
+#include "testutils/UnitTest.h"
+#include "utils/StringUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+constexpr float qnan = std::numeric_limits<float>::quiet_NaN();
+constexpr float inf  = std::numeric_limits<float>::infinity();
+
+// 7 pixels i.e. one block of 4 pixels and an incomplete block.
+constexpr long NumPixels = 7;
+const float InputImage[NumPixels * 4] = { -0.50f, -0.25f,  0.05f,  0.00f,
+                                           0.00f,  0.10f,  0.25f,  0.50f,
+                                           0.18f,  0.40f,  0.75f,  1.00f,
+                                           0.90f,  1.00f,  1.25f, -0.10f,
+                                           2.00f,  4.00f, 16.00f,  0.75f,
+                                          -0.0f,   0.001f, 0.5f,   2.00f,
+                                           qnan,   inf,   -inf,    0.25f };
+
+void CheckIdentical(const float * res, const float * expected, size_t numValues, unsigned line)
+{
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        OCIO_CHECK_ASSERT_FROM(res[idx] == expected[idx]
+                               || (std::isnan(res[idx]) && std::isnan(expected[idx])), line);
+    }
+}
+
+// The fused renderer of the ops must give the same results as their renderers, whatever
+// the pixel layout.
+void ValidateFusedOps(OCIO::OpRcPtrVec & ops, unsigned line)
+{
+    OCIO_CHECK_NO_THROW_FROM(ops.finalize(), line);
+
+    size_t numFusedOps = 0;
+    OCIO::ConstOpCPURcPtr fused = OCIO::GetFusedRenderer(ops, 0, true, numFusedOps);
+    OCIO_REQUIRE_ASSERT_FROM(fused, line);
+    OCIO_CHECK_EQUAL_FROM(numFusedOps, ops.size(), line);
+
+    const OCIO::OpCPU & c = *fused;
+    const std::string typeName(typeid(c).name());
+    OCIO_CHECK_ASSERT_FROM(StringUtils::Find(typeName, "FusedRenderer") != std::string::npos, line);
+
+    OCIO::ConstOpCPURcPtrVec renderers;
+    for (const auto & op : ops)
+    {
+        renderers.push_back(op->getCPUOp(true));
+    }
+
+    // Packed RGBA pixels, processed in place or not.
+    {
+        std::vector<float> expected(InputImage, InputImage + NumPixels * 4);
+        for (const auto & renderer : renderers)
+        {
+            renderer->apply(expected.data(), expected.data(), NumPixels);
+        }
+
+        std::vector<float> res(NumPixels * 4);
+        fused->apply(InputImage, res.data(), NumPixels);
+        CheckIdentical(res.data(), expected.data(), res.size(), line);
+
+        res.assign(InputImage, InputImage + NumPixels * 4);
+        fused->apply(res.data(), res.data(), NumPixels);
+        CheckIdentical(res.data(), expected.data(), res.size(), line);
+    }
+
+    // Packed RGB pixels, when all the ops allow it.
+    bool hasRGBApply = true;
+    for (const auto & renderer : renderers)
+    {
+        hasRGBApply = hasRGBApply && renderer->hasRGBApply();
+    }
+    OCIO_CHECK_EQUAL_FROM(fused->hasRGBApply(), hasRGBApply, line);
+
+    if (hasRGBApply)
+    {
+        std::vector<float> expected(NumPixels * 3);
+        for (long idx = 0; idx < NumPixels; ++idx)
+        {
+            std::copy(InputImage + 4 * idx, InputImage + 4 * idx + 3, &expected[3 * idx]);
+        }
+        std::vector<float> res(expected);
+
+        for (const auto & renderer : renderers)
+        {
+            renderer->applyRGB(expected.data(), expected.data(), NumPixels);
+        }
+
+        fused->applyRGB(res.data(), res.data(), NumPixels);
+        CheckIdentical(res.data(), expected.data(), res.size(), line);
+    }
+
+    // Planar pixels, with and without alpha.
+    OCIO_CHECK_ASSERT_FROM(fused->hasPlanarApply(), line);
+
+    for (const bool hasAlpha : { true, false })
+    {
+        std::vector<float> expected(NumPixels * 4);
+        for (long idx = 0; idx < NumPixels; ++idx)
+        {
+            for (long c = 0; c < 4; ++c)
+            {
+                expected[c * NumPixels + idx] = InputImage[4 * idx + c];
+            }
+        }
+        std::vector<float> res(expected);
+
+        for (const auto & renderer : renderers)
+        {
+            float * planes = expected.data();
+            renderer->applyPlanar(planes, planes + NumPixels, planes + 2 * NumPixels,
+                                  hasAlpha ? planes + 3 * NumPixels : nullptr, NumPixels);
+        }
+
+        float * planes = res.data();
+        fused->applyPlanar(planes, planes + NumPixels, planes + 2 * NumPixels,
+                           hasAlpha ? planes + 3 * NumPixels : nullptr, NumPixels);
+
+        CheckIdentical(res.data(), expected.data(), hasAlpha ? res.size() : 3 * NumPixels, line);
+    }
+}
+
+const double Matrix[16] = { 1.10,  0.20, -0.05, 0.01,
+                            0.05,  0.90,  0.10, 0.02,
+                           -0.02,  0.15,  1.20, 0.03,
+                            0.10,  0.00,  0.00, 0.95 };
+const double Offsets[4] = { 0.01, -0.02, 0.03, 0.04 };
+const double Scales[4]  = { 1.5, 0.5, 2.0, 1.0 };
+
+// Append the four kinds of matrix (i.e. with and without offsets, diagonal or not).
+void CreateMatrixOps(OCIO::OpRcPtrVec & ops, int kind)
+{
+    const double noOffsets[4] = { 0., 0., 0., 0. };
+    switch (kind)
+    {
+        case 0: OCIO::CreateMatrixOp(ops, Matrix, OCIO::TRANSFORM_DIR_FORWARD); break;
+        case 1: OCIO::CreateMatrixOffsetOp(ops, Matrix, Offsets, OCIO::TRANSFORM_DIR_FORWARD); break;
+        case 2: OCIO::CreateScaleOffsetOp(ops, Scales, noOffsets, OCIO::TRANSFORM_DIR_FORWARD); break;
+        case 3: OCIO::CreateScaleOffsetOp(ops, Scales, Offsets, OCIO::TRANSFORM_DIR_FORWARD); break;
+    }
+}
+
+void CreateRangeOps(OCIO::OpRcPtrVec & ops, int kind)
+{
+    const double empty = OCIO::RangeOpData::EmptyValue();
+    switch (kind)
+    {
+        case 0: OCIO::CreateRangeOp(ops, -0.1, 1.5, 0.0, 1.0, OCIO::TRANSFORM_DIR_FORWARD); break;
+        case 1: OCIO::CreateRangeOp(ops, 0.0, 1.0, 0.0, 1.0, OCIO::TRANSFORM_DIR_FORWARD); break;
+        case 2: OCIO::CreateRangeOp(ops, 0.0, empty, 0.0, empty, OCIO::TRANSFORM_DIR_FORWARD); break;
+        case 3: OCIO::CreateRangeOp(ops, empty, 1.0, empty, 1.0, OCIO::TRANSFORM_DIR_FORWARD); break;
+    }
+}
+
+// Append the six kinds of log.
+void CreateLogOps(OCIO::OpRcPtrVec & ops, int kind)
+{
+    const double logSlope[3]  = { 0.18, 0.2, 0.22 };
+    const double logOffset[3] = { 0.6, 0.55, 0.5 };
+    const double linSlope[3]  = { 1.1, 1.0, 0.9 };
+    const double linOffset[3] = { 0.05, 0.01, 0.02 };
+
+    const OCIO::TransformDirection dir = kind % 2 ? OCIO::TRANSFORM_DIR_INVERSE
+                                                  : OCIO::TRANSFORM_DIR_FORWARD;
+    switch (kind / 2)
+    {
+        case 0:
+        {
+            OCIO::CreateLogOp(ops, kind % 2 ? 10. : 2., dir);
+            break;
+        }
+        case 1:
+        {
+            OCIO::CreateLogOp(ops, 10., logSlope, logOffset, linSlope, linOffset, dir);
+            break;
+        }
+        case 2:
+        {
+            const OCIO::LogOpData::Params params{ 0.2, 0.6, 1.1, 0.05, 0.1, 1.2 };
+            auto log = std::make_shared<OCIO::LogOpData>(2., params, params, params,
+                                                         OCIO::TRANSFORM_DIR_FORWARD);
+            OCIO::CreateLogOp(ops, log, dir);
+            break;
+        }
+    }
+}
+
+// Append the seven kinds of gamma renderer.
+void CreateGammaOps(OCIO::OpRcPtrVec & ops, OCIO::GammaOpData::Style style)
+{
+    const bool moncurve = style == OCIO::GammaOpData::MONCURVE_FWD
+                          || style == OCIO::GammaOpData::MONCURVE_REV
+                          || style == OCIO::GammaOpData::MONCURVE_MIRROR_FWD
+                          || style == OCIO::GammaOpData::MONCURVE_MIRROR_REV;
+
+    auto gamma = moncurve
+        ? std::make_shared<OCIO::GammaOpData>(style,
+                                              OCIO::GammaOpData::Params{ 2.4, 0.055 },
+                                              OCIO::GammaOpData::Params{ 2.2, 0.099 },
+                                              OCIO::GammaOpData::Params{ 2.6, 0.1 },
+                                              OCIO::GammaOpData::Params{ 1.8, 0.02 })
+        : std::make_shared<OCIO::GammaOpData>(style,
+                                              OCIO::GammaOpData::Params{ 2.4 },
+                                              OCIO::GammaOpData::Params{ 2.2 },
+                                              OCIO::GammaOpData::Params{ 1.8 },
+                                              OCIO::GammaOpData::Params{ 1.2 });
+
+    OCIO::CreateGammaOp(ops, gamma, OCIO::TRANSFORM_DIR_FORWARD);
+}
+
+const OCIO::GammaOpData::Style GammaStyles[] = { OCIO::GammaOpData::BASIC_FWD,
+                                                 OCIO::GammaOpData::BASIC_REV,
+                                                 OCIO::GammaOpData::BASIC_MIRROR_FWD,
+                                                 OCIO::GammaOpData::BASIC_PASS_THRU_REV,
+                                                 OCIO::GammaOpData::MONCURVE_FWD,
+                                                 OCIO::GammaOpData::MONCURVE_REV,
+                                                 OCIO::GammaOpData::MONCURVE_MIRROR_FWD,
+                                                 OCIO::GammaOpData::MONCURVE_MIRROR_REV };
+
+} // anon.
+
+#if OCIO_USE_SSE2
+
+OCIO_ADD_TEST(FusedOpCPU, range_matrix_range)
+{
+    for (int first = 0; first < 4; ++first)
+    {
+        // Only the non diagonal matrices.
+        for (int matrix = 0; matrix < 2; ++matrix)
+        {
+            for (int last = 0; last < 4; ++last)
+            {
+                OCIO::OpRcPtrVec ops;
+                CreateRangeOps(ops, first);
+                CreateMatrixOps(ops, matrix);
+                CreateRangeOps(ops, last);
+                ValidateFusedOps(ops, __LINE__);
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(FusedOpCPU, matrix_log)
+{
+    for (int matrix = 0; matrix < 4; ++matrix)
+    {
+        for (int log = 0; log < 6; ++log)
+        {
+            {
+                OCIO::OpRcPtrVec ops;
+                CreateMatrixOps(ops, matrix);
+                CreateLogOps(ops, log);
+                ValidateFusedOps(ops, __LINE__);
+            }
+            {
+                OCIO::OpRcPtrVec ops;
+                CreateLogOps(ops, log);
+                CreateMatrixOps(ops, matrix);
+                ValidateFusedOps(ops, __LINE__);
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(FusedOpCPU, matrix_gamma)
+{
+    for (int matrix = 0; matrix < 4; ++matrix)
+    {
+        for (const auto style : GammaStyles)
+        {
+            {
+                OCIO::OpRcPtrVec ops;
+                CreateMatrixOps(ops, matrix);
+                CreateGammaOps(ops, style);
+                ValidateFusedOps(ops, __LINE__);
+            }
+            {
+                OCIO::OpRcPtrVec ops;
+                CreateGammaOps(ops, style);
+                CreateMatrixOps(ops, matrix);
+                ValidateFusedOps(ops, __LINE__);
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(FusedOpCPU, no_fusion)
+{
+    OCIO::OpRcPtrVec ops;
+    CreateMatrixOps(ops, 1);
+    CreateLogOps(ops, 0);
+    CreateRangeOps(ops, 0);
+    CreateLogOps(ops, 1);
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    size_t numFusedOps = 1;
+
+    // The log is only fused with the fast log, exp & pow.
+    OCIO_CHECK_ASSERT(!OCIO::GetFusedRenderer(ops, 0, false, numFusedOps));
+    OCIO_CHECK_EQUAL(numFusedOps, 0);
+
+    OCIO_CHECK_ASSERT(OCIO::GetFusedRenderer(ops, 0, true, numFusedOps));
+    OCIO_CHECK_EQUAL(numFusedOps, 2);
+
+    // No recognized sequence.
+    OCIO_CHECK_ASSERT(!OCIO::GetFusedRenderer(ops, 1, true, numFusedOps));
+    OCIO_CHECK_EQUAL(numFusedOps, 0);
+    OCIO_CHECK_ASSERT(!OCIO::GetFusedRenderer(ops, 2, true, numFusedOps));
+    OCIO_CHECK_EQUAL(numFusedOps, 0);
+
+    // The last op.
+    OCIO_CHECK_ASSERT(!OCIO::GetFusedRenderer(ops, 3, true, numFusedOps));
+    OCIO_CHECK_EQUAL(numFusedOps, 0);
+
+    // A diagonal matrix between two ranges.
+    OCIO::OpRcPtrVec rangeOps;
+    CreateRangeOps(rangeOps, 0);
+    CreateMatrixOps(rangeOps, 3);
+    CreateRangeOps(rangeOps, 1);
+    OCIO_CHECK_NO_THROW(rangeOps.finalize());
+
+    OCIO_CHECK_ASSERT(!OCIO::GetFusedRenderer(rangeOps, 0, true, numFusedOps));
+    OCIO_CHECK_EQUAL(numFusedOps, 0);
+}
+
+#endif // OCIO_USE_SSE2
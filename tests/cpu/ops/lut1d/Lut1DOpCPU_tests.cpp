@@ -1759,6 +1759,79 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_identity_half_code)
     }
 }
 
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_half_code_half_storage)
+{
+    OCIO::Lut1DOpDataRcPtr lutData
+        = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                              65536, false);
+    OCIO_CHECK_NO_THROW(lutData->validate());
+    OCIO_CHECK_NO_THROW(lutData->finalize());
+
+    OCIO::ConstLut1DOpDataRcPtr constLut = lutData;
+    OCIO::ConstOpCPURcPtr cpuOp;
+    OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut, OCIO::BIT_DEPTH_F32,
+                                                       OCIO::BIT_DEPTH_F32, true));
+
+    using HalfCodeRenderer = OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>;
+    auto renderer = OCIO::DynamicPtrCast<const HalfCodeRenderer>(cpuOp);
+    OCIO_REQUIRE_ASSERT(renderer);
+    OCIO_CHECK_ASSERT(renderer->isHalfStorage());
+
+    // The identity is exact for the half float values.
+    const std::vector<float> inImg = {
+        0.0f,   1.0f,     -2.5f,      1.0f,
+        0.125f, 65504.0f, -65504.0f,  0.5f,
+        HALF_NRM_MIN, -HALF_MIN, 0.0009765625f, 0.0f };
+
+    std::vector<float> outImg(inImg.size());
+    cpuOp->apply(inImg.data(), outImg.data(), 3);
+
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(outImg[idx], inImg[idx]);
+    }
+
+    // A non-identity LUT gives the float storage results within the half float precision.
+    OCIO::Array::Values & values = lutData->getArray().getValues();
+    for (auto & val : values)
+    {
+        val = std::isnan(val) ? val : std::copysign(std::sqrt(std::fabs(val)), val);
+    }
+    OCIO_CHECK_NO_THROW(lutData->finalize());
+
+    OCIO::ConstOpCPURcPtr floatOp;
+    OCIO_CHECK_NO_THROW(floatOp = OCIO::GetLut1DRenderer(constLut, OCIO::BIT_DEPTH_F32,
+                                                         OCIO::BIT_DEPTH_F32));
+    OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut, OCIO::BIT_DEPTH_F32,
+                                                       OCIO::BIT_DEPTH_F32, true));
+
+    constexpr long numPixels = 1000;
+    std::vector<float> src(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        src[idx] = float((idx * 7919) % 2001) / 1000.0f - 1.0f;
+    }
+
+    std::vector<float> dst(numPixels * 4);
+    floatOp->apply(src.data(), dst.data(), numPixels);
+
+    std::vector<float> halfDst(numPixels * 4);
+    cpuOp->apply(src.data(), halfDst.data(), numPixels);
+
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        OCIO_CHECK_CLOSE(halfDst[idx], dst[idx], 1e-3f);
+    }
+
+    // Lookups and the other renderers keep their storage.
+    OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut, OCIO::BIT_DEPTH_F16,
+                                                       OCIO::BIT_DEPTH_F32, true));
+    using HalfCodeLookup = OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F16, OCIO::BIT_DEPTH_F32>;
+    auto lookup = OCIO::DynamicPtrCast<const HalfCodeLookup>(cpuOp);
+    OCIO_REQUIRE_ASSERT(lookup);
+    OCIO_CHECK_ASSERT(!lookup->isHalfStorage());
+}
+
 OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_identity)
 {
     // By default, this constructor creates an 'identity lut'.
@@ -1952,6 +2025,85 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_increasing)
     }
 }
 
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_brackets)
+{
+    // The bracketing tables must give exactly the same results as a search over the whole LUT.
+
+    auto checkLut = [](const std::vector<float> & lut, unsigned line)
+    {
+        const float * start = lut.data();
+        const float * end   = lut.data() + lut.size() - 1;
+
+        std::vector<unsigned> storage(OCIO::LutBrackets::GetNumIndices(start, end));
+        OCIO::LutBrackets brackets;
+        brackets.build(start, end, storage.data());
+
+        // A single interval i.e. the original search.
+        const unsigned wholeIndices[] = { 0, (unsigned)(end - start) };
+        OCIO::LutBrackets whole;
+        whole.indices = wholeIndices;
+
+        std::vector<float> values = {
+            std::numeric_limits<float>::quiet_NaN(),
+            std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity(),
+            0.f, -0.f, *start, *end };
+        for (size_t i = 0; i < lut.size(); ++i)
+        {
+            values.push_back(lut[i]);
+            values.push_back(std::nextafter(lut[i], -std::numeric_limits<float>::infinity()));
+            values.push_back(std::nextafter(lut[i], std::numeric_limits<float>::infinity()));
+            if (i + 1 < lut.size())
+            {
+                values.push_back(lut[i] + (lut[i + 1] - lut[i]) * 0.37f);
+            }
+        }
+
+        for (const float val : values)
+        {
+            for (const float flipSign : { 1.f, -1.f })
+            {
+                const float res = OCIO::FindLutInv(start, 2.f, end, brackets, flipSign, 0.5f, val);
+                const float ref = OCIO::FindLutInv(start, 2.f, end, whole, flipSign, 0.5f, val);
+                OCIO_CHECK_ASSERT_MESSAGE_FROM(
+                    (OCIO::IsNan(res) && OCIO::IsNan(ref)) || res == ref,
+                    "Value " + std::to_string(val) + " gives " + std::to_string(res)
+                        + " instead of " + std::to_string(ref), line);
+            }
+        }
+    };
+
+    // Uniformly spaced values.
+    std::vector<float> lut(1024);
+    for (size_t i = 0; i < lut.size(); ++i)
+    {
+        lut[i] = (float)i / 1023.f;
+    }
+    checkLut(lut, __LINE__);
+
+    // Gamma-like values with flat spots and negative values.
+    for (size_t i = 0; i < lut.size(); ++i)
+    {
+        lut[i] = std::pow((float)i / 1023.f, 3.f) * 100.f - 1.f;
+    }
+    std::fill(lut.begin() + 100, lut.begin() + 200, lut[100]);
+    std::fill(lut.begin() + 1000, lut.end(), lut[1000]);
+    checkLut(lut, __LINE__);
+
+    // Values spanning many orders of magnitude up to infinity (e.g. half domain LUTs).
+    for (size_t i = 0; i < lut.size(); ++i)
+    {
+        lut[i] = std::ldexp(1.f + (float)(i % 16) / 16.f, (int)(i / 16) - 40);
+    }
+    lut.back() = std::numeric_limits<float>::infinity();
+    checkLut(lut, __LINE__);
+
+    // Small LUTs.
+    checkLut({ 0.5f, 0.5f }, __LINE__);
+    checkLut({ -1.f, 2.f }, __LINE__);
+    checkLut({ 0.f, 0.f, 0.25f, 1.f, 1.f }, __LINE__);
+}
+
 OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_decreasing_reversals)
 {
     OCIO::Lut1DOpDataRcPtr lutData = std::make_shared<OCIO::Lut1DOpData>(12);
@@ -2,7 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <cmath>
 #include <limits>
+#include <vector>
 
 #include "ops/lut3d/Lut3DOpCPU.cpp"
 
@@ -55,3 +57,289 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+
+OCIO_ADD_TEST(Lut3DRenderer, layout)
+{
+    // Plain layout, blue changing fastest.
+    OCIO::Lut3DLayout layout = OCIO::CreateLut3DLayout(5, 4, 1);
+    OCIO_CHECK_ASSERT(!layout.isBricked());
+    OCIO_CHECK_EQUAL(layout.numFloats, 5 * 5 * 5 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(0, 0, 1), 4);
+    OCIO_CHECK_EQUAL(layout.offset(0, 1, 0), 5 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(1, 0, 0), 5 * 5 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(4, 3, 2), ((4 * 5 + 3) * 5 + 2) * 4);
+    OCIO_CHECK_EQUAL(layout.brickStep[0], 0);
+
+    // Bricked layout, padded to 2x2x2 bricks of 4x4x4 entries.
+    layout = OCIO::CreateLut3DLayout(5, 4, 4);
+    OCIO_CHECK_ASSERT(layout.isBricked());
+    OCIO_CHECK_EQUAL(layout.numFloats, 8 * 8 * 8 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(0, 0, 3), 3 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(0, 0, 4), 64 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(0, 1, 0), 4 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(0, 4, 0), 2 * 64 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(1, 0, 0), 16 * 4);
+    OCIO_CHECK_EQUAL(layout.offset(4, 0, 0), 4 * 64 * 4);
+
+    // Each entry has its own place in the buffer, and the float computation done by the SIMD
+    // renderers gives the same offsets.
+    std::vector<bool> used(layout.numFloats / 4, false);
+    for (int r = 0; r < 5; ++r)
+    {
+        for (int g = 0; g < 5; ++g)
+        {
+            for (int b = 0; b < 5; ++b)
+            {
+                const int offset = layout.offset(r, g, b);
+                OCIO_REQUIRE_ASSERT(offset >= 0 && offset < layout.numFloats);
+                OCIO_CHECK_ASSERT(!used[offset / 4]);
+                used[offset / 4] = true;
+            }
+        }
+
+        const float v = float(r);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float offset = v * float(layout.stride[axis])
+                                 + std::floor(v / float(layout.brickSize))
+                                   * float(layout.brickStep[axis]);
+            OCIO_CHECK_EQUAL(int(offset), layout.axisOffset(axis, r));
+        }
+    }
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, bricked_tetra)
+{
+    // The bricked layout is used for the large LUTs, including the grid sizes which are not a
+    // multiple of the brick size.
+    constexpr unsigned long dim = 67;
+    OCIO_REQUIRE_ASSERT(dim >= OCIO::LUT3D_BRICKED_MIN_DIM);
+    OCIO_REQUIRE_ASSERT(dim % OCIO::LUT3D_BRICK_SIZE != 0);
+
+    OCIO::Lut3DOpDataRcPtr lut
+        = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, dim);
+
+    OCIO::Array::Values & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); idx += 3)
+    {
+        const float r = values[idx];
+        const float g = values[idx + 1];
+        const float b = values[idx + 2];
+        values[idx]     = std::pow(r, 1.5f) + 0.1f * g;
+        values[idx + 1] = std::sqrt(g) * (1.0f - 0.2f * b);
+        values[idx + 2] = 0.5f * b + 0.3f * r * g;
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+
+    // The grid points give the LUT values.
+    std::vector<float> pixels;
+    std::vector<size_t> indices;
+    for (unsigned long r = 0; r < dim; r += 11)
+    {
+        for (unsigned long g = 0; g < dim; g += 5)
+        {
+            for (unsigned long b = 0; b < dim; b += 3)
+            {
+                pixels.push_back(float(r) / float(dim - 1));
+                pixels.push_back(float(g) / float(dim - 1));
+                pixels.push_back(float(b) / float(dim - 1));
+                pixels.push_back(1.0f);
+                indices.push_back(((r * dim + g) * dim + b) * 3);
+            }
+        }
+    }
+
+    renderer->apply(pixels.data(), pixels.data(), long(indices.size()));
+
+    for (size_t idx = 0; idx < indices.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(pixels[idx * 4 + 0], values[indices[idx] + 0], 1e-6f);
+        OCIO_CHECK_CLOSE(pixels[idx * 4 + 1], values[indices[idx] + 1], 1e-6f);
+        OCIO_CHECK_CLOSE(pixels[idx * 4 + 2], values[indices[idx] + 2], 1e-6f);
+        OCIO_CHECK_EQUAL(pixels[idx * 4 + 3], 1.0f);
+    }
+
+    // The vectorized path gives the same results as the scalar path (used for one pixel).
+    constexpr long numPixels = 1001;
+    std::vector<float> src(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        src[idx] = float((idx * 7919) % 1013) / 1000.0f - 0.005f;
+    }
+
+    std::vector<float> dst(numPixels * 4);
+    renderer->apply(src.data(), dst.data(), numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float pixel[4];
+        renderer->apply(&src[idx * 4], pixel, 1);
+
+        OCIO_CHECK_CLOSE(dst[idx * 4 + 0], pixel[0], 1e-5f);
+        OCIO_CHECK_CLOSE(dst[idx * 4 + 1], pixel[1], 1e-5f);
+        OCIO_CHECK_CLOSE(dst[idx * 4 + 2], pixel[2], 1e-5f);
+        OCIO_CHECK_EQUAL(dst[idx * 4 + 3], pixel[3]);
+    }
+
+    // All the available SIMD versions support the bricked layout.
+    std::vector<OCIO::apply_lut_func *> funcs;
+#if OCIO_USE_SSE2
+    if (OCIO::CPUInfo::instance().hasSSE2()) funcs.push_back(OCIO::applyTetrahedralSSE2);
+#endif
+#if OCIO_USE_AVX
+    if (OCIO::CPUInfo::instance().hasAVX()) funcs.push_back(OCIO::applyTetrahedralAVX);
+#endif
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2()) funcs.push_back(OCIO::applyTetrahedralAVX2);
+#endif
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512()) funcs.push_back(OCIO::applyTetrahedralAVX512);
+#endif
+
+    const OCIO::Lut3DLayout layout
+        = OCIO::CreateLut3DLayout(int(dim), 4, OCIO::LUT3D_BRICK_SIZE);
+    std::vector<float> optLut(layout.numFloats, 0.0f);
+    for (unsigned long r = 0; r < dim; ++r)
+    {
+        for (unsigned long g = 0; g < dim; ++g)
+        {
+            for (unsigned long b = 0; b < dim; ++b)
+            {
+                const size_t idx = ((r * dim + g) * dim + b) * 3;
+                float * entry = &optLut[layout.offset(int(r), int(g), int(b))];
+                entry[0] = values[idx];
+                entry[1] = values[idx + 1];
+                entry[2] = values[idx + 2];
+            }
+        }
+    }
+
+    for (auto func : funcs)
+    {
+        std::vector<float> res(numPixels * 4);
+        func(optLut.data(), layout, src.data(), res.data(), int(numPixels));
+
+        for (long idx = 0; idx < numPixels * 4; ++idx)
+        {
+            OCIO_CHECK_CLOSE(res[idx], dst[idx], 1e-5f);
+        }
+    }
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, half_storage)
+{
+    for (unsigned long dim : { 33ul, 67ul })
+    {
+        OCIO::Lut3DOpDataRcPtr lut
+            = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, dim);
+
+        OCIO::Array::Values & values = lut->getArray().getValues();
+        for (size_t idx = 0; idx < values.size(); idx += 3)
+        {
+            const float r = values[idx];
+            const float g = values[idx + 1];
+            const float b = values[idx + 2];
+            values[idx]     = std::pow(r, 1.5f) + 0.1f * g;
+            values[idx + 1] = std::sqrt(g) * (1.0f - 0.2f * b);
+            values[idx + 2] = 0.5f * b + 0.3f * r * g;
+        }
+
+        OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+        OCIO::ConstOpCPURcPtr halfRenderer = OCIO::GetLut3DRenderer(lutConst, true);
+
+        auto tetra = OCIO::DynamicPtrCast<const OCIO::Lut3DTetrahedralRenderer>(halfRenderer);
+        OCIO_REQUIRE_ASSERT(tetra);
+        OCIO_CHECK_EQUAL(tetra->isHalfStorage(), OCIO::GetTetrahedralHalfLutFunc() != nullptr);
+
+        constexpr long numPixels = 1001;
+        std::vector<float> src(numPixels * 4);
+        for (long idx = 0; idx < numPixels * 4; ++idx)
+        {
+            src[idx] = float((idx * 7919) % 1013) / 1000.0f - 0.005f;
+        }
+
+        std::vector<float> dst(numPixels * 4);
+        renderer->apply(src.data(), dst.data(), numPixels);
+
+        std::vector<float> halfDst(numPixels * 4);
+        halfRenderer->apply(src.data(), halfDst.data(), numPixels);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // The half float LUT values are within 2^-11 (relative).
+            OCIO_CHECK_CLOSE(halfDst[idx * 4 + 0], dst[idx * 4 + 0], 1e-3f);
+            OCIO_CHECK_CLOSE(halfDst[idx * 4 + 1], dst[idx * 4 + 1], 1e-3f);
+            OCIO_CHECK_CLOSE(halfDst[idx * 4 + 2], dst[idx * 4 + 2], 1e-3f);
+            OCIO_CHECK_EQUAL(halfDst[idx * 4 + 3], dst[idx * 4 + 3]);
+
+            // The scalar path (used for one pixel) gives the same results.
+            float pixel[4];
+            halfRenderer->apply(&src[idx * 4], pixel, 1);
+
+            OCIO_CHECK_CLOSE(pixel[0], halfDst[idx * 4 + 0], 1e-5f);
+            OCIO_CHECK_CLOSE(pixel[1], halfDst[idx * 4 + 1], 1e-5f);
+            OCIO_CHECK_CLOSE(pixel[2], halfDst[idx * 4 + 2], 1e-5f);
+            OCIO_CHECK_EQUAL(pixel[3], halfDst[idx * 4 + 3]);
+        }
+
+        // All the available SIMD versions support the half float LUT.
+        std::vector<OCIO::apply_half_lut_func *> funcs;
+#if OCIO_USE_AVX && OCIO_USE_F16C
+        if (OCIO::CPUInfo::instance().hasAVX() && OCIO::CPUInfo::instance().hasF16C())
+        {
+            funcs.push_back(OCIO::applyTetrahedralAVXHalf);
+        }
+#endif
+#if OCIO_USE_AVX2 && OCIO_USE_F16C
+        if (OCIO::CPUInfo::instance().hasAVX2() && OCIO::CPUInfo::instance().hasF16C())
+        {
+            funcs.push_back(OCIO::applyTetrahedralAVX2Half);
+        }
+#endif
+#if OCIO_USE_AVX512
+        if (OCIO::CPUInfo::instance().hasAVX512())
+        {
+            funcs.push_back(OCIO::applyTetrahedralAVX512Half);
+        }
+#endif
+
+        const OCIO::Lut3DLayout layout = OCIO::CreateLut3DLayout(
+            int(dim), 4, dim >= OCIO::LUT3D_BRICKED_MIN_DIM ? OCIO::LUT3D_BRICK_SIZE : 1);
+        std::vector<half> optLut(layout.numFloats, 0.0f);
+        for (unsigned long r = 0; r < dim; ++r)
+        {
+            for (unsigned long g = 0; g < dim; ++g)
+            {
+                for (unsigned long b = 0; b < dim; ++b)
+                {
+                    const size_t idx = ((r * dim + g) * dim + b) * 3;
+                    half * entry = &optLut[layout.offset(int(r), int(g), int(b))];
+                    entry[0] = values[idx];
+                    entry[1] = values[idx + 1];
+                    entry[2] = values[idx + 2];
+                }
+            }
+        }
+
+        for (auto func : funcs)
+        {
+            std::vector<float> res(numPixels * 4);
+            func(optLut.data(), layout, src.data(), res.data(), int(numPixels));
+
+            for (long idx = 0; idx < numPixels * 4; ++idx)
+            {
+                OCIO_CHECK_CLOSE(res[idx], dst[idx], 1e-3f);
+            }
+        }
+
+        // The LUT is kept as floats when the values do not fit in half floats.
+        values[3] = 1e5f;
+        OCIO::ConstOpCPURcPtr floatRenderer = OCIO::GetLut3DRenderer(lutConst, true);
+        tetra = OCIO::DynamicPtrCast<const OCIO::Lut3DTetrahedralRenderer>(floatRenderer);
+        OCIO_REQUIRE_ASSERT(tetra);
+        OCIO_CHECK_ASSERT(!tetra->isHalfStorage());
+    }
+}
@@ -65,6 +65,43 @@ OCIO_ADD_TEST(Lut3DOpData, clone)
     OCIO_CHECK_ASSERT(pClone->getArray()==ref.getArray());
 }
 
+OCIO_ADD_TEST(Lut3DOpData, cache_id_digest)
+{
+    OCIO::Lut3DOpData l(OCIO::INTERP_LINEAR, 17);
+    l.getArray()[0] = 0.1f;
+
+    const std::string id = l.getCacheID();
+    const OCIO::CacheIDDigest digest = l.getCacheIDDigest();
+
+    // The memoized array digest gives the same results.
+    l.finalize();
+    OCIO_CHECK_EQUAL(l.getCacheID(), id);
+    OCIO_CHECK_ASSERT(l.getCacheIDDigest() == digest);
+    OCIO_CHECK_ASSERT(l.getCacheIDDigest() == digest);
+
+    // Changing the values invalidates the memoized digest.
+    l.getArray()[0] = 0.2f;
+    OCIO_CHECK_NE(l.getCacheID(), id);
+    OCIO_CHECK_ASSERT(l.getCacheIDDigest() != digest);
+
+    l.getArray()[0] = 0.1f;
+    l.finalize();
+    OCIO_CHECK_EQUAL(l.getCacheID(), id);
+    OCIO_CHECK_ASSERT(l.getCacheIDDigest() == digest);
+
+    // The other parameters are part of the digest.
+    l.setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    OCIO_CHECK_ASSERT(l.getCacheIDDigest() != digest);
+    l.setInterpolation(OCIO::INTERP_LINEAR);
+
+    l.setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_ASSERT(l.getCacheIDDigest() != digest);
+    l.setDirection(OCIO::TRANSFORM_DIR_FORWARD);
+
+    l.setID("uid");
+    OCIO_CHECK_ASSERT(l.getCacheIDDigest() != digest);
+}
+
 OCIO_ADD_TEST(Lut3DOpData, not_supported_length)
 {
     OCIO_CHECK_NO_THROW(OCIO::Lut3DOpData{ OCIO::Lut3DOpData::maxSupportedLength });
@@ -358,3 +395,70 @@ OCIO_ADD_TEST(Lut3DOpData, compose_inverse_luts)
     }
 
 }
+
+OCIO_ADD_TEST(Lut3DOpData, compose_sequence)
+{
+    auto MakeLut = [](unsigned long gridSize, float scale, float power) -> OCIO::Lut3DOpDataRcPtr
+    {
+        OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(gridSize);
+        for (auto & val : lut->getArray().getValues())
+        {
+            val = scale * std::pow(val, power);
+        }
+        return lut;
+    };
+
+    OCIO::ConstLut3DOpDataRcPtr lut1 = MakeLut(33, 0.9f, 2.0f);
+    OCIO::ConstLut3DOpDataRcPtr lut2 = MakeLut(17, 1.0f, 0.5f);
+    OCIO::ConstLut3DOpDataRcPtr lut3 = MakeLut(9, 1.1f, 1.2f);
+
+    // When the first LUT has the largest grid, the sequence gives the same result as composing
+    // the LUTs pair by pair.
+    OCIO::Lut3DOpDataRcPtr composed;
+    OCIO_CHECK_NO_THROW(composed = OCIO::Lut3DOpData::Compose({ lut1, lut2, lut3 }, 33));
+    OCIO_CHECK_EQUAL(composed->getArray().getLength(), 33);
+    OCIO_CHECK_EQUAL(composed->getDirection(), OCIO::TRANSFORM_DIR_FORWARD);
+
+    OCIO::ConstLut3DOpDataRcPtr pair = OCIO::Lut3DOpData::Compose(lut1, lut2);
+    OCIO::ConstLut3DOpDataRcPtr pairs = OCIO::Lut3DOpData::Compose(pair, lut3);
+    OCIO_CHECK_ASSERT(composed->getArray().getValues() == pairs->getArray().getValues());
+
+    // Otherwise the identity is resampled once at the requested grid size.
+    OCIO_CHECK_NO_THROW(composed = OCIO::Lut3DOpData::Compose({ lut3, lut2, lut1 }, 33));
+    OCIO_CHECK_EQUAL(composed->getArray().getLength(), 33);
+
+    pair = OCIO::Lut3DOpData::Compose(lut3, lut2);
+    pairs = OCIO::Lut3DOpData::Compose(pair, lut1);
+    OCIO_CHECK_EQUAL(pairs->getArray().getLength(), 33);
+
+    const auto & values = composed->getArray().getValues();
+    const auto & pairValues = pairs->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(values[idx], pairValues[idx], 1e-2f);
+    }
+
+    // A sequence of inverse LUTs is composed as the inverse of the reversed forward sequence.
+    OCIO::ConstLut3DOpDataRcPtr inv1 = lut1->inverse();
+    OCIO::ConstLut3DOpDataRcPtr inv2 = MakeLut(33, 1.0f, 0.5f)->inverse();
+    OCIO::ConstLut3DOpDataRcPtr inv3 = MakeLut(33, 1.1f, 1.2f)->inverse();
+
+    OCIO_CHECK_NO_THROW(composed = OCIO::Lut3DOpData::Compose({ inv1, inv2, inv3 }, 33));
+    OCIO_CHECK_EQUAL(composed->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_EQUAL(inv1->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+
+    pair = OCIO::Lut3DOpData::Compose(inv1, inv2);
+    pairs = OCIO::Lut3DOpData::Compose(pair, inv3);
+    OCIO_CHECK_EQUAL(pairs->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+    const auto & invValues = composed->getArray().getValues();
+    const auto & invPairValues = pairs->getArray().getValues();
+    for (size_t idx = 0; idx < invValues.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(invValues[idx], invPairValues[idx], 1e-2f);
+    }
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Lut3DOpData::Compose(OCIO::ConstLut3DOpDataRcPtrVec{}, 33),
+                          OCIO::Exception, "empty list");
+    OCIO_CHECK_THROW_WHAT(OCIO::Lut3DOpData::Compose({ lut1, lut2 }, 130),
+                          OCIO::Exception, "Maximum supported length is 129");
+}
@@ -120,3 +120,116 @@ OCIO_ADD_TEST(MatrixOpCPU, matrix_renderer)
     OCIO_CHECK_EQUAL(rgba[3], 2.f);
 }
 
+
+OCIO_ADD_TEST(MatrixOpCPU, rgb_apply)
+{
+    // The packed RGB processing gives the RGBA results of a zero alpha.
+
+    for (const bool diagonal : { true, false })
+    {
+        for (const bool withOffsets : { false, true })
+        {
+            OCIO::MatrixOpDataRcPtr mat(OCIO::MatrixOpData::CreateDiagonalMatrix(2.0));
+            if (!diagonal)
+            {
+                mat->setArrayValue(1, 0.25);
+                mat->setArrayValue(3, 0.5);
+                mat->setArrayValue(6, -0.75);
+            }
+            if (withOffsets)
+            {
+                mat->setOffsetValue(0, 1.f);
+                mat->setOffsetValue(1, 2.f);
+                mat->setOffsetValue(2, 3.f);
+                mat->setOffsetValue(3, 4.f);
+            }
+
+            OCIO::ConstMatrixOpDataRcPtr m = mat;
+            OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+            OCIO_REQUIRE_ASSERT(op->hasRGBApply());
+
+            float rgba[8] = { 4.f, 3.f, 2.f, 0.f, -1.f, 0.5f, 7.f, 0.f };
+            float rgb[6]  = { 4.f, 3.f, 2.f,      -1.f, 0.5f, 7.f      };
+            float out[6]  = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+
+            op->apply(rgba, rgba, 2);
+            op->applyRGB(rgb, out, 2);
+            op->applyRGB(rgb, rgb, 2);
+
+            for (int pix = 0; pix < 2; ++pix)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    OCIO_CHECK_EQUAL(out[3 * pix + c], rgba[4 * pix + c]);
+                    OCIO_CHECK_EQUAL(rgb[3 * pix + c], rgba[4 * pix + c]);
+                }
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(MatrixOpCPU, planar_apply)
+{
+    // The planar processing gives the RGBA results, a missing alpha plane being 0.
+
+    for (const bool diagonal : { true, false })
+    {
+        for (const bool withOffsets : { false, true })
+        {
+            OCIO::MatrixOpDataRcPtr mat(OCIO::MatrixOpData::CreateDiagonalMatrix(2.0));
+            if (!diagonal)
+            {
+                mat->setArrayValue(1, 0.25);
+                mat->setArrayValue(3, 0.5);
+                mat->setArrayValue(6, -0.75);
+                mat->setArrayValue(11, 0.125);
+            }
+            if (withOffsets)
+            {
+                mat->setOffsetValue(0, 1.f);
+                mat->setOffsetValue(1, 2.f);
+                mat->setOffsetValue(2, 3.f);
+                mat->setOffsetValue(3, 4.f);
+            }
+
+            OCIO::ConstMatrixOpDataRcPtr m = mat;
+            OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+            OCIO_REQUIRE_ASSERT(op->hasPlanarApply());
+
+            // Five pixels to also process the values beyond the SIMD width.
+            float rgba[20] = { 4.f, 3.f, 2.f, 0.5f,   -1.f, 0.5f, 7.f, 1.f,
+                               0.f, 1.f, 2.f, 3.f,     5.f, -2.f, 1.f, 0.25f,
+                               0.1f, 0.2f, 0.3f, 0.4f };
+            float noAlpha[20];
+            for (int idx = 0; idx < 20; ++idx)
+            {
+                noAlpha[idx] = (idx % 4 == 3) ? 0.f : rgba[idx];
+            }
+
+            float planes[4][5];
+            float planesNoAlpha[3][5];
+            for (int pix = 0; pix < 5; ++pix)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    planes[c][pix] = rgba[4 * pix + c];
+                    if (c < 3) planesNoAlpha[c][pix] = rgba[4 * pix + c];
+                }
+            }
+
+            op->apply(rgba, rgba, 5);
+            op->apply(noAlpha, noAlpha, 5);
+            op->applyPlanar(planes[0], planes[1], planes[2], planes[3], 5);
+            op->applyPlanar(planesNoAlpha[0], planesNoAlpha[1], planesNoAlpha[2], nullptr, 5);
+
+            for (int pix = 0; pix < 5; ++pix)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    OCIO_CHECK_EQUAL(planes[c][pix], rgba[4 * pix + c]);
+                    if (c < 3) OCIO_CHECK_EQUAL(planesNoAlpha[c][pix], noAlpha[4 * pix + c]);
+                }
+            }
+        }
+    }
+}
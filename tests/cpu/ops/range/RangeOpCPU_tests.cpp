@@ -341,3 +341,41 @@ OCIO_ADD_TEST(RangeOpCPU, inverse)
     OCIO_CHECK_CLOSE(image[10], 1.500f, g_error);
     OCIO_CHECK_CLOSE(image[11], 0.000f, g_error);
 }
+
+OCIO_ADD_TEST(RangeOpCPU, rgb_apply)
+{
+    // The packed RGB processing gives the same red, green and blue results as the RGBA one.
+
+    const double empty = OCIO::RangeOpData::EmptyValue();
+    const double bounds[4][4] = { {  0., 1.5, 0.5, 1.0 },     // Scale with clamping.
+                                  { 0.1, 0.9, 0.1, 0.9 },     // Clamping only.
+                                  { 0.1, empty, 0.1, empty }, // Low clamping only.
+                                  { empty, 0.9, empty, 0.9 }  // High clamping only.
+                                };
+
+    for (const auto & b : bounds)
+    {
+        OCIO::ConstRangeOpDataRcPtr r
+            = std::make_shared<OCIO::RangeOpData>(b[0], b[1], b[2], b[3]);
+        OCIO::ConstOpCPURcPtr op = OCIO::GetRangeRenderer(r);
+        OCIO_REQUIRE_ASSERT(op->hasRGBApply());
+
+        float rgba[12] = { -0.50f, -0.25f, 0.50f, 0.5f,
+                            0.75f,  1.00f, 1.25f, 1.0f,
+                            1.25f,  1.50f, 1.75f, 0.0f };
+        float rgb[9]   = { -0.50f, -0.25f, 0.50f,
+                            0.75f,  1.00f, 1.25f,
+                            1.25f,  1.50f, 1.75f };
+
+        op->apply(rgba, rgba, 3);
+        op->applyRGB(rgb, rgb, 3);
+
+        for (int pix = 0; pix < 3; ++pix)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                OCIO_CHECK_EQUAL(rgb[3 * pix + c], rgba[4 * pix + c]);
+            }
+        }
+    }
+}
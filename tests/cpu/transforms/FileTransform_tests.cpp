@@ -206,10 +206,10 @@ bool FormatExtensionFoundByName(const std::string & extension, const std::string
 OCIO_ADD_TEST(FileTransform, all_formats)
 {
     OCIO::FormatRegistry & formatRegistry = OCIO::FormatRegistry::GetInstance();
-    OCIO_CHECK_EQUAL(19, formatRegistry.getNumRawFormats());
-    OCIO_CHECK_EQUAL(24, formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_READ));
-    OCIO_CHECK_EQUAL(12, formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_BAKE));
-    OCIO_CHECK_EQUAL(5,  formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_WRITE));
+    OCIO_CHECK_EQUAL(20, formatRegistry.getNumRawFormats());
+    OCIO_CHECK_EQUAL(25, formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_READ));
+    OCIO_CHECK_EQUAL(15, formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_BAKE));
+    OCIO_CHECK_EQUAL(8,  formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_WRITE));
 
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("3dl", "flame"));
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("cc", "ColorCorrection"));
@@ -226,6 +226,7 @@ OCIO_ADD_TEST(FileTransform, all_formats)
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("lut", "houdini"));
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("lut", "Discreet 1D LUT"));
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("mga", "pandora_mga"));
+    OCIO_CHECK_ASSERT(FormatNameFoundByExtension("olut", "ocio_binary_lut"));
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("spi1d", "spi1d"));
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("spi3d", "spi3d"));
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("spimtx", "spimtx"));
@@ -256,6 +257,9 @@ OCIO_ADD_TEST(FileTransform, all_formats)
     OCIO_CHECK_ASSERT(FormatExtensionFoundByName("lut", "Discreet 1D LUT"));
     OCIO_CHECK_ASSERT(FormatExtensionFoundByName("m3d", "pandora_m3d"));
     OCIO_CHECK_ASSERT(FormatExtensionFoundByName("mga", "pandora_mga"));
+    OCIO_CHECK_ASSERT(FormatExtensionFoundByName("olut", "ocio_binary_lut"));
+    OCIO_CHECK_ASSERT(FormatExtensionFoundByName("olut", "ocio_binary_lut_half"));
+    OCIO_CHECK_ASSERT(FormatExtensionFoundByName("olut", "ocio_binary_lut_compressed"));
     OCIO_CHECK_ASSERT(FormatExtensionFoundByName("spi1d", "spi1d"));
     OCIO_CHECK_ASSERT(FormatExtensionFoundByName("spi3d", "spi3d"));
     OCIO_CHECK_ASSERT(FormatExtensionFoundByName("spimtx", "spimtx"));
@@ -70,13 +70,14 @@ std::string GetFormatName(const std::string & extension)
 
 OCIO_ADD_TEST(GroupTransform, write_formats)
 {
-    OCIO_CHECK_EQUAL(OCIO::GroupTransform::GetNumWriteFormats(), 5);
+    OCIO_CHECK_EQUAL(OCIO::GroupTransform::GetNumWriteFormats(), 8);
 
     OCIO_CHECK_EQUAL(GetFormatName("CLF"), OCIO::FILEFORMAT_CLF);
     OCIO_CHECK_EQUAL(GetFormatName("CTF"), OCIO::FILEFORMAT_CTF);
     OCIO_CHECK_EQUAL(GetFormatName("cc"), OCIO::FILEFORMAT_COLOR_CORRECTION);
     OCIO_CHECK_EQUAL(GetFormatName("ccc"), OCIO::FILEFORMAT_COLOR_CORRECTION_COLLECTION);
     OCIO_CHECK_EQUAL(GetFormatName("cdl"), OCIO::FILEFORMAT_COLOR_DECISION_LIST);
+    OCIO_CHECK_EQUAL(GetFormatName("olut"), "ocio_binary_lut");
     OCIO_CHECK_ASSERT(GetFormatName("XXX").empty());
 }
 
@@ -0,0 +1,3137 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "GLSLInterpreter.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Maximum number of float components of a non-array value (i.e. mat4).
+constexpr unsigned MaxComponents = 16;
+// Maximum number of arguments of a function call.
+constexpr unsigned MaxArguments  = 16;
+// Protect against infinite loops in a faulty shader program.
+constexpr unsigned MaxLoopIterations = 1 << 20;
+// Size (in floats) of the stack holding the local variables of the function calls.
+constexpr size_t StackSize = 1 << 16;
+
+void ThrowError(unsigned line, const std::string & msg)
+{
+    std::ostringstream oss;
+    oss << "GLSL interpreter: line " << line << ": " << msg;
+    throw Exception(oss.str().c_str());
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Types
+
+enum BaseType : uint8_t
+{
+    TYPE_VOID = 0,
+    TYPE_BOOL,
+    TYPE_INT,
+    TYPE_FLOAT,
+    TYPE_SAMPLER1D,
+    TYPE_SAMPLER2D,
+    TYPE_SAMPLER3D
+};
+
+// All the values are stored as floats i.e. ints & bools use exact float values. Matrices
+// are stored in column-major order.
+struct Type
+{
+    BaseType m_base{ TYPE_VOID };
+    uint8_t  m_rows{ 1 };
+    uint8_t  m_cols{ 1 };
+    unsigned m_arraySize{ 0 };
+
+    Type() = default;
+    Type(BaseType base, unsigned rows = 1, unsigned cols = 1)
+        :   m_base(base)
+        ,   m_rows((uint8_t)rows)
+        ,   m_cols((uint8_t)cols)
+    {
+    }
+
+    unsigned components() const { return m_rows * m_cols; }
+    unsigned storage() const { return components() * (m_arraySize ? m_arraySize : 1); }
+
+    bool isArray() const { return m_arraySize != 0; }
+    bool isScalar() const { return !isArray() && m_rows == 1 && m_cols == 1; }
+    bool isVector() const { return !isArray() && m_rows > 1 && m_cols == 1; }
+    bool isMatrix() const { return !isArray() && m_cols > 1; }
+    bool isNumeric() const { return m_base == TYPE_INT || m_base == TYPE_FLOAT; }
+    bool isSampler() const { return m_base >= TYPE_SAMPLER1D; }
+
+    Type elementType() const { return Type(m_base, m_rows, m_cols); }
+
+    bool operator==(const Type & t) const
+    {
+        return m_base == t.m_base && m_rows == t.m_rows
+            && m_cols == t.m_cols && m_arraySize == t.m_arraySize;
+    }
+    bool operator!=(const Type & t) const { return !(*this == t); }
+
+    std::string str() const
+    {
+        std::string name;
+        switch (m_base)
+        {
+            case TYPE_VOID:      name = "void"; break;
+            case TYPE_BOOL:      name = m_rows > 1 ? "bvec" : "bool"; break;
+            case TYPE_INT:       name = m_rows > 1 ? "ivec" : "int"; break;
+            case TYPE_FLOAT:     name = m_cols > 1 ? "mat" : (m_rows > 1 ? "vec" : "float"); break;
+            case TYPE_SAMPLER1D: name = "sampler1D"; break;
+            case TYPE_SAMPLER2D: name = "sampler2D"; break;
+            case TYPE_SAMPLER3D: name = "sampler3D"; break;
+        }
+        if (m_rows > 1 && !isSampler())
+        {
+            name += std::to_string(m_cols > 1 ? m_cols : m_rows);
+        }
+        if (m_arraySize)
+        {
+            name += "[" + std::to_string(m_arraySize) + "]";
+        }
+        return name;
+    }
+};
+
+// Return true if a value of type 'from' is implicitly convertible to the type 'to'.
+bool IsConvertible(const Type & from, const Type & to)
+{
+    if (from.m_rows != to.m_rows || from.m_cols != to.m_cols
+        || from.m_arraySize != to.m_arraySize)
+    {
+        return false;
+    }
+    return from.m_base == to.m_base || (from.m_base == TYPE_INT && to.m_base == TYPE_FLOAT);
+}
+
+bool ParseTypeName(const std::string & name, Type & type)
+{
+    static const std::unordered_map<std::string, Type> types
+    {
+        { "void",      Type(TYPE_VOID) },
+        { "bool",      Type(TYPE_BOOL) },
+        { "int",       Type(TYPE_INT) },
+        { "float",     Type(TYPE_FLOAT) },
+        { "vec2",      Type(TYPE_FLOAT, 2) },
+        { "vec3",      Type(TYPE_FLOAT, 3) },
+        { "vec4",      Type(TYPE_FLOAT, 4) },
+        { "ivec2",     Type(TYPE_INT, 2) },
+        { "ivec3",     Type(TYPE_INT, 3) },
+        { "ivec4",     Type(TYPE_INT, 4) },
+        { "bvec2",     Type(TYPE_BOOL, 2) },
+        { "bvec3",     Type(TYPE_BOOL, 3) },
+        { "bvec4",     Type(TYPE_BOOL, 4) },
+        { "mat2",      Type(TYPE_FLOAT, 2, 2) },
+        { "mat3",      Type(TYPE_FLOAT, 3, 3) },
+        { "mat4",      Type(TYPE_FLOAT, 4, 4) },
+        { "sampler1D", Type(TYPE_SAMPLER1D) },
+        { "sampler2D", Type(TYPE_SAMPLER2D) },
+        { "sampler3D", Type(TYPE_SAMPLER3D) },
+    };
+
+    const auto it = types.find(name);
+    if (it == types.end())
+    {
+        return false;
+    }
+    type = it->second;
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Tokenizer
+
+enum TokenKind
+{
+    TOKEN_IDENTIFIER = 0,
+    TOKEN_INT,
+    TOKEN_FLOAT,
+    TOKEN_PUNCTUATOR,
+    TOKEN_END
+};
+
+struct Token
+{
+    TokenKind   m_kind{ TOKEN_END };
+    std::string m_text;
+    unsigned    m_line{ 0 };
+};
+
+std::vector<Token> Tokenize(const std::string & src)
+{
+    static const char * punctuators[] =
+    {
+        "++", "--", "+=", "-=", "*=", "/=", "==", "!=", "<=", ">=", "&&", "||"
+    };
+
+    std::vector<Token> tokens;
+    unsigned line = 1;
+    size_t pos = 0;
+    const size_t size = src.size();
+
+    while (pos < size)
+    {
+        const char c = src[pos];
+
+        if (c == '\n')
+        {
+            ++line;
+            ++pos;
+        }
+        else if (std::isspace((unsigned char)c))
+        {
+            ++pos;
+        }
+        else if (c == '/' && pos + 1 < size && src[pos + 1] == '/')
+        {
+            pos = src.find('\n', pos);
+            if (pos == std::string::npos) pos = size;
+        }
+        else if (c == '/' && pos + 1 < size && src[pos + 1] == '*')
+        {
+            const size_t end = src.find("*/", pos + 2);
+            if (end == std::string::npos)
+            {
+                ThrowError(line, "unterminated comment.");
+            }
+            line += (unsigned)std::count(src.begin() + pos, src.begin() + end, '\n');
+            pos = end + 2;
+        }
+        else if (c == '#')
+        {
+            // Preprocessor directives (e.g. #version) have no effect on the interpreter.
+            pos = src.find('\n', pos);
+            if (pos == std::string::npos) pos = size;
+        }
+        else if (std::isalpha((unsigned char)c) || c == '_')
+        {
+            const size_t start = pos;
+            while (pos < size && (std::isalnum((unsigned char)src[pos]) || src[pos] == '_'))
+            {
+                ++pos;
+            }
+            tokens.push_back({ TOKEN_IDENTIFIER, src.substr(start, pos - start), line });
+        }
+        else if (std::isdigit((unsigned char)c)
+                 || (c == '.' && pos + 1 < size && std::isdigit((unsigned char)src[pos + 1])))
+        {
+            const size_t start = pos;
+            bool isFloat = false;
+            while (pos < size && std::isdigit((unsigned char)src[pos])) ++pos;
+            if (pos < size && src[pos] == '.')
+            {
+                isFloat = true;
+                ++pos;
+                while (pos < size && std::isdigit((unsigned char)src[pos])) ++pos;
+            }
+            if (pos < size && (src[pos] == 'e' || src[pos] == 'E'))
+            {
+                isFloat = true;
+                ++pos;
+                if (pos < size && (src[pos] == '+' || src[pos] == '-')) ++pos;
+                while (pos < size && std::isdigit((unsigned char)src[pos])) ++pos;
+            }
+            std::string text = src.substr(start, pos - start);
+            if (pos < size && (src[pos] == 'f' || src[pos] == 'F'))
+            {
+                isFloat = true;
+                ++pos;
+            }
+            tokens.push_back({ isFloat ? TOKEN_FLOAT : TOKEN_INT, text, line });
+        }
+        else
+        {
+            std::string text(1, c);
+            for (const char * p : punctuators)
+            {
+                if (src.compare(pos, 2, p) == 0)
+                {
+                    text = p;
+                    break;
+                }
+            }
+            pos += text.size();
+            tokens.push_back({ TOKEN_PUNCTUATOR, text, line });
+        }
+    }
+
+    tokens.push_back({ TOKEN_END, "", line });
+    return tokens;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Abstract syntax tree
+
+enum ExprKind
+{
+    EXPR_LITERAL = 0,
+    EXPR_VARIABLE,
+    EXPR_SWIZZLE,
+    EXPR_INDEX,
+    EXPR_NEGATE,
+    EXPR_NOT,
+    EXPR_INCDEC,
+    EXPR_BINARY,
+    EXPR_LOGICAL,
+    EXPR_ASSIGN,
+    EXPR_TERNARY,
+    EXPR_CALL,
+    EXPR_BUILTIN,
+    EXPR_CONSTRUCTOR,
+    EXPR_ARRAY_CONSTRUCTOR
+};
+
+enum BinaryOp
+{
+    OP_NONE = 0,
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_LT,
+    OP_GT,
+    OP_LE,
+    OP_GE,
+    OP_EQ,
+    OP_NE,
+    OP_AND,
+    OP_OR
+};
+
+enum BinaryMode
+{
+    MODE_COMPONENTWISE = 0,
+    MODE_MATRIX_VECTOR,
+    MODE_VECTOR_MATRIX,
+    MODE_MATRIX_MATRIX
+};
+
+// How to compute a binary operation on two operands of known types.
+struct BinaryInfo
+{
+    BinaryOp   m_op{ OP_NONE };
+    BinaryMode m_mode{ MODE_COMPONENTWISE };
+    // Component strides of the operands (i.e. 0 to broadcast a scalar).
+    unsigned   m_strideA{ 1 };
+    unsigned   m_strideB{ 1 };
+    // Number of components to process, or the shared dimension for matrix products.
+    unsigned   m_count{ 1 };
+    // Matrix dimensions for the matrix products.
+    unsigned   m_rowsA{ 0 };
+    unsigned   m_colsB{ 0 };
+    // Integer arithmetic (i.e. truncate the division).
+    bool       m_integer{ false };
+};
+
+enum Builtin
+{
+    BUILTIN_ABS = 0,
+    BUILTIN_SIGN,
+    BUILTIN_FLOOR,
+    BUILTIN_CEIL,
+    BUILTIN_FRACT,
+    BUILTIN_MOD,
+    BUILTIN_MIN,
+    BUILTIN_MAX,
+    BUILTIN_CLAMP,
+    BUILTIN_MIX,
+    BUILTIN_STEP,
+    BUILTIN_SMOOTHSTEP,
+    BUILTIN_SQRT,
+    BUILTIN_INVERSESQRT,
+    BUILTIN_POW,
+    BUILTIN_EXP,
+    BUILTIN_EXP2,
+    BUILTIN_LOG,
+    BUILTIN_LOG2,
+    BUILTIN_SIN,
+    BUILTIN_COS,
+    BUILTIN_TAN,
+    BUILTIN_ASIN,
+    BUILTIN_ACOS,
+    BUILTIN_ATAN,
+    BUILTIN_RADIANS,
+    BUILTIN_DEGREES,
+    BUILTIN_DOT,
+    BUILTIN_LENGTH,
+    BUILTIN_DISTANCE,
+    BUILTIN_NORMALIZE,
+    BUILTIN_CROSS,
+    BUILTIN_LESSTHAN,
+    BUILTIN_LESSTHANEQUAL,
+    BUILTIN_GREATERTHAN,
+    BUILTIN_GREATERTHANEQUAL,
+    BUILTIN_EQUAL,
+    BUILTIN_NOTEQUAL,
+    BUILTIN_ANY,
+    BUILTIN_ALL,
+    BUILTIN_NOT,
+    BUILTIN_TEXTURE1D,
+    BUILTIN_TEXTURE2D,
+    BUILTIN_TEXTURE3D
+};
+
+struct BuiltinInfo
+{
+    Builtin  m_id;
+    unsigned m_minArgs;
+    unsigned m_maxArgs;
+};
+
+bool FindBuiltin(const std::string & name, BuiltinInfo & info)
+{
+    static const std::unordered_map<std::string, BuiltinInfo> builtins
+    {
+        { "abs",              { BUILTIN_ABS,              1, 1 } },
+        { "sign",             { BUILTIN_SIGN,             1, 1 } },
+        { "floor",            { BUILTIN_FLOOR,            1, 1 } },
+        { "ceil",             { BUILTIN_CEIL,             1, 1 } },
+        { "fract",            { BUILTIN_FRACT,            1, 1 } },
+        { "mod",              { BUILTIN_MOD,              2, 2 } },
+        { "min",              { BUILTIN_MIN,              2, 2 } },
+        { "max",              { BUILTIN_MAX,              2, 2 } },
+        { "clamp",            { BUILTIN_CLAMP,            3, 3 } },
+        { "mix",              { BUILTIN_MIX,              3, 3 } },
+        { "step",             { BUILTIN_STEP,             2, 2 } },
+        { "smoothstep",       { BUILTIN_SMOOTHSTEP,       3, 3 } },
+        { "sqrt",             { BUILTIN_SQRT,             1, 1 } },
+        { "inversesqrt",      { BUILTIN_INVERSESQRT,      1, 1 } },
+        { "pow",              { BUILTIN_POW,              2, 2 } },
+        { "exp",              { BUILTIN_EXP,              1, 1 } },
+        { "exp2",             { BUILTIN_EXP2,             1, 1 } },
+        { "log",              { BUILTIN_LOG,              1, 1 } },
+        { "log2",             { BUILTIN_LOG2,             1, 1 } },
+        { "sin",              { BUILTIN_SIN,              1, 1 } },
+        { "cos",              { BUILTIN_COS,              1, 1 } },
+        { "tan",              { BUILTIN_TAN,              1, 1 } },
+        { "asin",             { BUILTIN_ASIN,             1, 1 } },
+        { "acos",             { BUILTIN_ACOS,             1, 1 } },
+        { "atan",             { BUILTIN_ATAN,             1, 2 } },
+        { "radians",          { BUILTIN_RADIANS,          1, 1 } },
+        { "degrees",          { BUILTIN_DEGREES,          1, 1 } },
+        { "dot",              { BUILTIN_DOT,              2, 2 } },
+        { "length",           { BUILTIN_LENGTH,           1, 1 } },
+        { "distance",         { BUILTIN_DISTANCE,         2, 2 } },
+        { "normalize",        { BUILTIN_NORMALIZE,        1, 1 } },
+        { "cross",            { BUILTIN_CROSS,            2, 2 } },
+        { "lessThan",         { BUILTIN_LESSTHAN,         2, 2 } },
+        { "lessThanEqual",    { BUILTIN_LESSTHANEQUAL,    2, 2 } },
+        { "greaterThan",      { BUILTIN_GREATERTHAN,      2, 2 } },
+        { "greaterThanEqual", { BUILTIN_GREATERTHANEQUAL, 2, 2 } },
+        { "equal",            { BUILTIN_EQUAL,            2, 2 } },
+        { "notEqual",         { BUILTIN_NOTEQUAL,         2, 2 } },
+        { "any",              { BUILTIN_ANY,              1, 1 } },
+        { "all",              { BUILTIN_ALL,              1, 1 } },
+        { "not",              { BUILTIN_NOT,              1, 1 } },
+        { "texture1D",        { BUILTIN_TEXTURE1D,        2, 2 } },
+        { "texture2D",        { BUILTIN_TEXTURE2D,        2, 2 } },
+        { "texture3D",        { BUILTIN_TEXTURE3D,        2, 2 } },
+    };
+
+    const auto it = builtins.find(name);
+    if (it == builtins.end())
+    {
+        return false;
+    }
+    info = it->second;
+    return true;
+}
+
+struct Function;
+
+struct Expr;
+typedef std::unique_ptr<Expr> ExprPtr;
+
+struct Expr
+{
+    ExprKind m_kind{ EXPR_LITERAL };
+    Type     m_type;
+    unsigned m_line{ 0 };
+
+    std::vector<ExprPtr> m_args;
+
+    // Literal value.
+    float m_value{ 0.0f };
+
+    // Variable location.
+    bool     m_global{ false };
+    unsigned m_offset{ 0 };
+
+    // Swizzle component indices.
+    uint8_t  m_swizzle[4]{ 0, 0, 0, 0 };
+    unsigned m_numSwizzle{ 0 };
+
+    // Operators i.e. binary & compound assignment operations, or increments.
+    BinaryInfo m_binary;
+    float      m_delta{ 0.0f };
+    bool       m_prefix{ false };
+
+    // Calls.
+    Builtin          m_builtin{ BUILTIN_ABS };
+    const Function * m_function{ nullptr };
+};
+
+enum StmtKind
+{
+    STMT_BLOCK = 0,
+    STMT_DECLARATION,
+    STMT_EXPRESSION,
+    STMT_IF,
+    STMT_FOR,
+    STMT_WHILE,
+    STMT_RETURN,
+    STMT_BREAK,
+    STMT_CONTINUE,
+    STMT_EMPTY
+};
+
+struct Stmt;
+typedef std::unique_ptr<Stmt> StmtPtr;
+
+struct Declaration
+{
+    Type     m_type;
+    unsigned m_offset{ 0 };
+    ExprPtr  m_init;
+};
+
+struct Stmt
+{
+    StmtKind m_kind{ STMT_EMPTY };
+
+    std::vector<StmtPtr>     m_statements;
+    std::vector<Declaration> m_declarations;
+
+    ExprPtr m_expr;   // Expression, returned value or condition.
+    ExprPtr m_step;   // Loop step expression.
+
+    StmtPtr m_init;   // Loop initialization.
+    StmtPtr m_then;   // 'if' branch or loop body.
+    StmtPtr m_else;
+};
+
+struct Function
+{
+    std::string           m_name;
+    Type                  m_returnType;
+    std::vector<Type>     m_paramTypes;
+    std::vector<unsigned> m_paramOffsets;
+    unsigned              m_frameSize{ 0 };
+    StmtPtr               m_body;
+};
+
+struct Variable
+{
+    Type     m_type;
+    bool     m_global{ false };
+    unsigned m_offset{ 0 };
+    bool     m_uniform{ false };
+};
+
+// The parsed shader program.
+struct Program
+{
+    std::unordered_map<std::string, std::unique_ptr<Function>> m_functions;
+
+    // Global variables, uniforms & samplers.
+    std::unordered_map<std::string, Variable> m_globals;
+    unsigned m_globalSize{ 0 };
+    // Initializers of the global variables (executed once).
+    std::vector<StmtPtr> m_globalInits;
+
+    unsigned m_numInstructions{ 0 };
+    unsigned m_numTextureFetches{ 0 };
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Parser
+
+class Parser
+{
+public:
+    Parser(const std::vector<Token> & tokens, Program & program)
+        :   m_tokens(tokens)
+        ,   m_program(program)
+    {
+    }
+
+    void parse()
+    {
+        m_scopes.emplace_back();
+        while (peek().m_kind != TOKEN_END)
+        {
+            parseExternalDeclaration();
+        }
+    }
+
+private:
+    const std::vector<Token> & m_tokens;
+    size_t m_pos{ 0 };
+
+    Program & m_program;
+    Function * m_function{ nullptr };
+    std::vector<std::unordered_map<std::string, Variable>> m_scopes;
+
+    const Token & peek(size_t ahead = 0) const
+    {
+        const size_t pos = std::min(m_pos + ahead, m_tokens.size() - 1);
+        return m_tokens[pos];
+    }
+
+    unsigned line() const { return peek().m_line; }
+
+    const Token & next()
+    {
+        const Token & tok = peek();
+        if (m_pos < m_tokens.size() - 1) ++m_pos;
+        return tok;
+    }
+
+    bool isPunctuator(const char * p, size_t ahead = 0) const
+    {
+        const Token & tok = peek(ahead);
+        return tok.m_kind == TOKEN_PUNCTUATOR && tok.m_text == p;
+    }
+
+    bool isKeyword(const char * k) const
+    {
+        const Token & tok = peek();
+        return tok.m_kind == TOKEN_IDENTIFIER && tok.m_text == k;
+    }
+
+    bool accept(const char * p)
+    {
+        if (isPunctuator(p))
+        {
+            next();
+            return true;
+        }
+        return false;
+    }
+
+    bool acceptKeyword(const char * k)
+    {
+        if (isKeyword(k))
+        {
+            next();
+            return true;
+        }
+        return false;
+    }
+
+    void expect(const char * p)
+    {
+        if (!accept(p))
+        {
+            ThrowError(line(), std::string("expected '") + p + "' but found '"
+                               + peek().m_text + "'.");
+        }
+    }
+
+    std::string expectIdentifier()
+    {
+        const Token & tok = next();
+        if (tok.m_kind != TOKEN_IDENTIFIER)
+        {
+            ThrowError(tok.m_line, "expected an identifier but found '" + tok.m_text + "'.");
+        }
+        return tok.m_text;
+    }
+
+    bool isTypeName(size_t ahead = 0) const
+    {
+        Type type;
+        const Token & tok = peek(ahead);
+        return tok.m_kind == TOKEN_IDENTIFIER && ParseTypeName(tok.m_text, type);
+    }
+
+    Type parseType()
+    {
+        // Precision qualifiers have no effect.
+        while (acceptKeyword("highp") || acceptKeyword("mediump") || acceptKeyword("lowp"))
+        {
+        }
+
+        Type type;
+        const Token & tok = next();
+        if (tok.m_kind != TOKEN_IDENTIFIER || !ParseTypeName(tok.m_text, type))
+        {
+            ThrowError(tok.m_line, "unknown type '" + tok.m_text + "'.");
+        }
+        return type;
+    }
+
+    unsigned parseArraySize()
+    {
+        const Token & tok = next();
+        if (tok.m_kind != TOKEN_INT || std::atoi(tok.m_text.c_str()) <= 0)
+        {
+            ThrowError(tok.m_line, "array size must be a positive integer literal.");
+        }
+        expect("]");
+        return (unsigned)std::atoi(tok.m_text.c_str());
+    }
+
+    const Variable * findVariable(const std::string & name) const
+    {
+        for (auto it = m_scopes.rbegin(); it != m_scopes.rend(); ++it)
+        {
+            const auto var = it->find(name);
+            if (var != it->end())
+            {
+                return &var->second;
+            }
+        }
+        return nullptr;
+    }
+
+    Variable & declareVariable(const std::string & name, const Type & type, unsigned ln,
+                               bool isUniform = false)
+    {
+        if (m_scopes.back().count(name))
+        {
+            ThrowError(ln, "redefinition of '" + name + "'.");
+        }
+
+        Variable var;
+        var.m_type = type;
+        var.m_uniform = isUniform;
+        if (m_function)
+        {
+            var.m_offset = m_function->m_frameSize;
+            m_function->m_frameSize += type.storage();
+        }
+        else
+        {
+            var.m_global = true;
+            var.m_offset = m_program.m_globalSize;
+            m_program.m_globalSize += type.storage();
+        }
+
+        Variable & v = m_scopes.back()[name];
+        v = var;
+        if (var.m_global)
+        {
+            m_program.m_globals[name] = var;
+        }
+        return v;
+    }
+
+    ExprPtr makeExpr(ExprKind kind, const Type & type, unsigned ln) const
+    {
+        ExprPtr expr(new Expr);
+        expr->m_kind = kind;
+        expr->m_type = type;
+        expr->m_line = ln;
+        return expr;
+    }
+
+    void countInstruction()
+    {
+        ++m_program.m_numInstructions;
+    }
+
+    // Check the implicit conversion of an expression to a given type.
+    void checkConversion(const Expr & expr, const Type & to, const char * context) const
+    {
+        if (!IsConvertible(expr.m_type, to))
+        {
+            ThrowError(expr.m_line, std::string("cannot convert '") + expr.m_type.str()
+                                    + "' to '" + to.str() + "' in " + context + ".");
+        }
+    }
+
+    // Global declarations.
+
+    void parseExternalDeclaration()
+    {
+        const unsigned ln = line();
+
+        const bool isUniform = acceptKeyword("uniform");
+        const bool isConst = !isUniform && acceptKeyword("const");
+
+        const Type type = parseType();
+        const std::string name = expectIdentifier();
+
+        if (!isUniform && !isConst && isPunctuator("("))
+        {
+            parseFunction(type, name, ln);
+            return;
+        }
+
+        StmtPtr decl = parseDeclarators(type, name, isConst, isUniform);
+        if (isUniform)
+        {
+            for (auto & d : decl->m_declarations)
+            {
+                if (d.m_init)
+                {
+                    ThrowError(ln, "uniform initializers are not supported.");
+                }
+            }
+        }
+        else
+        {
+            m_program.m_globalInits.push_back(std::move(decl));
+        }
+    }
+
+    void parseFunction(const Type & returnType, const std::string & name, unsigned ln)
+    {
+        expect("(");
+
+        std::unique_ptr<Function> func(new Function);
+        func->m_name = name;
+        func->m_returnType = returnType;
+
+        m_function = func.get();
+        m_scopes.emplace_back();
+
+        if (!(isKeyword("void") && isPunctuator(")", 1)))
+        {
+            while (!isPunctuator(")"))
+            {
+                acceptKeyword("const");
+                if (isKeyword("out") || isKeyword("inout"))
+                {
+                    ThrowError(line(), "out parameters are not supported.");
+                }
+                acceptKeyword("in");
+
+                const Type type = parseType();
+                const std::string param = expectIdentifier();
+                if (type.isSampler() || accept("["))
+                {
+                    ThrowError(line(), "array & sampler parameters are not supported.");
+                }
+
+                Variable & var = declareVariable(param, type, line());
+                func->m_paramTypes.push_back(type);
+                func->m_paramOffsets.push_back(var.m_offset);
+
+                if (!accept(","))
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            next();
+        }
+        expect(")");
+
+        if (func->m_paramTypes.size() > MaxArguments)
+        {
+            ThrowError(ln, "too many parameters for function '" + name + "'.");
+        }
+
+        if (accept(";"))
+        {
+            // Only a prototype.
+            m_scopes.pop_back();
+            m_function = nullptr;
+            if (!m_program.m_functions.count(name))
+            {
+                m_program.m_functions[name] = std::move(func);
+            }
+            return;
+        }
+
+        auto & existing = m_program.m_functions[name];
+        if (existing && existing->m_body)
+        {
+            ThrowError(ln, "redefinition of function '" + name + "' (overloads are not supported).");
+        }
+        if (existing)
+        {
+            // Complete the prototype so previous calls point to the definition.
+            existing->m_returnType   = func->m_returnType;
+            existing->m_paramTypes   = func->m_paramTypes;
+            existing->m_paramOffsets = func->m_paramOffsets;
+            existing->m_frameSize    = func->m_frameSize;
+            m_function = existing.get();
+        }
+        else
+        {
+            existing = std::move(func);
+            m_function = existing.get();
+        }
+
+        m_function->m_body = parseBlock(false);
+
+        m_scopes.pop_back();
+        m_function = nullptr;
+    }
+
+    // Statements.
+
+    StmtPtr parseBlock(bool newScope)
+    {
+        expect("{");
+        if (newScope) m_scopes.emplace_back();
+
+        StmtPtr block(new Stmt);
+        block->m_kind = STMT_BLOCK;
+        while (!accept("}"))
+        {
+            if (peek().m_kind == TOKEN_END)
+            {
+                ThrowError(line(), "unexpected end of the shader program.");
+            }
+            block->m_statements.push_back(parseStatement());
+        }
+
+        if (newScope) m_scopes.pop_back();
+        return block;
+    }
+
+    bool isDeclaration() const
+    {
+        if (isKeyword("const") || isKeyword("highp") || isKeyword("mediump") || isKeyword("lowp"))
+        {
+            return true;
+        }
+        // A type followed by an identifier (i.e. not a constructor call).
+        return isTypeName() && peek(1).m_kind == TOKEN_IDENTIFIER;
+    }
+
+    StmtPtr parseDeclarators(const Type & baseType, const std::string & firstName,
+                             bool isConst, bool isUniform = false)
+    {
+        StmtPtr stmt(new Stmt);
+        stmt->m_kind = STMT_DECLARATION;
+
+        std::string name = firstName;
+        while (true)
+        {
+            const unsigned ln = line();
+
+            Type type = baseType;
+            if (accept("["))
+            {
+                type.m_arraySize = parseArraySize();
+            }
+
+            Declaration decl;
+            decl.m_type = type;
+
+            if (accept("="))
+            {
+                decl.m_init = parseAssignment();
+                checkConversion(*decl.m_init, type, "initialization");
+            }
+            else if (isConst)
+            {
+                ThrowError(ln, "const variable '" + name + "' must be initialized.");
+            }
+            else if (type.isSampler() && m_function)
+            {
+                ThrowError(ln, "local samplers are not supported.");
+            }
+
+            // The variable is visible only after its initializer.
+            decl.m_offset = declareVariable(name, type, ln, isUniform).m_offset;
+            stmt->m_declarations.push_back(std::move(decl));
+
+            if (!accept(","))
+            {
+                break;
+            }
+            name = expectIdentifier();
+        }
+        expect(";");
+
+        return stmt;
+    }
+
+    StmtPtr parseStatement()
+    {
+        const unsigned ln = line();
+
+        if (isPunctuator("{"))
+        {
+            return parseBlock(true);
+        }
+
+        StmtPtr stmt(new Stmt);
+
+        if (accept(";"))
+        {
+            stmt->m_kind = STMT_EMPTY;
+        }
+        else if (acceptKeyword("if"))
+        {
+            stmt->m_kind = STMT_IF;
+            expect("(");
+            stmt->m_expr = parseCondition();
+            expect(")");
+            stmt->m_then = parseScopedStatement();
+            if (acceptKeyword("else"))
+            {
+                stmt->m_else = parseScopedStatement();
+            }
+        }
+        else if (acceptKeyword("for"))
+        {
+            stmt->m_kind = STMT_FOR;
+            m_scopes.emplace_back();
+            expect("(");
+            stmt->m_init = parseSimpleStatement();
+            if (!isPunctuator(";"))
+            {
+                stmt->m_expr = parseCondition();
+            }
+            expect(";");
+            if (!isPunctuator(")"))
+            {
+                stmt->m_step = parseExpression();
+            }
+            expect(")");
+            stmt->m_then = parseScopedStatement();
+            m_scopes.pop_back();
+        }
+        else if (acceptKeyword("while"))
+        {
+            stmt->m_kind = STMT_WHILE;
+            expect("(");
+            stmt->m_expr = parseCondition();
+            expect(")");
+            stmt->m_then = parseScopedStatement();
+        }
+        else if (acceptKeyword("return"))
+        {
+            stmt->m_kind = STMT_RETURN;
+            if (!isPunctuator(";"))
+            {
+                stmt->m_expr = parseExpression();
+                checkConversion(*stmt->m_expr, m_function->m_returnType, "return statement");
+            }
+            else if (m_function->m_returnType.m_base != TYPE_VOID)
+            {
+                ThrowError(ln, "missing return value.");
+            }
+            expect(";");
+        }
+        else if (acceptKeyword("break"))
+        {
+            stmt->m_kind = STMT_BREAK;
+            expect(";");
+        }
+        else if (acceptKeyword("continue"))
+        {
+            stmt->m_kind = STMT_CONTINUE;
+            expect(";");
+        }
+        else if (isKeyword("do") || isKeyword("switch") || isKeyword("discard"))
+        {
+            ThrowError(ln, "unsupported statement '" + peek().m_text + "'.");
+        }
+        else
+        {
+            return parseSimpleStatement();
+        }
+
+        return stmt;
+    }
+
+    // A statement which introduces its own scope (i.e. the body of a loop or a branch).
+    StmtPtr parseScopedStatement()
+    {
+        m_scopes.emplace_back();
+        StmtPtr stmt = parseStatement();
+        m_scopes.pop_back();
+        return stmt;
+    }
+
+    // A declaration or an expression statement.
+    StmtPtr parseSimpleStatement()
+    {
+        if (isDeclaration())
+        {
+            const bool isConst = acceptKeyword("const");
+            const Type type = parseType();
+            const std::string name = expectIdentifier();
+            return parseDeclarators(type, name, isConst);
+        }
+
+        StmtPtr stmt(new Stmt);
+        if (accept(";"))
+        {
+            stmt->m_kind = STMT_EMPTY;
+            return stmt;
+        }
+
+        stmt->m_kind = STMT_EXPRESSION;
+        stmt->m_expr = parseExpression();
+        expect(";");
+        return stmt;
+    }
+
+    ExprPtr parseCondition()
+    {
+        ExprPtr cond = parseExpression();
+        if (cond->m_type != Type(TYPE_BOOL))
+        {
+            ThrowError(cond->m_line, "condition must be a boolean scalar.");
+        }
+        return cond;
+    }
+
+    // Expressions.
+
+    ExprPtr parseExpression()
+    {
+        ExprPtr expr = parseAssignment();
+        if (isPunctuator(","))
+        {
+            ThrowError(line(), "the comma operator is not supported.");
+        }
+        return expr;
+    }
+
+    static BinaryOp AssignmentOp(const std::string & text)
+    {
+        if (text == "+=") return OP_ADD;
+        if (text == "-=") return OP_SUB;
+        if (text == "*=") return OP_MUL;
+        if (text == "/=") return OP_DIV;
+        return OP_NONE;
+    }
+
+    void checkLValue(const Expr & expr) const
+    {
+        if (expr.m_kind == EXPR_VARIABLE)
+        {
+            if (expr.m_type.isArray() || expr.m_type.isSampler())
+            {
+                ThrowError(expr.m_line, "invalid assignment target.");
+            }
+        }
+        else if (expr.m_kind == EXPR_SWIZZLE)
+        {
+            for (unsigned i = 0; i < expr.m_numSwizzle; ++i)
+            {
+                for (unsigned j = i + 1; j < expr.m_numSwizzle; ++j)
+                {
+                    if (expr.m_swizzle[i] == expr.m_swizzle[j])
+                    {
+                        ThrowError(expr.m_line, "duplicated components in the swizzle.");
+                    }
+                }
+            }
+            checkLValue(*expr.m_args[0]);
+        }
+        else if (expr.m_kind == EXPR_INDEX)
+        {
+            const Expr & base = *expr.m_args[0];
+            if (base.m_type.isArray())
+            {
+                if (base.m_kind != EXPR_VARIABLE)
+                {
+                    ThrowError(expr.m_line, "invalid assignment target.");
+                }
+            }
+            else
+            {
+                checkLValue(base);
+            }
+        }
+        else
+        {
+            ThrowError(expr.m_line, "invalid assignment target.");
+        }
+
+        // Uniforms & constants are read-only.
+        const Expr * root = &expr;
+        while (root->m_kind != EXPR_VARIABLE)
+        {
+            root = root->m_args[0].get();
+        }
+        if (root->m_global)
+        {
+            for (const auto & var : m_program.m_globals)
+            {
+                if (var.second.m_offset == root->m_offset && var.second.m_uniform)
+                {
+                    ThrowError(expr.m_line, "uniform '" + var.first + "' is read-only.");
+                }
+            }
+        }
+    }
+
+    ExprPtr parseAssignment()
+    {
+        ExprPtr lhs = parseTernary();
+
+        const Token & tok = peek();
+        if (tok.m_kind != TOKEN_PUNCTUATOR)
+        {
+            return lhs;
+        }
+
+        const BinaryOp op = AssignmentOp(tok.m_text);
+        if (tok.m_text != "=" && op == OP_NONE)
+        {
+            return lhs;
+        }
+
+        const unsigned ln = tok.m_line;
+        next();
+        checkLValue(*lhs);
+
+        ExprPtr rhs = parseAssignment();
+
+        ExprPtr expr = makeExpr(EXPR_ASSIGN, lhs->m_type, ln);
+        if (op != OP_NONE)
+        {
+            // The result of the operation must be convertible to the target type.
+            Type resType;
+            computeBinary(op, lhs->m_type, rhs->m_type, expr->m_binary, resType, ln);
+            if (!IsConvertible(resType, lhs->m_type))
+            {
+                ThrowError(ln, "invalid compound assignment between '" + lhs->m_type.str()
+                               + "' and '" + rhs->m_type.str() + "'.");
+            }
+            countInstruction();
+        }
+        else
+        {
+            checkConversion(*rhs, lhs->m_type, "assignment");
+        }
+
+        expr->m_args.push_back(std::move(lhs));
+        expr->m_args.push_back(std::move(rhs));
+        return expr;
+    }
+
+    ExprPtr parseTernary()
+    {
+        ExprPtr cond = parseBinary(0);
+        if (!isPunctuator("?"))
+        {
+            return cond;
+        }
+
+        const unsigned ln = line();
+        next();
+        if (cond->m_type != Type(TYPE_BOOL))
+        {
+            ThrowError(ln, "condition must be a boolean scalar.");
+        }
+
+        ExprPtr a = parseAssignment();
+        expect(":");
+        ExprPtr b = parseAssignment();
+
+        Type type = a->m_type;
+        if (IsConvertible(a->m_type, b->m_type))
+        {
+            type = b->m_type;
+        }
+        else if (!IsConvertible(b->m_type, a->m_type))
+        {
+            ThrowError(ln, "mismatched types '" + a->m_type.str() + "' and '"
+                           + b->m_type.str() + "' in the conditional operator.");
+        }
+
+        countInstruction();
+
+        ExprPtr expr = makeExpr(EXPR_TERNARY, type, ln);
+        expr->m_args.push_back(std::move(cond));
+        expr->m_args.push_back(std::move(a));
+        expr->m_args.push_back(std::move(b));
+        return expr;
+    }
+
+    static int Precedence(const Token & tok, BinaryOp & op)
+    {
+        op = OP_NONE;
+        if (tok.m_kind != TOKEN_PUNCTUATOR) return -1;
+
+        const std::string & t = tok.m_text;
+        if (t == "||") { op = OP_OR;  return 0; }
+        if (t == "&&") { op = OP_AND; return 1; }
+        if (t == "==") { op = OP_EQ;  return 2; }
+        if (t == "!=") { op = OP_NE;  return 2; }
+        if (t == "<")  { op = OP_LT;  return 3; }
+        if (t == ">")  { op = OP_GT;  return 3; }
+        if (t == "<=") { op = OP_LE;  return 3; }
+        if (t == ">=") { op = OP_GE;  return 3; }
+        if (t == "+")  { op = OP_ADD; return 4; }
+        if (t == "-")  { op = OP_SUB; return 4; }
+        if (t == "*")  { op = OP_MUL; return 5; }
+        if (t == "/")  { op = OP_DIV; return 5; }
+        return -1;
+    }
+
+    // Compute the type of a binary operation and how to evaluate it.
+    static void computeBinary(BinaryOp op, const Type & a, const Type & b,
+                              BinaryInfo & info, Type & type, unsigned ln)
+    {
+        info = BinaryInfo();
+        info.m_op = op;
+
+        const std::string types = " between '" + a.str() + "' and '" + b.str() + "'.";
+
+        if (a.isArray() || b.isArray() || a.isSampler() || b.isSampler()
+            || a.m_base == TYPE_VOID || b.m_base == TYPE_VOID)
+        {
+            ThrowError(ln, "invalid operands" + types);
+        }
+
+        if (op == OP_AND || op == OP_OR)
+        {
+            if (a != Type(TYPE_BOOL) || b != Type(TYPE_BOOL))
+            {
+                ThrowError(ln, "logical operators need boolean scalars" + types);
+            }
+            type = Type(TYPE_BOOL);
+            return;
+        }
+
+        if (op == OP_EQ || op == OP_NE)
+        {
+            if (!IsConvertible(a, b) && !IsConvertible(b, a))
+            {
+                ThrowError(ln, "invalid comparison" + types);
+            }
+            info.m_count = a.components();
+            type = Type(TYPE_BOOL);
+            return;
+        }
+
+        if (!a.isNumeric() || !b.isNumeric())
+        {
+            ThrowError(ln, "arithmetic operators need numeric operands" + types);
+        }
+
+        if (op == OP_LT || op == OP_GT || op == OP_LE || op == OP_GE)
+        {
+            if (!a.isScalar() || !b.isScalar())
+            {
+                ThrowError(ln, "relational operators need scalars" + types);
+            }
+            type = Type(TYPE_BOOL);
+            return;
+        }
+
+        const BaseType base = (a.m_base == TYPE_FLOAT || b.m_base == TYPE_FLOAT) ? TYPE_FLOAT
+                                                                                 : TYPE_INT;
+        info.m_integer = (base == TYPE_INT);
+
+        if (op == OP_MUL && a.isMatrix() && b.isMatrix())
+        {
+            if (a.m_cols != b.m_rows)
+            {
+                ThrowError(ln, "mismatched matrix dimensions" + types);
+            }
+            info.m_mode  = MODE_MATRIX_MATRIX;
+            info.m_rowsA = a.m_rows;
+            info.m_count = a.m_cols;
+            info.m_colsB = b.m_cols;
+            type = Type(TYPE_FLOAT, a.m_rows, b.m_cols);
+            return;
+        }
+        if (op == OP_MUL && a.isMatrix() && b.isVector())
+        {
+            if (a.m_cols != b.m_rows)
+            {
+                ThrowError(ln, "mismatched matrix dimensions" + types);
+            }
+            info.m_mode  = MODE_MATRIX_VECTOR;
+            info.m_rowsA = a.m_rows;
+            info.m_count = a.m_cols;
+            type = Type(TYPE_FLOAT, a.m_rows);
+            return;
+        }
+        if (op == OP_MUL && a.isVector() && b.isMatrix())
+        {
+            if (a.m_rows != b.m_rows)
+            {
+                ThrowError(ln, "mismatched matrix dimensions" + types);
+            }
+            info.m_mode  = MODE_VECTOR_MATRIX;
+            info.m_rowsA = b.m_rows;
+            info.m_count = b.m_rows;
+            info.m_colsB = b.m_cols;
+            type = Type(TYPE_FLOAT, b.m_cols);
+            return;
+        }
+
+        if (a.isScalar())
+        {
+            info.m_strideA = 0;
+            type = Type(base, b.m_rows, b.m_cols);
+        }
+        else if (b.isScalar())
+        {
+            info.m_strideB = 0;
+            type = Type(base, a.m_rows, a.m_cols);
+        }
+        else if (a.m_rows == b.m_rows && a.m_cols == b.m_cols)
+        {
+            type = Type(base, a.m_rows, a.m_cols);
+        }
+        else
+        {
+            ThrowError(ln, "mismatched operands" + types);
+        }
+        info.m_count = type.components();
+    }
+
+    ExprPtr parseBinary(int minPrecedence)
+    {
+        ExprPtr lhs = parseUnary();
+
+        while (true)
+        {
+            BinaryOp op = OP_NONE;
+            const int prec = Precedence(peek(), op);
+            if (prec < minPrecedence)
+            {
+                return lhs;
+            }
+
+            const unsigned ln = line();
+            next();
+            ExprPtr rhs = parseBinary(prec + 1);
+
+            Type type;
+            BinaryInfo info;
+            computeBinary(op, lhs->m_type, rhs->m_type, info, type, ln);
+
+            countInstruction();
+
+            ExprPtr expr = makeExpr((op == OP_AND || op == OP_OR) ? EXPR_LOGICAL : EXPR_BINARY,
+                                    type, ln);
+            expr->m_binary = info;
+            expr->m_args.push_back(std::move(lhs));
+            expr->m_args.push_back(std::move(rhs));
+            lhs = std::move(expr);
+        }
+    }
+
+    ExprPtr parseUnary()
+    {
+        const unsigned ln = line();
+
+        if (accept("+"))
+        {
+            return parseUnary();
+        }
+        if (accept("-"))
+        {
+            ExprPtr arg = parseUnary();
+            if (!arg->m_type.isNumeric() || arg->m_type.isArray())
+            {
+                ThrowError(ln, "invalid operand for the negation.");
+            }
+            // Fold the negative literals.
+            if (arg->m_kind == EXPR_LITERAL)
+            {
+                arg->m_value = -arg->m_value;
+                return arg;
+            }
+            countInstruction();
+            ExprPtr expr = makeExpr(EXPR_NEGATE, arg->m_type, ln);
+            expr->m_args.push_back(std::move(arg));
+            return expr;
+        }
+        if (accept("!"))
+        {
+            ExprPtr arg = parseUnary();
+            if (arg->m_type != Type(TYPE_BOOL))
+            {
+                ThrowError(ln, "invalid operand for the logical not.");
+            }
+            countInstruction();
+            ExprPtr expr = makeExpr(EXPR_NOT, arg->m_type, ln);
+            expr->m_args.push_back(std::move(arg));
+            return expr;
+        }
+        if (isPunctuator("++") || isPunctuator("--"))
+        {
+            const bool inc = next().m_text == "++";
+            ExprPtr arg = parseUnary();
+            return makeIncDec(std::move(arg), inc, true, ln);
+        }
+
+        return parsePostfix(parsePrimary());
+    }
+
+    ExprPtr makeIncDec(ExprPtr arg, bool inc, bool prefix, unsigned ln)
+    {
+        checkLValue(*arg);
+        if (!arg->m_type.isNumeric())
+        {
+            ThrowError(ln, "invalid operand for the increment or decrement.");
+        }
+        countInstruction();
+        ExprPtr expr = makeExpr(EXPR_INCDEC, arg->m_type, ln);
+        expr->m_delta = inc ? 1.0f : -1.0f;
+        expr->m_prefix = prefix;
+        expr->m_args.push_back(std::move(arg));
+        return expr;
+    }
+
+    ExprPtr parsePostfix(ExprPtr expr)
+    {
+        while (true)
+        {
+            const unsigned ln = line();
+
+            if (accept("["))
+            {
+                ExprPtr index = parseExpression();
+                expect("]");
+                if (index->m_type != Type(TYPE_INT))
+                {
+                    ThrowError(ln, "index must be an integer scalar.");
+                }
+
+                const Type & baseType = expr->m_type;
+                Type type;
+                if (baseType.isArray())
+                {
+                    if (expr->m_kind != EXPR_VARIABLE)
+                    {
+                        ThrowError(ln, "only array variables can be indexed.");
+                    }
+                    type = baseType.elementType();
+                }
+                else if (baseType.isMatrix())
+                {
+                    type = Type(baseType.m_base, baseType.m_rows);
+                }
+                else if (baseType.isVector())
+                {
+                    type = Type(baseType.m_base);
+                }
+                else
+                {
+                    ThrowError(ln, "invalid subscript on '" + baseType.str() + "'.");
+                }
+
+                ExprPtr idx = makeExpr(EXPR_INDEX, type, ln);
+                idx->m_args.push_back(std::move(expr));
+                idx->m_args.push_back(std::move(index));
+                expr = std::move(idx);
+            }
+            else if (accept("."))
+            {
+                const std::string fields = expectIdentifier();
+                const Type & baseType = expr->m_type;
+                if (!baseType.isVector() || fields.size() > 4)
+                {
+                    ThrowError(ln, "invalid swizzle '" + fields + "'.");
+                }
+
+                ExprPtr swz = makeExpr(EXPR_SWIZZLE,
+                                       Type(baseType.m_base, (unsigned)fields.size()), ln);
+                swz->m_numSwizzle = (unsigned)fields.size();
+                for (size_t i = 0; i < fields.size(); ++i)
+                {
+                    static const char * sets[] = { "xyzw", "rgba", "stpq" };
+                    int comp = -1;
+                    for (const char * set : sets)
+                    {
+                        const char * p = std::strchr(set, fields[i]);
+                        if (p)
+                        {
+                            comp = int(p - set);
+                            break;
+                        }
+                    }
+                    if (comp < 0 || comp >= (int)baseType.m_rows)
+                    {
+                        ThrowError(ln, "invalid swizzle '" + fields + "'.");
+                    }
+                    swz->m_swizzle[i] = (uint8_t)comp;
+                }
+                swz->m_args.push_back(std::move(expr));
+                expr = std::move(swz);
+            }
+            else if (isPunctuator("++") || isPunctuator("--"))
+            {
+                const bool inc = next().m_text == "++";
+                expr = makeIncDec(std::move(expr), inc, false, ln);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (expr->m_type.isArray() && expr->m_kind != EXPR_ARRAY_CONSTRUCTOR)
+        {
+            ThrowError(expr->m_line, "arrays can only be indexed.");
+        }
+        return expr;
+    }
+
+    std::vector<ExprPtr> parseArguments()
+    {
+        std::vector<ExprPtr> args;
+        expect("(");
+        if (isKeyword("void") && isPunctuator(")", 1))
+        {
+            next();
+        }
+        while (!isPunctuator(")"))
+        {
+            args.push_back(parseAssignment());
+            if (!accept(","))
+            {
+                break;
+            }
+        }
+        expect(")");
+        return args;
+    }
+
+    ExprPtr parsePrimary()
+    {
+        const Token & tok = peek();
+        const unsigned ln = tok.m_line;
+
+        if (tok.m_kind == TOKEN_INT || tok.m_kind == TOKEN_FLOAT)
+        {
+            next();
+            ExprPtr expr = makeExpr(EXPR_LITERAL,
+                                    Type(tok.m_kind == TOKEN_INT ? TYPE_INT : TYPE_FLOAT), ln);
+            expr->m_value = (tok.m_kind == TOKEN_INT) ? float(std::atol(tok.m_text.c_str()))
+                                                      : std::strtof(tok.m_text.c_str(), nullptr);
+            return expr;
+        }
+
+        if (accept("("))
+        {
+            ExprPtr expr = parseExpression();
+            expect(")");
+            return expr;
+        }
+
+        if (tok.m_kind != TOKEN_IDENTIFIER)
+        {
+            ThrowError(ln, "unexpected '" + tok.m_text + "'.");
+        }
+
+        if (tok.m_text == "true" || tok.m_text == "false")
+        {
+            next();
+            ExprPtr expr = makeExpr(EXPR_LITERAL, Type(TYPE_BOOL), ln);
+            expr->m_value = (tok.m_text == "true") ? 1.0f : 0.0f;
+            return expr;
+        }
+
+        Type ctorType;
+        if (ParseTypeName(tok.m_text, ctorType))
+        {
+            next();
+            if (accept("["))
+            {
+                return parseArrayConstructor(ctorType, ln);
+            }
+            return parseConstructor(ctorType, ln);
+        }
+
+        const std::string name = tok.m_text;
+        next();
+
+        if (isPunctuator("("))
+        {
+            return parseCall(name, ln);
+        }
+
+        const Variable * var = findVariable(name);
+        if (!var)
+        {
+            ThrowError(ln, "undeclared identifier '" + name + "'.");
+        }
+
+        ExprPtr expr = makeExpr(EXPR_VARIABLE, var->m_type, ln);
+        expr->m_global = var->m_global;
+        expr->m_offset = var->m_offset;
+        return expr;
+    }
+
+    ExprPtr parseArrayConstructor(const Type & elementType, unsigned ln)
+    {
+        const unsigned size = parseArraySize();
+        if (elementType.isSampler() || elementType.m_base == TYPE_VOID)
+        {
+            ThrowError(ln, "invalid array type.");
+        }
+
+        Type type = elementType;
+        type.m_arraySize = size;
+
+        ExprPtr expr = makeExpr(EXPR_ARRAY_CONSTRUCTOR, type, ln);
+        expr->m_args = parseArguments();
+        if (expr->m_args.size() != size)
+        {
+            ThrowError(ln, "wrong number of elements in the array constructor.");
+        }
+        for (const auto & arg : expr->m_args)
+        {
+            checkConversion(*arg, elementType, "array constructor");
+        }
+        return expr;
+    }
+
+    ExprPtr parseConstructor(const Type & type, unsigned ln)
+    {
+        if (type.isSampler() || type.m_base == TYPE_VOID)
+        {
+            ThrowError(ln, "invalid constructor '" + type.str() + "'.");
+        }
+
+        ExprPtr expr = makeExpr(EXPR_CONSTRUCTOR, type, ln);
+        expr->m_args = parseArguments();
+
+        unsigned numComponents = 0;
+        for (const auto & arg : expr->m_args)
+        {
+            const Type & t = arg->m_type;
+            if (t.isArray() || t.isSampler() || t.m_base == TYPE_VOID)
+            {
+                ThrowError(ln, "invalid argument in the constructor of '" + type.str() + "'.");
+            }
+            if (type.isMatrix() && t.isMatrix())
+            {
+                ThrowError(ln, "matrix from matrix constructors are not supported.");
+            }
+            numComponents += t.components();
+        }
+
+        const bool singleScalar = expr->m_args.size() == 1 && expr->m_args[0]->m_type.isScalar();
+        if (expr->m_args.empty()
+            || (!singleScalar && numComponents < type.components())
+            || (!singleScalar && !type.isScalar()
+                && numComponents - expr->m_args.back()->m_type.components() >= type.components()))
+        {
+            ThrowError(ln, "wrong number of components in the constructor of '"
+                           + type.str() + "'.");
+        }
+
+        return expr;
+    }
+
+    ExprPtr parseCall(const std::string & name, unsigned ln)
+    {
+        BuiltinInfo builtin;
+        if (FindBuiltin(name, builtin))
+        {
+            return parseBuiltin(builtin, name, ln);
+        }
+
+        const auto it = m_program.m_functions.find(name);
+        if (it == m_program.m_functions.end())
+        {
+            ThrowError(ln, "undeclared function '" + name + "'.");
+        }
+        const Function & func = *it->second;
+
+        ExprPtr expr = makeExpr(EXPR_CALL, func.m_returnType, ln);
+        expr->m_function = &func;
+        expr->m_args = parseArguments();
+
+        if (expr->m_args.size() != func.m_paramTypes.size())
+        {
+            ThrowError(ln, "wrong number of arguments in the call of '" + name + "'.");
+        }
+        for (size_t i = 0; i < expr->m_args.size(); ++i)
+        {
+            checkConversion(*expr->m_args[i], func.m_paramTypes[i], "function argument");
+        }
+
+        countInstruction();
+        return expr;
+    }
+
+    ExprPtr parseBuiltin(const BuiltinInfo & builtin, const std::string & name, unsigned ln)
+    {
+        ExprPtr expr = makeExpr(EXPR_BUILTIN, Type(TYPE_FLOAT), ln);
+        expr->m_builtin = builtin.m_id;
+        expr->m_args = parseArguments();
+
+        const auto & args = expr->m_args;
+        if (args.size() < builtin.m_minArgs || args.size() > builtin.m_maxArgs)
+        {
+            ThrowError(ln, "wrong number of arguments in the call of '" + name + "'.");
+        }
+
+        const std::string error = "invalid arguments in the call of '" + name + "'.";
+
+        for (const auto & arg : args)
+        {
+            if (arg->m_type.isArray() || arg->m_type.isMatrix() || arg->m_type.m_base == TYPE_VOID)
+            {
+                ThrowError(ln, error);
+            }
+        }
+
+        switch (builtin.m_id)
+        {
+            case BUILTIN_TEXTURE1D:
+            case BUILTIN_TEXTURE2D:
+            case BUILTIN_TEXTURE3D:
+            {
+                const BaseType samplerType = builtin.m_id == BUILTIN_TEXTURE1D ? TYPE_SAMPLER1D
+                                           : builtin.m_id == BUILTIN_TEXTURE2D ? TYPE_SAMPLER2D
+                                                                               : TYPE_SAMPLER3D;
+                const unsigned dims = unsigned(samplerType - TYPE_SAMPLER1D) + 1;
+
+                if (args[0]->m_type.m_base != samplerType || args[0]->m_kind != EXPR_VARIABLE
+                    || !IsConvertible(args[1]->m_type, Type(TYPE_FLOAT, dims)))
+                {
+                    ThrowError(ln, error);
+                }
+                expr->m_type = Type(TYPE_FLOAT, 4);
+                ++m_program.m_numTextureFetches;
+                break;
+            }
+
+            case BUILTIN_LESSTHAN:
+            case BUILTIN_LESSTHANEQUAL:
+            case BUILTIN_GREATERTHAN:
+            case BUILTIN_GREATERTHANEQUAL:
+            case BUILTIN_EQUAL:
+            case BUILTIN_NOTEQUAL:
+            {
+                const Type & a = args[0]->m_type;
+                const Type & b = args[1]->m_type;
+                if (!a.isVector() || (!IsConvertible(a, b) && !IsConvertible(b, a)))
+                {
+                    ThrowError(ln, error);
+                }
+                expr->m_type = Type(TYPE_BOOL, a.m_rows);
+                break;
+            }
+
+            case BUILTIN_ANY:
+            case BUILTIN_ALL:
+            case BUILTIN_NOT:
+            {
+                const Type & a = args[0]->m_type;
+                if (!a.isVector() || a.m_base != TYPE_BOOL)
+                {
+                    ThrowError(ln, error);
+                }
+                expr->m_type = builtin.m_id == BUILTIN_NOT ? a : Type(TYPE_BOOL);
+                break;
+            }
+
+            case BUILTIN_DOT:
+            case BUILTIN_DISTANCE:
+            case BUILTIN_CROSS:
+            {
+                const Type & a = args[0]->m_type;
+                const Type & b = args[1]->m_type;
+                if (!a.isNumeric() || !b.isNumeric() || a.m_rows != b.m_rows
+                    || (builtin.m_id == BUILTIN_CROSS && a.m_rows != 3))
+                {
+                    ThrowError(ln, error);
+                }
+                expr->m_type = builtin.m_id == BUILTIN_CROSS ? Type(TYPE_FLOAT, 3)
+                                                             : Type(TYPE_FLOAT);
+                break;
+            }
+
+            case BUILTIN_LENGTH:
+            case BUILTIN_NORMALIZE:
+            {
+                const Type & a = args[0]->m_type;
+                if (!a.isNumeric())
+                {
+                    ThrowError(ln, error);
+                }
+                expr->m_type = builtin.m_id == BUILTIN_LENGTH ? Type(TYPE_FLOAT)
+                                                              : Type(TYPE_FLOAT, a.m_rows);
+                break;
+            }
+
+            case BUILTIN_ABS:
+            case BUILTIN_SIGN:
+            case BUILTIN_FLOOR:
+            case BUILTIN_CEIL:
+            case BUILTIN_FRACT:
+            case BUILTIN_MOD:
+            case BUILTIN_MIN:
+            case BUILTIN_MAX:
+            case BUILTIN_CLAMP:
+            case BUILTIN_MIX:
+            case BUILTIN_STEP:
+            case BUILTIN_SMOOTHSTEP:
+            case BUILTIN_SQRT:
+            case BUILTIN_INVERSESQRT:
+            case BUILTIN_POW:
+            case BUILTIN_EXP:
+            case BUILTIN_EXP2:
+            case BUILTIN_LOG:
+            case BUILTIN_LOG2:
+            case BUILTIN_SIN:
+            case BUILTIN_COS:
+            case BUILTIN_TAN:
+            case BUILTIN_ASIN:
+            case BUILTIN_ACOS:
+            case BUILTIN_ATAN:
+            case BUILTIN_RADIANS:
+            case BUILTIN_DEGREES:
+            {
+                // The component-wise functions where scalar arguments are broadcast.
+                unsigned rows = 1;
+                bool allInt = true;
+                for (const auto & arg : args)
+                {
+                    const Type & t = arg->m_type;
+                    if (!t.isNumeric() || (t.m_rows > 1 && rows > 1 && t.m_rows != rows))
+                    {
+                        ThrowError(ln, error);
+                    }
+                    rows = std::max(rows, (unsigned)t.m_rows);
+                    allInt = allInt && t.m_base == TYPE_INT;
+                }
+
+                // Note that GLSL 1.2 only has the float versions; the int versions of
+                // GLSL 1.3 are accepted for min, max, clamp, abs & sign.
+                const bool intVersion = allInt
+                    && (builtin.m_id == BUILTIN_MIN || builtin.m_id == BUILTIN_MAX
+                        || builtin.m_id == BUILTIN_CLAMP || builtin.m_id == BUILTIN_ABS
+                        || builtin.m_id == BUILTIN_SIGN);
+
+                expr->m_type = Type(intVersion ? TYPE_INT : TYPE_FLOAT, rows);
+                break;
+            }
+        }
+
+        countInstruction();
+        return expr;
+    }
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Execution
+
+// GLSL min & max do not propagate NaNs on most GPUs.
+inline float Min(float a, float b) { return std::fmin(a, b); }
+inline float Max(float a, float b) { return std::fmax(a, b); }
+
+struct Texture
+{
+    unsigned m_width{ 0 };
+    unsigned m_height{ 0 };
+    unsigned m_depth{ 0 };
+    unsigned m_numChannels{ 0 };
+    bool     m_linear{ true };
+    const float * m_values{ nullptr };
+};
+
+// Compute the texel indices & weight using the OpenGL rules (i.e. clamp to edge).
+inline void TexelCoords(float coord, unsigned size, bool linear,
+                        unsigned & i0, unsigned & i1, float & weight)
+{
+    if (std::isnan(coord))
+    {
+        coord = 0.0f;
+    }
+
+    const float maxIdx = float(size - 1);
+    if (linear)
+    {
+        const float x = coord * float(size) - 0.5f;
+        const float fl = std::floor(x);
+        weight = x - fl;
+        const float c0 = std::min(std::max(fl, 0.0f), maxIdx);
+        const float c1 = std::min(std::max(fl + 1.0f, 0.0f), maxIdx);
+        i0 = unsigned(c0);
+        i1 = unsigned(c1);
+        if (!std::isfinite(weight))
+        {
+            weight = 0.0f;
+        }
+    }
+    else
+    {
+        const float x = std::floor(coord * float(size));
+        i0 = i1 = unsigned(std::min(std::max(x, 0.0f), maxIdx));
+        weight = 0.0f;
+    }
+}
+
+inline void FetchTexel(const Texture & tex, unsigned x, unsigned y, unsigned z, float * rgba)
+{
+    const size_t idx = (size_t(z) * tex.m_height + y) * tex.m_width + x;
+    const float * texel = tex.m_values + idx * tex.m_numChannels;
+    if (tex.m_numChannels == 1)
+    {
+        rgba[0] = texel[0];
+        rgba[1] = 0.0f;
+        rgba[2] = 0.0f;
+    }
+    else
+    {
+        rgba[0] = texel[0];
+        rgba[1] = texel[1];
+        rgba[2] = texel[2];
+    }
+    rgba[3] = 1.0f;
+}
+
+void SampleTexture(const Texture & tex, unsigned dims, const float * coords, float * out)
+{
+    unsigned x0, x1, y0 = 0, y1 = 0, z0 = 0, z1 = 0;
+    float wx, wy = 0.0f, wz = 0.0f;
+    TexelCoords(coords[0], tex.m_width, tex.m_linear, x0, x1, wx);
+    if (dims >= 2)
+    {
+        TexelCoords(coords[1], tex.m_height, tex.m_linear, y0, y1, wy);
+    }
+    if (dims == 3)
+    {
+        TexelCoords(coords[2], tex.m_depth, tex.m_linear, z0, z1, wz);
+    }
+
+    float c[4];
+    for (unsigned i = 0; i < 4; ++i) out[i] = 0.0f;
+
+    for (unsigned k = 0; k < 8; ++k)
+    {
+        const bool bx = (k & 1) != 0;
+        const bool by = (k & 2) != 0;
+        const bool bz = (k & 4) != 0;
+        if ((by && dims < 2) || (bz && dims < 3))
+        {
+            continue;
+        }
+
+        const float w = (bx ? wx : 1.0f - wx) * (by ? wy : 1.0f - wy) * (bz ? wz : 1.0f - wz);
+        if (w == 0.0f)
+        {
+            continue;
+        }
+
+        FetchTexel(tex, bx ? x1 : x0, by ? y1 : y0, bz ? z1 : z0, c);
+        for (unsigned i = 0; i < 4; ++i) out[i] += w * c[i];
+    }
+}
+
+enum Flow
+{
+    FLOW_NORMAL = 0,
+    FLOW_BREAK,
+    FLOW_CONTINUE,
+    FLOW_RETURN
+};
+
+// Reference to the components of an assignment target.
+struct LValue
+{
+    float *  m_data{ nullptr };
+    uint8_t  m_index[MaxComponents];
+    unsigned m_count{ 0 };
+};
+
+// The per-thread execution context.
+class Executor
+{
+public:
+    Executor(const Program & program, const std::vector<float> & globals,
+             const std::vector<Texture> & textures)
+        :   m_program(program)
+        ,   m_globals(globals)
+        ,   m_textures(textures)
+        ,   m_stack(StackSize, 0.0f)
+    {
+    }
+
+    std::vector<float> & globals() { return m_globals; }
+
+    void callFunction(const Function & func, const float * const * args, float * out)
+    {
+        if (m_stackTop + func.m_frameSize > m_stack.size())
+        {
+            throw Exception("GLSL interpreter: stack overflow.");
+        }
+
+        float * frame = &m_stack[m_stackTop];
+        for (size_t i = 0; i < func.m_paramTypes.size(); ++i)
+        {
+            std::memcpy(frame + func.m_paramOffsets[i], args[i],
+                        func.m_paramTypes[i].components() * sizeof(float));
+        }
+
+        float * savedFrame  = m_frame;
+        float * savedReturn = m_return;
+        m_frame  = frame;
+        m_return = out;
+        m_stackTop += func.m_frameSize;
+
+        exec(*func.m_body);
+
+        m_stackTop -= func.m_frameSize;
+        m_frame  = savedFrame;
+        m_return = savedReturn;
+    }
+
+    // Execute a statement outside of any function (i.e. global initializers).
+    void execGlobal(const Stmt & stmt)
+    {
+        m_frame = nullptr;
+        exec(stmt);
+    }
+
+    uint64_t m_numInstructions{ 0 };
+    uint64_t m_numTextureFetches{ 0 };
+
+private:
+    const Program & m_program;
+    std::vector<float> m_globals;
+    const std::vector<Texture> & m_textures;
+
+    std::vector<float> m_stack;
+    size_t  m_stackTop{ 0 };
+    float * m_frame{ nullptr };
+    float * m_return{ nullptr };
+
+    float * location(const Expr & var)
+    {
+        return (var.m_global ? m_globals.data() : m_frame) + var.m_offset;
+    }
+
+    unsigned arrayIndex(const Expr & idx, unsigned size)
+    {
+        float i;
+        eval(idx, &i);
+        // Out of range accesses are undefined so clamp the index to avoid crashes.
+        if (!(i >= 0.0f)) return 0;
+        return std::min(unsigned(i), size - 1);
+    }
+
+    void lvalue(const Expr & e, LValue & lv)
+    {
+        if (e.m_kind == EXPR_VARIABLE)
+        {
+            lv.m_data  = location(e);
+            lv.m_count = e.m_type.components();
+            for (unsigned i = 0; i < lv.m_count; ++i) lv.m_index[i] = (uint8_t)i;
+        }
+        else if (e.m_kind == EXPR_SWIZZLE)
+        {
+            LValue base;
+            lvalue(*e.m_args[0], base);
+            lv.m_data  = base.m_data;
+            lv.m_count = e.m_numSwizzle;
+            for (unsigned i = 0; i < lv.m_count; ++i)
+            {
+                lv.m_index[i] = base.m_index[e.m_swizzle[i]];
+            }
+        }
+        else if (e.m_kind == EXPR_INDEX)
+        {
+            const Expr & baseExpr = *e.m_args[0];
+            const Type & baseType = baseExpr.m_type;
+            if (baseType.isArray())
+            {
+                const unsigned idx = arrayIndex(*e.m_args[1], baseType.m_arraySize);
+                const unsigned size = e.m_type.components();
+                lv.m_data  = location(baseExpr) + idx * size;
+                lv.m_count = size;
+                for (unsigned i = 0; i < size; ++i) lv.m_index[i] = (uint8_t)i;
+            }
+            else
+            {
+                LValue base;
+                lvalue(baseExpr, base);
+                const unsigned rows = baseType.isMatrix() ? baseType.m_rows : 1;
+                const unsigned idx
+                    = arrayIndex(*e.m_args[1], baseType.isMatrix() ? baseType.m_cols
+                                                                   : baseType.m_rows);
+                lv.m_data  = base.m_data;
+                lv.m_count = rows;
+                for (unsigned i = 0; i < rows; ++i)
+                {
+                    lv.m_index[i] = base.m_index[idx * rows + i];
+                }
+            }
+        }
+        else
+        {
+            throw Exception("GLSL interpreter: invalid assignment target.");
+        }
+    }
+
+    static void applyBinary(const BinaryInfo & info, const float * a, const float * b, float * out)
+    {
+        switch (info.m_mode)
+        {
+            case MODE_COMPONENTWISE:
+            {
+                const unsigned n = info.m_count;
+                const unsigned sa = info.m_strideA;
+                const unsigned sb = info.m_strideB;
+                switch (info.m_op)
+                {
+                    case OP_ADD:
+                        for (unsigned i = 0; i < n; ++i) out[i] = a[i * sa] + b[i * sb];
+                        break;
+                    case OP_SUB:
+                        for (unsigned i = 0; i < n; ++i) out[i] = a[i * sa] - b[i * sb];
+                        break;
+                    case OP_MUL:
+                        for (unsigned i = 0; i < n; ++i) out[i] = a[i * sa] * b[i * sb];
+                        break;
+                    case OP_DIV:
+                        if (info.m_integer)
+                        {
+                            for (unsigned i = 0; i < n; ++i)
+                            {
+                                const float d = b[i * sb];
+                                out[i] = d == 0.0f ? 0.0f : std::trunc(a[i * sa] / d);
+                            }
+                        }
+                        else
+                        {
+                            for (unsigned i = 0; i < n; ++i) out[i] = a[i * sa] / b[i * sb];
+                        }
+                        break;
+                    case OP_LT: out[0] = a[0] <  b[0] ? 1.0f : 0.0f; break;
+                    case OP_GT: out[0] = a[0] >  b[0] ? 1.0f : 0.0f; break;
+                    case OP_LE: out[0] = a[0] <= b[0] ? 1.0f : 0.0f; break;
+                    case OP_GE: out[0] = a[0] >= b[0] ? 1.0f : 0.0f; break;
+                    case OP_EQ:
+                    case OP_NE:
+                    {
+                        bool equal = true;
+                        for (unsigned i = 0; i < n; ++i) equal = equal && (a[i] == b[i]);
+                        out[0] = (equal == (info.m_op == OP_EQ)) ? 1.0f : 0.0f;
+                        break;
+                    }
+                    case OP_NONE:
+                    case OP_AND:
+                    case OP_OR:
+                        throw Exception("GLSL interpreter: invalid binary operator.");
+                }
+                break;
+            }
+            case MODE_MATRIX_VECTOR:
+            {
+                const unsigned rows = info.m_rowsA;
+                for (unsigned r = 0; r < rows; ++r)
+                {
+                    float sum = 0.0f;
+                    for (unsigned c = 0; c < info.m_count; ++c) sum += a[c * rows + r] * b[c];
+                    out[r] = sum;
+                }
+                break;
+            }
+            case MODE_VECTOR_MATRIX:
+            {
+                const unsigned rows = info.m_rowsA;
+                for (unsigned c = 0; c < info.m_colsB; ++c)
+                {
+                    float sum = 0.0f;
+                    for (unsigned r = 0; r < rows; ++r) sum += a[r] * b[c * rows + r];
+                    out[c] = sum;
+                }
+                break;
+            }
+            case MODE_MATRIX_MATRIX:
+            {
+                const unsigned rows = info.m_rowsA;
+                const unsigned inner = info.m_count;
+                for (unsigned c = 0; c < info.m_colsB; ++c)
+                {
+                    for (unsigned r = 0; r < rows; ++r)
+                    {
+                        float sum = 0.0f;
+                        for (unsigned k = 0; k < inner; ++k)
+                        {
+                            sum += a[k * rows + r] * b[c * inner + k];
+                        }
+                        out[c * rows + r] = sum;
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    void evalConstructor(const Expr & e, float * out)
+    {
+        const Type & type = e.m_type;
+        const unsigned n = type.components();
+
+        float values[MaxComponents * 4];
+        unsigned count = 0;
+        for (const auto & arg : e.m_args)
+        {
+            float tmp[MaxComponents];
+            eval(*arg, tmp);
+            const unsigned argCount = arg->m_type.components();
+            for (unsigned i = 0; i < argCount && count < MaxComponents * 4; ++i)
+            {
+                values[count++] = tmp[i];
+            }
+        }
+
+        if (e.m_args.size() == 1 && e.m_args[0]->m_type.isScalar())
+        {
+            // Broadcast the scalar, or build a diagonal matrix.
+            for (unsigned i = 0; i < n; ++i)
+            {
+                const bool diagonal = !type.isMatrix() || (i % type.m_rows) == (i / type.m_rows);
+                out[i] = diagonal ? values[0] : 0.0f;
+            }
+        }
+        else
+        {
+            for (unsigned i = 0; i < n; ++i) out[i] = values[i];
+        }
+
+        // Convert the components.
+        if (type.m_base == TYPE_INT)
+        {
+            for (unsigned i = 0; i < n; ++i)
+            {
+                out[i] = std::isfinite(out[i]) ? std::trunc(out[i]) : 0.0f;
+            }
+        }
+        else if (type.m_base == TYPE_BOOL)
+        {
+            for (unsigned i = 0; i < n; ++i) out[i] = (out[i] != 0.0f) ? 1.0f : 0.0f;
+        }
+    }
+
+    void evalBuiltin(const Expr & e, float * out)
+    {
+        float args[3][MaxComponents];
+        unsigned strides[3] = { 0, 0, 0 };
+        const size_t numArgs = e.m_args.size();
+        for (size_t i = 0; i < numArgs; ++i)
+        {
+            eval(*e.m_args[i], args[i]);
+            strides[i] = e.m_args[i]->m_type.isScalar() ? 0 : 1;
+        }
+
+        const unsigned n = e.m_type.components();
+        const float * a = args[0];
+        const float * b = args[1];
+        const float * c = args[2];
+        const unsigned sa = strides[0];
+        const unsigned sb = strides[1];
+        const unsigned sc = strides[2];
+        const unsigned argSize = e.m_args[0]->m_type.components();
+
+        switch (e.m_builtin)
+        {
+            case BUILTIN_ABS:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::fabs(a[i * sa]);
+                break;
+            case BUILTIN_SIGN:
+                for (unsigned i = 0; i < n; ++i)
+                {
+                    const float x = a[i * sa];
+                    out[i] = x > 0.0f ? 1.0f : (x < 0.0f ? -1.0f : 0.0f);
+                }
+                break;
+            case BUILTIN_FLOOR:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::floor(a[i * sa]);
+                break;
+            case BUILTIN_CEIL:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::ceil(a[i * sa]);
+                break;
+            case BUILTIN_FRACT:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i * sa] - std::floor(a[i * sa]);
+                break;
+            case BUILTIN_MOD:
+                for (unsigned i = 0; i < n; ++i)
+                {
+                    const float x = a[i * sa];
+                    const float y = b[i * sb];
+                    out[i] = x - y * std::floor(x / y);
+                }
+                break;
+            case BUILTIN_MIN:
+                for (unsigned i = 0; i < n; ++i) out[i] = Min(a[i * sa], b[i * sb]);
+                break;
+            case BUILTIN_MAX:
+                for (unsigned i = 0; i < n; ++i) out[i] = Max(a[i * sa], b[i * sb]);
+                break;
+            case BUILTIN_CLAMP:
+                for (unsigned i = 0; i < n; ++i) out[i] = Min(Max(a[i * sa], b[i * sb]), c[i * sc]);
+                break;
+            case BUILTIN_MIX:
+                for (unsigned i = 0; i < n; ++i)
+                {
+                    const float t = c[i * sc];
+                    out[i] = a[i * sa] * (1.0f - t) + b[i * sb] * t;
+                }
+                break;
+            case BUILTIN_STEP:
+                for (unsigned i = 0; i < n; ++i) out[i] = b[i * sb] < a[i * sa] ? 0.0f : 1.0f;
+                break;
+            case BUILTIN_SMOOTHSTEP:
+                for (unsigned i = 0; i < n; ++i)
+                {
+                    const float e0 = a[i * sa];
+                    const float t = Min(Max((c[i * sc] - e0) / (b[i * sb] - e0), 0.0f), 1.0f);
+                    out[i] = t * t * (3.0f - 2.0f * t);
+                }
+                break;
+            case BUILTIN_SQRT:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::sqrt(a[i * sa]);
+                break;
+            case BUILTIN_INVERSESQRT:
+                for (unsigned i = 0; i < n; ++i) out[i] = 1.0f / std::sqrt(a[i * sa]);
+                break;
+            case BUILTIN_POW:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::pow(a[i * sa], b[i * sb]);
+                break;
+            case BUILTIN_EXP:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::exp(a[i * sa]);
+                break;
+            case BUILTIN_EXP2:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::exp2(a[i * sa]);
+                break;
+            case BUILTIN_LOG:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::log(a[i * sa]);
+                break;
+            case BUILTIN_LOG2:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::log2(a[i * sa]);
+                break;
+            case BUILTIN_SIN:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::sin(a[i * sa]);
+                break;
+            case BUILTIN_COS:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::cos(a[i * sa]);
+                break;
+            case BUILTIN_TAN:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::tan(a[i * sa]);
+                break;
+            case BUILTIN_ASIN:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::asin(a[i * sa]);
+                break;
+            case BUILTIN_ACOS:
+                for (unsigned i = 0; i < n; ++i) out[i] = std::acos(a[i * sa]);
+                break;
+            case BUILTIN_ATAN:
+                if (numArgs == 2)
+                {
+                    for (unsigned i = 0; i < n; ++i) out[i] = std::atan2(a[i * sa], b[i * sb]);
+                }
+                else
+                {
+                    for (unsigned i = 0; i < n; ++i) out[i] = std::atan(a[i * sa]);
+                }
+                break;
+            case BUILTIN_RADIANS:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i * sa] * 0.017453292519943295f;
+                break;
+            case BUILTIN_DEGREES:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i * sa] * 57.29577951308232f;
+                break;
+            case BUILTIN_DOT:
+            {
+                float sum = 0.0f;
+                for (unsigned i = 0; i < argSize; ++i) sum += a[i] * b[i];
+                out[0] = sum;
+                break;
+            }
+            case BUILTIN_LENGTH:
+            {
+                float sum = 0.0f;
+                for (unsigned i = 0; i < argSize; ++i) sum += a[i] * a[i];
+                out[0] = std::sqrt(sum);
+                break;
+            }
+            case BUILTIN_DISTANCE:
+            {
+                float sum = 0.0f;
+                for (unsigned i = 0; i < argSize; ++i) sum += (a[i] - b[i]) * (a[i] - b[i]);
+                out[0] = std::sqrt(sum);
+                break;
+            }
+            case BUILTIN_NORMALIZE:
+            {
+                float sum = 0.0f;
+                for (unsigned i = 0; i < argSize; ++i) sum += a[i] * a[i];
+                const float inv = 1.0f / std::sqrt(sum);
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] * inv;
+                break;
+            }
+            case BUILTIN_CROSS:
+                out[0] = a[1] * b[2] - b[1] * a[2];
+                out[1] = a[2] * b[0] - b[2] * a[0];
+                out[2] = a[0] * b[1] - b[0] * a[1];
+                break;
+            case BUILTIN_LESSTHAN:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] <  b[i] ? 1.0f : 0.0f;
+                break;
+            case BUILTIN_LESSTHANEQUAL:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] <= b[i] ? 1.0f : 0.0f;
+                break;
+            case BUILTIN_GREATERTHAN:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] >  b[i] ? 1.0f : 0.0f;
+                break;
+            case BUILTIN_GREATERTHANEQUAL:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] >= b[i] ? 1.0f : 0.0f;
+                break;
+            case BUILTIN_EQUAL:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] == b[i] ? 1.0f : 0.0f;
+                break;
+            case BUILTIN_NOTEQUAL:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] != b[i] ? 1.0f : 0.0f;
+                break;
+            case BUILTIN_ANY:
+            {
+                bool res = false;
+                for (unsigned i = 0; i < argSize; ++i) res = res || a[i] != 0.0f;
+                out[0] = res ? 1.0f : 0.0f;
+                break;
+            }
+            case BUILTIN_ALL:
+            {
+                bool res = true;
+                for (unsigned i = 0; i < argSize; ++i) res = res && a[i] != 0.0f;
+                out[0] = res ? 1.0f : 0.0f;
+                break;
+            }
+            case BUILTIN_NOT:
+                for (unsigned i = 0; i < n; ++i) out[i] = a[i] != 0.0f ? 0.0f : 1.0f;
+                break;
+            case BUILTIN_TEXTURE1D:
+            case BUILTIN_TEXTURE2D:
+            case BUILTIN_TEXTURE3D:
+            {
+                const unsigned dims = unsigned(e.m_builtin - BUILTIN_TEXTURE1D) + 1;
+                const size_t texIdx = size_t(a[0]);
+                SampleTexture(m_textures[texIdx], dims, b, out);
+                ++m_numTextureFetches;
+                break;
+            }
+        }
+
+        // The int versions of the functions.
+        if (e.m_type.m_base == TYPE_INT)
+        {
+            for (unsigned i = 0; i < n; ++i) out[i] = std::trunc(out[i]);
+        }
+    }
+
+public:
+    void eval(const Expr & e, float * out)
+    {
+        switch (e.m_kind)
+        {
+            case EXPR_LITERAL:
+            {
+                out[0] = e.m_value;
+                break;
+            }
+            case EXPR_VARIABLE:
+            {
+                std::memcpy(out, location(e), e.m_type.storage() * sizeof(float));
+                break;
+            }
+            case EXPR_SWIZZLE:
+            {
+                float tmp[MaxComponents];
+                eval(*e.m_args[0], tmp);
+                for (unsigned i = 0; i < e.m_numSwizzle; ++i) out[i] = tmp[e.m_swizzle[i]];
+                break;
+            }
+            case EXPR_INDEX:
+            {
+                const Expr & baseExpr = *e.m_args[0];
+                const Type & baseType = baseExpr.m_type;
+                if (baseType.isArray())
+                {
+                    const unsigned idx = arrayIndex(*e.m_args[1], baseType.m_arraySize);
+                    const unsigned size = e.m_type.components();
+                    std::memcpy(out, location(baseExpr) + idx * size, size * sizeof(float));
+                }
+                else
+                {
+                    float tmp[MaxComponents];
+                    eval(baseExpr, tmp);
+                    const unsigned rows = baseType.isMatrix() ? baseType.m_rows : 1;
+                    const unsigned idx
+                        = arrayIndex(*e.m_args[1], baseType.isMatrix() ? baseType.m_cols
+                                                                       : baseType.m_rows);
+                    for (unsigned i = 0; i < rows; ++i) out[i] = tmp[idx * rows + i];
+                }
+                break;
+            }
+            case EXPR_NEGATE:
+            {
+                ++m_numInstructions;
+                eval(*e.m_args[0], out);
+                const unsigned n = e.m_type.components();
+                for (unsigned i = 0; i < n; ++i) out[i] = -out[i];
+                break;
+            }
+            case EXPR_NOT:
+            {
+                ++m_numInstructions;
+                eval(*e.m_args[0], out);
+                out[0] = out[0] != 0.0f ? 0.0f : 1.0f;
+                break;
+            }
+            case EXPR_INCDEC:
+            {
+                ++m_numInstructions;
+                LValue lv;
+                lvalue(*e.m_args[0], lv);
+                for (unsigned i = 0; i < lv.m_count; ++i)
+                {
+                    float & v = lv.m_data[lv.m_index[i]];
+                    out[i] = e.m_prefix ? (v + e.m_delta) : v;
+                    v += e.m_delta;
+                }
+                break;
+            }
+            case EXPR_BINARY:
+            {
+                ++m_numInstructions;
+                float a[MaxComponents], b[MaxComponents];
+                eval(*e.m_args[0], a);
+                eval(*e.m_args[1], b);
+                applyBinary(e.m_binary, a, b, out);
+                break;
+            }
+            case EXPR_LOGICAL:
+            {
+                ++m_numInstructions;
+                eval(*e.m_args[0], out);
+                const bool a = out[0] != 0.0f;
+                if (e.m_binary.m_op == OP_AND ? a : !a)
+                {
+                    eval(*e.m_args[1], out);
+                }
+                break;
+            }
+            case EXPR_ASSIGN:
+            {
+                float value[MaxComponents];
+                eval(*e.m_args[1], value);
+
+                LValue lv;
+                lvalue(*e.m_args[0], lv);
+
+                if (e.m_binary.m_op != OP_NONE)
+                {
+                    ++m_numInstructions;
+                    float current[MaxComponents];
+                    for (unsigned i = 0; i < lv.m_count; ++i) current[i] = lv.m_data[lv.m_index[i]];
+                    float res[MaxComponents];
+                    applyBinary(e.m_binary, current, value, res);
+                    std::memcpy(value, res, lv.m_count * sizeof(float));
+                    if (e.m_binary.m_integer)
+                    {
+                        for (unsigned i = 0; i < lv.m_count; ++i) value[i] = std::trunc(value[i]);
+                    }
+                }
+
+                for (unsigned i = 0; i < lv.m_count; ++i)
+                {
+                    lv.m_data[lv.m_index[i]] = value[i];
+                    out[i] = value[i];
+                }
+                break;
+            }
+            case EXPR_TERNARY:
+            {
+                ++m_numInstructions;
+                float cond;
+                eval(*e.m_args[0], &cond);
+                eval(*e.m_args[cond != 0.0f ? 1 : 2], out);
+                break;
+            }
+            case EXPR_CALL:
+            {
+                ++m_numInstructions;
+                float args[MaxArguments][MaxComponents];
+                const float * argPtrs[MaxArguments];
+                for (size_t i = 0; i < e.m_args.size(); ++i)
+                {
+                    eval(*e.m_args[i], args[i]);
+                    argPtrs[i] = args[i];
+                }
+                if (!e.m_function->m_body)
+                {
+                    throw Exception(("GLSL interpreter: function '" + e.m_function->m_name
+                                     + "' is not defined.").c_str());
+                }
+                callFunction(*e.m_function, argPtrs, out);
+                break;
+            }
+            case EXPR_BUILTIN:
+            {
+                ++m_numInstructions;
+                evalBuiltin(e, out);
+                break;
+            }
+            case EXPR_CONSTRUCTOR:
+            {
+                evalConstructor(e, out);
+                break;
+            }
+            case EXPR_ARRAY_CONSTRUCTOR:
+            {
+                const unsigned size = e.m_type.elementType().components();
+                for (size_t i = 0; i < e.m_args.size(); ++i)
+                {
+                    eval(*e.m_args[i], out + i * size);
+                }
+                break;
+            }
+        }
+    }
+
+    Flow exec(const Stmt & s)
+    {
+        switch (s.m_kind)
+        {
+            case STMT_BLOCK:
+            {
+                for (const auto & stmt : s.m_statements)
+                {
+                    const Flow flow = exec(*stmt);
+                    if (flow != FLOW_NORMAL)
+                    {
+                        return flow;
+                    }
+                }
+                return FLOW_NORMAL;
+            }
+            case STMT_DECLARATION:
+            {
+                for (const auto & decl : s.m_declarations)
+                {
+                    float * dst = (m_frame ? m_frame : m_globals.data()) + decl.m_offset;
+                    if (decl.m_init)
+                    {
+                        if (decl.m_type.isArray())
+                        {
+                            eval(*decl.m_init, dst);
+                        }
+                        else
+                        {
+                            float tmp[MaxComponents];
+                            eval(*decl.m_init, tmp);
+                            std::memcpy(dst, tmp, decl.m_type.components() * sizeof(float));
+                        }
+                    }
+                    else
+                    {
+                        std::fill(dst, dst + decl.m_type.storage(), 0.0f);
+                    }
+                }
+                return FLOW_NORMAL;
+            }
+            case STMT_EXPRESSION:
+            {
+                float tmp[MaxComponents];
+                eval(*s.m_expr, tmp);
+                return FLOW_NORMAL;
+            }
+            case STMT_IF:
+            {
+                float cond;
+                eval(*s.m_expr, &cond);
+                if (cond != 0.0f)
+                {
+                    return exec(*s.m_then);
+                }
+                return s.m_else ? exec(*s.m_else) : FLOW_NORMAL;
+            }
+            case STMT_FOR:
+            case STMT_WHILE:
+            {
+                if (s.m_init)
+                {
+                    exec(*s.m_init);
+                }
+                for (unsigned iter = 0; ; ++iter)
+                {
+                    if (iter >= MaxLoopIterations)
+                    {
+                        throw Exception("GLSL interpreter: too many loop iterations.");
+                    }
+                    if (s.m_expr)
+                    {
+                        float cond;
+                        eval(*s.m_expr, &cond);
+                        if (cond == 0.0f)
+                        {
+                            break;
+                        }
+                    }
+                    const Flow flow = exec(*s.m_then);
+                    if (flow == FLOW_BREAK)
+                    {
+                        break;
+                    }
+                    if (flow == FLOW_RETURN)
+                    {
+                        return flow;
+                    }
+                    if (s.m_step)
+                    {
+                        float tmp[MaxComponents];
+                        eval(*s.m_step, tmp);
+                    }
+                }
+                return FLOW_NORMAL;
+            }
+            case STMT_RETURN:
+            {
+                if (s.m_expr)
+                {
+                    eval(*s.m_expr, m_return);
+                }
+                return FLOW_RETURN;
+            }
+            case STMT_BREAK:
+                return FLOW_BREAK;
+            case STMT_CONTINUE:
+                return FLOW_CONTINUE;
+            case STMT_EMPTY:
+                return FLOW_NORMAL;
+        }
+        return FLOW_NORMAL;
+    }
+};
+
+} // anon.
+
+
+class GLSLInterpreter::Impl
+{
+public:
+    Impl() = default;
+    Impl(const Impl &) = delete;
+    Impl & operator=(const Impl &) = delete;
+    ~Impl() = default;
+
+    void setShader(ConstGpuShaderDescRcPtr & shaderDesc)
+    {
+        Program program;
+        const std::vector<Token> tokens = Tokenize(shaderDesc->getShaderText());
+        Parser(tokens, program).parse();
+
+        const auto it = program.m_functions.find(shaderDesc->getFunctionName());
+        if (it == program.m_functions.end() || !it->second->m_body)
+        {
+            throw Exception("GLSL interpreter: missing the shader function.");
+        }
+        const Function & func = *it->second;
+        if (func.m_returnType != Type(TYPE_FLOAT, 4) || func.m_paramTypes.size() != 1
+            || func.m_paramTypes[0] != Type(TYPE_FLOAT, 4))
+        {
+            throw Exception("GLSL interpreter: the shader function must be 'vec4 f(vec4)'.");
+        }
+
+        // Bind the textures to the samplers.
+
+        std::vector<Texture> textures;
+        std::vector<float> globals(program.m_globalSize, 0.0f);
+
+        std::unordered_set<std::string> boundSamplers;
+        auto bindSampler = [&](const char * samplerName, BaseType samplerType)
+        {
+            const auto var = program.m_globals.find(samplerName);
+            if (var == program.m_globals.end())
+            {
+                // Unused texture.
+                return;
+            }
+            if (var->second.m_type.m_base != samplerType)
+            {
+                throw Exception((std::string("GLSL interpreter: mismatched sampler type for '")
+                                 + samplerName + "'.").c_str());
+            }
+            globals[var->second.m_offset] = float(textures.size() - 1);
+            boundSamplers.insert(samplerName);
+        };
+
+        const unsigned numTextures = shaderDesc->getNumTextures();
+        for (unsigned idx = 0; idx < numTextures; ++idx)
+        {
+            const char * textureName = nullptr;
+            const char * samplerName = nullptr;
+            unsigned width = 0, height = 0;
+            GpuShaderDesc::TextureType channel = GpuShaderDesc::TEXTURE_RGB_CHANNEL;
+            GpuShaderDesc::TextureDimensions dimensions = GpuShaderDesc::TEXTURE_2D;
+            Interpolation interpolation = INTERP_LINEAR;
+            shaderDesc->getTexture(idx, textureName, samplerName, width, height,
+                                   channel, dimensions, interpolation);
+
+            Texture tex;
+            tex.m_width  = width;
+            tex.m_height = height;
+            tex.m_depth  = 1;
+            tex.m_numChannels = (channel == GpuShaderDesc::TEXTURE_RED_CHANNEL) ? 1 : 3;
+            tex.m_linear = (interpolation != INTERP_NEAREST);
+            shaderDesc->getTextureValues(idx, tex.m_values);
+            textures.push_back(tex);
+
+            bindSampler(samplerName, dimensions == GpuShaderDesc::TEXTURE_1D ? TYPE_SAMPLER1D
+                                                                             : TYPE_SAMPLER2D);
+        }
+
+        const unsigned num3DTextures = shaderDesc->getNum3DTextures();
+        for (unsigned idx = 0; idx < num3DTextures; ++idx)
+        {
+            const char * textureName = nullptr;
+            const char * samplerName = nullptr;
+            unsigned edgelen = 0;
+            Interpolation interpolation = INTERP_LINEAR;
+            shaderDesc->get3DTexture(idx, textureName, samplerName, edgelen, interpolation);
+
+            Texture tex;
+            tex.m_width  = edgelen;
+            tex.m_height = edgelen;
+            tex.m_depth  = edgelen;
+            tex.m_numChannels = 3;
+            tex.m_linear = (interpolation != INTERP_NEAREST);
+            shaderDesc->get3DTextureValues(idx, tex.m_values);
+            textures.push_back(tex);
+
+            bindSampler(samplerName, TYPE_SAMPLER3D);
+        }
+
+        for (const auto & tex : textures)
+        {
+            if (!tex.m_values || tex.m_width == 0 || tex.m_height == 0)
+            {
+                throw Exception("GLSL interpreter: missing texture data.");
+            }
+        }
+
+        for (const auto & var : program.m_globals)
+        {
+            if (var.second.m_type.isSampler() && !boundSamplers.count(var.first))
+            {
+                throw Exception(("GLSL interpreter: no texture for the sampler '"
+                                 + var.first + "'.").c_str());
+            }
+        }
+
+        // Compute the constant global variables.
+
+        Executor executor(program, globals, textures);
+        for (const auto & init : program.m_globalInits)
+        {
+            executor.execGlobal(*init);
+        }
+
+        m_shaderDesc = shaderDesc;
+        m_program    = std::move(program);
+        m_function   = m_program.m_functions[shaderDesc->getFunctionName()].get();
+        m_globals    = executor.globals();
+        m_textures   = textures;
+
+        m_statistics = Statistics();
+        m_statistics.m_numInstructions   = m_program.m_numInstructions;
+        m_statistics.m_numTextureFetches = m_program.m_numTextureFetches;
+    }
+
+    void updateUniforms()
+    {
+        const unsigned numUniforms = m_shaderDesc->getNumUniforms();
+        for (unsigned idx = 0; idx < numUniforms; ++idx)
+        {
+            GpuShaderDesc::UniformData data;
+            const char * name = m_shaderDesc->getUniform(idx, data);
+
+            const auto it = m_program.m_globals.find(name);
+            if (it == m_program.m_globals.end())
+            {
+                // Unused uniform.
+                continue;
+            }
+
+            const Variable & var = it->second;
+            float * dst = &m_globals[var.m_offset];
+            const unsigned storage = var.m_type.storage();
+
+            switch (data.m_type)
+            {
+                case UNIFORM_DOUBLE:
+                    dst[0] = (float)data.m_getDouble();
+                    break;
+                case UNIFORM_BOOL:
+                    dst[0] = data.m_getBool() ? 1.0f : 0.0f;
+                    break;
+                case UNIFORM_FLOAT3:
+                {
+                    const Float3 & v = data.m_getFloat3();
+                    for (unsigned i = 0; i < std::min(storage, 3u); ++i) dst[i] = v[i];
+                    break;
+                }
+                case UNIFORM_VECTOR_FLOAT:
+                {
+                    const unsigned size
+                        = std::min(storage, (unsigned)data.m_vectorFloat.m_getSize());
+                    const float * v = data.m_vectorFloat.m_getVector();
+                    for (unsigned i = 0; i < size; ++i) dst[i] = v[i];
+                    break;
+                }
+                case UNIFORM_VECTOR_INT:
+                {
+                    const unsigned size
+                        = std::min(storage, (unsigned)data.m_vectorInt.m_getSize());
+                    const int * v = data.m_vectorInt.m_getVector();
+                    for (unsigned i = 0; i < size; ++i) dst[i] = float(v[i]);
+                    break;
+                }
+                case UNIFORM_UNKNOWN:
+                    throw Exception(("GLSL interpreter: unknown type for the uniform '"
+                                     + std::string(name) + "'.").c_str());
+            }
+        }
+    }
+
+    void process(const float * in, float * out, size_t numPixels)
+    {
+        if (!m_function)
+        {
+            throw Exception("GLSL interpreter: missing shader program.");
+        }
+
+        updateUniforms();
+
+        const unsigned hwThreads = std::max(1u, std::thread::hardware_concurrency());
+        const size_t minPixelsPerThread = 1024;
+        const size_t numThreads
+            = std::max<size_t>(1, std::min<size_t>(hwThreads, numPixels / minPixelsPerThread));
+        const size_t chunk = (numPixels + numThreads - 1) / numThreads;
+
+        std::vector<uint64_t> instructions(numThreads, 0);
+        std::vector<uint64_t> fetches(numThreads, 0);
+        std::vector<std::exception_ptr> errors(numThreads);
+
+        auto worker = [&](size_t t)
+        {
+            try
+            {
+                Executor executor(m_program, m_globals, m_textures);
+
+                const size_t start = t * chunk;
+                const size_t end = std::min(numPixels, start + chunk);
+                for (size_t pxl = start; pxl < end; ++pxl)
+                {
+                    float inPixel[4];
+                    std::memcpy(inPixel, in + 4 * pxl, 4 * sizeof(float));
+                    const float * args[1] = { inPixel };
+                    float outPixel[MaxComponents];
+                    executor.callFunction(*m_function, args, outPixel);
+                    std::memcpy(out + 4 * pxl, outPixel, 4 * sizeof(float));
+                }
+
+                instructions[t] = executor.m_numInstructions;
+                fetches[t] = executor.m_numTextureFetches;
+            }
+            catch (...)
+            {
+                errors[t] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < numThreads; ++t)
+        {
+            threads.emplace_back(worker, t);
+        }
+        worker(0);
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const auto & error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        m_statistics.m_executedInstructions = 0;
+        m_statistics.m_executedTextureFetches = 0;
+        for (size_t t = 0; t < numThreads; ++t)
+        {
+            m_statistics.m_executedInstructions += instructions[t];
+            m_statistics.m_executedTextureFetches += fetches[t];
+        }
+        m_statistics.m_numPixels = numPixels;
+    }
+
+    ConstGpuShaderDescRcPtr m_shaderDesc;
+
+    Program m_program;
+    const Function * m_function{ nullptr };
+    std::vector<float> m_globals;
+    std::vector<Texture> m_textures;
+
+    Statistics m_statistics;
+};
+
+
+GLSLInterpreter::GLSLInterpreter()
+    :   m_impl(new Impl)
+{
+}
+
+GLSLInterpreter::~GLSLInterpreter()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void GLSLInterpreter::setShader(ConstGpuShaderDescRcPtr & shaderDesc)
+{
+    getImpl()->setShader(shaderDesc);
+}
+
+void GLSLInterpreter::process(const float * in, float * out, size_t numPixels)
+{
+    getImpl()->process(in, out, numPixels);
+}
+
+const GLSLInterpreter::Statistics & GLSLInterpreter::getStatistics() const noexcept
+{
+    return getImpl()->m_statistics;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef OPENCOLORIO_GPU_GLSLINTERPRETER_H
+#define OPENCOLORIO_GPU_GLSLINTERPRETER_H
+
+#include <cstdint>
+#include <memory>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// CPU interpreter for the GLSL 1.2 subset generated by the GpuShaderText helper.
+//
+// It parses the shader program of a GpuShaderDesc, binds its uniforms & textures (emulating
+// the OpenGL sampling i.e. clamp to edge with nearest or linear filtering), and then executes
+// the shader function on RGBA pixels. That allows the GPU unit tests to validate the generated
+// shader programs on machines without any GPU.
+//
+// Note: Only the language subset emitted by OCIO is supported (no structs, no out parameters,
+// no preprocessor) and all the computations are done using 32-bit floats.
+class GLSLInterpreter
+{
+public:
+    struct Statistics
+    {
+        // Number of operations (i.e. arithmetic operators, built-in and function calls) and
+        // of texture fetches present in the shader program.
+        unsigned m_numInstructions{ 0 };
+        unsigned m_numTextureFetches{ 0 };
+
+        // Number of operations and texture fetches executed by the last process() call.
+        uint64_t m_executedInstructions{ 0 };
+        uint64_t m_executedTextureFetches{ 0 };
+        uint64_t m_numPixels{ 0 };
+    };
+
+    GLSLInterpreter();
+    GLSLInterpreter(const GLSLInterpreter &) = delete;
+    GLSLInterpreter & operator=(const GLSLInterpreter &) = delete;
+    ~GLSLInterpreter();
+
+    // Parse the shader program and bind the textures. Throw if the program uses a language
+    // feature outside of the supported subset.
+    void setShader(ConstGpuShaderDescRcPtr & shaderDesc);
+
+    // Process RGBA pixels i.e. the 'in' and 'out' buffers could be the same. The uniform
+    // values are read from the shader description at each call so dynamic property changes
+    // are taken into account.
+    void process(const float * in, float * out, size_t numPixels);
+
+    const Statistics & getStatistics() const noexcept;
+
+private:
+    class Impl;
+    Impl * m_impl;
+
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+typedef OCIO_SHARED_PTR<GLSLInterpreter> GLSLInterpreterRcPtr;
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OPENCOLORIO_GPU_GLSLINTERPRETER_H
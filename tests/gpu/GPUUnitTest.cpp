@@ -6,19 +6,23 @@
 #include <cmath>
 #include <cstring>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "GLSLInterpreter.h"
 #include "GPUUnitTest.h"
 
 #include "apputils/argparse.h"
 #include "utils/StringUtils.h"
 
+#ifdef OCIO_GPU_TESTS_GL
 #include "oglapp.h"
 #if __APPLE__
 #include "metalapp.h"
 #endif
+#endif // OCIO_GPU_TESTS_GL
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -194,12 +198,149 @@ namespace
     constexpr unsigned g_winHeight  = 256;
     constexpr unsigned g_components = 4;
 
-    void AllocateImageTexture(OCIO::OglAppRcPtr & app)
+    // The engine processing the RGBA image with the GPU shader program.
+    class Renderer
+    {
+    public:
+        virtual ~Renderer() = default;
+
+        virtual void printInfo() const = 0;
+
+        virtual void initImage(unsigned width, unsigned height, const float * image) = 0;
+        virtual void updateImage(const float * image) = 0;
+
+        virtual void setShader(OCIO::GpuShaderDescRcPtr & shaderDesc, bool printShader) = 0;
+
+        // Process the image using the current shader program.
+        virtual void redisplay() = 0;
+        virtual void readImage(float * image) = 0;
+
+        // Return the statistics of the last processing, if available.
+        virtual std::string getStatistics() const { return ""; }
+    };
+
+    using RendererRcPtr = std::shared_ptr<Renderer>;
+
+#ifdef OCIO_GPU_TESTS_GL
+    // Process the image with the GPU using OpenGL (or Metal).
+    class GLRenderer : public Renderer
+    {
+    public:
+        explicit GLRenderer(OCIO::OglAppRcPtr & app)
+            :   m_app(app)
+        {
+        }
+
+        void printInfo() const override
+        {
+            m_app->printGLInfo();
+        }
+
+        void initImage(unsigned width, unsigned height, const float * image) override
+        {
+            m_app->initImage(width, height, OCIO::OglApp::COMPONENTS_RGBA, image);
+
+            // Create the frame buffer and render buffer.
+            m_app->createGLBuffers();
+            m_app->reshape(width, height);
+        }
+
+        void updateImage(const float * image) override
+        {
+            m_app->updateImage(image);
+        }
+
+        void setShader(OCIO::GpuShaderDescRcPtr & shaderDesc, bool printShader) override
+        {
+            m_app->setPrintShader(printShader);
+            m_app->setShader(shaderDesc);
+        }
+
+        void redisplay() override
+        {
+            m_app->redisplay();
+        }
+
+        void readImage(float * image) override
+        {
+            m_app->readImage(image);
+        }
+
+    private:
+        OCIO::OglAppRcPtr m_app;
+    };
+#endif // OCIO_GPU_TESTS_GL
+
+    // Process the image on the CPU by interpreting the GLSL shader program i.e. no GPU needed.
+    class SoftwareRenderer : public Renderer
+    {
+    public:
+        void printInfo() const override
+        {
+            std::cout << std::endl
+                      << "GPU renderer:      software GLSL interpreter" << std::endl
+                      << "Shading language:  GLSL 1.2" << std::endl;
+        }
+
+        void initImage(unsigned width, unsigned height, const float * image) override
+        {
+            const size_t numEntries = size_t(width) * height * g_components;
+            m_image.assign(image, image + numEntries);
+            m_result.assign(numEntries, 0.0f);
+        }
+
+        void updateImage(const float * image) override
+        {
+            std::copy(image, image + m_image.size(), m_image.begin());
+        }
+
+        void setShader(OCIO::GpuShaderDescRcPtr & shaderDesc, bool printShader) override
+        {
+            if (printShader)
+            {
+                std::cout << std::endl << shaderDesc->getShaderText() << std::endl;
+            }
+
+            OCIO::ConstGpuShaderDescRcPtr desc = shaderDesc;
+            m_interpreter.setShader(desc);
+        }
+
+        void redisplay() override
+        {
+            m_interpreter.process(m_image.data(), m_result.data(), m_image.size() / g_components);
+        }
+
+        void readImage(float * image) override
+        {
+            std::copy(m_result.begin(), m_result.end(), image);
+        }
+
+        std::string getStatistics() const override
+        {
+            const OCIO::GLSLInterpreter::Statistics & stats = m_interpreter.getStatistics();
+            const double numPixels = double(std::max<uint64_t>(1, stats.m_numPixels));
+
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(1)
+                << "(Ops: " << stats.m_numInstructions
+                << " static, " << double(stats.m_executedInstructions) / numPixels
+                << "/pix; Fetches: " << stats.m_numTextureFetches
+                << " static, " << double(stats.m_executedTextureFetches) / numPixels << "/pix)";
+            return oss.str();
+        }
+
+    private:
+        OCIO::GLSLInterpreter m_interpreter;
+        std::vector<float> m_image;
+        std::vector<float> m_result;
+    };
+
+    void AllocateImageTexture(RendererRcPtr & app)
     {
         const unsigned numEntries = g_winWidth * g_winHeight * g_components;
         OCIOGPUTest::CustomValues::Values image(numEntries, 0.0f);
 
-        app->initImage(g_winWidth, g_winHeight, OCIO::OglApp::COMPONENTS_RGBA, &image[0]);
+        app->initImage(g_winWidth, g_winHeight, &image[0]);
     }
 
     void SetTestValue(float * image, float val, unsigned numComponents)
@@ -214,7 +355,7 @@ namespace
         }
     }
 
-    void UpdateImageTexture(OCIO::OglAppRcPtr & app, OCIOGPUTestRcPtr & test)
+    void UpdateImageTexture(RendererRcPtr & app, OCIOGPUTestRcPtr & test)
     {
         // Note: User-specified custom values are padded out
         // to the preferred size (g_winWidth x g_winHeight).
@@ -328,10 +469,8 @@ namespace
         app->updateImage(&values.m_inputValues[0]);
     }
 
-    void UpdateOCIOGLState(OCIO::OglAppRcPtr & app, OCIOGPUTestRcPtr & test)
+    void UpdateOCIOGLState(RendererRcPtr & app, OCIOGPUTestRcPtr & test)
     {
-        app->setPrintShader(test->isVerbose());
-
         OCIO::ConstProcessorRcPtr & processor = test->getProcessor();
         OCIO::GpuShaderDescRcPtr & shaderDesc = test->getShaderDesc();
         
@@ -349,7 +488,7 @@ namespace
         // Collect the shader program information for a specific processor.
         gpu->extractGpuShaderInfo(shaderDesc);
 
-        app->setShader(shaderDesc);
+        app->setShader(shaderDesc, test->isVerbose());
     }
 
     void DiffComponent(const std::vector<float> & cpuImage,
@@ -385,7 +524,7 @@ namespace
     constexpr size_t invalidIndex = std::numeric_limits<size_t>::max();
 
     // Validate the GPU processing against the CPU one.
-    void ValidateImageTexture(OCIO::OglAppRcPtr & app, OCIOGPUTestRcPtr & test)
+    void ValidateImageTexture(RendererRcPtr & app, OCIOGPUTestRcPtr & test)
     {
         // Each retest is rebuilding a cpu proc.
         OCIO::ConstCPUProcessorRcPtr processor = test->getProcessor()->getDefaultCPUProcessor();
@@ -536,6 +675,7 @@ int main(int argc, const char ** argv)
 
     bool printHelp = false;
     bool useMetalRenderer = false;
+    bool useSoftwareRenderer = false;
     bool verbose = false;
     bool stopOnFirstError = false;
 
@@ -546,6 +686,8 @@ int main(int argc, const char ** argv)
     ap.options("\nCommand line arguments:\n",
                "--help",          &printHelp,        "Print help message",
                "--metal",         &useMetalRenderer, "Run the GPU unit test with Metal",
+               "--software",      &useSoftwareRenderer,
+                                  "Run the GPU unit test with the software GLSL interpreter (no GPU needed)",
                "-v",              &verbose,          "Output the GPU shader program",
                "--stop_on_error", &stopOnFirstError, "Stop on the first error",
                "--run_only %s",   &filter,           "Run only some unit tests\n"
@@ -587,15 +729,31 @@ int main(int argc, const char ** argv)
         }
     }
 
+#ifndef OCIO_GPU_TESTS_GL
+    // Without OpenGL support, the software renderer is the only one available.
+    if (useMetalRenderer)
+    {
+        std::cerr << std::endl << "'GPU tests - Metal' is not supported" << std::endl;
+        return 1;
+    }
+    useSoftwareRenderer = true;
+#endif
+
     // Step 1: Initialize the graphic library engines.
-    OCIO::OglAppRcPtr app;
-    
+    RendererRcPtr app;
+
     try
     {
-        if(useMetalRenderer)
+        if (useSoftwareRenderer)
+        {
+            app = std::make_shared<SoftwareRenderer>();
+        }
+#ifdef OCIO_GPU_TESTS_GL
+        else if(useMetalRenderer)
         {
 #if __APPLE__
-            app = OCIO::MetalApp::CreateMetalGlApp("GPU tests - Metal", 10, 10);
+            OCIO::OglAppRcPtr oglApp = OCIO::MetalApp::CreateMetalGlApp("GPU tests - Metal", 10, 10);
+            app = std::make_shared<GLRenderer>(oglApp);
 #else
             std::cerr << std::endl << "'GPU tests - Metal' is not supported" << std::endl;
             return 1;
@@ -603,8 +761,10 @@ int main(int argc, const char ** argv)
         }
         else
         {
-            app = OCIO::OglApp::CreateOglApp("GPU tests", 10, 10);
+            OCIO::OglAppRcPtr oglApp = OCIO::OglApp::CreateOglApp("GPU tests", 10, 10);
+            app = std::make_shared<GLRenderer>(oglApp);
         }
+#endif // OCIO_GPU_TESTS_GL
     }
     catch (const OCIO::Exception & e)
     {
@@ -612,17 +772,12 @@ int main(int argc, const char ** argv)
         return 1;
     }
 
-    app->printGLInfo();
+    app->printInfo();
 
-    // Step 2: Allocate the texture that holds the image.
+    // Step 2: Allocate the texture that holds the image, and the rendering buffers.
     AllocateImageTexture(app);
 
-    // Step 3: Create the frame buffer and render buffer.
-    app->createGLBuffers();
-
-    app->reshape(g_winWidth, g_winHeight);
-
-    // Step 4: Execute all the unit tests.
+    // Step 3: Execute all the unit tests.
 
     unsigned failures = 0;
 
@@ -663,7 +818,7 @@ int main(int argc, const char ** argv)
         test->setVerbose(verbose);
         test->setShadingLanguage(
 #if __APPLE__
-            useMetalRenderer ?
+            useMetalRenderer && !useSoftwareRenderer ?
             OCIO::GPU_LANGUAGE_MSL_2_0 :
 #endif
             OCIO::GPU_LANGUAGE_GLSL_1_2);
@@ -741,7 +896,14 @@ int main(int argc, const char ** argv)
 
             std::cout << "PASSED - (MaxDiff: " << test->getMaxDiff()
                       << " at pix[" << pixelIdx
-                      << "][" << componentIdx << "])" << std::endl;
+                      << "][" << componentIdx << "])";
+
+            const std::string stats = app->getStatistics();
+            if (!stats.empty())
+            {
+                std::cout << " " << stats;
+            }
+            std::cout << std::endl;
         }
         else if(!test->isValid())
         {
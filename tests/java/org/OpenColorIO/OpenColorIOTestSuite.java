@@ -18,6 +18,7 @@ public class OpenColorIOTestSuite {
         suite.addTestSuite(BakerTest.class);
         suite.addTestSuite(PackedImageDescTest.class);
         suite.addTestSuite(PlanarImageDescTest.class);
+        suite.addTestSuite(ProcessorTest.class);
         suite.addTestSuite(GpuShaderDescTest.class);
         suite.addTestSuite(ContextTest.class);
         suite.addTestSuite(TransformsTest.class);
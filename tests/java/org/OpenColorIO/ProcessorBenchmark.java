@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+import org.OpenColorIO.*;
+import java.nio.*;
+
+// Micro-benchmark of the direct buffer apply paths, not part of the test suite.
+//
+// java -cp <classpath> -Djava.library.path=<lib> ProcessorBenchmark [width height iterations]
+
+public class ProcessorBenchmark {
+    
+    static double timeApply(Processor proc, PackedImageDesc img, int numThreads,
+                            int iterations) {
+        // Warm up the processor caches before timing.
+        proc.applyParallel(img, numThreads);
+        long start = System.nanoTime();
+        for (int i = 0; i < iterations; ++i) {
+            proc.applyParallel(img, numThreads);
+        }
+        return (System.nanoTime() - start) / 1.0e6 / iterations;
+    }
+    
+    public static void main(String[] args) {
+        
+        int width = args.length > 0 ? Integer.parseInt(args[0]) : 1920;
+        int height = args.length > 1 ? Integer.parseInt(args[1]) : 1080;
+        int iterations = args.length > 2 ? Integer.parseInt(args[2]) : 20;
+        int channels = 4;
+        int size = width * height * channels;
+        
+        Config cfg = new Config().Create();
+        ExponentTransform et = new ExponentTransform().Create();
+        et.setValue(new float[]{2.2f, 2.2f, 2.2f, 1.0f});
+        Processor proc = cfg.getProcessor(et);
+        
+        FloatBuffer buf = ByteBuffer.allocateDirect(size * Float.SIZE / 8)
+            .order(ByteOrder.nativeOrder()).asFloatBuffer();
+        for (int i = 0; i < size; ++i) {
+            buf.put(i, (float)(i % 1024) / 1023.0f);
+        }
+        PackedImageDesc img = new PackedImageDesc(buf, width, height, channels);
+        
+        System.out.println("Image " + width + "x" + height + ", "
+                           + iterations + " iterations");
+        int maxThreads = Runtime.getRuntime().availableProcessors();
+        for (int t = 1; t <= maxThreads; t *= 2) {
+            System.out.printf("  %2d thread(s): %8.3f ms/frame%n", t,
+                              timeApply(proc, img, t, iterations));
+        }
+        
+        proc.dispose();
+        cfg.dispose();
+    }
+    
+}
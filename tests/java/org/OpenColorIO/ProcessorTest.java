@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+import junit.framework.TestCase;
+import org.OpenColorIO.*;
+import java.nio.*;
+
+public class ProcessorTest extends TestCase {
+    
+    Config cfg;
+    Processor proc;
+    
+    protected void setUp() {
+        cfg = new Config().Create();
+        ExponentTransform et = new ExponentTransform().Create();
+        et.setValue(new float[]{2.0f, 2.0f, 2.0f, 1.0f});
+        proc = cfg.getProcessor(et);
+    }
+    
+    protected void tearDown() {
+        proc.dispose();
+        cfg.dispose();
+    }
+    
+    public void test_bytebuffer_image() {
+        
+        int width = 2;
+        int height = 2;
+        int channels = 4;
+        ByteBuffer buf = ByteBuffer.allocateDirect(width * height * channels);
+        for (int i = 0; i < width * height; ++i) {
+            buf.put((byte)128).put((byte)64).put((byte)255).put((byte)255);
+        }
+        //
+        PackedImageDesc img = new PackedImageDesc(buf, width, height, channels,
+                                                  BitDepth.BIT_DEPTH_UINT8);
+        assertEquals(true, BitDepth.BIT_DEPTH_UINT8.equals(img.getBitDepth()));
+        assertEquals(1, img.getChanStrideBytes());
+        assertEquals(4, img.getXStrideBytes());
+        assertEquals(8, img.getYStrideBytes());
+        
+        // The image aliases the direct buffer.
+        ByteBuffer wee = img.getByteData();
+        assertEquals(64, wee.get(13));
+        
+    }
+    
+    public void test_apply_parallel() {
+        
+        int width = 7;
+        int height = 13;
+        int channels = 4;
+        int size = width * height * channels;
+        FloatBuffer serial = ByteBuffer.allocateDirect(size * Float.SIZE / 8)
+            .order(ByteOrder.nativeOrder()).asFloatBuffer();
+        FloatBuffer parallel = ByteBuffer.allocateDirect(size * Float.SIZE / 8)
+            .order(ByteOrder.nativeOrder()).asFloatBuffer();
+        for (int i = 0; i < size; ++i) {
+            float v = (float)i / (float)size;
+            serial.put(i, v);
+            parallel.put(i, v);
+        }
+        //
+        proc.apply(new PackedImageDesc(serial, width, height, channels));
+        // More threads than rows must also work.
+        proc.applyParallel(new PackedImageDesc(parallel, width, height, channels), 16);
+        for (int i = 0; i < size; ++i) {
+            assertEquals(serial.get(i), parallel.get(i));
+        }
+        
+        proc.applyParallel(new PackedImageDesc(parallel, width, height, channels), 0);
+        assertEquals(0.25f, (float)Math.sqrt(parallel.get(size / 4 * 4)), 1e-5f);
+        
+    }
+    
+}
@@ -154,6 +154,6 @@ END METADATA
         self.assert_lut_match(output, self.EXPECTED_LUT)
 
         fmts = bake.getFormats()
-        self.assertEqual(len(fmts), 12)
+        self.assertEqual(len(fmts), 15)
         self.assertEqual("cinespace", fmts[4][0])
         self.assertEqual("3dl", fmts[1][1])
@@ -22,6 +22,7 @@ class ConstantsTest(unittest.TestCase):
         self.assertEqual(OCIO.OCIO_DISABLE_ALL_CACHES, 'OCIO_DISABLE_ALL_CACHES')
         self.assertEqual(OCIO.OCIO_DISABLE_PROCESSOR_CACHES, 'OCIO_DISABLE_PROCESSOR_CACHES')
         self.assertEqual(OCIO.OCIO_DISABLE_CACHE_FALLBACK, 'OCIO_DISABLE_CACHE_FALLBACK')
+        self.assertEqual(OCIO.OCIO_VALIDATE_FILE_CACHES, 'OCIO_VALIDATE_FILE_CACHES')
 
         # Roles.
         self.assertEqual(OCIO.ROLE_DEFAULT, 'default')
@@ -31,6 +31,7 @@ class FileTransformTest(unittest.TestCase, TransformsBaseTest):
                        ('iridas_cube', 'cube'),
                        ('iridas_itx', 'itx'),
                        ('iridas_look', 'look'),
+                       ('ocio_binary_lut', 'olut'),
                        ('pandora_mga', 'mga'),
                        ('pandora_m3d', 'm3d'),
                        ('resolve_cube', 'cube'),
@@ -111,7 +112,7 @@ class FileTransformTest(unittest.TestCase, TransformsBaseTest):
             self.assertEqual(format_name, name)
             self.assertEqual(format_ext, ext)
 
-        self.assertEqual(format_iterator.__len__(), 24)
+        self.assertEqual(format_iterator.__len__(), 25)
 
     def test_interpolation(self):
         """
@@ -174,6 +174,10 @@ class GpuShaderDescTest(unittest.TestCase):
         self.assertEqual(v2[4], np.float32(0.4))
         self.assertEqual(v2[5], np.float32(0.5))
 
+        # Both textures have the same values.
+        self.assertTrue(t1.getCacheID())
+        self.assertEqual(t1.getCacheID(), t2.getCacheID())
+
     def test_texture_3d(self):
         # Test add3DTexture() & get3DTextures().
         if not np:
@@ -208,3 +212,4 @@ class GpuShaderDescTest(unittest.TestCase):
         v2 = t2.getValues()
         self.assertEqual(len(v2), 3*27)
         self.assertEqual(v2[42], bufTest2)
+        self.assertNotEqual(t1.getCacheID(), t2.getCacheID())